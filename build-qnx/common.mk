@@ -20,7 +20,7 @@ NAME=vulkan
 
 # Make the library
 
-SRCS = cJSON.c debug_utils.c dev_ext_trampoline.c loader.c \
+SRCS = debug_utils.c dev_ext_trampoline.c loader.c \
 	phys_dev_ext.c trampoline.c unknown_ext_chain.c wsi.c \
 	extension_manual.c unknown_function_handling.c
 
@@ -39,7 +39,4 @@ CCFLAGS += -DVK_ENABLE_BETA_EXTENSIONS
 
 CXXFLAGS += $(CCFLAGS)
 
-# cJSON requires math library for pow() function
-LIBS += m
-
 INSTALLDIR=usr/lib
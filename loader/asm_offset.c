@@ -75,6 +75,10 @@ int main(int argc, char **argv) {
             .comment = "The offset of 'phys_dev_ext' within a 'loader_icd_term' struct" },
         { .name = "EXT_OFFSET_DEVICE_DISPATCH", .value = offsetof(struct loader_dev_dispatch_table, ext_dispatch),
             .comment = "The offset of 'ext_dispatch' within a 'loader_dev_dispatch_table' struct" },
+        { .name = "UNKNOWN_FUNCTION_CHUNK_SHIFT", .value = LOADER_UNKNOWN_FUNCTION_CHUNK_SHIFT,
+            .comment = "The shift from the index of an unknown function to the index of the chunk holding it" },
+        { .name = "UNKNOWN_FUNCTION_CHUNK_MASK", .value = LOADER_UNKNOWN_FUNCTION_CHUNK_MASK,
+            .comment = "The mask from the index of an unknown function to its index within a chunk" },
         // clang-format on
     };
 
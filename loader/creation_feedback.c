@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "creation_feedback.h"
+
+#include <string.h>
+
+#include "log.h"
+
+static void loader_clear_creation_feedback(VkLoaderCreationFeedback *out, uint32_t count) {
+    if (NULL != out) {
+        memset(out, 0, sizeof(VkLoaderCreationFeedback) * count);
+    }
+}
+
+static void loader_write_creation_feedback(VkLoaderCreationFeedback *out, const char *name, uint64_t duration_ns) {
+    if (NULL == out) {
+        return;
+    }
+    out->flags = VK_LOADER_CREATION_FEEDBACK_VALID_BIT;
+    out->name[0] = '\0';
+    if (NULL != name) {
+        strncpy(out->name, name, sizeof(out->name) - 1);
+        out->name[sizeof(out->name) - 1] = '\0';
+    }
+    out->duration = duration_ns;
+}
+
+const void *loader_creation_feedback_begin(const struct loader_instance *inst, struct loader_creation_feedback *feedback,
+                                           const void *pNext) {
+    memset(feedback, 0, sizeof(struct loader_creation_feedback));
+    feedback->start_ns = loader_platform_monotonic_time_ns();
+
+    const VkBaseInStructure *first = pNext;
+    if (NULL != first && VK_STRUCTURE_TYPE_LOADER_CREATION_FEEDBACK_CREATE_INFO == first->sType) {
+        feedback->info = (const VkLoaderCreationFeedbackCreateInfo *)first;
+    } else {
+        for (const VkBaseInStructure *cur = first; NULL != cur; cur = cur->pNext) {
+            if (VK_STRUCTURE_TYPE_LOADER_CREATION_FEEDBACK_CREATE_INFO == cur->sType) {
+                loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
+                           "VkLoaderCreationFeedbackCreateInfo must be the first structure in the pNext chain, ignoring it");
+                break;
+            }
+        }
+        return pNext;
+    }
+
+    const VkLoaderCreationFeedbackCreateInfo *info = feedback->info;
+    loader_clear_creation_feedback(info->pCreationFeedback, 1);
+    loader_clear_creation_feedback(info->pDiscoveryFeedback, 1);
+    loader_clear_creation_feedback(info->pLayerChainFeedback, 1);
+    loader_clear_creation_feedback(info->pLayerFeedbacks, info->layerFeedbackCount);
+    loader_clear_creation_feedback(info->pDriverFeedbacks, info->driverFeedbackCount);
+    return info->pNext;
+}
+
+void loader_creation_feedback_end(struct loader_creation_feedback *feedback) {
+    if (NULL == feedback || NULL == feedback->info) {
+        return;
+    }
+    loader_write_creation_feedback(feedback->info->pCreationFeedback, NULL,
+                                   loader_platform_monotonic_time_ns() - feedback->start_ns);
+}
+
+void loader_creation_feedback_discovery(struct loader_creation_feedback *feedback) {
+    if (NULL == feedback || NULL == feedback->info) {
+        return;
+    }
+    loader_write_creation_feedback(feedback->info->pDiscoveryFeedback, NULL,
+                                   loader_platform_monotonic_time_ns() - feedback->start_ns);
+}
+
+void loader_creation_feedback_layer(struct loader_creation_feedback *feedback, uint32_t index, const char *name,
+                                    uint64_t duration_ns) {
+    if (NULL == feedback || NULL == feedback->info || NULL == feedback->info->pLayerFeedbacks ||
+        index >= feedback->info->layerFeedbackCount) {
+        return;
+    }
+    loader_write_creation_feedback(&feedback->info->pLayerFeedbacks[index], name, duration_ns);
+}
+
+void loader_creation_feedback_layer_chain(struct loader_creation_feedback *feedback, uint64_t duration_ns) {
+    if (NULL == feedback || NULL == feedback->info) {
+        return;
+    }
+    // The driver calls are part of the chain call, but don't wrap around if that ever isn't so
+    uint64_t layer_ns = duration_ns > feedback->driver_ns ? duration_ns - feedback->driver_ns : 0;
+    loader_write_creation_feedback(feedback->info->pLayerChainFeedback, NULL, layer_ns);
+}
+
+void loader_creation_feedback_driver(struct loader_creation_feedback *feedback, const char *name, uint64_t duration_ns) {
+    if (NULL == feedback || NULL == feedback->info) {
+        return;
+    }
+    if (NULL != feedback->info->pDriverFeedbacks && feedback->driver_count < feedback->info->driverFeedbackCount) {
+        loader_write_creation_feedback(&feedback->info->pDriverFeedbacks[feedback->driver_count], name, duration_ns);
+    }
+    feedback->driver_count++;
+    feedback->driver_ns += duration_ns;
+}
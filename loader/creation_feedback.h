@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "loader_common.h"
+
+// Filling in VkLoaderCreationFeedbackCreateInfo, see vk_loader_creation_feedback.h.
+//
+// One of these lives on the stack of each vkCreateInstance and vkCreateDevice call. Every function does nothing if the
+// application didn't chain the structure, or if feedback is NULL.
+struct loader_creation_feedback {
+    const VkLoaderCreationFeedbackCreateInfo *info;  // NULL if the application didn't ask for feedback
+    uint64_t start_ns;
+    uint64_t driver_ns;     // Time spent in the driver calls so far
+    uint32_t driver_count;  // Number of driver calls so far
+};
+
+// Starts timing the call and clears every feedback in the structure, if it is the first structure in pNext, the chain of the
+// application's create info. Returns the chain to put in the loader's own copy of the create info, which leaves the structure
+// out so that layers and drivers never see it. The application's chain is never changed, so a feedback structure further down
+// it can't be taken out and is ignored with a warning.
+const void *loader_creation_feedback_begin(const struct loader_instance *inst, struct loader_creation_feedback *feedback,
+                                           const void *pNext);
+
+// Fills in the time taken by the whole call
+void loader_creation_feedback_end(struct loader_creation_feedback *feedback);
+
+// Fills in the time since loader_creation_feedback_begin as the discovery time
+void loader_creation_feedback_discovery(struct loader_creation_feedback *feedback);
+
+// index counts from the layer closest to the application
+void loader_creation_feedback_layer(struct loader_creation_feedback *feedback, uint32_t index, const char *name,
+                                    uint64_t duration_ns);
+
+// duration_ns is the whole call into the first layer, the time spent in drivers is taken out here
+void loader_creation_feedback_layer_chain(struct loader_creation_feedback *feedback, uint64_t duration_ns);
+
+void loader_creation_feedback_driver(struct loader_creation_feedback *feedback, const char *name, uint64_t duration_ns);
@@ -39,6 +39,7 @@
 #include "debug_utils.h"
 #include "log.h"
 #include "loader.h"
+#include "stats.h"
 #include "vk_loader_platform.h"
 
 // VK_EXT_debug_report related items
@@ -62,6 +63,7 @@ VkResult util_CreateDebugUtilsMessenger(struct loader_instance *inst, const VkDe
     pNewDbgFuncNode->pUserData = pCreateInfo->pUserData;
     pNewDbgFuncNode->pNext = inst->DbgFunctionHead;
     inst->DbgFunctionHead = pNewDbgFuncNode;
+    util_UpdateDebugCallbackInterest(inst);
 
     return VK_SUCCESS;
 }
@@ -70,9 +72,9 @@ static VKAPI_ATTR VkResult VKAPI_CALL
 debug_utils_CreateDebugUtilsMessengerEXT(VkInstance instance, const VkDebugUtilsMessengerCreateInfoEXT *pCreateInfo,
                                          const VkAllocationCallbacks *pAllocator, VkDebugUtilsMessengerEXT *pMessenger) {
     struct loader_instance *inst = loader_get_instance(instance);
-    loader_platform_thread_lock_mutex(&loader_lock);
+    loader_stats_lock_mutex(inst, &inst->instance_lock);
     VkResult result = inst->disp->layer_inst_disp.CreateDebugUtilsMessengerEXT(inst->instance, pCreateInfo, pAllocator, pMessenger);
-    loader_platform_thread_unlock_mutex(&loader_lock);
+    loader_platform_thread_unlock_mutex(&inst->instance_lock);
     return result;
 }
 
@@ -123,6 +125,7 @@ void util_DestroyDebugUtilsMessenger(struct loader_instance *inst, VkDebugUtilsM
             pPrev->pNext = pTrav->pNext;
             if (inst->DbgFunctionHead == pTrav) inst->DbgFunctionHead = pTrav->pNext;
             loader_free_with_instance_fallback(pAllocator, inst, pTrav);
+            util_UpdateDebugCallbackInterest(inst);
             break;
         }
         pPrev = pTrav;
@@ -160,11 +163,11 @@ static VKAPI_ATTR void VKAPI_CALL debug_utils_SubmitDebugUtilsMessageEXT(
 static VKAPI_ATTR void VKAPI_CALL debug_utils_DestroyDebugUtilsMessengerEXT(VkInstance instance, VkDebugUtilsMessengerEXT messenger,
                                                                             const VkAllocationCallbacks *pAllocator) {
     struct loader_instance *inst = loader_get_instance(instance);
-    loader_platform_thread_lock_mutex(&loader_lock);
+    loader_stats_lock_mutex(inst, &inst->instance_lock);
 
     inst->disp->layer_inst_disp.DestroyDebugUtilsMessengerEXT(inst->instance, messenger, pAllocator);
 
-    loader_platform_thread_unlock_mutex(&loader_lock);
+    loader_platform_thread_unlock_mutex(&inst->instance_lock);
 }
 
 // This is the instance chain terminator function for CreateDebugUtilsMessenger
@@ -218,6 +221,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugUtilsMessengerEXT(VkInstanc
     pNewDbgFuncNode->pUserData = pCreateInfo->pUserData;
     pNewDbgFuncNode->pNext = inst->DbgFunctionHead;
     inst->DbgFunctionHead = pNewDbgFuncNode;
+    util_UpdateDebugCallbackInterest(inst);
 
     *(VkDebugUtilsMessengerEXT **)pMessenger = icd_info;
     pNewDbgFuncNode->messenger.messenger = *pMessenger;
@@ -275,14 +279,14 @@ VKAPI_ATTR void VKAPI_CALL terminator_SubmitDebugUtilsMessageEXT(VkInstance inst
                                                                  VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
                                                                  VkDebugUtilsMessageTypeFlagsEXT messageTypes,
                                                                  const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData) {
-    loader_platform_thread_lock_mutex(&loader_lock);
     // NOTE: Just make the callback ourselves because there could be one or more ICDs that support this extension
     //       and each one will trigger the callback to the user.  This would result in multiple callback triggers
     //       per message.  Instead, if we get a messaged up to here, then just trigger the message ourselves and
     //       return.  This would still allow the ICDs to trigger their own messages, but won't get any external ones.
     struct loader_instance *inst = (struct loader_instance *)instance;
+    loader_stats_lock_mutex(inst, &inst->instance_lock);
     util_SubmitDebugUtilsMessageEXT(inst, messageSeverity, messageTypes, pCallbackData);
-    loader_platform_thread_unlock_mutex(&loader_lock);
+    loader_platform_thread_unlock_mutex(&inst->instance_lock);
 }
 
 // VK_EXT_debug_report related items
@@ -304,6 +308,7 @@ VkResult util_CreateDebugReportCallback(struct loader_instance *inst, const VkDe
     pNewDbgFuncNode->pUserData = pCreateInfo->pUserData;
     pNewDbgFuncNode->pNext = inst->DbgFunctionHead;
     inst->DbgFunctionHead = pNewDbgFuncNode;
+    util_UpdateDebugCallbackInterest(inst);
 
     return VK_SUCCESS;
 }
@@ -312,9 +317,9 @@ static VKAPI_ATTR VkResult VKAPI_CALL
 debug_utils_CreateDebugReportCallbackEXT(VkInstance instance, const VkDebugReportCallbackCreateInfoEXT *pCreateInfo,
                                          const VkAllocationCallbacks *pAllocator, VkDebugReportCallbackEXT *pCallback) {
     struct loader_instance *inst = loader_get_instance(instance);
-    loader_platform_thread_lock_mutex(&loader_lock);
+    loader_stats_lock_mutex(inst, &inst->instance_lock);
     VkResult result = inst->disp->layer_inst_disp.CreateDebugReportCallbackEXT(inst->instance, pCreateInfo, pAllocator, pCallback);
-    loader_platform_thread_unlock_mutex(&loader_lock);
+    loader_platform_thread_unlock_mutex(&inst->instance_lock);
     return result;
 }
 
@@ -373,6 +378,7 @@ void util_DestroyDebugReportCallback(struct loader_instance *inst, VkDebugReport
             pPrev->pNext = pTrav->pNext;
             if (inst->DbgFunctionHead == pTrav) inst->DbgFunctionHead = pTrav->pNext;
             loader_free_with_instance_fallback(pAllocator, inst, pTrav);
+            util_UpdateDebugCallbackInterest(inst);
             break;
         }
         pPrev = pTrav;
@@ -402,11 +408,11 @@ VkResult util_CreateDebugReportCallbacks(struct loader_instance *inst, const voi
 static VKAPI_ATTR void VKAPI_CALL debug_utils_DestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback,
                                                                             const VkAllocationCallbacks *pAllocator) {
     struct loader_instance *inst = loader_get_instance(instance);
-    loader_platform_thread_lock_mutex(&loader_lock);
+    loader_stats_lock_mutex(inst, &inst->instance_lock);
 
     inst->disp->layer_inst_disp.DestroyDebugReportCallbackEXT(inst->instance, callback, pAllocator);
 
-    loader_platform_thread_unlock_mutex(&loader_lock);
+    loader_platform_thread_unlock_mutex(&inst->instance_lock);
 }
 
 static VKAPI_ATTR void VKAPI_CALL debug_utils_DebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags,
@@ -470,6 +476,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugReportCallbackEXT(VkInstanc
     pNewDbgFuncNode->pUserData = pCreateInfo->pUserData;
     pNewDbgFuncNode->pNext = inst->DbgFunctionHead;
     inst->DbgFunctionHead = pNewDbgFuncNode;
+    util_UpdateDebugCallbackInterest(inst);
 
     *(VkDebugReportCallbackEXT **)pCallback = icd_info;
     pNewDbgFuncNode->report.msgCallback = *pCallback;
@@ -530,7 +537,7 @@ VKAPI_ATTR void VKAPI_CALL terminator_DebugReportMessageEXT(VkInstance instance,
 
     struct loader_instance *inst = (struct loader_instance *)instance;
 
-    loader_platform_thread_lock_mutex(&loader_lock);
+    loader_stats_lock_mutex(inst, &inst->instance_lock);
     for (icd_term = inst->icd_terms; icd_term; icd_term = icd_term->next) {
         if (icd_term->dispatch.DebugReportMessageEXT != NULL) {
             icd_term->dispatch.DebugReportMessageEXT(icd_term->instance, flags, objType, object, location, msgCode, pLayerPrefix,
@@ -543,7 +550,7 @@ VKAPI_ATTR void VKAPI_CALL terminator_DebugReportMessageEXT(VkInstance instance,
 
     util_DebugReportMessage(inst, flags, objType, object, location, msgCode, pLayerPrefix, pMsg);
 
-    loader_platform_thread_unlock_mutex(&loader_lock);
+    loader_platform_thread_unlock_mutex(&inst->instance_lock);
 }
 
 // General utilities
@@ -562,6 +569,29 @@ void destroy_debug_callbacks_chain(struct loader_instance *inst, const VkAllocat
         pTrav = pNext;
     }
     inst->DbgFunctionHead = NULL;
+    util_UpdateDebugCallbackInterest(inst);
+}
+
+void util_UpdateDebugCallbackInterest(struct loader_instance *inst) {
+    VkDebugUtilsMessageSeverityFlagsEXT severities = 0;
+    VkDebugUtilsMessageTypeFlagsEXT types = 0;
+    VkDebugReportFlagsEXT report_flags = 0;
+
+    // The union over all callbacks can over-report (one messenger's severities paired with another's types),
+    // which only costs a formatted message nobody receives. It must never under-report.
+    for (VkLayerDbgFunctionNode *pTrav = inst->DbgFunctionHead; pTrav; pTrav = pTrav->pNext) {
+        if (pTrav->is_messenger) {
+            severities |= pTrav->messenger.messageSeverity;
+            types |= pTrav->messenger.messageType;
+        } else {
+            report_flags |= pTrav->report.msgFlags;
+        }
+    }
+
+    // loader_log reads these without taking instance_lock
+    loader_platform_atomic_store_u32(&inst->debug_callback_severities, severities);
+    loader_platform_atomic_store_u32(&inst->debug_callback_types, types);
+    loader_platform_atomic_store_u32(&inst->debug_callback_report_flags, report_flags);
 }
 
 void add_debug_extensions_to_ext_list(const struct loader_instance *inst, struct loader_extension_list *ext_list) {
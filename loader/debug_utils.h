@@ -43,6 +43,10 @@ bool debug_utils_AnnotObjectToDebugReportObject(const VkDebugUtilsObjectNameInfo
 
 void destroy_debug_callbacks_chain(struct loader_instance *inst, const VkAllocationCallbacks *pAllocator);
 
+// Recompute the severities, types, and report flags any callback in inst->DbgFunctionHead listens for.
+// Must be called whenever DbgFunctionHead changes so loader_log can skip messages nobody wants.
+void util_UpdateDebugCallbackInterest(struct loader_instance *inst);
+
 // VK_EXT_debug_utils related items
 
 VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugUtilsMessengerEXT(VkInstance instance,
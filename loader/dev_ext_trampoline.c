@@ -277,6 +277,756 @@ VKAPI_ATTR void VKAPI_CALL vkdev_ext246(VkDevice device);
 VKAPI_ATTR void VKAPI_CALL vkdev_ext247(VkDevice device);
 VKAPI_ATTR void VKAPI_CALL vkdev_ext248(VkDevice device);
 VKAPI_ATTR void VKAPI_CALL vkdev_ext249(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext250(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext251(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext252(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext253(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext254(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext255(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext256(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext257(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext258(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext259(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext260(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext261(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext262(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext263(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext264(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext265(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext266(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext267(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext268(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext269(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext270(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext271(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext272(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext273(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext274(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext275(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext276(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext277(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext278(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext279(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext280(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext281(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext282(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext283(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext284(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext285(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext286(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext287(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext288(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext289(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext290(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext291(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext292(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext293(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext294(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext295(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext296(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext297(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext298(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext299(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext300(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext301(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext302(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext303(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext304(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext305(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext306(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext307(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext308(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext309(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext310(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext311(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext312(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext313(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext314(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext315(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext316(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext317(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext318(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext319(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext320(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext321(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext322(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext323(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext324(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext325(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext326(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext327(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext328(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext329(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext330(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext331(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext332(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext333(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext334(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext335(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext336(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext337(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext338(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext339(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext340(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext341(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext342(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext343(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext344(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext345(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext346(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext347(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext348(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext349(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext350(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext351(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext352(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext353(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext354(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext355(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext356(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext357(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext358(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext359(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext360(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext361(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext362(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext363(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext364(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext365(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext366(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext367(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext368(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext369(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext370(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext371(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext372(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext373(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext374(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext375(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext376(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext377(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext378(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext379(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext380(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext381(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext382(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext383(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext384(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext385(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext386(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext387(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext388(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext389(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext390(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext391(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext392(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext393(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext394(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext395(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext396(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext397(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext398(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext399(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext400(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext401(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext402(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext403(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext404(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext405(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext406(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext407(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext408(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext409(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext410(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext411(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext412(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext413(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext414(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext415(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext416(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext417(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext418(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext419(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext420(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext421(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext422(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext423(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext424(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext425(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext426(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext427(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext428(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext429(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext430(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext431(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext432(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext433(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext434(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext435(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext436(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext437(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext438(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext439(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext440(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext441(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext442(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext443(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext444(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext445(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext446(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext447(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext448(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext449(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext450(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext451(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext452(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext453(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext454(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext455(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext456(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext457(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext458(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext459(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext460(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext461(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext462(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext463(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext464(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext465(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext466(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext467(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext468(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext469(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext470(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext471(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext472(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext473(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext474(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext475(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext476(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext477(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext478(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext479(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext480(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext481(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext482(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext483(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext484(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext485(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext486(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext487(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext488(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext489(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext490(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext491(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext492(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext493(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext494(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext495(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext496(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext497(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext498(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext499(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext500(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext501(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext502(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext503(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext504(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext505(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext506(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext507(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext508(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext509(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext510(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext511(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext512(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext513(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext514(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext515(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext516(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext517(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext518(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext519(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext520(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext521(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext522(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext523(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext524(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext525(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext526(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext527(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext528(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext529(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext530(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext531(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext532(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext533(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext534(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext535(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext536(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext537(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext538(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext539(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext540(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext541(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext542(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext543(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext544(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext545(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext546(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext547(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext548(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext549(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext550(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext551(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext552(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext553(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext554(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext555(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext556(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext557(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext558(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext559(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext560(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext561(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext562(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext563(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext564(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext565(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext566(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext567(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext568(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext569(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext570(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext571(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext572(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext573(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext574(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext575(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext576(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext577(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext578(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext579(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext580(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext581(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext582(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext583(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext584(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext585(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext586(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext587(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext588(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext589(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext590(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext591(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext592(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext593(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext594(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext595(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext596(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext597(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext598(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext599(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext600(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext601(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext602(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext603(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext604(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext605(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext606(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext607(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext608(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext609(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext610(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext611(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext612(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext613(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext614(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext615(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext616(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext617(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext618(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext619(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext620(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext621(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext622(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext623(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext624(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext625(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext626(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext627(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext628(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext629(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext630(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext631(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext632(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext633(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext634(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext635(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext636(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext637(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext638(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext639(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext640(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext641(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext642(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext643(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext644(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext645(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext646(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext647(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext648(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext649(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext650(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext651(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext652(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext653(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext654(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext655(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext656(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext657(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext658(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext659(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext660(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext661(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext662(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext663(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext664(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext665(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext666(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext667(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext668(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext669(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext670(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext671(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext672(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext673(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext674(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext675(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext676(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext677(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext678(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext679(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext680(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext681(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext682(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext683(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext684(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext685(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext686(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext687(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext688(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext689(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext690(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext691(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext692(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext693(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext694(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext695(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext696(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext697(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext698(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext699(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext700(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext701(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext702(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext703(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext704(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext705(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext706(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext707(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext708(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext709(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext710(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext711(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext712(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext713(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext714(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext715(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext716(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext717(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext718(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext719(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext720(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext721(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext722(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext723(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext724(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext725(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext726(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext727(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext728(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext729(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext730(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext731(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext732(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext733(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext734(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext735(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext736(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext737(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext738(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext739(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext740(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext741(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext742(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext743(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext744(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext745(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext746(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext747(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext748(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext749(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext750(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext751(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext752(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext753(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext754(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext755(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext756(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext757(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext758(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext759(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext760(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext761(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext762(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext763(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext764(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext765(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext766(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext767(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext768(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext769(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext770(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext771(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext772(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext773(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext774(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext775(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext776(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext777(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext778(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext779(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext780(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext781(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext782(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext783(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext784(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext785(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext786(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext787(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext788(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext789(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext790(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext791(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext792(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext793(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext794(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext795(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext796(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext797(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext798(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext799(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext800(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext801(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext802(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext803(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext804(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext805(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext806(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext807(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext808(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext809(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext810(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext811(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext812(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext813(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext814(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext815(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext816(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext817(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext818(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext819(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext820(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext821(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext822(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext823(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext824(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext825(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext826(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext827(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext828(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext829(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext830(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext831(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext832(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext833(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext834(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext835(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext836(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext837(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext838(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext839(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext840(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext841(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext842(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext843(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext844(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext845(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext846(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext847(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext848(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext849(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext850(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext851(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext852(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext853(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext854(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext855(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext856(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext857(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext858(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext859(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext860(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext861(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext862(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext863(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext864(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext865(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext866(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext867(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext868(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext869(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext870(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext871(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext872(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext873(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext874(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext875(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext876(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext877(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext878(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext879(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext880(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext881(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext882(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext883(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext884(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext885(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext886(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext887(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext888(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext889(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext890(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext891(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext892(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext893(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext894(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext895(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext896(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext897(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext898(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext899(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext900(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext901(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext902(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext903(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext904(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext905(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext906(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext907(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext908(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext909(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext910(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext911(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext912(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext913(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext914(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext915(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext916(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext917(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext918(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext919(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext920(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext921(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext922(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext923(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext924(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext925(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext926(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext927(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext928(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext929(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext930(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext931(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext932(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext933(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext934(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext935(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext936(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext937(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext938(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext939(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext940(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext941(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext942(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext943(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext944(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext945(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext946(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext947(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext948(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext949(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext950(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext951(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext952(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext953(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext954(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext955(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext956(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext957(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext958(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext959(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext960(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext961(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext962(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext963(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext964(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext965(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext966(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext967(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext968(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext969(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext970(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext971(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext972(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext973(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext974(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext975(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext976(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext977(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext978(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext979(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext980(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext981(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext982(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext983(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext984(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext985(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext986(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext987(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext988(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext989(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext990(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext991(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext992(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext993(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext994(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext995(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext996(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext997(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext998(VkDevice device);
+VKAPI_ATTR void VKAPI_CALL vkdev_ext999(VkDevice device);
 
 void *loader_get_dev_ext_trampoline(uint32_t index) {
     switch (index) {
@@ -531,6 +1281,756 @@ void *loader_get_dev_ext_trampoline(uint32_t index) {
         CASE_HANDLE(247);
         CASE_HANDLE(248);
         CASE_HANDLE(249);
+        CASE_HANDLE(250);
+        CASE_HANDLE(251);
+        CASE_HANDLE(252);
+        CASE_HANDLE(253);
+        CASE_HANDLE(254);
+        CASE_HANDLE(255);
+        CASE_HANDLE(256);
+        CASE_HANDLE(257);
+        CASE_HANDLE(258);
+        CASE_HANDLE(259);
+        CASE_HANDLE(260);
+        CASE_HANDLE(261);
+        CASE_HANDLE(262);
+        CASE_HANDLE(263);
+        CASE_HANDLE(264);
+        CASE_HANDLE(265);
+        CASE_HANDLE(266);
+        CASE_HANDLE(267);
+        CASE_HANDLE(268);
+        CASE_HANDLE(269);
+        CASE_HANDLE(270);
+        CASE_HANDLE(271);
+        CASE_HANDLE(272);
+        CASE_HANDLE(273);
+        CASE_HANDLE(274);
+        CASE_HANDLE(275);
+        CASE_HANDLE(276);
+        CASE_HANDLE(277);
+        CASE_HANDLE(278);
+        CASE_HANDLE(279);
+        CASE_HANDLE(280);
+        CASE_HANDLE(281);
+        CASE_HANDLE(282);
+        CASE_HANDLE(283);
+        CASE_HANDLE(284);
+        CASE_HANDLE(285);
+        CASE_HANDLE(286);
+        CASE_HANDLE(287);
+        CASE_HANDLE(288);
+        CASE_HANDLE(289);
+        CASE_HANDLE(290);
+        CASE_HANDLE(291);
+        CASE_HANDLE(292);
+        CASE_HANDLE(293);
+        CASE_HANDLE(294);
+        CASE_HANDLE(295);
+        CASE_HANDLE(296);
+        CASE_HANDLE(297);
+        CASE_HANDLE(298);
+        CASE_HANDLE(299);
+        CASE_HANDLE(300);
+        CASE_HANDLE(301);
+        CASE_HANDLE(302);
+        CASE_HANDLE(303);
+        CASE_HANDLE(304);
+        CASE_HANDLE(305);
+        CASE_HANDLE(306);
+        CASE_HANDLE(307);
+        CASE_HANDLE(308);
+        CASE_HANDLE(309);
+        CASE_HANDLE(310);
+        CASE_HANDLE(311);
+        CASE_HANDLE(312);
+        CASE_HANDLE(313);
+        CASE_HANDLE(314);
+        CASE_HANDLE(315);
+        CASE_HANDLE(316);
+        CASE_HANDLE(317);
+        CASE_HANDLE(318);
+        CASE_HANDLE(319);
+        CASE_HANDLE(320);
+        CASE_HANDLE(321);
+        CASE_HANDLE(322);
+        CASE_HANDLE(323);
+        CASE_HANDLE(324);
+        CASE_HANDLE(325);
+        CASE_HANDLE(326);
+        CASE_HANDLE(327);
+        CASE_HANDLE(328);
+        CASE_HANDLE(329);
+        CASE_HANDLE(330);
+        CASE_HANDLE(331);
+        CASE_HANDLE(332);
+        CASE_HANDLE(333);
+        CASE_HANDLE(334);
+        CASE_HANDLE(335);
+        CASE_HANDLE(336);
+        CASE_HANDLE(337);
+        CASE_HANDLE(338);
+        CASE_HANDLE(339);
+        CASE_HANDLE(340);
+        CASE_HANDLE(341);
+        CASE_HANDLE(342);
+        CASE_HANDLE(343);
+        CASE_HANDLE(344);
+        CASE_HANDLE(345);
+        CASE_HANDLE(346);
+        CASE_HANDLE(347);
+        CASE_HANDLE(348);
+        CASE_HANDLE(349);
+        CASE_HANDLE(350);
+        CASE_HANDLE(351);
+        CASE_HANDLE(352);
+        CASE_HANDLE(353);
+        CASE_HANDLE(354);
+        CASE_HANDLE(355);
+        CASE_HANDLE(356);
+        CASE_HANDLE(357);
+        CASE_HANDLE(358);
+        CASE_HANDLE(359);
+        CASE_HANDLE(360);
+        CASE_HANDLE(361);
+        CASE_HANDLE(362);
+        CASE_HANDLE(363);
+        CASE_HANDLE(364);
+        CASE_HANDLE(365);
+        CASE_HANDLE(366);
+        CASE_HANDLE(367);
+        CASE_HANDLE(368);
+        CASE_HANDLE(369);
+        CASE_HANDLE(370);
+        CASE_HANDLE(371);
+        CASE_HANDLE(372);
+        CASE_HANDLE(373);
+        CASE_HANDLE(374);
+        CASE_HANDLE(375);
+        CASE_HANDLE(376);
+        CASE_HANDLE(377);
+        CASE_HANDLE(378);
+        CASE_HANDLE(379);
+        CASE_HANDLE(380);
+        CASE_HANDLE(381);
+        CASE_HANDLE(382);
+        CASE_HANDLE(383);
+        CASE_HANDLE(384);
+        CASE_HANDLE(385);
+        CASE_HANDLE(386);
+        CASE_HANDLE(387);
+        CASE_HANDLE(388);
+        CASE_HANDLE(389);
+        CASE_HANDLE(390);
+        CASE_HANDLE(391);
+        CASE_HANDLE(392);
+        CASE_HANDLE(393);
+        CASE_HANDLE(394);
+        CASE_HANDLE(395);
+        CASE_HANDLE(396);
+        CASE_HANDLE(397);
+        CASE_HANDLE(398);
+        CASE_HANDLE(399);
+        CASE_HANDLE(400);
+        CASE_HANDLE(401);
+        CASE_HANDLE(402);
+        CASE_HANDLE(403);
+        CASE_HANDLE(404);
+        CASE_HANDLE(405);
+        CASE_HANDLE(406);
+        CASE_HANDLE(407);
+        CASE_HANDLE(408);
+        CASE_HANDLE(409);
+        CASE_HANDLE(410);
+        CASE_HANDLE(411);
+        CASE_HANDLE(412);
+        CASE_HANDLE(413);
+        CASE_HANDLE(414);
+        CASE_HANDLE(415);
+        CASE_HANDLE(416);
+        CASE_HANDLE(417);
+        CASE_HANDLE(418);
+        CASE_HANDLE(419);
+        CASE_HANDLE(420);
+        CASE_HANDLE(421);
+        CASE_HANDLE(422);
+        CASE_HANDLE(423);
+        CASE_HANDLE(424);
+        CASE_HANDLE(425);
+        CASE_HANDLE(426);
+        CASE_HANDLE(427);
+        CASE_HANDLE(428);
+        CASE_HANDLE(429);
+        CASE_HANDLE(430);
+        CASE_HANDLE(431);
+        CASE_HANDLE(432);
+        CASE_HANDLE(433);
+        CASE_HANDLE(434);
+        CASE_HANDLE(435);
+        CASE_HANDLE(436);
+        CASE_HANDLE(437);
+        CASE_HANDLE(438);
+        CASE_HANDLE(439);
+        CASE_HANDLE(440);
+        CASE_HANDLE(441);
+        CASE_HANDLE(442);
+        CASE_HANDLE(443);
+        CASE_HANDLE(444);
+        CASE_HANDLE(445);
+        CASE_HANDLE(446);
+        CASE_HANDLE(447);
+        CASE_HANDLE(448);
+        CASE_HANDLE(449);
+        CASE_HANDLE(450);
+        CASE_HANDLE(451);
+        CASE_HANDLE(452);
+        CASE_HANDLE(453);
+        CASE_HANDLE(454);
+        CASE_HANDLE(455);
+        CASE_HANDLE(456);
+        CASE_HANDLE(457);
+        CASE_HANDLE(458);
+        CASE_HANDLE(459);
+        CASE_HANDLE(460);
+        CASE_HANDLE(461);
+        CASE_HANDLE(462);
+        CASE_HANDLE(463);
+        CASE_HANDLE(464);
+        CASE_HANDLE(465);
+        CASE_HANDLE(466);
+        CASE_HANDLE(467);
+        CASE_HANDLE(468);
+        CASE_HANDLE(469);
+        CASE_HANDLE(470);
+        CASE_HANDLE(471);
+        CASE_HANDLE(472);
+        CASE_HANDLE(473);
+        CASE_HANDLE(474);
+        CASE_HANDLE(475);
+        CASE_HANDLE(476);
+        CASE_HANDLE(477);
+        CASE_HANDLE(478);
+        CASE_HANDLE(479);
+        CASE_HANDLE(480);
+        CASE_HANDLE(481);
+        CASE_HANDLE(482);
+        CASE_HANDLE(483);
+        CASE_HANDLE(484);
+        CASE_HANDLE(485);
+        CASE_HANDLE(486);
+        CASE_HANDLE(487);
+        CASE_HANDLE(488);
+        CASE_HANDLE(489);
+        CASE_HANDLE(490);
+        CASE_HANDLE(491);
+        CASE_HANDLE(492);
+        CASE_HANDLE(493);
+        CASE_HANDLE(494);
+        CASE_HANDLE(495);
+        CASE_HANDLE(496);
+        CASE_HANDLE(497);
+        CASE_HANDLE(498);
+        CASE_HANDLE(499);
+        CASE_HANDLE(500);
+        CASE_HANDLE(501);
+        CASE_HANDLE(502);
+        CASE_HANDLE(503);
+        CASE_HANDLE(504);
+        CASE_HANDLE(505);
+        CASE_HANDLE(506);
+        CASE_HANDLE(507);
+        CASE_HANDLE(508);
+        CASE_HANDLE(509);
+        CASE_HANDLE(510);
+        CASE_HANDLE(511);
+        CASE_HANDLE(512);
+        CASE_HANDLE(513);
+        CASE_HANDLE(514);
+        CASE_HANDLE(515);
+        CASE_HANDLE(516);
+        CASE_HANDLE(517);
+        CASE_HANDLE(518);
+        CASE_HANDLE(519);
+        CASE_HANDLE(520);
+        CASE_HANDLE(521);
+        CASE_HANDLE(522);
+        CASE_HANDLE(523);
+        CASE_HANDLE(524);
+        CASE_HANDLE(525);
+        CASE_HANDLE(526);
+        CASE_HANDLE(527);
+        CASE_HANDLE(528);
+        CASE_HANDLE(529);
+        CASE_HANDLE(530);
+        CASE_HANDLE(531);
+        CASE_HANDLE(532);
+        CASE_HANDLE(533);
+        CASE_HANDLE(534);
+        CASE_HANDLE(535);
+        CASE_HANDLE(536);
+        CASE_HANDLE(537);
+        CASE_HANDLE(538);
+        CASE_HANDLE(539);
+        CASE_HANDLE(540);
+        CASE_HANDLE(541);
+        CASE_HANDLE(542);
+        CASE_HANDLE(543);
+        CASE_HANDLE(544);
+        CASE_HANDLE(545);
+        CASE_HANDLE(546);
+        CASE_HANDLE(547);
+        CASE_HANDLE(548);
+        CASE_HANDLE(549);
+        CASE_HANDLE(550);
+        CASE_HANDLE(551);
+        CASE_HANDLE(552);
+        CASE_HANDLE(553);
+        CASE_HANDLE(554);
+        CASE_HANDLE(555);
+        CASE_HANDLE(556);
+        CASE_HANDLE(557);
+        CASE_HANDLE(558);
+        CASE_HANDLE(559);
+        CASE_HANDLE(560);
+        CASE_HANDLE(561);
+        CASE_HANDLE(562);
+        CASE_HANDLE(563);
+        CASE_HANDLE(564);
+        CASE_HANDLE(565);
+        CASE_HANDLE(566);
+        CASE_HANDLE(567);
+        CASE_HANDLE(568);
+        CASE_HANDLE(569);
+        CASE_HANDLE(570);
+        CASE_HANDLE(571);
+        CASE_HANDLE(572);
+        CASE_HANDLE(573);
+        CASE_HANDLE(574);
+        CASE_HANDLE(575);
+        CASE_HANDLE(576);
+        CASE_HANDLE(577);
+        CASE_HANDLE(578);
+        CASE_HANDLE(579);
+        CASE_HANDLE(580);
+        CASE_HANDLE(581);
+        CASE_HANDLE(582);
+        CASE_HANDLE(583);
+        CASE_HANDLE(584);
+        CASE_HANDLE(585);
+        CASE_HANDLE(586);
+        CASE_HANDLE(587);
+        CASE_HANDLE(588);
+        CASE_HANDLE(589);
+        CASE_HANDLE(590);
+        CASE_HANDLE(591);
+        CASE_HANDLE(592);
+        CASE_HANDLE(593);
+        CASE_HANDLE(594);
+        CASE_HANDLE(595);
+        CASE_HANDLE(596);
+        CASE_HANDLE(597);
+        CASE_HANDLE(598);
+        CASE_HANDLE(599);
+        CASE_HANDLE(600);
+        CASE_HANDLE(601);
+        CASE_HANDLE(602);
+        CASE_HANDLE(603);
+        CASE_HANDLE(604);
+        CASE_HANDLE(605);
+        CASE_HANDLE(606);
+        CASE_HANDLE(607);
+        CASE_HANDLE(608);
+        CASE_HANDLE(609);
+        CASE_HANDLE(610);
+        CASE_HANDLE(611);
+        CASE_HANDLE(612);
+        CASE_HANDLE(613);
+        CASE_HANDLE(614);
+        CASE_HANDLE(615);
+        CASE_HANDLE(616);
+        CASE_HANDLE(617);
+        CASE_HANDLE(618);
+        CASE_HANDLE(619);
+        CASE_HANDLE(620);
+        CASE_HANDLE(621);
+        CASE_HANDLE(622);
+        CASE_HANDLE(623);
+        CASE_HANDLE(624);
+        CASE_HANDLE(625);
+        CASE_HANDLE(626);
+        CASE_HANDLE(627);
+        CASE_HANDLE(628);
+        CASE_HANDLE(629);
+        CASE_HANDLE(630);
+        CASE_HANDLE(631);
+        CASE_HANDLE(632);
+        CASE_HANDLE(633);
+        CASE_HANDLE(634);
+        CASE_HANDLE(635);
+        CASE_HANDLE(636);
+        CASE_HANDLE(637);
+        CASE_HANDLE(638);
+        CASE_HANDLE(639);
+        CASE_HANDLE(640);
+        CASE_HANDLE(641);
+        CASE_HANDLE(642);
+        CASE_HANDLE(643);
+        CASE_HANDLE(644);
+        CASE_HANDLE(645);
+        CASE_HANDLE(646);
+        CASE_HANDLE(647);
+        CASE_HANDLE(648);
+        CASE_HANDLE(649);
+        CASE_HANDLE(650);
+        CASE_HANDLE(651);
+        CASE_HANDLE(652);
+        CASE_HANDLE(653);
+        CASE_HANDLE(654);
+        CASE_HANDLE(655);
+        CASE_HANDLE(656);
+        CASE_HANDLE(657);
+        CASE_HANDLE(658);
+        CASE_HANDLE(659);
+        CASE_HANDLE(660);
+        CASE_HANDLE(661);
+        CASE_HANDLE(662);
+        CASE_HANDLE(663);
+        CASE_HANDLE(664);
+        CASE_HANDLE(665);
+        CASE_HANDLE(666);
+        CASE_HANDLE(667);
+        CASE_HANDLE(668);
+        CASE_HANDLE(669);
+        CASE_HANDLE(670);
+        CASE_HANDLE(671);
+        CASE_HANDLE(672);
+        CASE_HANDLE(673);
+        CASE_HANDLE(674);
+        CASE_HANDLE(675);
+        CASE_HANDLE(676);
+        CASE_HANDLE(677);
+        CASE_HANDLE(678);
+        CASE_HANDLE(679);
+        CASE_HANDLE(680);
+        CASE_HANDLE(681);
+        CASE_HANDLE(682);
+        CASE_HANDLE(683);
+        CASE_HANDLE(684);
+        CASE_HANDLE(685);
+        CASE_HANDLE(686);
+        CASE_HANDLE(687);
+        CASE_HANDLE(688);
+        CASE_HANDLE(689);
+        CASE_HANDLE(690);
+        CASE_HANDLE(691);
+        CASE_HANDLE(692);
+        CASE_HANDLE(693);
+        CASE_HANDLE(694);
+        CASE_HANDLE(695);
+        CASE_HANDLE(696);
+        CASE_HANDLE(697);
+        CASE_HANDLE(698);
+        CASE_HANDLE(699);
+        CASE_HANDLE(700);
+        CASE_HANDLE(701);
+        CASE_HANDLE(702);
+        CASE_HANDLE(703);
+        CASE_HANDLE(704);
+        CASE_HANDLE(705);
+        CASE_HANDLE(706);
+        CASE_HANDLE(707);
+        CASE_HANDLE(708);
+        CASE_HANDLE(709);
+        CASE_HANDLE(710);
+        CASE_HANDLE(711);
+        CASE_HANDLE(712);
+        CASE_HANDLE(713);
+        CASE_HANDLE(714);
+        CASE_HANDLE(715);
+        CASE_HANDLE(716);
+        CASE_HANDLE(717);
+        CASE_HANDLE(718);
+        CASE_HANDLE(719);
+        CASE_HANDLE(720);
+        CASE_HANDLE(721);
+        CASE_HANDLE(722);
+        CASE_HANDLE(723);
+        CASE_HANDLE(724);
+        CASE_HANDLE(725);
+        CASE_HANDLE(726);
+        CASE_HANDLE(727);
+        CASE_HANDLE(728);
+        CASE_HANDLE(729);
+        CASE_HANDLE(730);
+        CASE_HANDLE(731);
+        CASE_HANDLE(732);
+        CASE_HANDLE(733);
+        CASE_HANDLE(734);
+        CASE_HANDLE(735);
+        CASE_HANDLE(736);
+        CASE_HANDLE(737);
+        CASE_HANDLE(738);
+        CASE_HANDLE(739);
+        CASE_HANDLE(740);
+        CASE_HANDLE(741);
+        CASE_HANDLE(742);
+        CASE_HANDLE(743);
+        CASE_HANDLE(744);
+        CASE_HANDLE(745);
+        CASE_HANDLE(746);
+        CASE_HANDLE(747);
+        CASE_HANDLE(748);
+        CASE_HANDLE(749);
+        CASE_HANDLE(750);
+        CASE_HANDLE(751);
+        CASE_HANDLE(752);
+        CASE_HANDLE(753);
+        CASE_HANDLE(754);
+        CASE_HANDLE(755);
+        CASE_HANDLE(756);
+        CASE_HANDLE(757);
+        CASE_HANDLE(758);
+        CASE_HANDLE(759);
+        CASE_HANDLE(760);
+        CASE_HANDLE(761);
+        CASE_HANDLE(762);
+        CASE_HANDLE(763);
+        CASE_HANDLE(764);
+        CASE_HANDLE(765);
+        CASE_HANDLE(766);
+        CASE_HANDLE(767);
+        CASE_HANDLE(768);
+        CASE_HANDLE(769);
+        CASE_HANDLE(770);
+        CASE_HANDLE(771);
+        CASE_HANDLE(772);
+        CASE_HANDLE(773);
+        CASE_HANDLE(774);
+        CASE_HANDLE(775);
+        CASE_HANDLE(776);
+        CASE_HANDLE(777);
+        CASE_HANDLE(778);
+        CASE_HANDLE(779);
+        CASE_HANDLE(780);
+        CASE_HANDLE(781);
+        CASE_HANDLE(782);
+        CASE_HANDLE(783);
+        CASE_HANDLE(784);
+        CASE_HANDLE(785);
+        CASE_HANDLE(786);
+        CASE_HANDLE(787);
+        CASE_HANDLE(788);
+        CASE_HANDLE(789);
+        CASE_HANDLE(790);
+        CASE_HANDLE(791);
+        CASE_HANDLE(792);
+        CASE_HANDLE(793);
+        CASE_HANDLE(794);
+        CASE_HANDLE(795);
+        CASE_HANDLE(796);
+        CASE_HANDLE(797);
+        CASE_HANDLE(798);
+        CASE_HANDLE(799);
+        CASE_HANDLE(800);
+        CASE_HANDLE(801);
+        CASE_HANDLE(802);
+        CASE_HANDLE(803);
+        CASE_HANDLE(804);
+        CASE_HANDLE(805);
+        CASE_HANDLE(806);
+        CASE_HANDLE(807);
+        CASE_HANDLE(808);
+        CASE_HANDLE(809);
+        CASE_HANDLE(810);
+        CASE_HANDLE(811);
+        CASE_HANDLE(812);
+        CASE_HANDLE(813);
+        CASE_HANDLE(814);
+        CASE_HANDLE(815);
+        CASE_HANDLE(816);
+        CASE_HANDLE(817);
+        CASE_HANDLE(818);
+        CASE_HANDLE(819);
+        CASE_HANDLE(820);
+        CASE_HANDLE(821);
+        CASE_HANDLE(822);
+        CASE_HANDLE(823);
+        CASE_HANDLE(824);
+        CASE_HANDLE(825);
+        CASE_HANDLE(826);
+        CASE_HANDLE(827);
+        CASE_HANDLE(828);
+        CASE_HANDLE(829);
+        CASE_HANDLE(830);
+        CASE_HANDLE(831);
+        CASE_HANDLE(832);
+        CASE_HANDLE(833);
+        CASE_HANDLE(834);
+        CASE_HANDLE(835);
+        CASE_HANDLE(836);
+        CASE_HANDLE(837);
+        CASE_HANDLE(838);
+        CASE_HANDLE(839);
+        CASE_HANDLE(840);
+        CASE_HANDLE(841);
+        CASE_HANDLE(842);
+        CASE_HANDLE(843);
+        CASE_HANDLE(844);
+        CASE_HANDLE(845);
+        CASE_HANDLE(846);
+        CASE_HANDLE(847);
+        CASE_HANDLE(848);
+        CASE_HANDLE(849);
+        CASE_HANDLE(850);
+        CASE_HANDLE(851);
+        CASE_HANDLE(852);
+        CASE_HANDLE(853);
+        CASE_HANDLE(854);
+        CASE_HANDLE(855);
+        CASE_HANDLE(856);
+        CASE_HANDLE(857);
+        CASE_HANDLE(858);
+        CASE_HANDLE(859);
+        CASE_HANDLE(860);
+        CASE_HANDLE(861);
+        CASE_HANDLE(862);
+        CASE_HANDLE(863);
+        CASE_HANDLE(864);
+        CASE_HANDLE(865);
+        CASE_HANDLE(866);
+        CASE_HANDLE(867);
+        CASE_HANDLE(868);
+        CASE_HANDLE(869);
+        CASE_HANDLE(870);
+        CASE_HANDLE(871);
+        CASE_HANDLE(872);
+        CASE_HANDLE(873);
+        CASE_HANDLE(874);
+        CASE_HANDLE(875);
+        CASE_HANDLE(876);
+        CASE_HANDLE(877);
+        CASE_HANDLE(878);
+        CASE_HANDLE(879);
+        CASE_HANDLE(880);
+        CASE_HANDLE(881);
+        CASE_HANDLE(882);
+        CASE_HANDLE(883);
+        CASE_HANDLE(884);
+        CASE_HANDLE(885);
+        CASE_HANDLE(886);
+        CASE_HANDLE(887);
+        CASE_HANDLE(888);
+        CASE_HANDLE(889);
+        CASE_HANDLE(890);
+        CASE_HANDLE(891);
+        CASE_HANDLE(892);
+        CASE_HANDLE(893);
+        CASE_HANDLE(894);
+        CASE_HANDLE(895);
+        CASE_HANDLE(896);
+        CASE_HANDLE(897);
+        CASE_HANDLE(898);
+        CASE_HANDLE(899);
+        CASE_HANDLE(900);
+        CASE_HANDLE(901);
+        CASE_HANDLE(902);
+        CASE_HANDLE(903);
+        CASE_HANDLE(904);
+        CASE_HANDLE(905);
+        CASE_HANDLE(906);
+        CASE_HANDLE(907);
+        CASE_HANDLE(908);
+        CASE_HANDLE(909);
+        CASE_HANDLE(910);
+        CASE_HANDLE(911);
+        CASE_HANDLE(912);
+        CASE_HANDLE(913);
+        CASE_HANDLE(914);
+        CASE_HANDLE(915);
+        CASE_HANDLE(916);
+        CASE_HANDLE(917);
+        CASE_HANDLE(918);
+        CASE_HANDLE(919);
+        CASE_HANDLE(920);
+        CASE_HANDLE(921);
+        CASE_HANDLE(922);
+        CASE_HANDLE(923);
+        CASE_HANDLE(924);
+        CASE_HANDLE(925);
+        CASE_HANDLE(926);
+        CASE_HANDLE(927);
+        CASE_HANDLE(928);
+        CASE_HANDLE(929);
+        CASE_HANDLE(930);
+        CASE_HANDLE(931);
+        CASE_HANDLE(932);
+        CASE_HANDLE(933);
+        CASE_HANDLE(934);
+        CASE_HANDLE(935);
+        CASE_HANDLE(936);
+        CASE_HANDLE(937);
+        CASE_HANDLE(938);
+        CASE_HANDLE(939);
+        CASE_HANDLE(940);
+        CASE_HANDLE(941);
+        CASE_HANDLE(942);
+        CASE_HANDLE(943);
+        CASE_HANDLE(944);
+        CASE_HANDLE(945);
+        CASE_HANDLE(946);
+        CASE_HANDLE(947);
+        CASE_HANDLE(948);
+        CASE_HANDLE(949);
+        CASE_HANDLE(950);
+        CASE_HANDLE(951);
+        CASE_HANDLE(952);
+        CASE_HANDLE(953);
+        CASE_HANDLE(954);
+        CASE_HANDLE(955);
+        CASE_HANDLE(956);
+        CASE_HANDLE(957);
+        CASE_HANDLE(958);
+        CASE_HANDLE(959);
+        CASE_HANDLE(960);
+        CASE_HANDLE(961);
+        CASE_HANDLE(962);
+        CASE_HANDLE(963);
+        CASE_HANDLE(964);
+        CASE_HANDLE(965);
+        CASE_HANDLE(966);
+        CASE_HANDLE(967);
+        CASE_HANDLE(968);
+        CASE_HANDLE(969);
+        CASE_HANDLE(970);
+        CASE_HANDLE(971);
+        CASE_HANDLE(972);
+        CASE_HANDLE(973);
+        CASE_HANDLE(974);
+        CASE_HANDLE(975);
+        CASE_HANDLE(976);
+        CASE_HANDLE(977);
+        CASE_HANDLE(978);
+        CASE_HANDLE(979);
+        CASE_HANDLE(980);
+        CASE_HANDLE(981);
+        CASE_HANDLE(982);
+        CASE_HANDLE(983);
+        CASE_HANDLE(984);
+        CASE_HANDLE(985);
+        CASE_HANDLE(986);
+        CASE_HANDLE(987);
+        CASE_HANDLE(988);
+        CASE_HANDLE(989);
+        CASE_HANDLE(990);
+        CASE_HANDLE(991);
+        CASE_HANDLE(992);
+        CASE_HANDLE(993);
+        CASE_HANDLE(994);
+        CASE_HANDLE(995);
+        CASE_HANDLE(996);
+        CASE_HANDLE(997);
+        CASE_HANDLE(998);
+        CASE_HANDLE(999);
     }
 
     return NULL;
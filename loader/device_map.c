@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "device_map.h"
+
+#include <string.h>
+
+#include "allocation.h"
+#include "loader.h"
+
+struct loader_device_map_entry {
+    const struct loader_dev_dispatch_table *dispatch;  // NULL for an empty slot
+    struct loader_device *dev;
+    struct loader_icd_term *icd_term;
+    uint32_t icd_index;
+};
+
+// Open addressing with linear probing, kept at most half full so that lookups stay short. A table is never changed once it
+// is published: adding or removing a device builds a new one, so lookups read the current table without taking the lock.
+struct loader_device_map_table {
+    uint32_t capacity;  // A power of two
+    uint32_t count;
+    struct loader_device_map_entry *entries;  // Allocated along with the table
+};
+
+// Lookups in progress are counted in one of several counters, picked by the device being looked up, so that lookups of different
+// devices on different threads mostly don't write to the same cache line
+#define LOADER_DEVICE_MAP_READER_STRIPES 16
+
+struct loader_device_map_reader_count {
+    uint64_t count;
+    uint8_t padding[56];  // Keeps every counter on its own cache line
+};
+
+static struct {
+    loader_platform_thread_mutex lock;  // Only taken to add or remove a device
+    // Only read through loader_platform_atomic_load_ptr, NULL while there are no devices
+    struct loader_device_map_table *table;
+    // Lookups count themselves in the readers of the current epoch. Publishing a table moves on to the next epoch and waits for
+    // the lookups counted in the previous one to finish, after which nothing can be reading the table that was replaced.
+    uint64_t epoch;
+    struct loader_device_map_reader_count readers[2][LOADER_DEVICE_MAP_READER_STRIPES];
+} device_map;
+
+static uint32_t loader_device_map_slot(const struct loader_dev_dispatch_table *dispatch, uint32_t mask) {
+    // The low bits of a heap pointer carry no information, so mix all of them into the slot
+    uint64_t value = (uint64_t)(uintptr_t)dispatch;
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    return (uint32_t)value & mask;
+}
+
+static void loader_device_map_insert(struct loader_device_map_table *table, const struct loader_device_map_entry *new_entry) {
+    uint32_t mask = table->capacity - 1;
+    uint32_t slot = loader_device_map_slot(new_entry->dispatch, mask);
+    while (NULL != table->entries[slot].dispatch) {
+        slot = (slot + 1) & mask;
+    }
+    table->entries[slot] = *new_entry;
+    table->count++;
+}
+
+// Builds a table holding every entry of old except the one for skip, big enough to take one more entry
+static struct loader_device_map_table *loader_device_map_copy_table(const struct loader_device_map_table *old,
+                                                                    const struct loader_dev_dispatch_table *skip) {
+    uint32_t count = NULL == old ? 0 : old->count;
+    uint32_t capacity = NULL == old ? 16 : old->capacity;
+    while ((count + 1) * 2 > capacity) {
+        capacity *= 2;
+    }
+    // Outlives the instance the devices were created from, so the system allocator is used
+    size_t size = sizeof(struct loader_device_map_table) + sizeof(struct loader_device_map_entry) * capacity;
+    struct loader_device_map_table *table = loader_instance_heap_calloc(NULL, size, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == table) {
+        return NULL;
+    }
+    table->capacity = capacity;
+    table->entries = (struct loader_device_map_entry *)(table + 1);
+    for (uint32_t i = 0; NULL != old && i < old->capacity; i++) {
+        if (NULL != old->entries[i].dispatch && skip != old->entries[i].dispatch) {
+            loader_device_map_insert(table, &old->entries[i]);
+        }
+    }
+    return table;
+}
+
+// Must be called with the lock held. Returns once no lookup can be reading the table that was replaced, which is then freed.
+static void loader_device_map_publish(struct loader_device_map_table *table) {
+    struct loader_device_map_table *old = device_map.table;
+    loader_platform_atomic_store_ptr((void **)&device_map.table, table);
+    // Lookups which see the new epoch also see the new table. The counters are read with an atomic add rather than a load so
+    // that a lookup which still counted itself in the previous epoch either is seen here or sees the new epoch and starts over,
+    // see loader_device_map_find.
+    uint64_t previous = loader_platform_atomic_fetch_add_u64(&device_map.epoch, 1) & 1;
+    for (uint32_t i = 0; i < LOADER_DEVICE_MAP_READER_STRIPES; i++) {
+        while (0 != loader_platform_atomic_fetch_add_u64(&device_map.readers[previous][i].count, 0)) {
+            // Lookups are short, so just wait them out
+        }
+    }
+    loader_instance_heap_free(NULL, old);
+}
+
+void loader_device_map_initialize(void) { loader_platform_thread_create_mutex(&device_map.lock); }
+
+void loader_device_map_release(void) {
+    loader_instance_heap_free(NULL, device_map.table);
+    device_map.table = NULL;
+    loader_platform_thread_delete_mutex(&device_map.lock);
+}
+
+VkResult loader_device_map_add(struct loader_device *dev, struct loader_icd_term *icd_term, uint32_t icd_index) {
+    VkResult res = VK_SUCCESS;
+    loader_platform_thread_lock_mutex(&device_map.lock);
+    // Any entry left behind for a device that used to be at the same address is dropped, see loader_device_map_remove
+    struct loader_device_map_table *table = loader_device_map_copy_table(device_map.table, &dev->loader_dispatch);
+    if (NULL == table) {
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    }
+    struct loader_device_map_entry new_entry = {&dev->loader_dispatch, dev, icd_term, icd_index};
+    loader_device_map_insert(table, &new_entry);
+    loader_device_map_publish(table);
+
+out:
+    loader_platform_thread_unlock_mutex(&device_map.lock);
+    return res;
+}
+
+static const struct loader_device_map_entry *loader_device_map_lookup(const struct loader_device_map_table *table,
+                                                                      const struct loader_dev_dispatch_table *dispatch) {
+    uint32_t mask = table->capacity - 1;
+    for (uint32_t slot = loader_device_map_slot(dispatch, mask); NULL != table->entries[slot].dispatch; slot = (slot + 1) & mask) {
+        if (table->entries[slot].dispatch == dispatch) {
+            return &table->entries[slot];
+        }
+    }
+    return NULL;
+}
+
+void loader_device_map_remove(const struct loader_device *dev) {
+    loader_platform_thread_lock_mutex(&device_map.lock);
+    struct loader_device_map_table *old = device_map.table;
+    if (NULL == old || NULL == loader_device_map_lookup(old, &dev->loader_dispatch)) {
+        goto out;
+    }
+    if (1 == old->count) {
+        loader_device_map_publish(NULL);
+        goto out;
+    }
+    // If there is no memory for the new table the entry stays behind. Nothing can look it up without using the destroyed device,
+    // and it is dropped when a device is added at the same address.
+    struct loader_device_map_table *table = loader_device_map_copy_table(old, &dev->loader_dispatch);
+    if (NULL != table) {
+        loader_device_map_publish(table);
+    }
+
+out:
+    loader_platform_thread_unlock_mutex(&device_map.lock);
+}
+
+struct loader_icd_term *loader_device_map_find(const void *object, struct loader_device **found_dev, uint32_t *icd_index) {
+    struct loader_icd_term *icd_term = NULL;
+    *found_dev = NULL;
+    // Layers wrapping any of these objects are required to keep the loader's dispatch table pointer at the start of theirs
+    const struct loader_dev_dispatch_table *dispatch = (const struct loader_dev_dispatch_table *)loader_get_dispatch(object);
+    if (NULL == dispatch) {
+        return NULL;
+    }
+
+    // Count this lookup in the current epoch. If the epoch moved on in the meantime, the table may have been replaced by a
+    // publish which didn't see this lookup, so count it again in the new epoch.
+    uint32_t stripe = loader_device_map_slot(dispatch, LOADER_DEVICE_MAP_READER_STRIPES - 1);
+    uint64_t *readers;
+    uint64_t epoch = loader_platform_atomic_load_u64(&device_map.epoch);
+    while (true) {
+        readers = &device_map.readers[epoch & 1][stripe].count;
+        loader_platform_atomic_fetch_add_u64(readers, 1);
+        uint64_t current = loader_platform_atomic_load_u64(&device_map.epoch);
+        if (current == epoch) {
+            break;
+        }
+        loader_platform_atomic_fetch_add_u64(readers, (uint64_t)-1);
+        epoch = current;
+    }
+    const struct loader_device_map_table *table = loader_platform_atomic_load_ptr((void *const *)&device_map.table);
+    const struct loader_device_map_entry *entry = NULL == table ? NULL : loader_device_map_lookup(table, dispatch);
+    if (NULL != entry) {
+        *found_dev = entry->dev;
+        if (NULL != icd_index) {
+            *icd_index = entry->icd_index;
+        }
+        icd_term = entry->icd_term;
+    }
+    loader_platform_atomic_fetch_add_u64(readers, (uint64_t)-1);
+    return icd_term;
+}
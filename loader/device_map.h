@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "loader_common.h"
+
+// Process wide map from the dispatch table pointer at the start of every dispatchable object belonging to a device, to the
+// loader_device it was created as and the loader_icd_term of the driver it was created on. Devices are added as soon as the
+// driver has created them and removed when they are destroyed, so that finding the device behind a VkDevice, VkQueue or
+// VkCommandBuffer doesn't depend on how many instances, drivers and devices there are. Finding a device never takes a lock or
+// waits, and lookups of different devices mostly touch different cache lines. Adding or removing a device waits for the
+// lookups already in progress to finish, so that the memory they read can be freed straight away.
+
+void loader_device_map_initialize(void);
+void loader_device_map_release(void);
+
+// icd_index is the position of icd_term in the list of drivers of its instance
+VkResult loader_device_map_add(struct loader_device *dev, struct loader_icd_term *icd_term, uint32_t icd_index);
+
+// Does nothing if dev was never added
+void loader_device_map_remove(const struct loader_device *dev);
+
+// Returns NULL if object doesn't belong to any device which currently exists
+struct loader_icd_term *loader_device_map_find(const void *object, struct loader_device **found_dev, uint32_t *icd_index);
@@ -22,6 +22,7 @@
  * Author: Mark Young <marky@lunarg.com>
  */
 
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -330,7 +331,6 @@ VKAPI_ATTR void VKAPI_CALL loader_init_device_dispatch_table(struct loader_dev_d
                                                              VkDevice dev) {
     VkLayerDispatchTable *table = &dev_table->core_dispatch;
     table->magic = DEVICE_DISP_TABLE_MAGIC_NUMBER;
-    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) dev_table->ext_dispatch[i] = (PFN_vkDevExt)vkDevExtError;
 
     // ---- Core 1_0 commands
     table->GetDeviceProcAddr = gpa;
@@ -1295,716 +1295,899 @@ VKAPI_ATTR void VKAPI_CALL loader_init_instance_extension_dispatch_table(VkLayer
 #endif // VK_USE_PLATFORM_SCREEN_QNX
 }
 
-// Device command lookup function
-VKAPI_ATTR void* VKAPI_CALL loader_lookup_device_dispatch_table(const VkLayerDispatchTable *table, const char *name) {
-    if (!name || name[0] != 'v' || name[1] != 'k') return NULL;
-
-    name += 2;
-
-    // ---- Core 1_0 commands
-    if (!strcmp(name, "GetDeviceProcAddr")) return (void *)table->GetDeviceProcAddr;
-    if (!strcmp(name, "DestroyDevice")) return (void *)table->DestroyDevice;
-    if (!strcmp(name, "GetDeviceQueue")) return (void *)table->GetDeviceQueue;
-    if (!strcmp(name, "QueueSubmit")) return (void *)table->QueueSubmit;
-    if (!strcmp(name, "QueueWaitIdle")) return (void *)table->QueueWaitIdle;
-    if (!strcmp(name, "DeviceWaitIdle")) return (void *)table->DeviceWaitIdle;
-    if (!strcmp(name, "AllocateMemory")) return (void *)table->AllocateMemory;
-    if (!strcmp(name, "FreeMemory")) return (void *)table->FreeMemory;
-    if (!strcmp(name, "MapMemory")) return (void *)table->MapMemory;
-    if (!strcmp(name, "UnmapMemory")) return (void *)table->UnmapMemory;
-    if (!strcmp(name, "FlushMappedMemoryRanges")) return (void *)table->FlushMappedMemoryRanges;
-    if (!strcmp(name, "InvalidateMappedMemoryRanges")) return (void *)table->InvalidateMappedMemoryRanges;
-    if (!strcmp(name, "GetDeviceMemoryCommitment")) return (void *)table->GetDeviceMemoryCommitment;
-    if (!strcmp(name, "BindBufferMemory")) return (void *)table->BindBufferMemory;
-    if (!strcmp(name, "BindImageMemory")) return (void *)table->BindImageMemory;
-    if (!strcmp(name, "GetBufferMemoryRequirements")) return (void *)table->GetBufferMemoryRequirements;
-    if (!strcmp(name, "GetImageMemoryRequirements")) return (void *)table->GetImageMemoryRequirements;
-    if (!strcmp(name, "GetImageSparseMemoryRequirements")) return (void *)table->GetImageSparseMemoryRequirements;
-    if (!strcmp(name, "QueueBindSparse")) return (void *)table->QueueBindSparse;
-    if (!strcmp(name, "CreateFence")) return (void *)table->CreateFence;
-    if (!strcmp(name, "DestroyFence")) return (void *)table->DestroyFence;
-    if (!strcmp(name, "ResetFences")) return (void *)table->ResetFences;
-    if (!strcmp(name, "GetFenceStatus")) return (void *)table->GetFenceStatus;
-    if (!strcmp(name, "WaitForFences")) return (void *)table->WaitForFences;
-    if (!strcmp(name, "CreateSemaphore")) return (void *)table->CreateSemaphore;
-    if (!strcmp(name, "DestroySemaphore")) return (void *)table->DestroySemaphore;
-    if (!strcmp(name, "CreateEvent")) return (void *)table->CreateEvent;
-    if (!strcmp(name, "DestroyEvent")) return (void *)table->DestroyEvent;
-    if (!strcmp(name, "GetEventStatus")) return (void *)table->GetEventStatus;
-    if (!strcmp(name, "SetEvent")) return (void *)table->SetEvent;
-    if (!strcmp(name, "ResetEvent")) return (void *)table->ResetEvent;
-    if (!strcmp(name, "CreateQueryPool")) return (void *)table->CreateQueryPool;
-    if (!strcmp(name, "DestroyQueryPool")) return (void *)table->DestroyQueryPool;
-    if (!strcmp(name, "GetQueryPoolResults")) return (void *)table->GetQueryPoolResults;
-    if (!strcmp(name, "CreateBuffer")) return (void *)table->CreateBuffer;
-    if (!strcmp(name, "DestroyBuffer")) return (void *)table->DestroyBuffer;
-    if (!strcmp(name, "CreateBufferView")) return (void *)table->CreateBufferView;
-    if (!strcmp(name, "DestroyBufferView")) return (void *)table->DestroyBufferView;
-    if (!strcmp(name, "CreateImage")) return (void *)table->CreateImage;
-    if (!strcmp(name, "DestroyImage")) return (void *)table->DestroyImage;
-    if (!strcmp(name, "GetImageSubresourceLayout")) return (void *)table->GetImageSubresourceLayout;
-    if (!strcmp(name, "CreateImageView")) return (void *)table->CreateImageView;
-    if (!strcmp(name, "DestroyImageView")) return (void *)table->DestroyImageView;
-    if (!strcmp(name, "CreateShaderModule")) return (void *)table->CreateShaderModule;
-    if (!strcmp(name, "DestroyShaderModule")) return (void *)table->DestroyShaderModule;
-    if (!strcmp(name, "CreatePipelineCache")) return (void *)table->CreatePipelineCache;
-    if (!strcmp(name, "DestroyPipelineCache")) return (void *)table->DestroyPipelineCache;
-    if (!strcmp(name, "GetPipelineCacheData")) return (void *)table->GetPipelineCacheData;
-    if (!strcmp(name, "MergePipelineCaches")) return (void *)table->MergePipelineCaches;
-    if (!strcmp(name, "CreateGraphicsPipelines")) return (void *)table->CreateGraphicsPipelines;
-    if (!strcmp(name, "CreateComputePipelines")) return (void *)table->CreateComputePipelines;
-    if (!strcmp(name, "DestroyPipeline")) return (void *)table->DestroyPipeline;
-    if (!strcmp(name, "CreatePipelineLayout")) return (void *)table->CreatePipelineLayout;
-    if (!strcmp(name, "DestroyPipelineLayout")) return (void *)table->DestroyPipelineLayout;
-    if (!strcmp(name, "CreateSampler")) return (void *)table->CreateSampler;
-    if (!strcmp(name, "DestroySampler")) return (void *)table->DestroySampler;
-    if (!strcmp(name, "CreateDescriptorSetLayout")) return (void *)table->CreateDescriptorSetLayout;
-    if (!strcmp(name, "DestroyDescriptorSetLayout")) return (void *)table->DestroyDescriptorSetLayout;
-    if (!strcmp(name, "CreateDescriptorPool")) return (void *)table->CreateDescriptorPool;
-    if (!strcmp(name, "DestroyDescriptorPool")) return (void *)table->DestroyDescriptorPool;
-    if (!strcmp(name, "ResetDescriptorPool")) return (void *)table->ResetDescriptorPool;
-    if (!strcmp(name, "AllocateDescriptorSets")) return (void *)table->AllocateDescriptorSets;
-    if (!strcmp(name, "FreeDescriptorSets")) return (void *)table->FreeDescriptorSets;
-    if (!strcmp(name, "UpdateDescriptorSets")) return (void *)table->UpdateDescriptorSets;
-    if (!strcmp(name, "CreateFramebuffer")) return (void *)table->CreateFramebuffer;
-    if (!strcmp(name, "DestroyFramebuffer")) return (void *)table->DestroyFramebuffer;
-    if (!strcmp(name, "CreateRenderPass")) return (void *)table->CreateRenderPass;
-    if (!strcmp(name, "DestroyRenderPass")) return (void *)table->DestroyRenderPass;
-    if (!strcmp(name, "GetRenderAreaGranularity")) return (void *)table->GetRenderAreaGranularity;
-    if (!strcmp(name, "CreateCommandPool")) return (void *)table->CreateCommandPool;
-    if (!strcmp(name, "DestroyCommandPool")) return (void *)table->DestroyCommandPool;
-    if (!strcmp(name, "ResetCommandPool")) return (void *)table->ResetCommandPool;
-    if (!strcmp(name, "AllocateCommandBuffers")) return (void *)table->AllocateCommandBuffers;
-    if (!strcmp(name, "FreeCommandBuffers")) return (void *)table->FreeCommandBuffers;
-    if (!strcmp(name, "BeginCommandBuffer")) return (void *)table->BeginCommandBuffer;
-    if (!strcmp(name, "EndCommandBuffer")) return (void *)table->EndCommandBuffer;
-    if (!strcmp(name, "ResetCommandBuffer")) return (void *)table->ResetCommandBuffer;
-    if (!strcmp(name, "CmdBindPipeline")) return (void *)table->CmdBindPipeline;
-    if (!strcmp(name, "CmdSetViewport")) return (void *)table->CmdSetViewport;
-    if (!strcmp(name, "CmdSetScissor")) return (void *)table->CmdSetScissor;
-    if (!strcmp(name, "CmdSetLineWidth")) return (void *)table->CmdSetLineWidth;
-    if (!strcmp(name, "CmdSetDepthBias")) return (void *)table->CmdSetDepthBias;
-    if (!strcmp(name, "CmdSetBlendConstants")) return (void *)table->CmdSetBlendConstants;
-    if (!strcmp(name, "CmdSetDepthBounds")) return (void *)table->CmdSetDepthBounds;
-    if (!strcmp(name, "CmdSetStencilCompareMask")) return (void *)table->CmdSetStencilCompareMask;
-    if (!strcmp(name, "CmdSetStencilWriteMask")) return (void *)table->CmdSetStencilWriteMask;
-    if (!strcmp(name, "CmdSetStencilReference")) return (void *)table->CmdSetStencilReference;
-    if (!strcmp(name, "CmdBindDescriptorSets")) return (void *)table->CmdBindDescriptorSets;
-    if (!strcmp(name, "CmdBindIndexBuffer")) return (void *)table->CmdBindIndexBuffer;
-    if (!strcmp(name, "CmdBindVertexBuffers")) return (void *)table->CmdBindVertexBuffers;
-    if (!strcmp(name, "CmdDraw")) return (void *)table->CmdDraw;
-    if (!strcmp(name, "CmdDrawIndexed")) return (void *)table->CmdDrawIndexed;
-    if (!strcmp(name, "CmdDrawIndirect")) return (void *)table->CmdDrawIndirect;
-    if (!strcmp(name, "CmdDrawIndexedIndirect")) return (void *)table->CmdDrawIndexedIndirect;
-    if (!strcmp(name, "CmdDispatch")) return (void *)table->CmdDispatch;
-    if (!strcmp(name, "CmdDispatchIndirect")) return (void *)table->CmdDispatchIndirect;
-    if (!strcmp(name, "CmdCopyBuffer")) return (void *)table->CmdCopyBuffer;
-    if (!strcmp(name, "CmdCopyImage")) return (void *)table->CmdCopyImage;
-    if (!strcmp(name, "CmdBlitImage")) return (void *)table->CmdBlitImage;
-    if (!strcmp(name, "CmdCopyBufferToImage")) return (void *)table->CmdCopyBufferToImage;
-    if (!strcmp(name, "CmdCopyImageToBuffer")) return (void *)table->CmdCopyImageToBuffer;
-    if (!strcmp(name, "CmdUpdateBuffer")) return (void *)table->CmdUpdateBuffer;
-    if (!strcmp(name, "CmdFillBuffer")) return (void *)table->CmdFillBuffer;
-    if (!strcmp(name, "CmdClearColorImage")) return (void *)table->CmdClearColorImage;
-    if (!strcmp(name, "CmdClearDepthStencilImage")) return (void *)table->CmdClearDepthStencilImage;
-    if (!strcmp(name, "CmdClearAttachments")) return (void *)table->CmdClearAttachments;
-    if (!strcmp(name, "CmdResolveImage")) return (void *)table->CmdResolveImage;
-    if (!strcmp(name, "CmdSetEvent")) return (void *)table->CmdSetEvent;
-    if (!strcmp(name, "CmdResetEvent")) return (void *)table->CmdResetEvent;
-    if (!strcmp(name, "CmdWaitEvents")) return (void *)table->CmdWaitEvents;
-    if (!strcmp(name, "CmdPipelineBarrier")) return (void *)table->CmdPipelineBarrier;
-    if (!strcmp(name, "CmdBeginQuery")) return (void *)table->CmdBeginQuery;
-    if (!strcmp(name, "CmdEndQuery")) return (void *)table->CmdEndQuery;
-    if (!strcmp(name, "CmdResetQueryPool")) return (void *)table->CmdResetQueryPool;
-    if (!strcmp(name, "CmdWriteTimestamp")) return (void *)table->CmdWriteTimestamp;
-    if (!strcmp(name, "CmdCopyQueryPoolResults")) return (void *)table->CmdCopyQueryPoolResults;
-    if (!strcmp(name, "CmdPushConstants")) return (void *)table->CmdPushConstants;
-    if (!strcmp(name, "CmdBeginRenderPass")) return (void *)table->CmdBeginRenderPass;
-    if (!strcmp(name, "CmdNextSubpass")) return (void *)table->CmdNextSubpass;
-    if (!strcmp(name, "CmdEndRenderPass")) return (void *)table->CmdEndRenderPass;
-    if (!strcmp(name, "CmdExecuteCommands")) return (void *)table->CmdExecuteCommands;
-
-    // ---- Core 1_1 commands
-    if (!strcmp(name, "BindBufferMemory2")) return (void *)table->BindBufferMemory2;
-    if (!strcmp(name, "BindImageMemory2")) return (void *)table->BindImageMemory2;
-    if (!strcmp(name, "GetDeviceGroupPeerMemoryFeatures")) return (void *)table->GetDeviceGroupPeerMemoryFeatures;
-    if (!strcmp(name, "CmdSetDeviceMask")) return (void *)table->CmdSetDeviceMask;
-    if (!strcmp(name, "CmdDispatchBase")) return (void *)table->CmdDispatchBase;
-    if (!strcmp(name, "GetImageMemoryRequirements2")) return (void *)table->GetImageMemoryRequirements2;
-    if (!strcmp(name, "GetBufferMemoryRequirements2")) return (void *)table->GetBufferMemoryRequirements2;
-    if (!strcmp(name, "GetImageSparseMemoryRequirements2")) return (void *)table->GetImageSparseMemoryRequirements2;
-    if (!strcmp(name, "TrimCommandPool")) return (void *)table->TrimCommandPool;
-    if (!strcmp(name, "GetDeviceQueue2")) return (void *)table->GetDeviceQueue2;
-    if (!strcmp(name, "CreateSamplerYcbcrConversion")) return (void *)table->CreateSamplerYcbcrConversion;
-    if (!strcmp(name, "DestroySamplerYcbcrConversion")) return (void *)table->DestroySamplerYcbcrConversion;
-    if (!strcmp(name, "CreateDescriptorUpdateTemplate")) return (void *)table->CreateDescriptorUpdateTemplate;
-    if (!strcmp(name, "DestroyDescriptorUpdateTemplate")) return (void *)table->DestroyDescriptorUpdateTemplate;
-    if (!strcmp(name, "UpdateDescriptorSetWithTemplate")) return (void *)table->UpdateDescriptorSetWithTemplate;
-    if (!strcmp(name, "GetDescriptorSetLayoutSupport")) return (void *)table->GetDescriptorSetLayoutSupport;
+// Hashes used to look up commands by name, see BuildCommandNameHash in loader_extension_generator.py
+static uint32_t loader_command_name_hash(const char *name) {
+    uint32_t hash = 2166136261u;
+    for (; *name != '\0'; name++) {
+        hash ^= (uint8_t)*name;
+        hash *= 16777619u;
+    }
+    return hash;
+}
 
-    // ---- Core 1_2 commands
-    if (!strcmp(name, "CmdDrawIndirectCount")) return (void *)table->CmdDrawIndirectCount;
-    if (!strcmp(name, "CmdDrawIndexedIndirectCount")) return (void *)table->CmdDrawIndexedIndirectCount;
-    if (!strcmp(name, "CreateRenderPass2")) return (void *)table->CreateRenderPass2;
-    if (!strcmp(name, "CmdBeginRenderPass2")) return (void *)table->CmdBeginRenderPass2;
-    if (!strcmp(name, "CmdNextSubpass2")) return (void *)table->CmdNextSubpass2;
-    if (!strcmp(name, "CmdEndRenderPass2")) return (void *)table->CmdEndRenderPass2;
-    if (!strcmp(name, "ResetQueryPool")) return (void *)table->ResetQueryPool;
-    if (!strcmp(name, "GetSemaphoreCounterValue")) return (void *)table->GetSemaphoreCounterValue;
-    if (!strcmp(name, "WaitSemaphores")) return (void *)table->WaitSemaphores;
-    if (!strcmp(name, "SignalSemaphore")) return (void *)table->SignalSemaphore;
-    if (!strcmp(name, "GetBufferDeviceAddress")) return (void *)table->GetBufferDeviceAddress;
-    if (!strcmp(name, "GetBufferOpaqueCaptureAddress")) return (void *)table->GetBufferOpaqueCaptureAddress;
-    if (!strcmp(name, "GetDeviceMemoryOpaqueCaptureAddress")) return (void *)table->GetDeviceMemoryOpaqueCaptureAddress;
+static uint32_t loader_command_name_mix(uint32_t hash, uint32_t seed) {
+    hash ^= seed;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash;
+}
 
-    // ---- Core 1_3 commands
-    if (!strcmp(name, "CreatePrivateDataSlot")) return (void *)table->CreatePrivateDataSlot;
-    if (!strcmp(name, "DestroyPrivateDataSlot")) return (void *)table->DestroyPrivateDataSlot;
-    if (!strcmp(name, "SetPrivateData")) return (void *)table->SetPrivateData;
-    if (!strcmp(name, "GetPrivateData")) return (void *)table->GetPrivateData;
-    if (!strcmp(name, "CmdSetEvent2")) return (void *)table->CmdSetEvent2;
-    if (!strcmp(name, "CmdResetEvent2")) return (void *)table->CmdResetEvent2;
-    if (!strcmp(name, "CmdWaitEvents2")) return (void *)table->CmdWaitEvents2;
-    if (!strcmp(name, "CmdPipelineBarrier2")) return (void *)table->CmdPipelineBarrier2;
-    if (!strcmp(name, "CmdWriteTimestamp2")) return (void *)table->CmdWriteTimestamp2;
-    if (!strcmp(name, "QueueSubmit2")) return (void *)table->QueueSubmit2;
-    if (!strcmp(name, "CmdCopyBuffer2")) return (void *)table->CmdCopyBuffer2;
-    if (!strcmp(name, "CmdCopyImage2")) return (void *)table->CmdCopyImage2;
-    if (!strcmp(name, "CmdCopyBufferToImage2")) return (void *)table->CmdCopyBufferToImage2;
-    if (!strcmp(name, "CmdCopyImageToBuffer2")) return (void *)table->CmdCopyImageToBuffer2;
-    if (!strcmp(name, "CmdBlitImage2")) return (void *)table->CmdBlitImage2;
-    if (!strcmp(name, "CmdResolveImage2")) return (void *)table->CmdResolveImage2;
-    if (!strcmp(name, "CmdBeginRendering")) return (void *)table->CmdBeginRendering;
-    if (!strcmp(name, "CmdEndRendering")) return (void *)table->CmdEndRendering;
-    if (!strcmp(name, "CmdSetCullMode")) return (void *)table->CmdSetCullMode;
-    if (!strcmp(name, "CmdSetFrontFace")) return (void *)table->CmdSetFrontFace;
-    if (!strcmp(name, "CmdSetPrimitiveTopology")) return (void *)table->CmdSetPrimitiveTopology;
-    if (!strcmp(name, "CmdSetViewportWithCount")) return (void *)table->CmdSetViewportWithCount;
-    if (!strcmp(name, "CmdSetScissorWithCount")) return (void *)table->CmdSetScissorWithCount;
-    if (!strcmp(name, "CmdBindVertexBuffers2")) return (void *)table->CmdBindVertexBuffers2;
-    if (!strcmp(name, "CmdSetDepthTestEnable")) return (void *)table->CmdSetDepthTestEnable;
-    if (!strcmp(name, "CmdSetDepthWriteEnable")) return (void *)table->CmdSetDepthWriteEnable;
-    if (!strcmp(name, "CmdSetDepthCompareOp")) return (void *)table->CmdSetDepthCompareOp;
-    if (!strcmp(name, "CmdSetDepthBoundsTestEnable")) return (void *)table->CmdSetDepthBoundsTestEnable;
-    if (!strcmp(name, "CmdSetStencilTestEnable")) return (void *)table->CmdSetStencilTestEnable;
-    if (!strcmp(name, "CmdSetStencilOp")) return (void *)table->CmdSetStencilOp;
-    if (!strcmp(name, "CmdSetRasterizerDiscardEnable")) return (void *)table->CmdSetRasterizerDiscardEnable;
-    if (!strcmp(name, "CmdSetDepthBiasEnable")) return (void *)table->CmdSetDepthBiasEnable;
-    if (!strcmp(name, "CmdSetPrimitiveRestartEnable")) return (void *)table->CmdSetPrimitiveRestartEnable;
-    if (!strcmp(name, "GetDeviceBufferMemoryRequirements")) return (void *)table->GetDeviceBufferMemoryRequirements;
-    if (!strcmp(name, "GetDeviceImageMemoryRequirements")) return (void *)table->GetDeviceImageMemoryRequirements;
-    if (!strcmp(name, "GetDeviceImageSparseMemoryRequirements")) return (void *)table->GetDeviceImageSparseMemoryRequirements;
+// Returns the only slot of a perfect hash table which could hold name
+static uint32_t loader_command_name_slot(const int32_t *seeds, uint32_t size, const char *name) {
+    uint32_t hash = loader_command_name_hash(name);
+    int32_t seed = seeds[loader_command_name_mix(hash, 0) % size];
+    if (seed < 0) return (uint32_t)(-seed - 1);
+    return loader_command_name_mix(hash, (uint32_t)seed) % size;
+}
 
-    // ---- VK_KHR_swapchain extension commands
-    if (!strcmp(name, "CreateSwapchainKHR")) return (void *)table->CreateSwapchainKHR;
-    if (!strcmp(name, "DestroySwapchainKHR")) return (void *)table->DestroySwapchainKHR;
-    if (!strcmp(name, "GetSwapchainImagesKHR")) return (void *)table->GetSwapchainImagesKHR;
-    if (!strcmp(name, "AcquireNextImageKHR")) return (void *)table->AcquireNextImageKHR;
-    if (!strcmp(name, "QueuePresentKHR")) return (void *)table->QueuePresentKHR;
-    if (!strcmp(name, "GetDeviceGroupPresentCapabilitiesKHR")) return (void *)table->GetDeviceGroupPresentCapabilitiesKHR;
-    if (!strcmp(name, "GetDeviceGroupSurfacePresentModesKHR")) return (void *)table->GetDeviceGroupSurfacePresentModesKHR;
-    if (!strcmp(name, "AcquireNextImage2KHR")) return (void *)table->AcquireNextImage2KHR;
+// Location of a command in a dispatch table, or a NULL name if the command isn't part of this build
+struct loader_dispatch_table_entry {
+    const char *name;
+    size_t offset;
+};
 
-    // ---- VK_KHR_display_swapchain extension commands
-    if (!strcmp(name, "CreateSharedSwapchainsKHR")) return (void *)table->CreateSharedSwapchainsKHR;
+// Device dispatch table members, in the order of their perfect hash
+static const int32_t device_dispatch_table_seeds[448] = {
+    1, 0, 0, 0, 0, 1, 0, 1, -1, 1, 0, 3,
+    -5, 0, 1, 0, 0, 3, 0, 0, -7, -13, 0, -14,
+    0, 1, -15, -18, 0, 2, 1, -19, 0, 0, -20, -22,
+    -24, -26, -27, -33, 0, -38, -41, -44, 1, -46, -48, -49,
+    0, 2, 1, 0, 2, 0, -51, -53, -57, -61, 3, 0,
+    -65, -69, 0, -71, -72, 1, 0, 1, -73, 0, 1, -74,
+    5, -77, -78, 0, -81, -82, 0, 1, -83, -86, 0, 0,
+    0, -88, 0, -94, -97, 3, 0, 1, 1, 1, -98, 0,
+    0, 2, -99, 0, 0, -102, -104, 1, 0, -106, 0, -110,
+    -114, 9, -115, 0, -119, 0, 1, 0, -121, -123, 1, 0,
+    -124, 2, 1, -125, 0, 0, 4, 0, -127, 0, 0, -128,
+    0, 0, 0, 0, 0, 0, -129, 1, 0, 0, -130, -135,
+    4, 5, 0, 0, 3, 0, -137, -139, 2, 0, 1, -140,
+    1, 0, -143, 0, -146, 1, 0, 0, -152, 1, -155, -158,
+    -160, -165, 3, -166, 2, 0, 2, -169, -170, -171, 1, -172,
+    2, 0, -175, -177, 0, -179, -181, 0, 0, -185, 0, 0,
+    -186, 0, -191, -193, 1, 0, -198, 7, -201, -202, 0, -204,
+    0, -207, 1, -210, -211, -215, 0, -219, 2, -221, 2, -222,
+    0, -223, 0, -225, -226, 0, 0, 0, 2, 0, 5, -227,
+    0, -232, 0, 0, 0, 0, 1, -236, 0, 1, 3, -238,
+    -242, 5, 0, -245, 1, -259, 0, 0, -261, 2, 3, 0,
+    -262, -264, -270, -271, 0, 0, -273, 0, -276, -277, -281, 1,
+    -282, 1, 0, -283, 8, -288, 5, 1, 2, -293, -295, 4,
+    1, -296, 0, -298, -302, 2, 5, 1, -306, 0, 0, 5,
+    0, 0, 3, -308, 0, 0, 0, -309, -311, 0, 0, -312,
+    1, -313, 0, 0, 15, -314, -317, -318, 0, -322, 0, -329,
+    1, -334, 3, 2, -335, -336, 0, 0, -337, 2, -338, -339,
+    -346, 1, 0, -350, 0, 5, -351, 10, -352, 0, 0, 10,
+    0, 7, 0, 2, 1, -358, 1, 8, 0, 4, -359, -361,
+    -362, 0, -364, -369, 0, -372, 0, 1, 3, 4, 0, 0,
+    0, 0, 1, 0, 0, 1, -375, -379, -380, 11, 0, 2,
+    -383, -389, -392, 2, -393, 17, 3, 0, 0, 0, 0, -396,
+    0, 1, -399, 2, 0, 0, 0, 0, -402, 0, 0, 7,
+    -410, 0, 0, -411, 0, -420, 0, 0, 0, -422, -426, 0,
+    0, -428, -430, 0, 0, -431, 1, 8, 0, 0, -432, 0,
+    7, 2, -433, 0, 0, 0, 1, 12, 0, -436, -437, -439,
+    -441, 5, -443, 0, 0, 15, 3, 2, -445, 0, 0, 1,
+    -446, 4, 3, -448,
+};
 
-    // ---- VK_KHR_video_queue extension commands
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CreateVideoSessionKHR")) return (void *)table->CreateVideoSessionKHR;
-#endif // VK_ENABLE_BETA_EXTENSIONS
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "DestroyVideoSessionKHR")) return (void *)table->DestroyVideoSessionKHR;
-#endif // VK_ENABLE_BETA_EXTENSIONS
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "GetVideoSessionMemoryRequirementsKHR")) return (void *)table->GetVideoSessionMemoryRequirementsKHR;
-#endif // VK_ENABLE_BETA_EXTENSIONS
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "BindVideoSessionMemoryKHR")) return (void *)table->BindVideoSessionMemoryKHR;
-#endif // VK_ENABLE_BETA_EXTENSIONS
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CreateVideoSessionParametersKHR")) return (void *)table->CreateVideoSessionParametersKHR;
-#endif // VK_ENABLE_BETA_EXTENSIONS
+static const struct loader_dispatch_table_entry device_dispatch_table_entries[448] = {
+    {"vkGetDeviceMemoryOpaqueCaptureAddress", offsetof(VkLayerDispatchTable, GetDeviceMemoryOpaqueCaptureAddress)},
+    {"vkCmdSetFragmentShadingRateEnumNV", offsetof(VkLayerDispatchTable, CmdSetFragmentShadingRateEnumNV)},
+    {"vkUninitializePerformanceApiINTEL", offsetof(VkLayerDispatchTable, UninitializePerformanceApiINTEL)},
+    {"vkCmdTraceRaysIndirectKHR", offsetof(VkLayerDispatchTable, CmdTraceRaysIndirectKHR)},
+    {"vkImportFenceFdKHR", offsetof(VkLayerDispatchTable, ImportFenceFdKHR)},
+    {"vkDestroySamplerYcbcrConversionKHR", offsetof(VkLayerDispatchTable, DestroySamplerYcbcrConversionKHR)},
+    {"vkCreateValidationCacheEXT", offsetof(VkLayerDispatchTable, CreateValidationCacheEXT)},
+    {"vkAcquireNextImageKHR", offsetof(VkLayerDispatchTable, AcquireNextImageKHR)},
+    {"vkCreateSwapchainKHR", offsetof(VkLayerDispatchTable, CreateSwapchainKHR)},
+    {"vkDestroyImageView", offsetof(VkLayerDispatchTable, DestroyImageView)},
+    {"vkQueueSubmit2KHR", offsetof(VkLayerDispatchTable, QueueSubmit2KHR)},
+    {"vkCreateRayTracingPipelinesKHR", offsetof(VkLayerDispatchTable, CreateRayTracingPipelinesKHR)},
+    {"vkGetBufferOpaqueCaptureAddressKHR", offsetof(VkLayerDispatchTable, GetBufferOpaqueCaptureAddressKHR)},
+    {"vkDestroyIndirectCommandsLayoutNV", offsetof(VkLayerDispatchTable, DestroyIndirectCommandsLayoutNV)},
+    {"vkFreeDescriptorSets", offsetof(VkLayerDispatchTable, FreeDescriptorSets)},
+    {"vkGetImageSparseMemoryRequirements", offsetof(VkLayerDispatchTable, GetImageSparseMemoryRequirements)},
+    {"vkGetGeneratedCommandsMemoryRequirementsNV", offsetof(VkLayerDispatchTable, GetGeneratedCommandsMemoryRequirementsNV)},
+    {"vkGetPipelinePropertiesEXT", offsetof(VkLayerDispatchTable, GetPipelinePropertiesEXT)},
+    {"vkCmdSetBlendConstants", offsetof(VkLayerDispatchTable, CmdSetBlendConstants)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "UpdateVideoSessionParametersKHR")) return (void *)table->UpdateVideoSessionParametersKHR;
+    {"vkBindVideoSessionMemoryKHR", offsetof(VkLayerDispatchTable, BindVideoSessionMemoryKHR)},
+#else
+    {NULL, 0},
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    {"vkCreateBufferView", offsetof(VkLayerDispatchTable, CreateBufferView)},
+    {"vkGetFramebufferTilePropertiesQCOM", offsetof(VkLayerDispatchTable, GetFramebufferTilePropertiesQCOM)},
+    {"vkGetDeviceImageMemoryRequirements", offsetof(VkLayerDispatchTable, GetDeviceImageMemoryRequirements)},
+    {"vkCmdSetCheckpointNV", offsetof(VkLayerDispatchTable, CmdSetCheckpointNV)},
+    {"vkCreateDescriptorSetLayout", offsetof(VkLayerDispatchTable, CreateDescriptorSetLayout)},
+    {"vkDestroyFramebuffer", offsetof(VkLayerDispatchTable, DestroyFramebuffer)},
+    {"vkWaitForFences", offsetof(VkLayerDispatchTable, WaitForFences)},
+    {"vkCmdDrawIndexedIndirectCountAMD", offsetof(VkLayerDispatchTable, CmdDrawIndexedIndirectCountAMD)},
+    {"vkDestroySamplerYcbcrConversion", offsetof(VkLayerDispatchTable, DestroySamplerYcbcrConversion)},
+    {"vkCmdSetDiscardRectangleEXT", offsetof(VkLayerDispatchTable, CmdSetDiscardRectangleEXT)},
+    {"vkGetImageDrmFormatModifierPropertiesEXT", offsetof(VkLayerDispatchTable, GetImageDrmFormatModifierPropertiesEXT)},
+    {"vkCmdBeginTransformFeedbackEXT", offsetof(VkLayerDispatchTable, CmdBeginTransformFeedbackEXT)},
+    {"vkTrimCommandPool", offsetof(VkLayerDispatchTable, TrimCommandPool)},
+    {"vkGetMemoryRemoteAddressNV", offsetof(VkLayerDispatchTable, GetMemoryRemoteAddressNV)},
+    {"vkGetBufferDeviceAddressKHR", offsetof(VkLayerDispatchTable, GetBufferDeviceAddressKHR)},
+    {"vkCmdSetEvent2", offsetof(VkLayerDispatchTable, CmdSetEvent2)},
+    {"vkCmdSetStencilTestEnableEXT", offsetof(VkLayerDispatchTable, CmdSetStencilTestEnableEXT)},
+    {"vkCmdBindPipeline", offsetof(VkLayerDispatchTable, CmdBindPipeline)},
+    {"vkGetImageMemoryRequirements", offsetof(VkLayerDispatchTable, GetImageMemoryRequirements)},
+    {"vkDestroySwapchainKHR", offsetof(VkLayerDispatchTable, DestroySwapchainKHR)},
+    {"vkCmdSetDepthBias", offsetof(VkLayerDispatchTable, CmdSetDepthBias)},
+    {"vkSetLocalDimmingAMD", offsetof(VkLayerDispatchTable, SetLocalDimmingAMD)},
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    {"vkGetMemoryAndroidHardwareBufferANDROID", offsetof(VkLayerDispatchTable, GetMemoryAndroidHardwareBufferANDROID)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_ANDROID_KHR
+    {"vkCmdSetRasterizerDiscardEnableEXT", offsetof(VkLayerDispatchTable, CmdSetRasterizerDiscardEnableEXT)},
+    {"vkQueueWaitIdle", offsetof(VkLayerDispatchTable, QueueWaitIdle)},
+    {"vkGetDeviceQueue2", offsetof(VkLayerDispatchTable, GetDeviceQueue2)},
+    {"vkCmdCopyAccelerationStructureKHR", offsetof(VkLayerDispatchTable, CmdCopyAccelerationStructureKHR)},
+    {"vkCreateCommandPool", offsetof(VkLayerDispatchTable, CreateCommandPool)},
+    {"vkCmdPushConstants", offsetof(VkLayerDispatchTable, CmdPushConstants)},
+    {"vkDestroySampler", offsetof(VkLayerDispatchTable, DestroySampler)},
+    {"vkCmdCopyAccelerationStructureToMemoryKHR", offsetof(VkLayerDispatchTable, CmdCopyAccelerationStructureToMemoryKHR)},
+    {"vkCmdWaitEvents2KHR", offsetof(VkLayerDispatchTable, CmdWaitEvents2KHR)},
+    {"vkGetRefreshCycleDurationGOOGLE", offsetof(VkLayerDispatchTable, GetRefreshCycleDurationGOOGLE)},
+    {"vkCmdSetFrontFace", offsetof(VkLayerDispatchTable, CmdSetFrontFace)},
+    {"vkBindImageMemory", offsetof(VkLayerDispatchTable, BindImageMemory)},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkReleaseFullScreenExclusiveModeEXT", offsetof(VkLayerDispatchTable, ReleaseFullScreenExclusiveModeEXT)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetDeferredOperationResultKHR", offsetof(VkLayerDispatchTable, GetDeferredOperationResultKHR)},
+    {"vkGetPipelineExecutablePropertiesKHR", offsetof(VkLayerDispatchTable, GetPipelineExecutablePropertiesKHR)},
+    {"vkCmdEndRendering", offsetof(VkLayerDispatchTable, CmdEndRendering)},
+    {"vkSetHdrMetadataEXT", offsetof(VkLayerDispatchTable, SetHdrMetadataEXT)},
+    {"vkGetBufferMemoryRequirements2KHR", offsetof(VkLayerDispatchTable, GetBufferMemoryRequirements2KHR)},
+    {"vkCmdWriteAccelerationStructuresPropertiesNV", offsetof(VkLayerDispatchTable, CmdWriteAccelerationStructuresPropertiesNV)},
+    {"vkBuildAccelerationStructuresKHR", offsetof(VkLayerDispatchTable, BuildAccelerationStructuresKHR)},
+    {"vkGetRenderAreaGranularity", offsetof(VkLayerDispatchTable, GetRenderAreaGranularity)},
+    {"vkCmdBindIndexBuffer", offsetof(VkLayerDispatchTable, CmdBindIndexBuffer)},
+#ifdef VK_USE_PLATFORM_METAL_EXT
+    {"vkExportMetalObjectsEXT", offsetof(VkLayerDispatchTable, ExportMetalObjectsEXT)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_METAL_EXT
+    {"vkDestroyPipeline", offsetof(VkLayerDispatchTable, DestroyPipeline)},
+    {"vkCmdDebugMarkerBeginEXT", offsetof(VkLayerDispatchTable, CmdDebugMarkerBeginEXT)},
+    {"vkCmdInsertDebugUtilsLabelEXT", offsetof(VkLayerDispatchTable, CmdInsertDebugUtilsLabelEXT)},
+    {"vkCmdSetScissorWithCount", offsetof(VkLayerDispatchTable, CmdSetScissorWithCount)},
+    {"vkCmdCopyBufferToImage2", offsetof(VkLayerDispatchTable, CmdCopyBufferToImage2)},
+    {"vkResetFences", offsetof(VkLayerDispatchTable, ResetFences)},
+    {"vkCreateImageView", offsetof(VkLayerDispatchTable, CreateImageView)},
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {"vkImportSemaphoreZirconHandleFUCHSIA", offsetof(VkLayerDispatchTable, ImportSemaphoreZirconHandleFUCHSIA)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_FUCHSIA
+    {"vkGetDeviceGroupSurfacePresentModesKHR", offsetof(VkLayerDispatchTable, GetDeviceGroupSurfacePresentModesKHR)},
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {"vkGetBufferCollectionPropertiesFUCHSIA", offsetof(VkLayerDispatchTable, GetBufferCollectionPropertiesFUCHSIA)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_FUCHSIA
+    {"vkCopyAccelerationStructureToMemoryKHR", offsetof(VkLayerDispatchTable, CopyAccelerationStructureToMemoryKHR)},
+    {"vkCreateQueryPool", offsetof(VkLayerDispatchTable, CreateQueryPool)},
+    {"vkGetPerformanceParameterINTEL", offsetof(VkLayerDispatchTable, GetPerformanceParameterINTEL)},
+    {"vkGetDeviceQueue", offsetof(VkLayerDispatchTable, GetDeviceQueue)},
+    {"vkGetBufferMemoryRequirements", offsetof(VkLayerDispatchTable, GetBufferMemoryRequirements)},
+    {"vkGetRayTracingCaptureReplayShaderGroupHandlesKHR", offsetof(VkLayerDispatchTable, GetRayTracingCaptureReplayShaderGroupHandlesKHR)},
+    {"vkGetPrivateData", offsetof(VkLayerDispatchTable, GetPrivateData)},
+    {"vkCmdBindInvocationMaskHUAWEI", offsetof(VkLayerDispatchTable, CmdBindInvocationMaskHUAWEI)},
+    {"vkUpdateDescriptorSetWithTemplateKHR", offsetof(VkLayerDispatchTable, UpdateDescriptorSetWithTemplateKHR)},
+    {"vkBindAccelerationStructureMemoryNV", offsetof(VkLayerDispatchTable, BindAccelerationStructureMemoryNV)},
+    {"vkGetImageSubresourceLayout", offsetof(VkLayerDispatchTable, GetImageSubresourceLayout)},
+    {"vkDestroyEvent", offsetof(VkLayerDispatchTable, DestroyEvent)},
+    {"vkUpdateDescriptorSetWithTemplate", offsetof(VkLayerDispatchTable, UpdateDescriptorSetWithTemplate)},
+    {"vkCmdEndRenderPass2", offsetof(VkLayerDispatchTable, CmdEndRenderPass2)},
+    {"vkCmdPipelineBarrier", offsetof(VkLayerDispatchTable, CmdPipelineBarrier)},
+    {"vkGetAccelerationStructureMemoryRequirementsNV", offsetof(VkLayerDispatchTable, GetAccelerationStructureMemoryRequirementsNV)},
+    {"vkDestroyPrivateDataSlot", offsetof(VkLayerDispatchTable, DestroyPrivateDataSlot)},
+    {"vkCmdSetPrimitiveTopology", offsetof(VkLayerDispatchTable, CmdSetPrimitiveTopology)},
+    {"vkCreateComputePipelines", offsetof(VkLayerDispatchTable, CreateComputePipelines)},
+    {"vkDestroyShaderModule", offsetof(VkLayerDispatchTable, DestroyShaderModule)},
+    {"vkReleasePerformanceConfigurationINTEL", offsetof(VkLayerDispatchTable, ReleasePerformanceConfigurationINTEL)},
+    {"vkCreateSampler", offsetof(VkLayerDispatchTable, CreateSampler)},
+    {"vkBeginCommandBuffer", offsetof(VkLayerDispatchTable, BeginCommandBuffer)},
+    {"vkCreateDescriptorUpdateTemplate", offsetof(VkLayerDispatchTable, CreateDescriptorUpdateTemplate)},
+    {"vkAcquirePerformanceConfigurationINTEL", offsetof(VkLayerDispatchTable, AcquirePerformanceConfigurationINTEL)},
+    {"vkGetSwapchainStatusKHR", offsetof(VkLayerDispatchTable, GetSwapchainStatusKHR)},
+    {"vkCmdResolveImage2KHR", offsetof(VkLayerDispatchTable, CmdResolveImage2KHR)},
+    {"vkCmdExecuteGeneratedCommandsNV", offsetof(VkLayerDispatchTable, CmdExecuteGeneratedCommandsNV)},
+    {"vkCmdBeginRenderPass2KHR", offsetof(VkLayerDispatchTable, CmdBeginRenderPass2KHR)},
+    {"vkGetDeviceGroupPeerMemoryFeaturesKHR", offsetof(VkLayerDispatchTable, GetDeviceGroupPeerMemoryFeaturesKHR)},
+    {"vkGetSemaphoreCounterValueKHR", offsetof(VkLayerDispatchTable, GetSemaphoreCounterValueKHR)},
+    {"vkCmdDrawIndirectCountAMD", offsetof(VkLayerDispatchTable, CmdDrawIndirectCountAMD)},
+    {"vkGetQueueCheckpointData2NV", offsetof(VkLayerDispatchTable, GetQueueCheckpointData2NV)},
+    {"vkCmdDrawMeshTasksIndirectCountNV", offsetof(VkLayerDispatchTable, CmdDrawMeshTasksIndirectCountNV)},
+    {"vkCmdCopyImage2KHR", offsetof(VkLayerDispatchTable, CmdCopyImage2KHR)},
+    {"vkGetValidationCacheDataEXT", offsetof(VkLayerDispatchTable, GetValidationCacheDataEXT)},
+    {"vkCmdDrawIndexedIndirectCountKHR", offsetof(VkLayerDispatchTable, CmdDrawIndexedIndirectCountKHR)},
+    {"vkCmdPushDescriptorSetWithTemplateKHR", offsetof(VkLayerDispatchTable, CmdPushDescriptorSetWithTemplateKHR)},
+    {"vkGetDescriptorSetLayoutHostMappingInfoVALVE", offsetof(VkLayerDispatchTable, GetDescriptorSetLayoutHostMappingInfoVALVE)},
+    {"vkDestroyDescriptorPool", offsetof(VkLayerDispatchTable, DestroyDescriptorPool)},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetDeviceGroupSurfacePresentModes2EXT", offsetof(VkLayerDispatchTable, GetDeviceGroupSurfacePresentModes2EXT)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {"vkCmdCopyAccelerationStructureNV", offsetof(VkLayerDispatchTable, CmdCopyAccelerationStructureNV)},
+    {"vkCmdDispatchBase", offsetof(VkLayerDispatchTable, CmdDispatchBase)},
+    {"vkGetDescriptorSetLayoutSupportKHR", offsetof(VkLayerDispatchTable, GetDescriptorSetLayoutSupportKHR)},
+    {"vkCmdSetViewport", offsetof(VkLayerDispatchTable, CmdSetViewport)},
+    {"vkCreateCuModuleNVX", offsetof(VkLayerDispatchTable, CreateCuModuleNVX)},
+    {"vkCreateFramebuffer", offsetof(VkLayerDispatchTable, CreateFramebuffer)},
+    {"vkDestroyBuffer", offsetof(VkLayerDispatchTable, DestroyBuffer)},
+    {"vkGetDeviceProcAddr", offsetof(VkLayerDispatchTable, GetDeviceProcAddr)},
+    {"vkCmdSetFrontFaceEXT", offsetof(VkLayerDispatchTable, CmdSetFrontFaceEXT)},
+    {"vkQueueBeginDebugUtilsLabelEXT", offsetof(VkLayerDispatchTable, QueueBeginDebugUtilsLabelEXT)},
+    {"vkCmdSetViewportWScalingNV", offsetof(VkLayerDispatchTable, CmdSetViewportWScalingNV)},
+    {"vkGetEventStatus", offsetof(VkLayerDispatchTable, GetEventStatus)},
+    {"vkDestroyValidationCacheEXT", offsetof(VkLayerDispatchTable, DestroyValidationCacheEXT)},
+    {"vkCmdNextSubpass2", offsetof(VkLayerDispatchTable, CmdNextSubpass2)},
+    {"vkGetImageSparseMemoryRequirements2KHR", offsetof(VkLayerDispatchTable, GetImageSparseMemoryRequirements2KHR)},
+    {"vkBindBufferMemory2", offsetof(VkLayerDispatchTable, BindBufferMemory2)},
+    {"vkGetPastPresentationTimingGOOGLE", offsetof(VkLayerDispatchTable, GetPastPresentationTimingGOOGLE)},
+    {"vkCmdSetPrimitiveRestartEnableEXT", offsetof(VkLayerDispatchTable, CmdSetPrimitiveRestartEnableEXT)},
+    {"vkDestroyDevice", offsetof(VkLayerDispatchTable, DestroyDevice)},
+    {"vkCmdSetDepthBounds", offsetof(VkLayerDispatchTable, CmdSetDepthBounds)},
+    {"vkGetMemoryFdKHR", offsetof(VkLayerDispatchTable, GetMemoryFdKHR)},
+    {"vkResetCommandBuffer", offsetof(VkLayerDispatchTable, ResetCommandBuffer)},
+    {"vkGetAccelerationStructureBuildSizesKHR", offsetof(VkLayerDispatchTable, GetAccelerationStructureBuildSizesKHR)},
+    {"vkCmdWriteBufferMarker2AMD", offsetof(VkLayerDispatchTable, CmdWriteBufferMarker2AMD)},
+    {"vkQueuePresentKHR", offsetof(VkLayerDispatchTable, QueuePresentKHR)},
+    {"vkCreateDeferredOperationKHR", offsetof(VkLayerDispatchTable, CreateDeferredOperationKHR)},
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {"vkGetSemaphoreZirconHandleFUCHSIA", offsetof(VkLayerDispatchTable, GetSemaphoreZirconHandleFUCHSIA)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_FUCHSIA
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {"vkGetMemoryZirconHandlePropertiesFUCHSIA", offsetof(VkLayerDispatchTable, GetMemoryZirconHandlePropertiesFUCHSIA)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_FUCHSIA
+    {"vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI", offsetof(VkLayerDispatchTable, GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI)},
+    {"vkGetDeviceMemoryCommitment", offsetof(VkLayerDispatchTable, GetDeviceMemoryCommitment)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "DestroyVideoSessionParametersKHR")) return (void *)table->DestroyVideoSessionParametersKHR;
+    {"vkGetVideoSessionMemoryRequirementsKHR", offsetof(VkLayerDispatchTable, GetVideoSessionMemoryRequirementsKHR)},
+#else
+    {NULL, 0},
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    {"vkGetImageMemoryRequirements2KHR", offsetof(VkLayerDispatchTable, GetImageMemoryRequirements2KHR)},
+    {"vkSetDebugUtilsObjectTagEXT", offsetof(VkLayerDispatchTable, SetDebugUtilsObjectTagEXT)},
+    {"vkDestroyDeferredOperationKHR", offsetof(VkLayerDispatchTable, DestroyDeferredOperationKHR)},
+    {"vkAllocateCommandBuffers", offsetof(VkLayerDispatchTable, AllocateCommandBuffers)},
+    {"vkGetPrivateDataEXT", offsetof(VkLayerDispatchTable, GetPrivateDataEXT)},
+    {"vkCmdSetDepthWriteEnableEXT", offsetof(VkLayerDispatchTable, CmdSetDepthWriteEnableEXT)},
+    {"vkAcquireNextImage2KHR", offsetof(VkLayerDispatchTable, AcquireNextImage2KHR)},
+    {"vkCreateImage", offsetof(VkLayerDispatchTable, CreateImage)},
+    {"vkCmdBindShadingRateImageNV", offsetof(VkLayerDispatchTable, CmdBindShadingRateImageNV)},
+    {"vkGetDeviceBufferMemoryRequirements", offsetof(VkLayerDispatchTable, GetDeviceBufferMemoryRequirements)},
+    {"vkGetDeviceGroupPresentCapabilitiesKHR", offsetof(VkLayerDispatchTable, GetDeviceGroupPresentCapabilitiesKHR)},
+    {"vkGetDeviceBufferMemoryRequirementsKHR", offsetof(VkLayerDispatchTable, GetDeviceBufferMemoryRequirementsKHR)},
+    {"vkCmdResetEvent", offsetof(VkLayerDispatchTable, CmdResetEvent)},
+    {"vkCmdDrawIndirectCount", offsetof(VkLayerDispatchTable, CmdDrawIndirectCount)},
+    {"vkCmdSetStencilOp", offsetof(VkLayerDispatchTable, CmdSetStencilOp)},
+    {"vkCmdDrawMultiEXT", offsetof(VkLayerDispatchTable, CmdDrawMultiEXT)},
+    {"vkCreatePrivateDataSlot", offsetof(VkLayerDispatchTable, CreatePrivateDataSlot)},
+    {"vkGetRayTracingShaderGroupHandlesNV", offsetof(VkLayerDispatchTable, GetRayTracingShaderGroupHandlesNV)},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetMemoryWin32HandlePropertiesKHR", offsetof(VkLayerDispatchTable, GetMemoryWin32HandlePropertiesKHR)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {"vkCompileDeferredNV", offsetof(VkLayerDispatchTable, CompileDeferredNV)},
+    {"vkCmdPipelineBarrier2KHR", offsetof(VkLayerDispatchTable, CmdPipelineBarrier2KHR)},
+    {"vkRegisterDisplayEventEXT", offsetof(VkLayerDispatchTable, RegisterDisplayEventEXT)},
+    {"vkGetQueryPoolResults", offsetof(VkLayerDispatchTable, GetQueryPoolResults)},
+    {"vkGetDeviceMemoryOpaqueCaptureAddressKHR", offsetof(VkLayerDispatchTable, GetDeviceMemoryOpaqueCaptureAddressKHR)},
+    {"vkDestroyAccelerationStructureNV", offsetof(VkLayerDispatchTable, DestroyAccelerationStructureNV)},
+    {"vkCmdWriteTimestamp", offsetof(VkLayerDispatchTable, CmdWriteTimestamp)},
+    {"vkWaitSemaphoresKHR", offsetof(VkLayerDispatchTable, WaitSemaphoresKHR)},
+    {"vkBindBufferMemory2KHR", offsetof(VkLayerDispatchTable, BindBufferMemory2KHR)},
+    {"vkCmdSetStencilOpEXT", offsetof(VkLayerDispatchTable, CmdSetStencilOpEXT)},
+    {"vkCmdSetPrimitiveTopologyEXT", offsetof(VkLayerDispatchTable, CmdSetPrimitiveTopologyEXT)},
+    {"vkGetFenceFdKHR", offsetof(VkLayerDispatchTable, GetFenceFdKHR)},
+    {"vkAllocateMemory", offsetof(VkLayerDispatchTable, AllocateMemory)},
+    {"vkCmdSetCullModeEXT", offsetof(VkLayerDispatchTable, CmdSetCullModeEXT)},
+    {"vkCmdWriteTimestamp2", offsetof(VkLayerDispatchTable, CmdWriteTimestamp2)},
+    {"vkCmdNextSubpass2KHR", offsetof(VkLayerDispatchTable, CmdNextSubpass2KHR)},
+    {"vkReleaseProfilingLockKHR", offsetof(VkLayerDispatchTable, ReleaseProfilingLockKHR)},
+    {"vkResetQueryPoolEXT", offsetof(VkLayerDispatchTable, ResetQueryPoolEXT)},
+    {"vkCmdBuildAccelerationStructuresKHR", offsetof(VkLayerDispatchTable, CmdBuildAccelerationStructuresKHR)},
+    {"vkSignalSemaphore", offsetof(VkLayerDispatchTable, SignalSemaphore)},
+    {"vkQueueSubmit2", offsetof(VkLayerDispatchTable, QueueSubmit2)},
+    {"vkDestroyDescriptorUpdateTemplateKHR", offsetof(VkLayerDispatchTable, DestroyDescriptorUpdateTemplateKHR)},
+    {"vkTrimCommandPoolKHR", offsetof(VkLayerDispatchTable, TrimCommandPoolKHR)},
+    {"vkCmdDrawIndexedIndirect", offsetof(VkLayerDispatchTable, CmdDrawIndexedIndirect)},
+    {"vkCmdDraw", offsetof(VkLayerDispatchTable, CmdDraw)},
+    {"vkGetDescriptorSetLayoutSupport", offsetof(VkLayerDispatchTable, GetDescriptorSetLayoutSupport)},
+    {"vkCreateSharedSwapchainsKHR", offsetof(VkLayerDispatchTable, CreateSharedSwapchainsKHR)},
+    {"vkCmdBlitImage2KHR", offsetof(VkLayerDispatchTable, CmdBlitImage2KHR)},
+    {"vkCmdEndQueryIndexedEXT", offsetof(VkLayerDispatchTable, CmdEndQueryIndexedEXT)},
+    {"vkDestroyImage", offsetof(VkLayerDispatchTable, DestroyImage)},
+    {"vkGetCalibratedTimestampsEXT", offsetof(VkLayerDispatchTable, GetCalibratedTimestampsEXT)},
+    {"vkCmdDrawMeshTasksNV", offsetof(VkLayerDispatchTable, CmdDrawMeshTasksNV)},
+    {"vkGetSwapchainImagesKHR", offsetof(VkLayerDispatchTable, GetSwapchainImagesKHR)},
+    {"vkDestroyDescriptorSetLayout", offsetof(VkLayerDispatchTable, DestroyDescriptorSetLayout)},
+    {"vkCreatePipelineLayout", offsetof(VkLayerDispatchTable, CreatePipelineLayout)},
+    {"vkCmdBindVertexBuffers", offsetof(VkLayerDispatchTable, CmdBindVertexBuffers)},
+    {"vkCmdBindPipelineShaderGroupNV", offsetof(VkLayerDispatchTable, CmdBindPipelineShaderGroupNV)},
+    {"vkResetQueryPool", offsetof(VkLayerDispatchTable, ResetQueryPool)},
+    {"vkCmdDrawIndirect", offsetof(VkLayerDispatchTable, CmdDrawIndirect)},
+    {"vkGetBufferDeviceAddress", offsetof(VkLayerDispatchTable, GetBufferDeviceAddress)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CmdBeginVideoCodingKHR")) return (void *)table->CmdBeginVideoCodingKHR;
+    {"vkCreateVideoSessionParametersKHR", offsetof(VkLayerDispatchTable, CreateVideoSessionParametersKHR)},
+#else
+    {NULL, 0},
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    {"vkRegisterDeviceEventEXT", offsetof(VkLayerDispatchTable, RegisterDeviceEventEXT)},
+    {"vkGetShaderModuleCreateInfoIdentifierEXT", offsetof(VkLayerDispatchTable, GetShaderModuleCreateInfoIdentifierEXT)},
+    {"vkCmdSetPerformanceOverrideINTEL", offsetof(VkLayerDispatchTable, CmdSetPerformanceOverrideINTEL)},
+    {"vkCmdSetCoarseSampleOrderNV", offsetof(VkLayerDispatchTable, CmdSetCoarseSampleOrderNV)},
+    {"vkGetPipelineExecutableStatisticsKHR", offsetof(VkLayerDispatchTable, GetPipelineExecutableStatisticsKHR)},
+    {"vkQueueInsertDebugUtilsLabelEXT", offsetof(VkLayerDispatchTable, QueueInsertDebugUtilsLabelEXT)},
+    {"vkResetCommandPool", offsetof(VkLayerDispatchTable, ResetCommandPool)},
+    {"vkCmdSetSampleLocationsEXT", offsetof(VkLayerDispatchTable, CmdSetSampleLocationsEXT)},
+    {"vkGetQueueCheckpointDataNV", offsetof(VkLayerDispatchTable, GetQueueCheckpointDataNV)},
+    {"vkGetBufferMemoryRequirements2", offsetof(VkLayerDispatchTable, GetBufferMemoryRequirements2)},
+    {"vkCmdCopyImageToBuffer2KHR", offsetof(VkLayerDispatchTable, CmdCopyImageToBuffer2KHR)},
+    {"vkCmdSetDepthBoundsTestEnable", offsetof(VkLayerDispatchTable, CmdSetDepthBoundsTestEnable)},
+    {"vkCmdSetPerformanceMarkerINTEL", offsetof(VkLayerDispatchTable, CmdSetPerformanceMarkerINTEL)},
+    {"vkDestroyPrivateDataSlotEXT", offsetof(VkLayerDispatchTable, DestroyPrivateDataSlotEXT)},
+    {"vkGetImageMemoryRequirements2", offsetof(VkLayerDispatchTable, GetImageMemoryRequirements2)},
+    {"vkCmdSetPrimitiveRestartEnable", offsetof(VkLayerDispatchTable, CmdSetPrimitiveRestartEnable)},
+    {"vkSetDeviceMemoryPriorityEXT", offsetof(VkLayerDispatchTable, SetDeviceMemoryPriorityEXT)},
+    {"vkDeferredOperationJoinKHR", offsetof(VkLayerDispatchTable, DeferredOperationJoinKHR)},
+    {"vkCmdSetPatchControlPointsEXT", offsetof(VkLayerDispatchTable, CmdSetPatchControlPointsEXT)},
+    {"vkCmdCopyBufferToImage2KHR", offsetof(VkLayerDispatchTable, CmdCopyBufferToImage2KHR)},
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {"vkSetBufferCollectionImageConstraintsFUCHSIA", offsetof(VkLayerDispatchTable, SetBufferCollectionImageConstraintsFUCHSIA)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_FUCHSIA
+    {"vkCmdEndDebugUtilsLabelEXT", offsetof(VkLayerDispatchTable, CmdEndDebugUtilsLabelEXT)},
+    {"vkCmdDrawMeshTasksIndirectNV", offsetof(VkLayerDispatchTable, CmdDrawMeshTasksIndirectNV)},
+    {"vkCmdSetRasterizerDiscardEnable", offsetof(VkLayerDispatchTable, CmdSetRasterizerDiscardEnable)},
+    {"vkGetImageViewHandleNVX", offsetof(VkLayerDispatchTable, GetImageViewHandleNVX)},
+    {"vkInitializePerformanceApiINTEL", offsetof(VkLayerDispatchTable, InitializePerformanceApiINTEL)},
+    {"vkCmdSetStencilReference", offsetof(VkLayerDispatchTable, CmdSetStencilReference)},
+    {"vkCreatePrivateDataSlotEXT", offsetof(VkLayerDispatchTable, CreatePrivateDataSlotEXT)},
+    {"vkCmdBeginRendering", offsetof(VkLayerDispatchTable, CmdBeginRendering)},
+    {"vkQueueSetPerformanceConfigurationINTEL", offsetof(VkLayerDispatchTable, QueueSetPerformanceConfigurationINTEL)},
+    {"vkCmdClearColorImage", offsetof(VkLayerDispatchTable, CmdClearColorImage)},
+    {"vkGetSwapchainCounterEXT", offsetof(VkLayerDispatchTable, GetSwapchainCounterEXT)},
+    {"vkSetPrivateData", offsetof(VkLayerDispatchTable, SetPrivateData)},
+    {"vkGetShaderInfoAMD", offsetof(VkLayerDispatchTable, GetShaderInfoAMD)},
+    {"vkCmdTraceRaysKHR", offsetof(VkLayerDispatchTable, CmdTraceRaysKHR)},
+    {"vkCmdDrawMultiIndexedEXT", offsetof(VkLayerDispatchTable, CmdDrawMultiIndexedEXT)},
+    {"vkCmdTraceRaysIndirect2KHR", offsetof(VkLayerDispatchTable, CmdTraceRaysIndirect2KHR)},
+    {"vkGetDeviceImageMemoryRequirementsKHR", offsetof(VkLayerDispatchTable, GetDeviceImageMemoryRequirementsKHR)},
+    {"vkCmdSetVertexInputEXT", offsetof(VkLayerDispatchTable, CmdSetVertexInputEXT)},
+    {"vkGetImageSubresourceLayout2EXT", offsetof(VkLayerDispatchTable, GetImageSubresourceLayout2EXT)},
+    {"vkMergeValidationCachesEXT", offsetof(VkLayerDispatchTable, MergeValidationCachesEXT)},
+    {"vkCmdCopyImage2", offsetof(VkLayerDispatchTable, CmdCopyImage2)},
+    {"vkGetDeviceAccelerationStructureCompatibilityKHR", offsetof(VkLayerDispatchTable, GetDeviceAccelerationStructureCompatibilityKHR)},
+    {"vkCmdSetDepthBiasEnable", offsetof(VkLayerDispatchTable, CmdSetDepthBiasEnable)},
+    {"vkCmdSetColorWriteEnableEXT", offsetof(VkLayerDispatchTable, CmdSetColorWriteEnableEXT)},
+    {"vkDestroySemaphore", offsetof(VkLayerDispatchTable, DestroySemaphore)},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetMemoryWin32HandleKHR", offsetof(VkLayerDispatchTable, GetMemoryWin32HandleKHR)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CmdEndVideoCodingKHR")) return (void *)table->CmdEndVideoCodingKHR;
+    {"vkDestroyVideoSessionKHR", offsetof(VkLayerDispatchTable, DestroyVideoSessionKHR)},
+#else
+    {NULL, 0},
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdSetStencilWriteMask", offsetof(VkLayerDispatchTable, CmdSetStencilWriteMask)},
+    {"vkQueueBindSparse", offsetof(VkLayerDispatchTable, QueueBindSparse)},
+    {"vkGetDescriptorSetHostMappingVALVE", offsetof(VkLayerDispatchTable, GetDescriptorSetHostMappingVALVE)},
+    {"vkCmdSetDepthTestEnableEXT", offsetof(VkLayerDispatchTable, CmdSetDepthTestEnableEXT)},
+    {"vkCmdWriteTimestamp2KHR", offsetof(VkLayerDispatchTable, CmdWriteTimestamp2KHR)},
+    {"vkCmdSetScissorWithCountEXT", offsetof(VkLayerDispatchTable, CmdSetScissorWithCountEXT)},
+    {"vkWaitSemaphores", offsetof(VkLayerDispatchTable, WaitSemaphores)},
+    {"vkCmdSetEvent2KHR", offsetof(VkLayerDispatchTable, CmdSetEvent2KHR)},
+    {"vkGetImageViewAddressNVX", offsetof(VkLayerDispatchTable, GetImageViewAddressNVX)},
+    {"vkGetDeviceImageSparseMemoryRequirements", offsetof(VkLayerDispatchTable, GetDeviceImageSparseMemoryRequirements)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CmdControlVideoCodingKHR")) return (void *)table->CmdControlVideoCodingKHR;
+    {"vkUpdateVideoSessionParametersKHR", offsetof(VkLayerDispatchTable, UpdateVideoSessionParametersKHR)},
+#else
+    {NULL, 0},
 #endif // VK_ENABLE_BETA_EXTENSIONS
-
-    // ---- VK_KHR_video_decode_queue extension commands
+    {"vkCreateEvent", offsetof(VkLayerDispatchTable, CreateEvent)},
+    {"vkSignalSemaphoreKHR", offsetof(VkLayerDispatchTable, SignalSemaphoreKHR)},
+    {"vkGetFenceStatus", offsetof(VkLayerDispatchTable, GetFenceStatus)},
+    {"vkCmdCopyBuffer2KHR", offsetof(VkLayerDispatchTable, CmdCopyBuffer2KHR)},
+    {"vkCmdSetDepthCompareOp", offsetof(VkLayerDispatchTable, CmdSetDepthCompareOp)},
+    {"vkWriteAccelerationStructuresPropertiesKHR", offsetof(VkLayerDispatchTable, WriteAccelerationStructuresPropertiesKHR)},
+    {"vkCmdCopyBufferToImage", offsetof(VkLayerDispatchTable, CmdCopyBufferToImage)},
+    {"vkCmdDebugMarkerEndEXT", offsetof(VkLayerDispatchTable, CmdDebugMarkerEndEXT)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CmdDecodeVideoKHR")) return (void *)table->CmdDecodeVideoKHR;
+    {"vkCmdBeginVideoCodingKHR", offsetof(VkLayerDispatchTable, CmdBeginVideoCodingKHR)},
+#else
+    {NULL, 0},
 #endif // VK_ENABLE_BETA_EXTENSIONS
-
-    // ---- VK_KHR_dynamic_rendering extension commands
-    if (!strcmp(name, "CmdBeginRenderingKHR")) return (void *)table->CmdBeginRenderingKHR;
-    if (!strcmp(name, "CmdEndRenderingKHR")) return (void *)table->CmdEndRenderingKHR;
-
-    // ---- VK_KHR_device_group extension commands
-    if (!strcmp(name, "GetDeviceGroupPeerMemoryFeaturesKHR")) return (void *)table->GetDeviceGroupPeerMemoryFeaturesKHR;
-    if (!strcmp(name, "CmdSetDeviceMaskKHR")) return (void *)table->CmdSetDeviceMaskKHR;
-    if (!strcmp(name, "CmdDispatchBaseKHR")) return (void *)table->CmdDispatchBaseKHR;
-
-    // ---- VK_KHR_maintenance1 extension commands
-    if (!strcmp(name, "TrimCommandPoolKHR")) return (void *)table->TrimCommandPoolKHR;
-
-    // ---- VK_KHR_external_memory_win32 extension commands
+    {"vkCmdSetDepthWriteEnable", offsetof(VkLayerDispatchTable, CmdSetDepthWriteEnable)},
+    {"vkCmdDispatch", offsetof(VkLayerDispatchTable, CmdDispatch)},
+    {"vkGetAccelerationStructureDeviceAddressKHR", offsetof(VkLayerDispatchTable, GetAccelerationStructureDeviceAddressKHR)},
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {"vkCreateBufferCollectionFUCHSIA", offsetof(VkLayerDispatchTable, CreateBufferCollectionFUCHSIA)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_FUCHSIA
+    {"vkCmdBlitImage2", offsetof(VkLayerDispatchTable, CmdBlitImage2)},
+    {"vkCmdBeginRenderingKHR", offsetof(VkLayerDispatchTable, CmdBeginRenderingKHR)},
+    {"vkCmdResolveImage", offsetof(VkLayerDispatchTable, CmdResolveImage)},
+    {"vkImportSemaphoreFdKHR", offsetof(VkLayerDispatchTable, ImportSemaphoreFdKHR)},
+    {"vkCreateGraphicsPipelines", offsetof(VkLayerDispatchTable, CreateGraphicsPipelines)},
+    {"vkCmdSetViewportShadingRatePaletteNV", offsetof(VkLayerDispatchTable, CmdSetViewportShadingRatePaletteNV)},
+    {"vkCmdSetExclusiveScissorNV", offsetof(VkLayerDispatchTable, CmdSetExclusiveScissorNV)},
+    {"vkCmdCopyQueryPoolResults", offsetof(VkLayerDispatchTable, CmdCopyQueryPoolResults)},
+    {"vkCmdSetRayTracingPipelineStackSizeKHR", offsetof(VkLayerDispatchTable, CmdSetRayTracingPipelineStackSizeKHR)},
+    {"vkCmdCopyMemoryToAccelerationStructureKHR", offsetof(VkLayerDispatchTable, CmdCopyMemoryToAccelerationStructureKHR)},
+    {"vkDestroyCommandPool", offsetof(VkLayerDispatchTable, DestroyCommandPool)},
+    {"vkAcquireProfilingLockKHR", offsetof(VkLayerDispatchTable, AcquireProfilingLockKHR)},
+    {"vkFreeCommandBuffers", offsetof(VkLayerDispatchTable, FreeCommandBuffers)},
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    {"vkGetAndroidHardwareBufferPropertiesANDROID", offsetof(VkLayerDispatchTable, GetAndroidHardwareBufferPropertiesANDROID)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetMemoryWin32HandleKHR")) return (void *)table->GetMemoryWin32HandleKHR;
+    {"vkGetFenceWin32HandleKHR", offsetof(VkLayerDispatchTable, GetFenceWin32HandleKHR)},
+#else
+    {NULL, 0},
 #endif // VK_USE_PLATFORM_WIN32_KHR
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkCreateVideoSessionKHR", offsetof(VkLayerDispatchTable, CreateVideoSessionKHR)},
+#else
+    {NULL, 0},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+    {"vkQueueEndDebugUtilsLabelEXT", offsetof(VkLayerDispatchTable, QueueEndDebugUtilsLabelEXT)},
+    {"vkGetAccelerationStructureHandleNV", offsetof(VkLayerDispatchTable, GetAccelerationStructureHandleNV)},
+    {"vkCopyMemoryToAccelerationStructureKHR", offsetof(VkLayerDispatchTable, CopyMemoryToAccelerationStructureKHR)},
+    {"vkCmdBeginQuery", offsetof(VkLayerDispatchTable, CmdBeginQuery)},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetMemoryWin32HandlePropertiesKHR")) return (void *)table->GetMemoryWin32HandlePropertiesKHR;
+    {"vkImportFenceWin32HandleKHR", offsetof(VkLayerDispatchTable, ImportFenceWin32HandleKHR)},
+#else
+    {NULL, 0},
 #endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_KHR_external_memory_fd extension commands
-    if (!strcmp(name, "GetMemoryFdKHR")) return (void *)table->GetMemoryFdKHR;
-    if (!strcmp(name, "GetMemoryFdPropertiesKHR")) return (void *)table->GetMemoryFdPropertiesKHR;
-
-    // ---- VK_KHR_external_semaphore_win32 extension commands
+    {"vkDebugMarkerSetObjectTagEXT", offsetof(VkLayerDispatchTable, DebugMarkerSetObjectTagEXT)},
+    {"vkCmdDrawIndexed", offsetof(VkLayerDispatchTable, CmdDrawIndexed)},
+    {"vkGetSemaphoreFdKHR", offsetof(VkLayerDispatchTable, GetSemaphoreFdKHR)},
+    {"vkCmdBuildAccelerationStructureNV", offsetof(VkLayerDispatchTable, CmdBuildAccelerationStructureNV)},
+    {"vkDestroyFence", offsetof(VkLayerDispatchTable, DestroyFence)},
+    {"vkCmdSetEvent", offsetof(VkLayerDispatchTable, CmdSetEvent)},
+    {"vkCopyAccelerationStructureKHR", offsetof(VkLayerDispatchTable, CopyAccelerationStructureKHR)},
+    {"vkWaitForPresentKHR", offsetof(VkLayerDispatchTable, WaitForPresentKHR)},
+    {"vkDestroyRenderPass", offsetof(VkLayerDispatchTable, DestroyRenderPass)},
+    {"vkCmdWriteAccelerationStructuresPropertiesKHR", offsetof(VkLayerDispatchTable, CmdWriteAccelerationStructuresPropertiesKHR)},
+    {"vkCreateIndirectCommandsLayoutNV", offsetof(VkLayerDispatchTable, CreateIndirectCommandsLayoutNV)},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "ImportSemaphoreWin32HandleKHR")) return (void *)table->ImportSemaphoreWin32HandleKHR;
+    {"vkGetMemoryWin32HandleNV", offsetof(VkLayerDispatchTable, GetMemoryWin32HandleNV)},
+#else
+    {NULL, 0},
 #endif // VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetPipelineCacheData", offsetof(VkLayerDispatchTable, GetPipelineCacheData)},
+    {"vkCmdResetEvent2KHR", offsetof(VkLayerDispatchTable, CmdResetEvent2KHR)},
+    {"vkDeviceWaitIdle", offsetof(VkLayerDispatchTable, DeviceWaitIdle)},
+    {"vkGetSemaphoreCounterValue", offsetof(VkLayerDispatchTable, GetSemaphoreCounterValue)},
+    {"vkCreateSemaphore", offsetof(VkLayerDispatchTable, CreateSemaphore)},
+    {"vkCmdCopyImageToBuffer", offsetof(VkLayerDispatchTable, CmdCopyImageToBuffer)},
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {"vkGetMemoryZirconHandleFUCHSIA", offsetof(VkLayerDispatchTable, GetMemoryZirconHandleFUCHSIA)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_FUCHSIA
+    {"vkCmdBuildAccelerationStructuresIndirectKHR", offsetof(VkLayerDispatchTable, CmdBuildAccelerationStructuresIndirectKHR)},
+    {"vkCmdSetStencilCompareMask", offsetof(VkLayerDispatchTable, CmdSetStencilCompareMask)},
+    {"vkCmdEndRenderingKHR", offsetof(VkLayerDispatchTable, CmdEndRenderingKHR)},
+    {"vkCmdClearAttachments", offsetof(VkLayerDispatchTable, CmdClearAttachments)},
+    {"vkCmdBindVertexBuffers2", offsetof(VkLayerDispatchTable, CmdBindVertexBuffers2)},
+    {"vkCmdDrawIndirectByteCountEXT", offsetof(VkLayerDispatchTable, CmdDrawIndirectByteCountEXT)},
+    {"vkCreateShaderModule", offsetof(VkLayerDispatchTable, CreateShaderModule)},
+    {"vkDestroyQueryPool", offsetof(VkLayerDispatchTable, DestroyQueryPool)},
+    {"vkCreateDescriptorPool", offsetof(VkLayerDispatchTable, CreateDescriptorPool)},
+    {"vkGetDeviceImageSparseMemoryRequirementsKHR", offsetof(VkLayerDispatchTable, GetDeviceImageSparseMemoryRequirementsKHR)},
+    {"vkDisplayPowerControlEXT", offsetof(VkLayerDispatchTable, DisplayPowerControlEXT)},
+    {"vkDestroyAccelerationStructureKHR", offsetof(VkLayerDispatchTable, DestroyAccelerationStructureKHR)},
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {"vkSetBufferCollectionBufferConstraintsFUCHSIA", offsetof(VkLayerDispatchTable, SetBufferCollectionBufferConstraintsFUCHSIA)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_FUCHSIA
+    {"vkDestroyCuFunctionNVX", offsetof(VkLayerDispatchTable, DestroyCuFunctionNVX)},
+    {"vkCmdCopyImage", offsetof(VkLayerDispatchTable, CmdCopyImage)},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetSemaphoreWin32HandleKHR")) return (void *)table->GetSemaphoreWin32HandleKHR;
+    {"vkGetSemaphoreWin32HandleKHR", offsetof(VkLayerDispatchTable, GetSemaphoreWin32HandleKHR)},
+#else
+    {NULL, 0},
 #endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_KHR_external_semaphore_fd extension commands
-    if (!strcmp(name, "ImportSemaphoreFdKHR")) return (void *)table->ImportSemaphoreFdKHR;
-    if (!strcmp(name, "GetSemaphoreFdKHR")) return (void *)table->GetSemaphoreFdKHR;
-
-    // ---- VK_KHR_push_descriptor extension commands
-    if (!strcmp(name, "CmdPushDescriptorSetKHR")) return (void *)table->CmdPushDescriptorSetKHR;
-    if (!strcmp(name, "CmdPushDescriptorSetWithTemplateKHR")) return (void *)table->CmdPushDescriptorSetWithTemplateKHR;
-
-    // ---- VK_KHR_descriptor_update_template extension commands
-    if (!strcmp(name, "CreateDescriptorUpdateTemplateKHR")) return (void *)table->CreateDescriptorUpdateTemplateKHR;
-    if (!strcmp(name, "DestroyDescriptorUpdateTemplateKHR")) return (void *)table->DestroyDescriptorUpdateTemplateKHR;
-    if (!strcmp(name, "UpdateDescriptorSetWithTemplateKHR")) return (void *)table->UpdateDescriptorSetWithTemplateKHR;
-
-    // ---- VK_KHR_create_renderpass2 extension commands
-    if (!strcmp(name, "CreateRenderPass2KHR")) return (void *)table->CreateRenderPass2KHR;
-    if (!strcmp(name, "CmdBeginRenderPass2KHR")) return (void *)table->CmdBeginRenderPass2KHR;
-    if (!strcmp(name, "CmdNextSubpass2KHR")) return (void *)table->CmdNextSubpass2KHR;
-    if (!strcmp(name, "CmdEndRenderPass2KHR")) return (void *)table->CmdEndRenderPass2KHR;
-
-    // ---- VK_KHR_shared_presentable_image extension commands
-    if (!strcmp(name, "GetSwapchainStatusKHR")) return (void *)table->GetSwapchainStatusKHR;
-
-    // ---- VK_KHR_external_fence_win32 extension commands
+    {"vkCmdDrawIndirectCountKHR", offsetof(VkLayerDispatchTable, CmdDrawIndirectCountKHR)},
+    {"vkCmdEndRenderPass", offsetof(VkLayerDispatchTable, CmdEndRenderPass)},
+    {"vkAllocateDescriptorSets", offsetof(VkLayerDispatchTable, AllocateDescriptorSets)},
+    {"vkGetPipelineExecutableInternalRepresentationsKHR", offsetof(VkLayerDispatchTable, GetPipelineExecutableInternalRepresentationsKHR)},
+    {"vkCmdSetViewportWithCount", offsetof(VkLayerDispatchTable, CmdSetViewportWithCount)},
+    {"vkCmdWaitEvents", offsetof(VkLayerDispatchTable, CmdWaitEvents)},
+    {"vkCmdSetDepthTestEnable", offsetof(VkLayerDispatchTable, CmdSetDepthTestEnable)},
+    {"vkCreateAccelerationStructureNV", offsetof(VkLayerDispatchTable, CreateAccelerationStructureNV)},
+    {"vkCmdBeginRenderPass", offsetof(VkLayerDispatchTable, CmdBeginRenderPass)},
+    {"vkQueueSubmit", offsetof(VkLayerDispatchTable, QueueSubmit)},
+    {"vkCmdPushDescriptorSetKHR", offsetof(VkLayerDispatchTable, CmdPushDescriptorSetKHR)},
+    {"vkCreateRenderPass2KHR", offsetof(VkLayerDispatchTable, CreateRenderPass2KHR)},
+    {"vkGetDeferredOperationMaxConcurrencyKHR", offsetof(VkLayerDispatchTable, GetDeferredOperationMaxConcurrencyKHR)},
+    {"vkCmdCopyBuffer", offsetof(VkLayerDispatchTable, CmdCopyBuffer)},
+    {"vkGetMemoryHostPointerPropertiesEXT", offsetof(VkLayerDispatchTable, GetMemoryHostPointerPropertiesEXT)},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdDecodeVideoKHR", offsetof(VkLayerDispatchTable, CmdDecodeVideoKHR)},
+#else
+    {NULL, 0},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdSetDeviceMaskKHR", offsetof(VkLayerDispatchTable, CmdSetDeviceMaskKHR)},
+    {"vkGetShaderModuleIdentifierEXT", offsetof(VkLayerDispatchTable, GetShaderModuleIdentifierEXT)},
+    {"vkCmdSetFragmentShadingRateKHR", offsetof(VkLayerDispatchTable, CmdSetFragmentShadingRateKHR)},
+    {"vkEndCommandBuffer", offsetof(VkLayerDispatchTable, EndCommandBuffer)},
+    {"vkCmdDispatchBaseKHR", offsetof(VkLayerDispatchTable, CmdDispatchBaseKHR)},
+    {"vkCmdBeginConditionalRenderingEXT", offsetof(VkLayerDispatchTable, CmdBeginConditionalRenderingEXT)},
+    {"vkResetDescriptorPool", offsetof(VkLayerDispatchTable, ResetDescriptorPool)},
+    {"vkBindImageMemory2KHR", offsetof(VkLayerDispatchTable, BindImageMemory2KHR)},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "ImportFenceWin32HandleKHR")) return (void *)table->ImportFenceWin32HandleKHR;
+    {"vkImportSemaphoreWin32HandleKHR", offsetof(VkLayerDispatchTable, ImportSemaphoreWin32HandleKHR)},
+#else
+    {NULL, 0},
 #endif // VK_USE_PLATFORM_WIN32_KHR
+    {"vkCmdEndConditionalRenderingEXT", offsetof(VkLayerDispatchTable, CmdEndConditionalRenderingEXT)},
+    {"vkCmdDrawIndexedIndirectCount", offsetof(VkLayerDispatchTable, CmdDrawIndexedIndirectCount)},
+    {"vkCmdResetEvent2", offsetof(VkLayerDispatchTable, CmdResetEvent2)},
+    {"vkCmdSetDepthBiasEnableEXT", offsetof(VkLayerDispatchTable, CmdSetDepthBiasEnableEXT)},
+    {"vkCmdResetQueryPool", offsetof(VkLayerDispatchTable, CmdResetQueryPool)},
+    {"vkCmdSetStencilTestEnable", offsetof(VkLayerDispatchTable, CmdSetStencilTestEnable)},
+    {"vkCmdWriteBufferMarkerAMD", offsetof(VkLayerDispatchTable, CmdWriteBufferMarkerAMD)},
+    {"vkCmdSetScissor", offsetof(VkLayerDispatchTable, CmdSetScissor)},
+    {"vkCmdTraceRaysNV", offsetof(VkLayerDispatchTable, CmdTraceRaysNV)},
+    {"vkFreeMemory", offsetof(VkLayerDispatchTable, FreeMemory)},
+    {"vkCmdCopyImageToBuffer2", offsetof(VkLayerDispatchTable, CmdCopyImageToBuffer2)},
+    {"vkCmdSetLineWidth", offsetof(VkLayerDispatchTable, CmdSetLineWidth)},
+    {"vkCreateBuffer", offsetof(VkLayerDispatchTable, CreateBuffer)},
+    {"vkUnmapMemory", offsetof(VkLayerDispatchTable, UnmapMemory)},
+    {"vkCmdDebugMarkerInsertEXT", offsetof(VkLayerDispatchTable, CmdDebugMarkerInsertEXT)},
+    {"vkCreateFence", offsetof(VkLayerDispatchTable, CreateFence)},
+    {"vkCmdSetLineStippleEXT", offsetof(VkLayerDispatchTable, CmdSetLineStippleEXT)},
+    {"vkCreateAccelerationStructureKHR", offsetof(VkLayerDispatchTable, CreateAccelerationStructureKHR)},
+    {"vkCmdSetCullMode", offsetof(VkLayerDispatchTable, CmdSetCullMode)},
+    {"vkCmdSetDepthBoundsTestEnableEXT", offsetof(VkLayerDispatchTable, CmdSetDepthBoundsTestEnableEXT)},
+    {"vkSetDebugUtilsObjectNameEXT", offsetof(VkLayerDispatchTable, SetDebugUtilsObjectNameEXT)},
+    {"vkCmdSubpassShadingHUAWEI", offsetof(VkLayerDispatchTable, CmdSubpassShadingHUAWEI)},
+    {"vkDebugMarkerSetObjectNameEXT", offsetof(VkLayerDispatchTable, DebugMarkerSetObjectNameEXT)},
+    {"vkGetRayTracingShaderGroupStackSizeKHR", offsetof(VkLayerDispatchTable, GetRayTracingShaderGroupStackSizeKHR)},
+    {"vkCreateCuFunctionNVX", offsetof(VkLayerDispatchTable, CreateCuFunctionNVX)},
+    {"vkCmdBindVertexBuffers2EXT", offsetof(VkLayerDispatchTable, CmdBindVertexBuffers2EXT)},
+    {"vkCmdResolveImage2", offsetof(VkLayerDispatchTable, CmdResolveImage2)},
+    {"vkGetImageSparseMemoryRequirements2", offsetof(VkLayerDispatchTable, GetImageSparseMemoryRequirements2)},
+    {"vkResetEvent", offsetof(VkLayerDispatchTable, ResetEvent)},
+    {"vkCmdSetViewportWithCountEXT", offsetof(VkLayerDispatchTable, CmdSetViewportWithCountEXT)},
+    {"vkDestroyPipelineLayout", offsetof(VkLayerDispatchTable, DestroyPipelineLayout)},
+    {"vkCmdCopyBuffer2", offsetof(VkLayerDispatchTable, CmdCopyBuffer2)},
+    {"vkCmdEndTransformFeedbackEXT", offsetof(VkLayerDispatchTable, CmdEndTransformFeedbackEXT)},
+    {"vkCreateRayTracingPipelinesNV", offsetof(VkLayerDispatchTable, CreateRayTracingPipelinesNV)},
+    {"vkFlushMappedMemoryRanges", offsetof(VkLayerDispatchTable, FlushMappedMemoryRanges)},
+    {"vkCmdBeginQueryIndexedEXT", offsetof(VkLayerDispatchTable, CmdBeginQueryIndexedEXT)},
+    {"vkCreateSamplerYcbcrConversion", offsetof(VkLayerDispatchTable, CreateSamplerYcbcrConversion)},
+    {"vkMapMemory", offsetof(VkLayerDispatchTable, MapMemory)},
+    {"vkCmdFillBuffer", offsetof(VkLayerDispatchTable, CmdFillBuffer)},
+    {"vkGetRayTracingShaderGroupHandlesKHR", offsetof(VkLayerDispatchTable, GetRayTracingShaderGroupHandlesKHR)},
+    {"vkCreatePipelineCache", offsetof(VkLayerDispatchTable, CreatePipelineCache)},
+    {"vkCmdExecuteCommands", offsetof(VkLayerDispatchTable, CmdExecuteCommands)},
+    {"vkCmdSetLogicOpEXT", offsetof(VkLayerDispatchTable, CmdSetLogicOpEXT)},
+    {"vkCreateRenderPass2", offsetof(VkLayerDispatchTable, CreateRenderPass2)},
+    {"vkCmdClearDepthStencilImage", offsetof(VkLayerDispatchTable, CmdClearDepthStencilImage)},
+    {"vkGetBufferOpaqueCaptureAddress", offsetof(VkLayerDispatchTable, GetBufferOpaqueCaptureAddress)},
+    {"vkBindBufferMemory", offsetof(VkLayerDispatchTable, BindBufferMemory)},
+    {"vkCreateDescriptorUpdateTemplateKHR", offsetof(VkLayerDispatchTable, CreateDescriptorUpdateTemplateKHR)},
+    {"vkCmdEndRenderPass2KHR", offsetof(VkLayerDispatchTable, CmdEndRenderPass2KHR)},
+    {"vkCreateRenderPass", offsetof(VkLayerDispatchTable, CreateRenderPass)},
+    {"vkGetDeviceGroupPeerMemoryFeatures", offsetof(VkLayerDispatchTable, GetDeviceGroupPeerMemoryFeatures)},
+    {"vkCmdDispatchIndirect", offsetof(VkLayerDispatchTable, CmdDispatchIndirect)},
+    {"vkBindImageMemory2", offsetof(VkLayerDispatchTable, BindImageMemory2)},
+    {"vkCmdWaitEvents2", offsetof(VkLayerDispatchTable, CmdWaitEvents2)},
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {"vkDestroyBufferCollectionFUCHSIA", offsetof(VkLayerDispatchTable, DestroyBufferCollectionFUCHSIA)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_FUCHSIA
+    {"vkSetPrivateDataEXT", offsetof(VkLayerDispatchTable, SetPrivateDataEXT)},
+    {"vkCmdPipelineBarrier2", offsetof(VkLayerDispatchTable, CmdPipelineBarrier2)},
+    {"vkCmdSetPerformanceStreamMarkerINTEL", offsetof(VkLayerDispatchTable, CmdSetPerformanceStreamMarkerINTEL)},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdEndVideoCodingKHR", offsetof(VkLayerDispatchTable, CmdEndVideoCodingKHR)},
+#else
+    {NULL, 0},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkDestroyVideoSessionParametersKHR", offsetof(VkLayerDispatchTable, DestroyVideoSessionParametersKHR)},
+#else
+    {NULL, 0},
+#endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetFenceWin32HandleKHR")) return (void *)table->GetFenceWin32HandleKHR;
+    {"vkAcquireFullScreenExclusiveModeEXT", offsetof(VkLayerDispatchTable, AcquireFullScreenExclusiveModeEXT)},
+#else
+    {NULL, 0},
 #endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_KHR_external_fence_fd extension commands
-    if (!strcmp(name, "ImportFenceFdKHR")) return (void *)table->ImportFenceFdKHR;
-    if (!strcmp(name, "GetFenceFdKHR")) return (void *)table->GetFenceFdKHR;
-
-    // ---- VK_KHR_performance_query extension commands
-    if (!strcmp(name, "AcquireProfilingLockKHR")) return (void *)table->AcquireProfilingLockKHR;
-    if (!strcmp(name, "ReleaseProfilingLockKHR")) return (void *)table->ReleaseProfilingLockKHR;
-
-    // ---- VK_KHR_get_memory_requirements2 extension commands
-    if (!strcmp(name, "GetImageMemoryRequirements2KHR")) return (void *)table->GetImageMemoryRequirements2KHR;
-    if (!strcmp(name, "GetBufferMemoryRequirements2KHR")) return (void *)table->GetBufferMemoryRequirements2KHR;
-    if (!strcmp(name, "GetImageSparseMemoryRequirements2KHR")) return (void *)table->GetImageSparseMemoryRequirements2KHR;
-
-    // ---- VK_KHR_sampler_ycbcr_conversion extension commands
-    if (!strcmp(name, "CreateSamplerYcbcrConversionKHR")) return (void *)table->CreateSamplerYcbcrConversionKHR;
-    if (!strcmp(name, "DestroySamplerYcbcrConversionKHR")) return (void *)table->DestroySamplerYcbcrConversionKHR;
-
-    // ---- VK_KHR_bind_memory2 extension commands
-    if (!strcmp(name, "BindBufferMemory2KHR")) return (void *)table->BindBufferMemory2KHR;
-    if (!strcmp(name, "BindImageMemory2KHR")) return (void *)table->BindImageMemory2KHR;
-
-    // ---- VK_KHR_maintenance3 extension commands
-    if (!strcmp(name, "GetDescriptorSetLayoutSupportKHR")) return (void *)table->GetDescriptorSetLayoutSupportKHR;
-
-    // ---- VK_KHR_draw_indirect_count extension commands
-    if (!strcmp(name, "CmdDrawIndirectCountKHR")) return (void *)table->CmdDrawIndirectCountKHR;
-    if (!strcmp(name, "CmdDrawIndexedIndirectCountKHR")) return (void *)table->CmdDrawIndexedIndirectCountKHR;
-
-    // ---- VK_KHR_timeline_semaphore extension commands
-    if (!strcmp(name, "GetSemaphoreCounterValueKHR")) return (void *)table->GetSemaphoreCounterValueKHR;
-    if (!strcmp(name, "WaitSemaphoresKHR")) return (void *)table->WaitSemaphoresKHR;
-    if (!strcmp(name, "SignalSemaphoreKHR")) return (void *)table->SignalSemaphoreKHR;
-
-    // ---- VK_KHR_fragment_shading_rate extension commands
-    if (!strcmp(name, "CmdSetFragmentShadingRateKHR")) return (void *)table->CmdSetFragmentShadingRateKHR;
-
-    // ---- VK_KHR_present_wait extension commands
-    if (!strcmp(name, "WaitForPresentKHR")) return (void *)table->WaitForPresentKHR;
-
-    // ---- VK_KHR_buffer_device_address extension commands
-    if (!strcmp(name, "GetBufferDeviceAddressKHR")) return (void *)table->GetBufferDeviceAddressKHR;
-    if (!strcmp(name, "GetBufferOpaqueCaptureAddressKHR")) return (void *)table->GetBufferOpaqueCaptureAddressKHR;
-    if (!strcmp(name, "GetDeviceMemoryOpaqueCaptureAddressKHR")) return (void *)table->GetDeviceMemoryOpaqueCaptureAddressKHR;
-
-    // ---- VK_KHR_deferred_host_operations extension commands
-    if (!strcmp(name, "CreateDeferredOperationKHR")) return (void *)table->CreateDeferredOperationKHR;
-    if (!strcmp(name, "DestroyDeferredOperationKHR")) return (void *)table->DestroyDeferredOperationKHR;
-    if (!strcmp(name, "GetDeferredOperationMaxConcurrencyKHR")) return (void *)table->GetDeferredOperationMaxConcurrencyKHR;
-    if (!strcmp(name, "GetDeferredOperationResultKHR")) return (void *)table->GetDeferredOperationResultKHR;
-    if (!strcmp(name, "DeferredOperationJoinKHR")) return (void *)table->DeferredOperationJoinKHR;
-
-    // ---- VK_KHR_pipeline_executable_properties extension commands
-    if (!strcmp(name, "GetPipelineExecutablePropertiesKHR")) return (void *)table->GetPipelineExecutablePropertiesKHR;
-    if (!strcmp(name, "GetPipelineExecutableStatisticsKHR")) return (void *)table->GetPipelineExecutableStatisticsKHR;
-    if (!strcmp(name, "GetPipelineExecutableInternalRepresentationsKHR")) return (void *)table->GetPipelineExecutableInternalRepresentationsKHR;
-
-    // ---- VK_KHR_video_encode_queue extension commands
+    {"vkCmdBindTransformFeedbackBuffersEXT", offsetof(VkLayerDispatchTable, CmdBindTransformFeedbackBuffersEXT)},
+    {"vkCmdNextSubpass", offsetof(VkLayerDispatchTable, CmdNextSubpass)},
+    {"vkDestroyPipelineCache", offsetof(VkLayerDispatchTable, DestroyPipelineCache)},
+    {"vkCmdSetDeviceMask", offsetof(VkLayerDispatchTable, CmdSetDeviceMask)},
+    {"vkUpdateDescriptorSets", offsetof(VkLayerDispatchTable, UpdateDescriptorSets)},
+    {"vkCmdBeginDebugUtilsLabelEXT", offsetof(VkLayerDispatchTable, CmdBeginDebugUtilsLabelEXT)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CmdEncodeVideoKHR")) return (void *)table->CmdEncodeVideoKHR;
+    {"vkCmdEncodeVideoKHR", offsetof(VkLayerDispatchTable, CmdEncodeVideoKHR)},
+#else
+    {NULL, 0},
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    {"vkMergePipelineCaches", offsetof(VkLayerDispatchTable, MergePipelineCaches)},
+    {"vkInvalidateMappedMemoryRanges", offsetof(VkLayerDispatchTable, InvalidateMappedMemoryRanges)},
+    {"vkCmdSetDepthCompareOpEXT", offsetof(VkLayerDispatchTable, CmdSetDepthCompareOpEXT)},
+    {"vkCmdBindDescriptorSets", offsetof(VkLayerDispatchTable, CmdBindDescriptorSets)},
+    {"vkCmdBlitImage", offsetof(VkLayerDispatchTable, CmdBlitImage)},
+    {"vkCmdEndQuery", offsetof(VkLayerDispatchTable, CmdEndQuery)},
+    {"vkGetDynamicRenderingTilePropertiesQCOM", offsetof(VkLayerDispatchTable, GetDynamicRenderingTilePropertiesQCOM)},
+    {"vkCreateSamplerYcbcrConversionKHR", offsetof(VkLayerDispatchTable, CreateSamplerYcbcrConversionKHR)},
+    {"vkGetMemoryFdPropertiesKHR", offsetof(VkLayerDispatchTable, GetMemoryFdPropertiesKHR)},
+    {"vkDestroyDescriptorUpdateTemplate", offsetof(VkLayerDispatchTable, DestroyDescriptorUpdateTemplate)},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdControlVideoCodingKHR", offsetof(VkLayerDispatchTable, CmdControlVideoCodingKHR)},
+#else
+    {NULL, 0},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdCuLaunchKernelNVX", offsetof(VkLayerDispatchTable, CmdCuLaunchKernelNVX)},
+    {"vkDestroyCuModuleNVX", offsetof(VkLayerDispatchTable, DestroyCuModuleNVX)},
+    {"vkCmdPreprocessGeneratedCommandsNV", offsetof(VkLayerDispatchTable, CmdPreprocessGeneratedCommandsNV)},
+    {"vkDestroyBufferView", offsetof(VkLayerDispatchTable, DestroyBufferView)},
+    {"vkCmdUpdateBuffer", offsetof(VkLayerDispatchTable, CmdUpdateBuffer)},
+    {"vkCmdBeginRenderPass2", offsetof(VkLayerDispatchTable, CmdBeginRenderPass2)},
+    {"vkSetEvent", offsetof(VkLayerDispatchTable, SetEvent)},
+    {"vkGetBufferDeviceAddressEXT", offsetof(VkLayerDispatchTable, GetBufferDeviceAddressEXT)},
+};
 
-    // ---- VK_KHR_synchronization2 extension commands
-    if (!strcmp(name, "CmdSetEvent2KHR")) return (void *)table->CmdSetEvent2KHR;
-    if (!strcmp(name, "CmdResetEvent2KHR")) return (void *)table->CmdResetEvent2KHR;
-    if (!strcmp(name, "CmdWaitEvents2KHR")) return (void *)table->CmdWaitEvents2KHR;
-    if (!strcmp(name, "CmdPipelineBarrier2KHR")) return (void *)table->CmdPipelineBarrier2KHR;
-    if (!strcmp(name, "CmdWriteTimestamp2KHR")) return (void *)table->CmdWriteTimestamp2KHR;
-    if (!strcmp(name, "QueueSubmit2KHR")) return (void *)table->QueueSubmit2KHR;
-    if (!strcmp(name, "CmdWriteBufferMarker2AMD")) return (void *)table->CmdWriteBufferMarker2AMD;
-    if (!strcmp(name, "GetQueueCheckpointData2NV")) return (void *)table->GetQueueCheckpointData2NV;
-
-    // ---- VK_KHR_copy_commands2 extension commands
-    if (!strcmp(name, "CmdCopyBuffer2KHR")) return (void *)table->CmdCopyBuffer2KHR;
-    if (!strcmp(name, "CmdCopyImage2KHR")) return (void *)table->CmdCopyImage2KHR;
-    if (!strcmp(name, "CmdCopyBufferToImage2KHR")) return (void *)table->CmdCopyBufferToImage2KHR;
-    if (!strcmp(name, "CmdCopyImageToBuffer2KHR")) return (void *)table->CmdCopyImageToBuffer2KHR;
-    if (!strcmp(name, "CmdBlitImage2KHR")) return (void *)table->CmdBlitImage2KHR;
-    if (!strcmp(name, "CmdResolveImage2KHR")) return (void *)table->CmdResolveImage2KHR;
-
-    // ---- VK_KHR_ray_tracing_maintenance1 extension commands
-    if (!strcmp(name, "CmdTraceRaysIndirect2KHR")) return (void *)table->CmdTraceRaysIndirect2KHR;
-
-    // ---- VK_KHR_maintenance4 extension commands
-    if (!strcmp(name, "GetDeviceBufferMemoryRequirementsKHR")) return (void *)table->GetDeviceBufferMemoryRequirementsKHR;
-    if (!strcmp(name, "GetDeviceImageMemoryRequirementsKHR")) return (void *)table->GetDeviceImageMemoryRequirementsKHR;
-    if (!strcmp(name, "GetDeviceImageSparseMemoryRequirementsKHR")) return (void *)table->GetDeviceImageSparseMemoryRequirementsKHR;
-
-    // ---- VK_EXT_debug_marker extension commands
-    if (!strcmp(name, "DebugMarkerSetObjectTagEXT")) return (void *)table->DebugMarkerSetObjectTagEXT;
-    if (!strcmp(name, "DebugMarkerSetObjectNameEXT")) return (void *)table->DebugMarkerSetObjectNameEXT;
-    if (!strcmp(name, "CmdDebugMarkerBeginEXT")) return (void *)table->CmdDebugMarkerBeginEXT;
-    if (!strcmp(name, "CmdDebugMarkerEndEXT")) return (void *)table->CmdDebugMarkerEndEXT;
-    if (!strcmp(name, "CmdDebugMarkerInsertEXT")) return (void *)table->CmdDebugMarkerInsertEXT;
-
-    // ---- VK_EXT_transform_feedback extension commands
-    if (!strcmp(name, "CmdBindTransformFeedbackBuffersEXT")) return (void *)table->CmdBindTransformFeedbackBuffersEXT;
-    if (!strcmp(name, "CmdBeginTransformFeedbackEXT")) return (void *)table->CmdBeginTransformFeedbackEXT;
-    if (!strcmp(name, "CmdEndTransformFeedbackEXT")) return (void *)table->CmdEndTransformFeedbackEXT;
-    if (!strcmp(name, "CmdBeginQueryIndexedEXT")) return (void *)table->CmdBeginQueryIndexedEXT;
-    if (!strcmp(name, "CmdEndQueryIndexedEXT")) return (void *)table->CmdEndQueryIndexedEXT;
-    if (!strcmp(name, "CmdDrawIndirectByteCountEXT")) return (void *)table->CmdDrawIndirectByteCountEXT;
-
-    // ---- VK_NVX_binary_import extension commands
-    if (!strcmp(name, "CreateCuModuleNVX")) return (void *)table->CreateCuModuleNVX;
-    if (!strcmp(name, "CreateCuFunctionNVX")) return (void *)table->CreateCuFunctionNVX;
-    if (!strcmp(name, "DestroyCuModuleNVX")) return (void *)table->DestroyCuModuleNVX;
-    if (!strcmp(name, "DestroyCuFunctionNVX")) return (void *)table->DestroyCuFunctionNVX;
-    if (!strcmp(name, "CmdCuLaunchKernelNVX")) return (void *)table->CmdCuLaunchKernelNVX;
+// Device command lookup function
+VKAPI_ATTR void* VKAPI_CALL loader_lookup_device_dispatch_table(const VkLayerDispatchTable *table, const char *name) {
+    if (!name || name[0] != 'v' || name[1] != 'k') return NULL;
 
-    // ---- VK_NVX_image_view_handle extension commands
-    if (!strcmp(name, "GetImageViewHandleNVX")) return (void *)table->GetImageViewHandleNVX;
-    if (!strcmp(name, "GetImageViewAddressNVX")) return (void *)table->GetImageViewAddressNVX;
+    const struct loader_dispatch_table_entry *entry =
+        &device_dispatch_table_entries[loader_command_name_slot(device_dispatch_table_seeds, 448, name)];
+    if (NULL == entry->name || strcmp(entry->name, name) != 0) return NULL;
 
-    // ---- VK_AMD_draw_indirect_count extension commands
-    if (!strcmp(name, "CmdDrawIndirectCountAMD")) return (void *)table->CmdDrawIndirectCountAMD;
-    if (!strcmp(name, "CmdDrawIndexedIndirectCountAMD")) return (void *)table->CmdDrawIndexedIndirectCountAMD;
+    return (void *)*(const PFN_vkVoidFunction *)((const char *)table + entry->offset);
+}
 
-    // ---- VK_AMD_shader_info extension commands
-    if (!strcmp(name, "GetShaderInfoAMD")) return (void *)table->GetShaderInfoAMD;
+// Instance dispatch table members, in the order of their perfect hash
+static const int32_t instance_dispatch_table_seeds[100] = {
+    0, -1, 0, -7, 0, -13, 2, 1, -18, -19, 2, -20,
+    1, 0, -24, -25, -29, 1, -36, 0, 0, -41, 0, -42,
+    -43, -45, 4, 1, -46, -47, 1, 0, -51, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 1, -53, 0, -56, -58, -62,
+    2, 0, 0, 0, 2, 6, 0, 6, 3, -65, -66, 0,
+    10, -69, 0, 2, 0, 4, 3, 0, 2, 2, -70, 0,
+    -71, -75, -79, 1, -82, 2, -85, 0, 4, 19, 0, 7,
+    0, 0, -86, 0, 2, 1, 0, 0, 0, -88, -92, -93,
+    0, 0, -99, 0,
+};
 
-    // ---- VK_NV_external_memory_win32 extension commands
+static const struct loader_dispatch_table_entry instance_dispatch_table_entries[100] = {
+    {"vkGetPhysicalDeviceCalibrateableTimeDomainsEXT", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceCalibrateableTimeDomainsEXT)},
+    {"vkCreateDebugUtilsMessengerEXT", offsetof(VkLayerInstanceDispatchTable, CreateDebugUtilsMessengerEXT)},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetMemoryWin32HandleNV")) return (void *)table->GetMemoryWin32HandleNV;
+    {"vkCreateWin32SurfaceKHR", offsetof(VkLayerInstanceDispatchTable, CreateWin32SurfaceKHR)},
+#else
+    {NULL, 0},
 #endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_EXT_conditional_rendering extension commands
-    if (!strcmp(name, "CmdBeginConditionalRenderingEXT")) return (void *)table->CmdBeginConditionalRenderingEXT;
-    if (!strcmp(name, "CmdEndConditionalRenderingEXT")) return (void *)table->CmdEndConditionalRenderingEXT;
-
-    // ---- VK_NV_clip_space_w_scaling extension commands
-    if (!strcmp(name, "CmdSetViewportWScalingNV")) return (void *)table->CmdSetViewportWScalingNV;
-
-    // ---- VK_EXT_display_control extension commands
-    if (!strcmp(name, "DisplayPowerControlEXT")) return (void *)table->DisplayPowerControlEXT;
-    if (!strcmp(name, "RegisterDeviceEventEXT")) return (void *)table->RegisterDeviceEventEXT;
-    if (!strcmp(name, "RegisterDisplayEventEXT")) return (void *)table->RegisterDisplayEventEXT;
-    if (!strcmp(name, "GetSwapchainCounterEXT")) return (void *)table->GetSwapchainCounterEXT;
-
-    // ---- VK_GOOGLE_display_timing extension commands
-    if (!strcmp(name, "GetRefreshCycleDurationGOOGLE")) return (void *)table->GetRefreshCycleDurationGOOGLE;
-    if (!strcmp(name, "GetPastPresentationTimingGOOGLE")) return (void *)table->GetPastPresentationTimingGOOGLE;
-
-    // ---- VK_EXT_discard_rectangles extension commands
-    if (!strcmp(name, "CmdSetDiscardRectangleEXT")) return (void *)table->CmdSetDiscardRectangleEXT;
-
-    // ---- VK_EXT_hdr_metadata extension commands
-    if (!strcmp(name, "SetHdrMetadataEXT")) return (void *)table->SetHdrMetadataEXT;
-
-    // ---- VK_EXT_debug_utils extension commands
-    if (!strcmp(name, "SetDebugUtilsObjectNameEXT")) return (void *)table->SetDebugUtilsObjectNameEXT;
-    if (!strcmp(name, "SetDebugUtilsObjectTagEXT")) return (void *)table->SetDebugUtilsObjectTagEXT;
-    if (!strcmp(name, "QueueBeginDebugUtilsLabelEXT")) return (void *)table->QueueBeginDebugUtilsLabelEXT;
-    if (!strcmp(name, "QueueEndDebugUtilsLabelEXT")) return (void *)table->QueueEndDebugUtilsLabelEXT;
-    if (!strcmp(name, "QueueInsertDebugUtilsLabelEXT")) return (void *)table->QueueInsertDebugUtilsLabelEXT;
-    if (!strcmp(name, "CmdBeginDebugUtilsLabelEXT")) return (void *)table->CmdBeginDebugUtilsLabelEXT;
-    if (!strcmp(name, "CmdEndDebugUtilsLabelEXT")) return (void *)table->CmdEndDebugUtilsLabelEXT;
-    if (!strcmp(name, "CmdInsertDebugUtilsLabelEXT")) return (void *)table->CmdInsertDebugUtilsLabelEXT;
-
-    // ---- VK_ANDROID_external_memory_android_hardware_buffer extension commands
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-    if (!strcmp(name, "GetAndroidHardwareBufferPropertiesANDROID")) return (void *)table->GetAndroidHardwareBufferPropertiesANDROID;
-#endif // VK_USE_PLATFORM_ANDROID_KHR
+    {"vkGetPhysicalDeviceSurfaceSupportKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfaceSupportKHR)},
+    {"vkGetPhysicalDeviceExternalFencePropertiesKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalFencePropertiesKHR)},
+    {"vkEnumerateDeviceExtensionProperties", offsetof(VkLayerInstanceDispatchTable, EnumerateDeviceExtensionProperties)},
+    {"vkDestroyDebugUtilsMessengerEXT", offsetof(VkLayerInstanceDispatchTable, DestroyDebugUtilsMessengerEXT)},
+    {"vkGetPhysicalDeviceDisplayPlaneProperties2KHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceDisplayPlaneProperties2KHR)},
+    {"vkGetPhysicalDeviceFeatures", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFeatures)},
+    {"vkDestroySurfaceKHR", offsetof(VkLayerInstanceDispatchTable, DestroySurfaceKHR)},
+    {"vkDebugReportMessageEXT", offsetof(VkLayerInstanceDispatchTable, DebugReportMessageEXT)},
+#ifdef VK_USE_PLATFORM_IOS_MVK
+    {"vkCreateIOSSurfaceMVK", offsetof(VkLayerInstanceDispatchTable, CreateIOSSurfaceMVK)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_IOS_MVK
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    {"vkCreateXcbSurfaceKHR", offsetof(VkLayerInstanceDispatchTable, CreateXcbSurfaceKHR)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_XCB_KHR
+    {"vkGetPhysicalDeviceProperties2", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceProperties2)},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties2KHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSparseImageFormatProperties2KHR)},
+    {"vkGetPhysicalDeviceMemoryProperties2KHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceMemoryProperties2KHR)},
+    {"vkGetDrmDisplayEXT", offsetof(VkLayerInstanceDispatchTable, GetDrmDisplayEXT)},
+    {"vkGetPhysicalDeviceProperties", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceProperties)},
+    {"vkGetPhysicalDeviceSurfacePresentModesKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfacePresentModesKHR)},
+    {"vkSubmitDebugUtilsMessageEXT", offsetof(VkLayerInstanceDispatchTable, SubmitDebugUtilsMessageEXT)},
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+    {"vkCreateMacOSSurfaceMVK", offsetof(VkLayerInstanceDispatchTable, CreateMacOSSurfaceMVK)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_MACOS_MVK
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    {"vkGetPhysicalDeviceXcbPresentationSupportKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceXcbPresentationSupportKHR)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_XCB_KHR
+    {"vkGetPhysicalDeviceExternalFenceProperties", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalFenceProperties)},
+    {"vkGetPhysicalDeviceQueueFamilyProperties2", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceQueueFamilyProperties2)},
+    {"vkReleaseDisplayEXT", offsetof(VkLayerInstanceDispatchTable, ReleaseDisplayEXT)},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkGetPhysicalDeviceVideoCapabilitiesKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceVideoCapabilitiesKHR)},
+#else
+    {NULL, 0},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+    {"vkGetPhysicalDeviceExternalImageFormatPropertiesNV", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalImageFormatPropertiesNV)},
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    {"vkGetPhysicalDeviceXlibPresentationSupportKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceXlibPresentationSupportKHR)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_XLIB_KHR
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+    {"vkGetPhysicalDeviceScreenPresentationSupportQNX", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceScreenPresentationSupportQNX)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_SCREEN_QNX
+    {"vkGetPhysicalDeviceImageFormatProperties2", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceImageFormatProperties2)},
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+    {"vkCreateScreenSurfaceQNX", offsetof(VkLayerInstanceDispatchTable, CreateScreenSurfaceQNX)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_SCREEN_QNX
+    {"vkGetPhysicalDeviceExternalSemaphorePropertiesKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalSemaphorePropertiesKHR)},
+    {"vkGetPhysicalDeviceImageFormatProperties2KHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceImageFormatProperties2KHR)},
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+    {"vkCreateDirectFBSurfaceEXT", offsetof(VkLayerInstanceDispatchTable, CreateDirectFBSurfaceEXT)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_DIRECTFB_EXT
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-    if (!strcmp(name, "GetMemoryAndroidHardwareBufferANDROID")) return (void *)table->GetMemoryAndroidHardwareBufferANDROID;
+    {"vkCreateAndroidSurfaceKHR", offsetof(VkLayerInstanceDispatchTable, CreateAndroidSurfaceKHR)},
+#else
+    {NULL, 0},
 #endif // VK_USE_PLATFORM_ANDROID_KHR
-
-    // ---- VK_EXT_sample_locations extension commands
-    if (!strcmp(name, "CmdSetSampleLocationsEXT")) return (void *)table->CmdSetSampleLocationsEXT;
-
-    // ---- VK_EXT_image_drm_format_modifier extension commands
-    if (!strcmp(name, "GetImageDrmFormatModifierPropertiesEXT")) return (void *)table->GetImageDrmFormatModifierPropertiesEXT;
-
-    // ---- VK_EXT_validation_cache extension commands
-    if (!strcmp(name, "CreateValidationCacheEXT")) return (void *)table->CreateValidationCacheEXT;
-    if (!strcmp(name, "DestroyValidationCacheEXT")) return (void *)table->DestroyValidationCacheEXT;
-    if (!strcmp(name, "MergeValidationCachesEXT")) return (void *)table->MergeValidationCachesEXT;
-    if (!strcmp(name, "GetValidationCacheDataEXT")) return (void *)table->GetValidationCacheDataEXT;
-
-    // ---- VK_NV_shading_rate_image extension commands
-    if (!strcmp(name, "CmdBindShadingRateImageNV")) return (void *)table->CmdBindShadingRateImageNV;
-    if (!strcmp(name, "CmdSetViewportShadingRatePaletteNV")) return (void *)table->CmdSetViewportShadingRatePaletteNV;
-    if (!strcmp(name, "CmdSetCoarseSampleOrderNV")) return (void *)table->CmdSetCoarseSampleOrderNV;
-
-    // ---- VK_NV_ray_tracing extension commands
-    if (!strcmp(name, "CreateAccelerationStructureNV")) return (void *)table->CreateAccelerationStructureNV;
-    if (!strcmp(name, "DestroyAccelerationStructureNV")) return (void *)table->DestroyAccelerationStructureNV;
-    if (!strcmp(name, "GetAccelerationStructureMemoryRequirementsNV")) return (void *)table->GetAccelerationStructureMemoryRequirementsNV;
-    if (!strcmp(name, "BindAccelerationStructureMemoryNV")) return (void *)table->BindAccelerationStructureMemoryNV;
-    if (!strcmp(name, "CmdBuildAccelerationStructureNV")) return (void *)table->CmdBuildAccelerationStructureNV;
-    if (!strcmp(name, "CmdCopyAccelerationStructureNV")) return (void *)table->CmdCopyAccelerationStructureNV;
-    if (!strcmp(name, "CmdTraceRaysNV")) return (void *)table->CmdTraceRaysNV;
-    if (!strcmp(name, "CreateRayTracingPipelinesNV")) return (void *)table->CreateRayTracingPipelinesNV;
-    if (!strcmp(name, "GetRayTracingShaderGroupHandlesKHR")) return (void *)table->GetRayTracingShaderGroupHandlesKHR;
-    if (!strcmp(name, "GetRayTracingShaderGroupHandlesNV")) return (void *)table->GetRayTracingShaderGroupHandlesNV;
-    if (!strcmp(name, "GetAccelerationStructureHandleNV")) return (void *)table->GetAccelerationStructureHandleNV;
-    if (!strcmp(name, "CmdWriteAccelerationStructuresPropertiesNV")) return (void *)table->CmdWriteAccelerationStructuresPropertiesNV;
-    if (!strcmp(name, "CompileDeferredNV")) return (void *)table->CompileDeferredNV;
-
-    // ---- VK_EXT_external_memory_host extension commands
-    if (!strcmp(name, "GetMemoryHostPointerPropertiesEXT")) return (void *)table->GetMemoryHostPointerPropertiesEXT;
-
-    // ---- VK_AMD_buffer_marker extension commands
-    if (!strcmp(name, "CmdWriteBufferMarkerAMD")) return (void *)table->CmdWriteBufferMarkerAMD;
-
-    // ---- VK_EXT_calibrated_timestamps extension commands
-    if (!strcmp(name, "GetCalibratedTimestampsEXT")) return (void *)table->GetCalibratedTimestampsEXT;
-
-    // ---- VK_NV_mesh_shader extension commands
-    if (!strcmp(name, "CmdDrawMeshTasksNV")) return (void *)table->CmdDrawMeshTasksNV;
-    if (!strcmp(name, "CmdDrawMeshTasksIndirectNV")) return (void *)table->CmdDrawMeshTasksIndirectNV;
-    if (!strcmp(name, "CmdDrawMeshTasksIndirectCountNV")) return (void *)table->CmdDrawMeshTasksIndirectCountNV;
-
-    // ---- VK_NV_scissor_exclusive extension commands
-    if (!strcmp(name, "CmdSetExclusiveScissorNV")) return (void *)table->CmdSetExclusiveScissorNV;
-
-    // ---- VK_NV_device_diagnostic_checkpoints extension commands
-    if (!strcmp(name, "CmdSetCheckpointNV")) return (void *)table->CmdSetCheckpointNV;
-    if (!strcmp(name, "GetQueueCheckpointDataNV")) return (void *)table->GetQueueCheckpointDataNV;
-
-    // ---- VK_INTEL_performance_query extension commands
-    if (!strcmp(name, "InitializePerformanceApiINTEL")) return (void *)table->InitializePerformanceApiINTEL;
-    if (!strcmp(name, "UninitializePerformanceApiINTEL")) return (void *)table->UninitializePerformanceApiINTEL;
-    if (!strcmp(name, "CmdSetPerformanceMarkerINTEL")) return (void *)table->CmdSetPerformanceMarkerINTEL;
-    if (!strcmp(name, "CmdSetPerformanceStreamMarkerINTEL")) return (void *)table->CmdSetPerformanceStreamMarkerINTEL;
-    if (!strcmp(name, "CmdSetPerformanceOverrideINTEL")) return (void *)table->CmdSetPerformanceOverrideINTEL;
-    if (!strcmp(name, "AcquirePerformanceConfigurationINTEL")) return (void *)table->AcquirePerformanceConfigurationINTEL;
-    if (!strcmp(name, "ReleasePerformanceConfigurationINTEL")) return (void *)table->ReleasePerformanceConfigurationINTEL;
-    if (!strcmp(name, "QueueSetPerformanceConfigurationINTEL")) return (void *)table->QueueSetPerformanceConfigurationINTEL;
-    if (!strcmp(name, "GetPerformanceParameterINTEL")) return (void *)table->GetPerformanceParameterINTEL;
-
-    // ---- VK_AMD_display_native_hdr extension commands
-    if (!strcmp(name, "SetLocalDimmingAMD")) return (void *)table->SetLocalDimmingAMD;
-
-    // ---- VK_EXT_buffer_device_address extension commands
-    if (!strcmp(name, "GetBufferDeviceAddressEXT")) return (void *)table->GetBufferDeviceAddressEXT;
-
-    // ---- VK_EXT_full_screen_exclusive extension commands
+    {"vkGetPhysicalDeviceExternalBufferProperties", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalBufferProperties)},
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    {"vkGetRandROutputDisplayEXT", offsetof(VkLayerInstanceDispatchTable, GetRandROutputDisplayEXT)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_XLIB_XRANDR_EXT
+#ifdef VK_USE_PLATFORM_VI_NN
+    {"vkCreateViSurfaceNN", offsetof(VkLayerInstanceDispatchTable, CreateViSurfaceNN)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_VI_NN
+    {"vkGetPhysicalDeviceMemoryProperties2", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceMemoryProperties2)},
+    {"vkGetPhysicalDeviceSurfaceCapabilities2KHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfaceCapabilities2KHR)},
+    {"vkGetPhysicalDeviceFragmentShadingRatesKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFragmentShadingRatesKHR)},
+    {"vkGetPhysicalDeviceMemoryProperties", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceMemoryProperties)},
+    {"vkGetPhysicalDeviceImageFormatProperties", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceImageFormatProperties)},
+    {"vkGetInstanceProcAddr", offsetof(VkLayerInstanceDispatchTable, GetInstanceProcAddr)},
+    {"vkGetPhysicalDeviceMultisamplePropertiesEXT", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceMultisamplePropertiesEXT)},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "AcquireFullScreenExclusiveModeEXT")) return (void *)table->AcquireFullScreenExclusiveModeEXT;
+    {"vkGetWinrtDisplayNV", offsetof(VkLayerInstanceDispatchTable, GetWinrtDisplayNV)},
+#else
+    {NULL, 0},
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "ReleaseFullScreenExclusiveModeEXT")) return (void *)table->ReleaseFullScreenExclusiveModeEXT;
+    {"vkGetPhysicalDeviceSurfacePresentModes2EXT", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfacePresentModes2EXT)},
+#else
+    {NULL, 0},
 #endif // VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetPhysicalDeviceCooperativeMatrixPropertiesNV", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceCooperativeMatrixPropertiesNV)},
+#ifdef VK_USE_PLATFORM_GGP
+    {"vkCreateStreamDescriptorSurfaceGGP", offsetof(VkLayerInstanceDispatchTable, CreateStreamDescriptorSurfaceGGP)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_GGP
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetDeviceGroupSurfacePresentModes2EXT")) return (void *)table->GetDeviceGroupSurfacePresentModes2EXT;
+    {"vkAcquireWinrtDisplayNV", offsetof(VkLayerInstanceDispatchTable, AcquireWinrtDisplayNV)},
+#else
+    {NULL, 0},
 #endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_EXT_line_rasterization extension commands
-    if (!strcmp(name, "CmdSetLineStippleEXT")) return (void *)table->CmdSetLineStippleEXT;
-
-    // ---- VK_EXT_host_query_reset extension commands
-    if (!strcmp(name, "ResetQueryPoolEXT")) return (void *)table->ResetQueryPoolEXT;
-
-    // ---- VK_EXT_extended_dynamic_state extension commands
-    if (!strcmp(name, "CmdSetCullModeEXT")) return (void *)table->CmdSetCullModeEXT;
-    if (!strcmp(name, "CmdSetFrontFaceEXT")) return (void *)table->CmdSetFrontFaceEXT;
-    if (!strcmp(name, "CmdSetPrimitiveTopologyEXT")) return (void *)table->CmdSetPrimitiveTopologyEXT;
-    if (!strcmp(name, "CmdSetViewportWithCountEXT")) return (void *)table->CmdSetViewportWithCountEXT;
-    if (!strcmp(name, "CmdSetScissorWithCountEXT")) return (void *)table->CmdSetScissorWithCountEXT;
-    if (!strcmp(name, "CmdBindVertexBuffers2EXT")) return (void *)table->CmdBindVertexBuffers2EXT;
-    if (!strcmp(name, "CmdSetDepthTestEnableEXT")) return (void *)table->CmdSetDepthTestEnableEXT;
-    if (!strcmp(name, "CmdSetDepthWriteEnableEXT")) return (void *)table->CmdSetDepthWriteEnableEXT;
-    if (!strcmp(name, "CmdSetDepthCompareOpEXT")) return (void *)table->CmdSetDepthCompareOpEXT;
-    if (!strcmp(name, "CmdSetDepthBoundsTestEnableEXT")) return (void *)table->CmdSetDepthBoundsTestEnableEXT;
-    if (!strcmp(name, "CmdSetStencilTestEnableEXT")) return (void *)table->CmdSetStencilTestEnableEXT;
-    if (!strcmp(name, "CmdSetStencilOpEXT")) return (void *)table->CmdSetStencilOpEXT;
-
-    // ---- VK_NV_device_generated_commands extension commands
-    if (!strcmp(name, "GetGeneratedCommandsMemoryRequirementsNV")) return (void *)table->GetGeneratedCommandsMemoryRequirementsNV;
-    if (!strcmp(name, "CmdPreprocessGeneratedCommandsNV")) return (void *)table->CmdPreprocessGeneratedCommandsNV;
-    if (!strcmp(name, "CmdExecuteGeneratedCommandsNV")) return (void *)table->CmdExecuteGeneratedCommandsNV;
-    if (!strcmp(name, "CmdBindPipelineShaderGroupNV")) return (void *)table->CmdBindPipelineShaderGroupNV;
-    if (!strcmp(name, "CreateIndirectCommandsLayoutNV")) return (void *)table->CreateIndirectCommandsLayoutNV;
-    if (!strcmp(name, "DestroyIndirectCommandsLayoutNV")) return (void *)table->DestroyIndirectCommandsLayoutNV;
-
-    // ---- VK_EXT_private_data extension commands
-    if (!strcmp(name, "CreatePrivateDataSlotEXT")) return (void *)table->CreatePrivateDataSlotEXT;
-    if (!strcmp(name, "DestroyPrivateDataSlotEXT")) return (void *)table->DestroyPrivateDataSlotEXT;
-    if (!strcmp(name, "SetPrivateDataEXT")) return (void *)table->SetPrivateDataEXT;
-    if (!strcmp(name, "GetPrivateDataEXT")) return (void *)table->GetPrivateDataEXT;
-
-    // ---- VK_EXT_metal_objects extension commands
+    {"vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR)},
+    {"vkCreateHeadlessSurfaceEXT", offsetof(VkLayerInstanceDispatchTable, CreateHeadlessSurfaceEXT)},
+    {"vkEnumeratePhysicalDeviceGroups", offsetof(VkLayerInstanceDispatchTable, EnumeratePhysicalDeviceGroups)},
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    {"vkCreateWaylandSurfaceKHR", offsetof(VkLayerInstanceDispatchTable, CreateWaylandSurfaceKHR)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_WAYLAND_KHR
+    {"vkCreateDisplayPlaneSurfaceKHR", offsetof(VkLayerInstanceDispatchTable, CreateDisplayPlaneSurfaceKHR)},
+    {"vkEnumeratePhysicalDeviceGroupsKHR", offsetof(VkLayerInstanceDispatchTable, EnumeratePhysicalDeviceGroupsKHR)},
+    {"vkDestroyInstance", offsetof(VkLayerInstanceDispatchTable, DestroyInstance)},
+    {"vkGetPhysicalDevicePresentRectanglesKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDevicePresentRectanglesKHR)},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSparseImageFormatProperties)},
+    {"vkGetPhysicalDeviceExternalBufferPropertiesKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalBufferPropertiesKHR)},
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    {"vkAcquireXlibDisplayEXT", offsetof(VkLayerInstanceDispatchTable, AcquireXlibDisplayEXT)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    {"vkGetPhysicalDeviceDisplayProperties2KHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceDisplayProperties2KHR)},
+    {"vkGetPhysicalDeviceQueueFamilyProperties2KHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceQueueFamilyProperties2KHR)},
+    {"vkGetDisplayModePropertiesKHR", offsetof(VkLayerInstanceDispatchTable, GetDisplayModePropertiesKHR)},
+    {"vkGetPhysicalDeviceQueueFamilyProperties", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceQueueFamilyProperties)},
+    {"vkGetPhysicalDeviceFormatProperties2", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFormatProperties2)},
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    {"vkGetPhysicalDeviceWaylandPresentationSupportKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceWaylandPresentationSupportKHR)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_WAYLAND_KHR
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    {"vkCreateXlibSurfaceKHR", offsetof(VkLayerInstanceDispatchTable, CreateXlibSurfaceKHR)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_XLIB_KHR
+    {"vkGetPhysicalDeviceSurfaceFormatsKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfaceFormatsKHR)},
+    {"vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR", offsetof(VkLayerInstanceDispatchTable, EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR)},
+    {"vkGetPhysicalDeviceFormatProperties", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFormatProperties)},
 #ifdef VK_USE_PLATFORM_METAL_EXT
-    if (!strcmp(name, "ExportMetalObjectsEXT")) return (void *)table->ExportMetalObjectsEXT;
+    {"vkCreateMetalSurfaceEXT", offsetof(VkLayerInstanceDispatchTable, CreateMetalSurfaceEXT)},
+#else
+    {NULL, 0},
 #endif // VK_USE_PLATFORM_METAL_EXT
-
-    // ---- VK_NV_fragment_shading_rate_enums extension commands
-    if (!strcmp(name, "CmdSetFragmentShadingRateEnumNV")) return (void *)table->CmdSetFragmentShadingRateEnumNV;
-
-    // ---- VK_EXT_image_compression_control extension commands
-    if (!strcmp(name, "GetImageSubresourceLayout2EXT")) return (void *)table->GetImageSubresourceLayout2EXT;
-
-    // ---- VK_EXT_vertex_input_dynamic_state extension commands
-    if (!strcmp(name, "CmdSetVertexInputEXT")) return (void *)table->CmdSetVertexInputEXT;
-
-    // ---- VK_FUCHSIA_external_memory extension commands
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "GetMemoryZirconHandleFUCHSIA")) return (void *)table->GetMemoryZirconHandleFUCHSIA;
-#endif // VK_USE_PLATFORM_FUCHSIA
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "GetMemoryZirconHandlePropertiesFUCHSIA")) return (void *)table->GetMemoryZirconHandlePropertiesFUCHSIA;
-#endif // VK_USE_PLATFORM_FUCHSIA
-
-    // ---- VK_FUCHSIA_external_semaphore extension commands
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "ImportSemaphoreZirconHandleFUCHSIA")) return (void *)table->ImportSemaphoreZirconHandleFUCHSIA;
-#endif // VK_USE_PLATFORM_FUCHSIA
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "GetSemaphoreZirconHandleFUCHSIA")) return (void *)table->GetSemaphoreZirconHandleFUCHSIA;
-#endif // VK_USE_PLATFORM_FUCHSIA
-
-    // ---- VK_FUCHSIA_buffer_collection extension commands
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "CreateBufferCollectionFUCHSIA")) return (void *)table->CreateBufferCollectionFUCHSIA;
-#endif // VK_USE_PLATFORM_FUCHSIA
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "SetBufferCollectionImageConstraintsFUCHSIA")) return (void *)table->SetBufferCollectionImageConstraintsFUCHSIA;
-#endif // VK_USE_PLATFORM_FUCHSIA
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "SetBufferCollectionBufferConstraintsFUCHSIA")) return (void *)table->SetBufferCollectionBufferConstraintsFUCHSIA;
-#endif // VK_USE_PLATFORM_FUCHSIA
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "DestroyBufferCollectionFUCHSIA")) return (void *)table->DestroyBufferCollectionFUCHSIA;
-#endif // VK_USE_PLATFORM_FUCHSIA
+    {"vkDestroyDebugReportCallbackEXT", offsetof(VkLayerInstanceDispatchTable, DestroyDebugReportCallbackEXT)},
+    {"vkGetPhysicalDeviceSurfaceCapabilities2EXT", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfaceCapabilities2EXT)},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkGetPhysicalDeviceVideoFormatPropertiesKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceVideoFormatPropertiesKHR)},
+#else
+    {NULL, 0},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+    {"vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV)},
+    {"vkCreateDebugReportCallbackEXT", offsetof(VkLayerInstanceDispatchTable, CreateDebugReportCallbackEXT)},
+    {"vkGetPhysicalDeviceFeatures2KHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFeatures2KHR)},
+    {"vkCreateDisplayModeKHR", offsetof(VkLayerInstanceDispatchTable, CreateDisplayModeKHR)},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties2", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSparseImageFormatProperties2)},
+    {"vkGetPhysicalDeviceProperties2KHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceProperties2KHR)},
+    {"vkAcquireDrmDisplayEXT", offsetof(VkLayerInstanceDispatchTable, AcquireDrmDisplayEXT)},
+    {"vkGetPhysicalDeviceFormatProperties2KHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFormatProperties2KHR)},
+    {"vkGetPhysicalDeviceExternalSemaphoreProperties", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalSemaphoreProperties)},
+    {"vkGetPhysicalDeviceSurfaceFormats2KHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfaceFormats2KHR)},
+    {"vkGetDisplayPlaneCapabilities2KHR", offsetof(VkLayerInstanceDispatchTable, GetDisplayPlaneCapabilities2KHR)},
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+    {"vkGetPhysicalDeviceDirectFBPresentationSupportEXT", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceDirectFBPresentationSupportEXT)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_DIRECTFB_EXT
+    {"vkGetPhysicalDeviceSurfaceCapabilitiesKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfaceCapabilitiesKHR)},
+    {"vkGetPhysicalDeviceDisplayPropertiesKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceDisplayPropertiesKHR)},
+    {"vkEnumerateDeviceLayerProperties", offsetof(VkLayerInstanceDispatchTable, EnumerateDeviceLayerProperties)},
+    {"vkGetDisplayModeProperties2KHR", offsetof(VkLayerInstanceDispatchTable, GetDisplayModeProperties2KHR)},
+    {"vkGetPhysicalDeviceDisplayPlanePropertiesKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceDisplayPlanePropertiesKHR)},
+    {"vkGetDisplayPlaneSupportedDisplaysKHR", offsetof(VkLayerInstanceDispatchTable, GetDisplayPlaneSupportedDisplaysKHR)},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetPhysicalDeviceWin32PresentationSupportKHR", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceWin32PresentationSupportKHR)},
+#else
+    {NULL, 0},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetPhysicalDeviceToolPropertiesEXT", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceToolPropertiesEXT)},
+    {"vkGetPhysicalDeviceFeatures2", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFeatures2)},
+    {"vkGetPhysicalDeviceToolProperties", offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceToolProperties)},
+    {"vkGetDisplayPlaneCapabilitiesKHR", offsetof(VkLayerInstanceDispatchTable, GetDisplayPlaneCapabilitiesKHR)},
 #ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "GetBufferCollectionPropertiesFUCHSIA")) return (void *)table->GetBufferCollectionPropertiesFUCHSIA;
+    {"vkCreateImagePipeSurfaceFUCHSIA", offsetof(VkLayerInstanceDispatchTable, CreateImagePipeSurfaceFUCHSIA)},
+#else
+    {NULL, 0},
 #endif // VK_USE_PLATFORM_FUCHSIA
-
-    // ---- VK_HUAWEI_subpass_shading extension commands
-    if (!strcmp(name, "GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI")) return (void *)table->GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
-    if (!strcmp(name, "CmdSubpassShadingHUAWEI")) return (void *)table->CmdSubpassShadingHUAWEI;
-
-    // ---- VK_HUAWEI_invocation_mask extension commands
-    if (!strcmp(name, "CmdBindInvocationMaskHUAWEI")) return (void *)table->CmdBindInvocationMaskHUAWEI;
-
-    // ---- VK_NV_external_memory_rdma extension commands
-    if (!strcmp(name, "GetMemoryRemoteAddressNV")) return (void *)table->GetMemoryRemoteAddressNV;
-
-    // ---- VK_EXT_pipeline_properties extension commands
-    if (!strcmp(name, "GetPipelinePropertiesEXT")) return (void *)table->GetPipelinePropertiesEXT;
-
-    // ---- VK_EXT_extended_dynamic_state2 extension commands
-    if (!strcmp(name, "CmdSetPatchControlPointsEXT")) return (void *)table->CmdSetPatchControlPointsEXT;
-    if (!strcmp(name, "CmdSetRasterizerDiscardEnableEXT")) return (void *)table->CmdSetRasterizerDiscardEnableEXT;
-    if (!strcmp(name, "CmdSetDepthBiasEnableEXT")) return (void *)table->CmdSetDepthBiasEnableEXT;
-    if (!strcmp(name, "CmdSetLogicOpEXT")) return (void *)table->CmdSetLogicOpEXT;
-    if (!strcmp(name, "CmdSetPrimitiveRestartEnableEXT")) return (void *)table->CmdSetPrimitiveRestartEnableEXT;
-
-    // ---- VK_EXT_color_write_enable extension commands
-    if (!strcmp(name, "CmdSetColorWriteEnableEXT")) return (void *)table->CmdSetColorWriteEnableEXT;
-
-    // ---- VK_EXT_multi_draw extension commands
-    if (!strcmp(name, "CmdDrawMultiEXT")) return (void *)table->CmdDrawMultiEXT;
-    if (!strcmp(name, "CmdDrawMultiIndexedEXT")) return (void *)table->CmdDrawMultiIndexedEXT;
-
-    // ---- VK_EXT_pageable_device_local_memory extension commands
-    if (!strcmp(name, "SetDeviceMemoryPriorityEXT")) return (void *)table->SetDeviceMemoryPriorityEXT;
-
-    // ---- VK_VALVE_descriptor_set_host_mapping extension commands
-    if (!strcmp(name, "GetDescriptorSetLayoutHostMappingInfoVALVE")) return (void *)table->GetDescriptorSetLayoutHostMappingInfoVALVE;
-    if (!strcmp(name, "GetDescriptorSetHostMappingVALVE")) return (void *)table->GetDescriptorSetHostMappingVALVE;
-
-    // ---- VK_EXT_shader_module_identifier extension commands
-    if (!strcmp(name, "GetShaderModuleIdentifierEXT")) return (void *)table->GetShaderModuleIdentifierEXT;
-    if (!strcmp(name, "GetShaderModuleCreateInfoIdentifierEXT")) return (void *)table->GetShaderModuleCreateInfoIdentifierEXT;
-
-    // ---- VK_QCOM_tile_properties extension commands
-    if (!strcmp(name, "GetFramebufferTilePropertiesQCOM")) return (void *)table->GetFramebufferTilePropertiesQCOM;
-    if (!strcmp(name, "GetDynamicRenderingTilePropertiesQCOM")) return (void *)table->GetDynamicRenderingTilePropertiesQCOM;
-
-    // ---- VK_KHR_acceleration_structure extension commands
-    if (!strcmp(name, "CreateAccelerationStructureKHR")) return (void *)table->CreateAccelerationStructureKHR;
-    if (!strcmp(name, "DestroyAccelerationStructureKHR")) return (void *)table->DestroyAccelerationStructureKHR;
-    if (!strcmp(name, "CmdBuildAccelerationStructuresKHR")) return (void *)table->CmdBuildAccelerationStructuresKHR;
-    if (!strcmp(name, "CmdBuildAccelerationStructuresIndirectKHR")) return (void *)table->CmdBuildAccelerationStructuresIndirectKHR;
-    if (!strcmp(name, "BuildAccelerationStructuresKHR")) return (void *)table->BuildAccelerationStructuresKHR;
-    if (!strcmp(name, "CopyAccelerationStructureKHR")) return (void *)table->CopyAccelerationStructureKHR;
-    if (!strcmp(name, "CopyAccelerationStructureToMemoryKHR")) return (void *)table->CopyAccelerationStructureToMemoryKHR;
-    if (!strcmp(name, "CopyMemoryToAccelerationStructureKHR")) return (void *)table->CopyMemoryToAccelerationStructureKHR;
-    if (!strcmp(name, "WriteAccelerationStructuresPropertiesKHR")) return (void *)table->WriteAccelerationStructuresPropertiesKHR;
-    if (!strcmp(name, "CmdCopyAccelerationStructureKHR")) return (void *)table->CmdCopyAccelerationStructureKHR;
-    if (!strcmp(name, "CmdCopyAccelerationStructureToMemoryKHR")) return (void *)table->CmdCopyAccelerationStructureToMemoryKHR;
-    if (!strcmp(name, "CmdCopyMemoryToAccelerationStructureKHR")) return (void *)table->CmdCopyMemoryToAccelerationStructureKHR;
-    if (!strcmp(name, "GetAccelerationStructureDeviceAddressKHR")) return (void *)table->GetAccelerationStructureDeviceAddressKHR;
-    if (!strcmp(name, "CmdWriteAccelerationStructuresPropertiesKHR")) return (void *)table->CmdWriteAccelerationStructuresPropertiesKHR;
-    if (!strcmp(name, "GetDeviceAccelerationStructureCompatibilityKHR")) return (void *)table->GetDeviceAccelerationStructureCompatibilityKHR;
-    if (!strcmp(name, "GetAccelerationStructureBuildSizesKHR")) return (void *)table->GetAccelerationStructureBuildSizesKHR;
-
-    // ---- VK_KHR_ray_tracing_pipeline extension commands
-    if (!strcmp(name, "CmdTraceRaysKHR")) return (void *)table->CmdTraceRaysKHR;
-    if (!strcmp(name, "CreateRayTracingPipelinesKHR")) return (void *)table->CreateRayTracingPipelinesKHR;
-    if (!strcmp(name, "GetRayTracingCaptureReplayShaderGroupHandlesKHR")) return (void *)table->GetRayTracingCaptureReplayShaderGroupHandlesKHR;
-    if (!strcmp(name, "CmdTraceRaysIndirectKHR")) return (void *)table->CmdTraceRaysIndirectKHR;
-    if (!strcmp(name, "GetRayTracingShaderGroupStackSizeKHR")) return (void *)table->GetRayTracingShaderGroupStackSizeKHR;
-    if (!strcmp(name, "CmdSetRayTracingPipelineStackSizeKHR")) return (void *)table->CmdSetRayTracingPipelineStackSizeKHR;
-
-    return NULL;
-}
+    {"vkEnumeratePhysicalDevices", offsetof(VkLayerInstanceDispatchTable, EnumeratePhysicalDevices)},
+};
 
 // Instance command lookup function
 VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,
@@ -2014,251 +2197,278 @@ VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerI
         return NULL;
     }
 
-    *found_name = true;
-    name += 2;
-
-    // ---- Core 1_0 commands
-    if (!strcmp(name, "DestroyInstance")) return (void *)table->DestroyInstance;
-    if (!strcmp(name, "EnumeratePhysicalDevices")) return (void *)table->EnumeratePhysicalDevices;
-    if (!strcmp(name, "GetPhysicalDeviceFeatures")) return (void *)table->GetPhysicalDeviceFeatures;
-    if (!strcmp(name, "GetPhysicalDeviceFormatProperties")) return (void *)table->GetPhysicalDeviceFormatProperties;
-    if (!strcmp(name, "GetPhysicalDeviceImageFormatProperties")) return (void *)table->GetPhysicalDeviceImageFormatProperties;
-    if (!strcmp(name, "GetPhysicalDeviceProperties")) return (void *)table->GetPhysicalDeviceProperties;
-    if (!strcmp(name, "GetPhysicalDeviceQueueFamilyProperties")) return (void *)table->GetPhysicalDeviceQueueFamilyProperties;
-    if (!strcmp(name, "GetPhysicalDeviceMemoryProperties")) return (void *)table->GetPhysicalDeviceMemoryProperties;
-    if (!strcmp(name, "GetInstanceProcAddr")) return (void *)table->GetInstanceProcAddr;
-    if (!strcmp(name, "EnumerateDeviceExtensionProperties")) return (void *)table->EnumerateDeviceExtensionProperties;
-    if (!strcmp(name, "EnumerateDeviceLayerProperties")) return (void *)table->EnumerateDeviceLayerProperties;
-    if (!strcmp(name, "GetPhysicalDeviceSparseImageFormatProperties")) return (void *)table->GetPhysicalDeviceSparseImageFormatProperties;
-
-    // ---- Core 1_1 commands
-    if (!strcmp(name, "EnumeratePhysicalDeviceGroups")) return (void *)table->EnumeratePhysicalDeviceGroups;
-    if (!strcmp(name, "GetPhysicalDeviceFeatures2")) return (void *)table->GetPhysicalDeviceFeatures2;
-    if (!strcmp(name, "GetPhysicalDeviceProperties2")) return (void *)table->GetPhysicalDeviceProperties2;
-    if (!strcmp(name, "GetPhysicalDeviceFormatProperties2")) return (void *)table->GetPhysicalDeviceFormatProperties2;
-    if (!strcmp(name, "GetPhysicalDeviceImageFormatProperties2")) return (void *)table->GetPhysicalDeviceImageFormatProperties2;
-    if (!strcmp(name, "GetPhysicalDeviceQueueFamilyProperties2")) return (void *)table->GetPhysicalDeviceQueueFamilyProperties2;
-    if (!strcmp(name, "GetPhysicalDeviceMemoryProperties2")) return (void *)table->GetPhysicalDeviceMemoryProperties2;
-    if (!strcmp(name, "GetPhysicalDeviceSparseImageFormatProperties2")) return (void *)table->GetPhysicalDeviceSparseImageFormatProperties2;
-    if (!strcmp(name, "GetPhysicalDeviceExternalBufferProperties")) return (void *)table->GetPhysicalDeviceExternalBufferProperties;
-    if (!strcmp(name, "GetPhysicalDeviceExternalFenceProperties")) return (void *)table->GetPhysicalDeviceExternalFenceProperties;
-    if (!strcmp(name, "GetPhysicalDeviceExternalSemaphoreProperties")) return (void *)table->GetPhysicalDeviceExternalSemaphoreProperties;
-
-    // ---- Core 1_3 commands
-    if (!strcmp(name, "GetPhysicalDeviceToolProperties")) return (void *)table->GetPhysicalDeviceToolProperties;
-
-    // ---- VK_KHR_surface extension commands
-    if (!strcmp(name, "DestroySurfaceKHR")) return (void *)table->DestroySurfaceKHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceSupportKHR")) return (void *)table->GetPhysicalDeviceSurfaceSupportKHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceCapabilitiesKHR")) return (void *)table->GetPhysicalDeviceSurfaceCapabilitiesKHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceFormatsKHR")) return (void *)table->GetPhysicalDeviceSurfaceFormatsKHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfacePresentModesKHR")) return (void *)table->GetPhysicalDeviceSurfacePresentModesKHR;
-
-    // ---- VK_KHR_swapchain extension commands
-    if (!strcmp(name, "GetPhysicalDevicePresentRectanglesKHR")) return (void *)table->GetPhysicalDevicePresentRectanglesKHR;
-
-    // ---- VK_KHR_display extension commands
-    if (!strcmp(name, "GetPhysicalDeviceDisplayPropertiesKHR")) return (void *)table->GetPhysicalDeviceDisplayPropertiesKHR;
-    if (!strcmp(name, "GetPhysicalDeviceDisplayPlanePropertiesKHR")) return (void *)table->GetPhysicalDeviceDisplayPlanePropertiesKHR;
-    if (!strcmp(name, "GetDisplayPlaneSupportedDisplaysKHR")) return (void *)table->GetDisplayPlaneSupportedDisplaysKHR;
-    if (!strcmp(name, "GetDisplayModePropertiesKHR")) return (void *)table->GetDisplayModePropertiesKHR;
-    if (!strcmp(name, "CreateDisplayModeKHR")) return (void *)table->CreateDisplayModeKHR;
-    if (!strcmp(name, "GetDisplayPlaneCapabilitiesKHR")) return (void *)table->GetDisplayPlaneCapabilitiesKHR;
-    if (!strcmp(name, "CreateDisplayPlaneSurfaceKHR")) return (void *)table->CreateDisplayPlaneSurfaceKHR;
-
-    // ---- VK_KHR_xlib_surface extension commands
-#ifdef VK_USE_PLATFORM_XLIB_KHR
-    if (!strcmp(name, "CreateXlibSurfaceKHR")) return (void *)table->CreateXlibSurfaceKHR;
-#endif // VK_USE_PLATFORM_XLIB_KHR
-#ifdef VK_USE_PLATFORM_XLIB_KHR
-    if (!strcmp(name, "GetPhysicalDeviceXlibPresentationSupportKHR")) return (void *)table->GetPhysicalDeviceXlibPresentationSupportKHR;
-#endif // VK_USE_PLATFORM_XLIB_KHR
-
-    // ---- VK_KHR_xcb_surface extension commands
-#ifdef VK_USE_PLATFORM_XCB_KHR
-    if (!strcmp(name, "CreateXcbSurfaceKHR")) return (void *)table->CreateXcbSurfaceKHR;
-#endif // VK_USE_PLATFORM_XCB_KHR
-#ifdef VK_USE_PLATFORM_XCB_KHR
-    if (!strcmp(name, "GetPhysicalDeviceXcbPresentationSupportKHR")) return (void *)table->GetPhysicalDeviceXcbPresentationSupportKHR;
-#endif // VK_USE_PLATFORM_XCB_KHR
-
-    // ---- VK_KHR_wayland_surface extension commands
-#ifdef VK_USE_PLATFORM_WAYLAND_KHR
-    if (!strcmp(name, "CreateWaylandSurfaceKHR")) return (void *)table->CreateWaylandSurfaceKHR;
-#endif // VK_USE_PLATFORM_WAYLAND_KHR
-#ifdef VK_USE_PLATFORM_WAYLAND_KHR
-    if (!strcmp(name, "GetPhysicalDeviceWaylandPresentationSupportKHR")) return (void *)table->GetPhysicalDeviceWaylandPresentationSupportKHR;
-#endif // VK_USE_PLATFORM_WAYLAND_KHR
-
-    // ---- VK_KHR_android_surface extension commands
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-    if (!strcmp(name, "CreateAndroidSurfaceKHR")) return (void *)table->CreateAndroidSurfaceKHR;
-#endif // VK_USE_PLATFORM_ANDROID_KHR
-
-    // ---- VK_KHR_win32_surface extension commands
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "CreateWin32SurfaceKHR")) return (void *)table->CreateWin32SurfaceKHR;
-#endif // VK_USE_PLATFORM_WIN32_KHR
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetPhysicalDeviceWin32PresentationSupportKHR")) return (void *)table->GetPhysicalDeviceWin32PresentationSupportKHR;
-#endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_KHR_video_queue extension commands
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "GetPhysicalDeviceVideoCapabilitiesKHR")) return (void *)table->GetPhysicalDeviceVideoCapabilitiesKHR;
-#endif // VK_ENABLE_BETA_EXTENSIONS
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "GetPhysicalDeviceVideoFormatPropertiesKHR")) return (void *)table->GetPhysicalDeviceVideoFormatPropertiesKHR;
-#endif // VK_ENABLE_BETA_EXTENSIONS
-
-    // ---- VK_KHR_get_physical_device_properties2 extension commands
-    if (!strcmp(name, "GetPhysicalDeviceFeatures2KHR")) return (void *)table->GetPhysicalDeviceFeatures2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceProperties2KHR")) return (void *)table->GetPhysicalDeviceProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceFormatProperties2KHR")) return (void *)table->GetPhysicalDeviceFormatProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceImageFormatProperties2KHR")) return (void *)table->GetPhysicalDeviceImageFormatProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceQueueFamilyProperties2KHR")) return (void *)table->GetPhysicalDeviceQueueFamilyProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceMemoryProperties2KHR")) return (void *)table->GetPhysicalDeviceMemoryProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceSparseImageFormatProperties2KHR")) return (void *)table->GetPhysicalDeviceSparseImageFormatProperties2KHR;
-
-    // ---- VK_KHR_device_group_creation extension commands
-    if (!strcmp(name, "EnumeratePhysicalDeviceGroupsKHR")) return (void *)table->EnumeratePhysicalDeviceGroupsKHR;
-
-    // ---- VK_KHR_external_memory_capabilities extension commands
-    if (!strcmp(name, "GetPhysicalDeviceExternalBufferPropertiesKHR")) return (void *)table->GetPhysicalDeviceExternalBufferPropertiesKHR;
-
-    // ---- VK_KHR_external_semaphore_capabilities extension commands
-    if (!strcmp(name, "GetPhysicalDeviceExternalSemaphorePropertiesKHR")) return (void *)table->GetPhysicalDeviceExternalSemaphorePropertiesKHR;
-
-    // ---- VK_KHR_external_fence_capabilities extension commands
-    if (!strcmp(name, "GetPhysicalDeviceExternalFencePropertiesKHR")) return (void *)table->GetPhysicalDeviceExternalFencePropertiesKHR;
-
-    // ---- VK_KHR_performance_query extension commands
-    if (!strcmp(name, "EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR")) return (void *)table->EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR;
-    if (!strcmp(name, "GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR")) return (void *)table->GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR;
-
-    // ---- VK_KHR_get_surface_capabilities2 extension commands
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceCapabilities2KHR")) return (void *)table->GetPhysicalDeviceSurfaceCapabilities2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceFormats2KHR")) return (void *)table->GetPhysicalDeviceSurfaceFormats2KHR;
-
-    // ---- VK_KHR_get_display_properties2 extension commands
-    if (!strcmp(name, "GetPhysicalDeviceDisplayProperties2KHR")) return (void *)table->GetPhysicalDeviceDisplayProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceDisplayPlaneProperties2KHR")) return (void *)table->GetPhysicalDeviceDisplayPlaneProperties2KHR;
-    if (!strcmp(name, "GetDisplayModeProperties2KHR")) return (void *)table->GetDisplayModeProperties2KHR;
-    if (!strcmp(name, "GetDisplayPlaneCapabilities2KHR")) return (void *)table->GetDisplayPlaneCapabilities2KHR;
-
-    // ---- VK_KHR_fragment_shading_rate extension commands
-    if (!strcmp(name, "GetPhysicalDeviceFragmentShadingRatesKHR")) return (void *)table->GetPhysicalDeviceFragmentShadingRatesKHR;
-
-    // ---- VK_EXT_debug_report extension commands
-    if (!strcmp(name, "CreateDebugReportCallbackEXT")) return (void *)table->CreateDebugReportCallbackEXT;
-    if (!strcmp(name, "DestroyDebugReportCallbackEXT")) return (void *)table->DestroyDebugReportCallbackEXT;
-    if (!strcmp(name, "DebugReportMessageEXT")) return (void *)table->DebugReportMessageEXT;
-
-    // ---- VK_GGP_stream_descriptor_surface extension commands
-#ifdef VK_USE_PLATFORM_GGP
-    if (!strcmp(name, "CreateStreamDescriptorSurfaceGGP")) return (void *)table->CreateStreamDescriptorSurfaceGGP;
-#endif // VK_USE_PLATFORM_GGP
-
-    // ---- VK_NV_external_memory_capabilities extension commands
-    if (!strcmp(name, "GetPhysicalDeviceExternalImageFormatPropertiesNV")) return (void *)table->GetPhysicalDeviceExternalImageFormatPropertiesNV;
-
-    // ---- VK_NN_vi_surface extension commands
-#ifdef VK_USE_PLATFORM_VI_NN
-    if (!strcmp(name, "CreateViSurfaceNN")) return (void *)table->CreateViSurfaceNN;
-#endif // VK_USE_PLATFORM_VI_NN
-
-    // ---- VK_EXT_direct_mode_display extension commands
-    if (!strcmp(name, "ReleaseDisplayEXT")) return (void *)table->ReleaseDisplayEXT;
-
-    // ---- VK_EXT_acquire_xlib_display extension commands
-#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
-    if (!strcmp(name, "AcquireXlibDisplayEXT")) return (void *)table->AcquireXlibDisplayEXT;
-#endif // VK_USE_PLATFORM_XLIB_XRANDR_EXT
-#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
-    if (!strcmp(name, "GetRandROutputDisplayEXT")) return (void *)table->GetRandROutputDisplayEXT;
-#endif // VK_USE_PLATFORM_XLIB_XRANDR_EXT
-
-    // ---- VK_EXT_display_surface_counter extension commands
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceCapabilities2EXT")) return (void *)table->GetPhysicalDeviceSurfaceCapabilities2EXT;
-
-    // ---- VK_MVK_ios_surface extension commands
-#ifdef VK_USE_PLATFORM_IOS_MVK
-    if (!strcmp(name, "CreateIOSSurfaceMVK")) return (void *)table->CreateIOSSurfaceMVK;
-#endif // VK_USE_PLATFORM_IOS_MVK
-
-    // ---- VK_MVK_macos_surface extension commands
-#ifdef VK_USE_PLATFORM_MACOS_MVK
-    if (!strcmp(name, "CreateMacOSSurfaceMVK")) return (void *)table->CreateMacOSSurfaceMVK;
-#endif // VK_USE_PLATFORM_MACOS_MVK
-
-    // ---- VK_EXT_debug_utils extension commands
-    if (!strcmp(name, "CreateDebugUtilsMessengerEXT")) return (void *)table->CreateDebugUtilsMessengerEXT;
-    if (!strcmp(name, "DestroyDebugUtilsMessengerEXT")) return (void *)table->DestroyDebugUtilsMessengerEXT;
-    if (!strcmp(name, "SubmitDebugUtilsMessageEXT")) return (void *)table->SubmitDebugUtilsMessageEXT;
-
-    // ---- VK_EXT_sample_locations extension commands
-    if (!strcmp(name, "GetPhysicalDeviceMultisamplePropertiesEXT")) return (void *)table->GetPhysicalDeviceMultisamplePropertiesEXT;
-
-    // ---- VK_EXT_calibrated_timestamps extension commands
-    if (!strcmp(name, "GetPhysicalDeviceCalibrateableTimeDomainsEXT")) return (void *)table->GetPhysicalDeviceCalibrateableTimeDomainsEXT;
-
-    // ---- VK_FUCHSIA_imagepipe_surface extension commands
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "CreateImagePipeSurfaceFUCHSIA")) return (void *)table->CreateImagePipeSurfaceFUCHSIA;
-#endif // VK_USE_PLATFORM_FUCHSIA
-
-    // ---- VK_EXT_metal_surface extension commands
-#ifdef VK_USE_PLATFORM_METAL_EXT
-    if (!strcmp(name, "CreateMetalSurfaceEXT")) return (void *)table->CreateMetalSurfaceEXT;
-#endif // VK_USE_PLATFORM_METAL_EXT
-
-    // ---- VK_EXT_tooling_info extension commands
-    if (!strcmp(name, "GetPhysicalDeviceToolPropertiesEXT")) return (void *)table->GetPhysicalDeviceToolPropertiesEXT;
-
-    // ---- VK_NV_cooperative_matrix extension commands
-    if (!strcmp(name, "GetPhysicalDeviceCooperativeMatrixPropertiesNV")) return (void *)table->GetPhysicalDeviceCooperativeMatrixPropertiesNV;
+    const struct loader_dispatch_table_entry *entry =
+        &instance_dispatch_table_entries[loader_command_name_slot(instance_dispatch_table_seeds, 100, name)];
+    if (NULL == entry->name || strcmp(entry->name, name) != 0) {
+        *found_name = false;
+        return NULL;
+    }
 
-    // ---- VK_NV_coverage_reduction_mode extension commands
-    if (!strcmp(name, "GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV")) return (void *)table->GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV;
+    *found_name = true;
+    return (void *)*(const PFN_vkVoidFunction *)((const char *)table + entry->offset);
+}
 
-    // ---- VK_EXT_full_screen_exclusive extension commands
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetPhysicalDeviceSurfacePresentModes2EXT")) return (void *)table->GetPhysicalDeviceSurfacePresentModes2EXT;
-#endif // VK_USE_PLATFORM_WIN32_KHR
+struct loader_trampoline_entry {
+    const char *name;
+    PFN_vkVoidFunction addr;
+};
 
-    // ---- VK_EXT_headless_surface extension commands
-    if (!strcmp(name, "CreateHeadlessSurfaceEXT")) return (void *)table->CreateHeadlessSurfaceEXT;
+static const int32_t core_trampoline_seeds[211] = {
+    0, -2, 0, 0, 0, -11, 0, 0, 1, 0, 0, -12,
+    2, 1, -15, 1, -16, 0, -19, 0, -24, -25, 1, -27,
+    0, 0, -28, 3, -32, 0, -36, -37, 0, 1, 1, 0,
+    -38, 0, 1, 0, 0, -40, 1, 0, 4, 0, -41, -43,
+    -44, -46, 1, 4, 1, 0, 0, 1, -49, 0, 1, -56,
+    2, -57, 0, 1, -59, 0, 2, -61, 0, 0, 0, -65,
+    -67, 0, 1, 0, -68, 8, 1, 0, -76, 0, 0, -77,
+    0, -80, 2, -84, -85, -88, -90, -91, 2, -92, 12, 1,
+    1, -95, -97, 0, 0, 0, 5, 0, 0, -99, -101, 0,
+    -102, -105, 0, 6, 0, 0, -106, -108, -109, 0, 5, 0,
+    4, 0, -110, 0, -114, 0, 0, -115, -116, -119, -120, 0,
+    1, -123, 2, 0, 1, -125, 0, -128, -130, -132, 0, 0,
+    1, 2, 5, 5, -135, 5, -136, -138, -142, 2, -145, -146,
+    0, 0, -157, 2, 0, 0, -159, 1, -161, -162, 0, -163,
+    0, 1, 0, 5, 0, 4, 0, -170, 0, -171, -175, 0,
+    -178, -180, 4, 10, 0, -181, -183, -184, -187, 2, 0, -191,
+    -192, 3, 3, 0, 0, -193, 0, 0, -198, -202, 1, 0,
+    -206, 5, -207, -210, 6, 0, 0,
+};
 
-    // ---- VK_EXT_acquire_drm_display extension commands
-    if (!strcmp(name, "AcquireDrmDisplayEXT")) return (void *)table->AcquireDrmDisplayEXT;
-    if (!strcmp(name, "GetDrmDisplayEXT")) return (void *)table->GetDrmDisplayEXT;
+static const struct loader_trampoline_entry core_trampolines[211] = {
+    {"vkGetPhysicalDeviceExternalFenceProperties", (PFN_vkVoidFunction)vkGetPhysicalDeviceExternalFenceProperties},
+    {"vkGetBufferMemoryRequirements2", (PFN_vkVoidFunction)vkGetBufferMemoryRequirements2},
+    {"vkCmdExecuteCommands", (PFN_vkVoidFunction)vkCmdExecuteCommands},
+    {"vkAllocateCommandBuffers", (PFN_vkVoidFunction)vkAllocateCommandBuffers},
+    {"vkGetPrivateData", (PFN_vkVoidFunction)vkGetPrivateData},
+    {"vkSignalSemaphore", (PFN_vkVoidFunction)vkSignalSemaphore},
+    {"vkResetEvent", (PFN_vkVoidFunction)vkResetEvent},
+    {"vkCmdWriteTimestamp2", (PFN_vkVoidFunction)vkCmdWriteTimestamp2},
+    {"vkDestroyPipelineLayout", (PFN_vkVoidFunction)vkDestroyPipelineLayout},
+    {"vkDestroyImageView", (PFN_vkVoidFunction)vkDestroyImageView},
+    {"vkWaitSemaphores", (PFN_vkVoidFunction)vkWaitSemaphores},
+    {"vkDestroyImage", (PFN_vkVoidFunction)vkDestroyImage},
+    {"vkCmdSetEvent", (PFN_vkVoidFunction)vkCmdSetEvent},
+    {"vkCreateDescriptorUpdateTemplate", (PFN_vkVoidFunction)vkCreateDescriptorUpdateTemplate},
+    {"vkCmdSetDeviceMask", (PFN_vkVoidFunction)vkCmdSetDeviceMask},
+    {"vkCmdCopyBuffer2", (PFN_vkVoidFunction)vkCmdCopyBuffer2},
+    {"vkGetBufferDeviceAddress", (PFN_vkVoidFunction)vkGetBufferDeviceAddress},
+    {"vkCmdDispatchBase", (PFN_vkVoidFunction)vkCmdDispatchBase},
+    {"vkCmdEndQuery", (PFN_vkVoidFunction)vkCmdEndQuery},
+    {"vkEnumeratePhysicalDevices", (PFN_vkVoidFunction)vkEnumeratePhysicalDevices},
+    {"vkCmdSetCullMode", (PFN_vkVoidFunction)vkCmdSetCullMode},
+    {"vkDestroySamplerYcbcrConversion", (PFN_vkVoidFunction)vkDestroySamplerYcbcrConversion},
+    {"vkCmdSetPrimitiveRestartEnable", (PFN_vkVoidFunction)vkCmdSetPrimitiveRestartEnable},
+    {"vkFlushMappedMemoryRanges", (PFN_vkVoidFunction)vkFlushMappedMemoryRanges},
+    {"vkCmdResolveImage", (PFN_vkVoidFunction)vkCmdResolveImage},
+    {"vkGetFenceStatus", (PFN_vkVoidFunction)vkGetFenceStatus},
+    {"vkCmdEndRendering", (PFN_vkVoidFunction)vkCmdEndRendering},
+    {"vkCmdPushConstants", (PFN_vkVoidFunction)vkCmdPushConstants},
+    {"vkCmdBlitImage2", (PFN_vkVoidFunction)vkCmdBlitImage2},
+    {"vkSetPrivateData", (PFN_vkVoidFunction)vkSetPrivateData},
+    {"vkBindBufferMemory2", (PFN_vkVoidFunction)vkBindBufferMemory2},
+    {"vkGetBufferOpaqueCaptureAddress", (PFN_vkVoidFunction)vkGetBufferOpaqueCaptureAddress},
+    {"vkDestroySemaphore", (PFN_vkVoidFunction)vkDestroySemaphore},
+    {"vkCmdCopyImageToBuffer2", (PFN_vkVoidFunction)vkCmdCopyImageToBuffer2},
+    {"vkCmdSetLineWidth", (PFN_vkVoidFunction)vkCmdSetLineWidth},
+    {"vkDestroyCommandPool", (PFN_vkVoidFunction)vkDestroyCommandPool},
+    {"vkCmdClearColorImage", (PFN_vkVoidFunction)vkCmdClearColorImage},
+    {"vkDestroyDescriptorSetLayout", (PFN_vkVoidFunction)vkDestroyDescriptorSetLayout},
+    {"vkCmdDrawIndexed", (PFN_vkVoidFunction)vkCmdDrawIndexed},
+    {"vkCreateGraphicsPipelines", (PFN_vkVoidFunction)vkCreateGraphicsPipelines},
+    {"vkCreateRenderPass", (PFN_vkVoidFunction)vkCreateRenderPass},
+    {"vkCmdPipelineBarrier", (PFN_vkVoidFunction)vkCmdPipelineBarrier},
+    {"vkDestroyBuffer", (PFN_vkVoidFunction)vkDestroyBuffer},
+    {"vkEnumerateDeviceExtensionProperties", (PFN_vkVoidFunction)vkEnumerateDeviceExtensionProperties},
+    {"vkCmdEndRenderPass", (PFN_vkVoidFunction)vkCmdEndRenderPass},
+    {"vkCmdPipelineBarrier2", (PFN_vkVoidFunction)vkCmdPipelineBarrier2},
+    {"vkDestroyEvent", (PFN_vkVoidFunction)vkDestroyEvent},
+    {"vkCmdSetDepthBiasEnable", (PFN_vkVoidFunction)vkCmdSetDepthBiasEnable},
+    {"vkCmdWaitEvents", (PFN_vkVoidFunction)vkCmdWaitEvents},
+    {"vkCmdCopyImage2", (PFN_vkVoidFunction)vkCmdCopyImage2},
+    {"vkResetCommandBuffer", (PFN_vkVoidFunction)vkResetCommandBuffer},
+    {"vkGetPhysicalDeviceQueueFamilyProperties", (PFN_vkVoidFunction)vkGetPhysicalDeviceQueueFamilyProperties},
+    {"vkCmdSetViewportWithCount", (PFN_vkVoidFunction)vkCmdSetViewportWithCount},
+    {"vkCreateDescriptorPool", (PFN_vkVoidFunction)vkCreateDescriptorPool},
+    {"vkInvalidateMappedMemoryRanges", (PFN_vkVoidFunction)vkInvalidateMappedMemoryRanges},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties", (PFN_vkVoidFunction)vkGetPhysicalDeviceSparseImageFormatProperties},
+    {"vkCreateCommandPool", (PFN_vkVoidFunction)vkCreateCommandPool},
+    {"vkCmdNextSubpass2", (PFN_vkVoidFunction)vkCmdNextSubpass2},
+    {"vkResetDescriptorPool", (PFN_vkVoidFunction)vkResetDescriptorPool},
+    {"vkCmdCopyImageToBuffer", (PFN_vkVoidFunction)vkCmdCopyImageToBuffer},
+    {"vkCreateQueryPool", (PFN_vkVoidFunction)vkCreateQueryPool},
+    {"vkCmdEndRenderPass2", (PFN_vkVoidFunction)vkCmdEndRenderPass2},
+    {"vkCmdSetFrontFace", (PFN_vkVoidFunction)vkCmdSetFrontFace},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties2", (PFN_vkVoidFunction)vkGetPhysicalDeviceSparseImageFormatProperties2},
+    {"vkGetImageSubresourceLayout", (PFN_vkVoidFunction)vkGetImageSubresourceLayout},
+    {"vkAllocateDescriptorSets", (PFN_vkVoidFunction)vkAllocateDescriptorSets},
+    {"vkCmdWriteTimestamp", (PFN_vkVoidFunction)vkCmdWriteTimestamp},
+    {"vkCmdCopyQueryPoolResults", (PFN_vkVoidFunction)vkCmdCopyQueryPoolResults},
+    {"vkTrimCommandPool", (PFN_vkVoidFunction)vkTrimCommandPool},
+    {"vkDestroyBufferView", (PFN_vkVoidFunction)vkDestroyBufferView},
+    {"vkGetPhysicalDeviceExternalSemaphoreProperties", (PFN_vkVoidFunction)vkGetPhysicalDeviceExternalSemaphoreProperties},
+    {"vkCmdCopyBufferToImage", (PFN_vkVoidFunction)vkCmdCopyBufferToImage},
+    {"vkDestroyInstance", (PFN_vkVoidFunction)vkDestroyInstance},
+    {"vkBindImageMemory", (PFN_vkVoidFunction)vkBindImageMemory},
+    {"vkGetPhysicalDeviceProperties2", (PFN_vkVoidFunction)vkGetPhysicalDeviceProperties2},
+    {"vkDestroyDescriptorUpdateTemplate", (PFN_vkVoidFunction)vkDestroyDescriptorUpdateTemplate},
+    {"vkCmdBeginRenderPass2", (PFN_vkVoidFunction)vkCmdBeginRenderPass2},
+    {"vkCreateRenderPass2", (PFN_vkVoidFunction)vkCreateRenderPass2},
+    {"vkGetBufferMemoryRequirements", (PFN_vkVoidFunction)vkGetBufferMemoryRequirements},
+    {"vkCreateImageView", (PFN_vkVoidFunction)vkCreateImageView},
+    {"vkGetSemaphoreCounterValue", (PFN_vkVoidFunction)vkGetSemaphoreCounterValue},
+    {"vkCmdSetEvent2", (PFN_vkVoidFunction)vkCmdSetEvent2},
+    {"vkFreeDescriptorSets", (PFN_vkVoidFunction)vkFreeDescriptorSets},
+    {"vkCmdSetScissorWithCount", (PFN_vkVoidFunction)vkCmdSetScissorWithCount},
+    {"vkCmdSetScissor", (PFN_vkVoidFunction)vkCmdSetScissor},
+    {"vkGetPhysicalDeviceProperties", (PFN_vkVoidFunction)vkGetPhysicalDeviceProperties},
+    {"vkDestroyQueryPool", (PFN_vkVoidFunction)vkDestroyQueryPool},
+    {"vkCmdSetDepthWriteEnable", (PFN_vkVoidFunction)vkCmdSetDepthWriteEnable},
+    {"vkFreeCommandBuffers", (PFN_vkVoidFunction)vkFreeCommandBuffers},
+    {"vkDestroyPrivateDataSlot", (PFN_vkVoidFunction)vkDestroyPrivateDataSlot},
+    {"vkCreateSamplerYcbcrConversion", (PFN_vkVoidFunction)vkCreateSamplerYcbcrConversion},
+    {"vkGetDeviceQueue2", (PFN_vkVoidFunction)vkGetDeviceQueue2},
+    {"vkMapMemory", (PFN_vkVoidFunction)vkMapMemory},
+    {"vkCmdClearDepthStencilImage", (PFN_vkVoidFunction)vkCmdClearDepthStencilImage},
+    {"vkEndCommandBuffer", (PFN_vkVoidFunction)vkEndCommandBuffer},
+    {"vkCmdResetEvent2", (PFN_vkVoidFunction)vkCmdResetEvent2},
+    {"vkGetDeviceBufferMemoryRequirements", (PFN_vkVoidFunction)vkGetDeviceBufferMemoryRequirements},
+    {"vkCmdDrawIndirect", (PFN_vkVoidFunction)vkCmdDrawIndirect},
+    {"vkBeginCommandBuffer", (PFN_vkVoidFunction)vkBeginCommandBuffer},
+    {"vkCmdResetQueryPool", (PFN_vkVoidFunction)vkCmdResetQueryPool},
+    {"vkCmdDispatch", (PFN_vkVoidFunction)vkCmdDispatch},
+    {"vkCreateEvent", (PFN_vkVoidFunction)vkCreateEvent},
+    {"vkCmdCopyImage", (PFN_vkVoidFunction)vkCmdCopyImage},
+    {"vkGetPhysicalDeviceImageFormatProperties2", (PFN_vkVoidFunction)vkGetPhysicalDeviceImageFormatProperties2},
+    {"vkCmdFillBuffer", (PFN_vkVoidFunction)vkCmdFillBuffer},
+    {"vkGetEventStatus", (PFN_vkVoidFunction)vkGetEventStatus},
+    {"vkCmdBindVertexBuffers", (PFN_vkVoidFunction)vkCmdBindVertexBuffers},
+    {"vkResetQueryPool", (PFN_vkVoidFunction)vkResetQueryPool},
+    {"vkBindImageMemory2", (PFN_vkVoidFunction)vkBindImageMemory2},
+    {"vkCreateDevice", (PFN_vkVoidFunction)vkCreateDevice},
+    {"vkCmdSetStencilTestEnable", (PFN_vkVoidFunction)vkCmdSetStencilTestEnable},
+    {"vkGetDeviceProcAddr", (PFN_vkVoidFunction)vkGetDeviceProcAddr},
+    {"vkBindBufferMemory", (PFN_vkVoidFunction)vkBindBufferMemory},
+    {"vkDestroyFence", (PFN_vkVoidFunction)vkDestroyFence},
+    {"vkGetInstanceProcAddr", (PFN_vkVoidFunction)vkGetInstanceProcAddr},
+    {"vkCmdBindPipeline", (PFN_vkVoidFunction)vkCmdBindPipeline},
+    {"vkDestroySampler", (PFN_vkVoidFunction)vkDestroySampler},
+    {"vkCreateFramebuffer", (PFN_vkVoidFunction)vkCreateFramebuffer},
+    {"vkCmdUpdateBuffer", (PFN_vkVoidFunction)vkCmdUpdateBuffer},
+    {"vkGetDeviceMemoryCommitment", (PFN_vkVoidFunction)vkGetDeviceMemoryCommitment},
+    {"vkGetPhysicalDeviceMemoryProperties2", (PFN_vkVoidFunction)vkGetPhysicalDeviceMemoryProperties2},
+    {"vkCreateShaderModule", (PFN_vkVoidFunction)vkCreateShaderModule},
+    {"vkCmdBlitImage", (PFN_vkVoidFunction)vkCmdBlitImage},
+    {"vkQueueWaitIdle", (PFN_vkVoidFunction)vkQueueWaitIdle},
+    {"vkCmdDrawIndexedIndirectCount", (PFN_vkVoidFunction)vkCmdDrawIndexedIndirectCount},
+    {"vkGetImageMemoryRequirements2", (PFN_vkVoidFunction)vkGetImageMemoryRequirements2},
+    {"vkCreateBuffer", (PFN_vkVoidFunction)vkCreateBuffer},
+    {"vkCreateComputePipelines", (PFN_vkVoidFunction)vkCreateComputePipelines},
+    {"vkCreateFence", (PFN_vkVoidFunction)vkCreateFence},
+    {"vkCreatePipelineCache", (PFN_vkVoidFunction)vkCreatePipelineCache},
+    {"vkCmdSetRasterizerDiscardEnable", (PFN_vkVoidFunction)vkCmdSetRasterizerDiscardEnable},
+    {"vkCmdSetBlendConstants", (PFN_vkVoidFunction)vkCmdSetBlendConstants},
+    {"vkCmdClearAttachments", (PFN_vkVoidFunction)vkCmdClearAttachments},
+    {"vkUnmapMemory", (PFN_vkVoidFunction)vkUnmapMemory},
+    {"vkGetPhysicalDeviceImageFormatProperties", (PFN_vkVoidFunction)vkGetPhysicalDeviceImageFormatProperties},
+    {"vkDestroyRenderPass", (PFN_vkVoidFunction)vkDestroyRenderPass},
+    {"vkResetCommandPool", (PFN_vkVoidFunction)vkResetCommandPool},
+    {"vkGetPipelineCacheData", (PFN_vkVoidFunction)vkGetPipelineCacheData},
+    {"vkGetDeviceImageMemoryRequirements", (PFN_vkVoidFunction)vkGetDeviceImageMemoryRequirements},
+    {"vkCmdBeginRenderPass", (PFN_vkVoidFunction)vkCmdBeginRenderPass},
+    {"vkCreatePrivateDataSlot", (PFN_vkVoidFunction)vkCreatePrivateDataSlot},
+    {"vkGetPhysicalDeviceExternalBufferProperties", (PFN_vkVoidFunction)vkGetPhysicalDeviceExternalBufferProperties},
+    {"vkCmdSetStencilOp", (PFN_vkVoidFunction)vkCmdSetStencilOp},
+    {"vkDestroyShaderModule", (PFN_vkVoidFunction)vkDestroyShaderModule},
+    {"vkDestroyFramebuffer", (PFN_vkVoidFunction)vkDestroyFramebuffer},
+    {"vkDestroyDevice", (PFN_vkVoidFunction)vkDestroyDevice},
+    {"vkGetDeviceImageSparseMemoryRequirements", (PFN_vkVoidFunction)vkGetDeviceImageSparseMemoryRequirements},
+    {"vkGetPhysicalDeviceMemoryProperties", (PFN_vkVoidFunction)vkGetPhysicalDeviceMemoryProperties},
+    {"vkDestroyPipeline", (PFN_vkVoidFunction)vkDestroyPipeline},
+    {"vkGetImageSparseMemoryRequirements", (PFN_vkVoidFunction)vkGetImageSparseMemoryRequirements},
+    {"vkAllocateMemory", (PFN_vkVoidFunction)vkAllocateMemory},
+    {"vkCmdNextSubpass", (PFN_vkVoidFunction)vkCmdNextSubpass},
+    {"vkQueueSubmit", (PFN_vkVoidFunction)vkQueueSubmit},
+    {"vkGetImageMemoryRequirements", (PFN_vkVoidFunction)vkGetImageMemoryRequirements},
+    {"vkCmdCopyBufferToImage2", (PFN_vkVoidFunction)vkCmdCopyBufferToImage2},
+    {"vkDestroyPipelineCache", (PFN_vkVoidFunction)vkDestroyPipelineCache},
+    {"vkQueueSubmit2", (PFN_vkVoidFunction)vkQueueSubmit2},
+    {"vkCmdResolveImage2", (PFN_vkVoidFunction)vkCmdResolveImage2},
+    {"vkCmdSetDepthBoundsTestEnable", (PFN_vkVoidFunction)vkCmdSetDepthBoundsTestEnable},
+    {"vkCmdBindVertexBuffers2", (PFN_vkVoidFunction)vkCmdBindVertexBuffers2},
+    {"vkGetPhysicalDeviceFormatProperties2", (PFN_vkVoidFunction)vkGetPhysicalDeviceFormatProperties2},
+    {"vkCreateDescriptorSetLayout", (PFN_vkVoidFunction)vkCreateDescriptorSetLayout},
+    {"vkGetDeviceQueue", (PFN_vkVoidFunction)vkGetDeviceQueue},
+    {"vkDestroyDescriptorPool", (PFN_vkVoidFunction)vkDestroyDescriptorPool},
+    {"vkCreateImage", (PFN_vkVoidFunction)vkCreateImage},
+    {"vkCmdBeginRendering", (PFN_vkVoidFunction)vkCmdBeginRendering},
+    {"vkGetDeviceMemoryOpaqueCaptureAddress", (PFN_vkVoidFunction)vkGetDeviceMemoryOpaqueCaptureAddress},
+    {"vkGetPhysicalDeviceQueueFamilyProperties2", (PFN_vkVoidFunction)vkGetPhysicalDeviceQueueFamilyProperties2},
+    {"vkGetImageSparseMemoryRequirements2", (PFN_vkVoidFunction)vkGetImageSparseMemoryRequirements2},
+    {"vkCmdDrawIndexedIndirect", (PFN_vkVoidFunction)vkCmdDrawIndexedIndirect},
+    {"vkCmdDrawIndirectCount", (PFN_vkVoidFunction)vkCmdDrawIndirectCount},
+    {"vkGetPhysicalDeviceToolProperties", (PFN_vkVoidFunction)vkGetPhysicalDeviceToolProperties},
+    {"vkGetPhysicalDeviceFeatures", (PFN_vkVoidFunction)vkGetPhysicalDeviceFeatures},
+    {"vkSetEvent", (PFN_vkVoidFunction)vkSetEvent},
+    {"vkCreatePipelineLayout", (PFN_vkVoidFunction)vkCreatePipelineLayout},
+    {"vkCmdSetViewport", (PFN_vkVoidFunction)vkCmdSetViewport},
+    {"vkCmdDraw", (PFN_vkVoidFunction)vkCmdDraw},
+    {"vkCmdDispatchIndirect", (PFN_vkVoidFunction)vkCmdDispatchIndirect},
+    {"vkGetPhysicalDeviceFormatProperties", (PFN_vkVoidFunction)vkGetPhysicalDeviceFormatProperties},
+    {"vkCmdBindIndexBuffer", (PFN_vkVoidFunction)vkCmdBindIndexBuffer},
+    {"vkQueueBindSparse", (PFN_vkVoidFunction)vkQueueBindSparse},
+    {"vkUpdateDescriptorSets", (PFN_vkVoidFunction)vkUpdateDescriptorSets},
+    {"vkEnumerateDeviceLayerProperties", (PFN_vkVoidFunction)vkEnumerateDeviceLayerProperties},
+    {"vkCreateBufferView", (PFN_vkVoidFunction)vkCreateBufferView},
+    {"vkCmdWaitEvents2", (PFN_vkVoidFunction)vkCmdWaitEvents2},
+    {"vkCreateSampler", (PFN_vkVoidFunction)vkCreateSampler},
+    {"vkGetRenderAreaGranularity", (PFN_vkVoidFunction)vkGetRenderAreaGranularity},
+    {"vkDeviceWaitIdle", (PFN_vkVoidFunction)vkDeviceWaitIdle},
+    {"vkGetDescriptorSetLayoutSupport", (PFN_vkVoidFunction)vkGetDescriptorSetLayoutSupport},
+    {"vkCmdSetDepthBounds", (PFN_vkVoidFunction)vkCmdSetDepthBounds},
+    {"vkCmdSetDepthCompareOp", (PFN_vkVoidFunction)vkCmdSetDepthCompareOp},
+    {"vkGetDeviceGroupPeerMemoryFeatures", (PFN_vkVoidFunction)vkGetDeviceGroupPeerMemoryFeatures},
+    {"vkCmdBeginQuery", (PFN_vkVoidFunction)vkCmdBeginQuery},
+    {"vkEnumeratePhysicalDeviceGroups", (PFN_vkVoidFunction)vkEnumeratePhysicalDeviceGroups},
+    {"vkResetFences", (PFN_vkVoidFunction)vkResetFences},
+    {"vkCmdSetStencilWriteMask", (PFN_vkVoidFunction)vkCmdSetStencilWriteMask},
+    {"vkWaitForFences", (PFN_vkVoidFunction)vkWaitForFences},
+    {"vkCmdSetDepthTestEnable", (PFN_vkVoidFunction)vkCmdSetDepthTestEnable},
+    {"vkCmdBindDescriptorSets", (PFN_vkVoidFunction)vkCmdBindDescriptorSets},
+    {"vkCmdSetPrimitiveTopology", (PFN_vkVoidFunction)vkCmdSetPrimitiveTopology},
+    {"vkUpdateDescriptorSetWithTemplate", (PFN_vkVoidFunction)vkUpdateDescriptorSetWithTemplate},
+    {"vkMergePipelineCaches", (PFN_vkVoidFunction)vkMergePipelineCaches},
+    {"vkGetPhysicalDeviceFeatures2", (PFN_vkVoidFunction)vkGetPhysicalDeviceFeatures2},
+    {"vkCmdCopyBuffer", (PFN_vkVoidFunction)vkCmdCopyBuffer},
+    {"vkCreateSemaphore", (PFN_vkVoidFunction)vkCreateSemaphore},
+    {"vkCmdSetDepthBias", (PFN_vkVoidFunction)vkCmdSetDepthBias},
+    {"vkCmdSetStencilCompareMask", (PFN_vkVoidFunction)vkCmdSetStencilCompareMask},
+    {"vkFreeMemory", (PFN_vkVoidFunction)vkFreeMemory},
+    {"vkGetQueryPoolResults", (PFN_vkVoidFunction)vkGetQueryPoolResults},
+    {"vkCmdSetStencilReference", (PFN_vkVoidFunction)vkCmdSetStencilReference},
+    {"vkCmdResetEvent", (PFN_vkVoidFunction)vkCmdResetEvent},
+};
 
-    // ---- VK_NV_acquire_winrt_display extension commands
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "AcquireWinrtDisplayNV")) return (void *)table->AcquireWinrtDisplayNV;
-#endif // VK_USE_PLATFORM_WIN32_KHR
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetWinrtDisplayNV")) return (void *)table->GetWinrtDisplayNV;
-#endif // VK_USE_PLATFORM_WIN32_KHR
+void *loader_lookup_core_trampoline(const char *name) {
+    const struct loader_trampoline_entry *entry =
+        &core_trampolines[loader_command_name_slot(core_trampoline_seeds, 211, name)];
+    return strcmp(entry->name, name) == 0 ? (void *)entry->addr : NULL;
+}
 
-    // ---- VK_EXT_directfb_surface extension commands
-#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
-    if (!strcmp(name, "CreateDirectFBSurfaceEXT")) return (void *)table->CreateDirectFBSurfaceEXT;
-#endif // VK_USE_PLATFORM_DIRECTFB_EXT
-#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
-    if (!strcmp(name, "GetPhysicalDeviceDirectFBPresentationSupportEXT")) return (void *)table->GetPhysicalDeviceDirectFBPresentationSupportEXT;
-#endif // VK_USE_PLATFORM_DIRECTFB_EXT
+static const int32_t global_trampoline_seeds[4] = {
+    -1, -2, -3, -4,
+};
 
-    // ---- VK_QNX_screen_surface extension commands
-#ifdef VK_USE_PLATFORM_SCREEN_QNX
-    if (!strcmp(name, "CreateScreenSurfaceQNX")) return (void *)table->CreateScreenSurfaceQNX;
-#endif // VK_USE_PLATFORM_SCREEN_QNX
-#ifdef VK_USE_PLATFORM_SCREEN_QNX
-    if (!strcmp(name, "GetPhysicalDeviceScreenPresentationSupportQNX")) return (void *)table->GetPhysicalDeviceScreenPresentationSupportQNX;
-#endif // VK_USE_PLATFORM_SCREEN_QNX
+static const struct loader_trampoline_entry global_trampolines[4] = {
+    {"vkCreateInstance", (PFN_vkVoidFunction)vkCreateInstance},
+    {"vkEnumerateInstanceLayerProperties", (PFN_vkVoidFunction)vkEnumerateInstanceLayerProperties},
+    {"vkEnumerateInstanceExtensionProperties", (PFN_vkVoidFunction)vkEnumerateInstanceExtensionProperties},
+    {"vkEnumerateInstanceVersion", (PFN_vkVoidFunction)vkEnumerateInstanceVersion},
+};
 
-    *found_name = false;
-    return NULL;
+void *loader_lookup_global_trampoline(const char *name) {
+    const struct loader_trampoline_entry *entry =
+        &global_trampolines[loader_command_name_slot(global_trampoline_seeds, 4, name)];
+    return strcmp(entry->name, name) == 0 ? (void *)entry->addr : NULL;
 }
 
 
@@ -83,6 +83,10 @@ VKAPI_ATTR void* VKAPI_CALL loader_lookup_device_dispatch_table(const VkLayerDis
 VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,
                                                                   bool *found_name);
 
+// Core command trampoline lookup functions. The global commands are only found by loader_lookup_global_trampoline.
+void *loader_lookup_core_trampoline(const char *name);
+void *loader_lookup_global_trampoline(const char *name);
+
 // Loader core instance terminators
 VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateInstance(
     const VkInstanceCreateInfo*                 pCreateInfo,
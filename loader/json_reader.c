@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "json_reader.h"
+
+#include <string.h>
+
+// Deeper documents are rejected rather than risking the stack
+#define LOADER_JSON_MAX_DEPTH 64
+
+static const char *skip_whitespace(const char *cur, const char *end) {
+    while (cur < end && (*cur == ' ' || *cur == '\t' || *cur == '\n' || *cur == '\r')) {
+        cur++;
+    }
+    return cur;
+}
+
+static bool is_hex_digit(char c) { return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'); }
+
+static uint32_t hex_digit_value(char c) {
+    if (c >= '0' && c <= '9') return (uint32_t)(c - '0');
+    if (c >= 'a' && c <= 'f') return (uint32_t)(c - 'a' + 10);
+    return (uint32_t)(c - 'A' + 10);
+}
+
+// cur points at the opening quote. Returns a pointer past the closing quote, or NULL if the string is malformed.
+static const char *scan_string(const char *cur, const char *end) {
+    cur++;
+    while (cur < end && *cur != '"') {
+        if (*cur == '\0') {
+            return NULL;
+        }
+        if (*cur == '\\') {
+            cur++;
+            if (cur >= end) {
+                return NULL;
+            }
+            if (*cur == 'u') {
+                if (end - cur < 5 || !is_hex_digit(cur[1]) || !is_hex_digit(cur[2]) || !is_hex_digit(cur[3]) ||
+                    !is_hex_digit(cur[4])) {
+                    return NULL;
+                }
+                cur += 4;
+            }
+        }
+        cur++;
+    }
+    return cur < end ? cur + 1 : NULL;
+}
+
+static const char *scan_number(const char *cur, const char *end) {
+    if (cur < end && *cur == '-') cur++;
+    if (cur >= end || *cur < '0' || *cur > '9') return NULL;
+    while (cur < end && *cur >= '0' && *cur <= '9') cur++;
+    if (cur < end && *cur == '.') {
+        cur++;
+        if (cur >= end || *cur < '0' || *cur > '9') return NULL;
+        while (cur < end && *cur >= '0' && *cur <= '9') cur++;
+    }
+    if (cur < end && (*cur == 'e' || *cur == 'E')) {
+        cur++;
+        if (cur < end && (*cur == '+' || *cur == '-')) cur++;
+        if (cur >= end || *cur < '0' || *cur > '9') return NULL;
+        while (cur < end && *cur >= '0' && *cur <= '9') cur++;
+    }
+    return cur;
+}
+
+static const char *scan_literal(const char *cur, const char *end, const char *literal) {
+    size_t length = strlen(literal);
+    if ((size_t)(end - cur) < length || strncmp(cur, literal, length) != 0) {
+        return NULL;
+    }
+    return cur + length;
+}
+
+// Scan the value starting at cur, which must not be whitespace. On success value describes it and a pointer past the end of it
+// is returned, otherwise NULL. If value_count isn't NULL, it is incremented for the value and for every value nested in it.
+static const char *scan_value(const char *cur, const char *end, uint32_t depth, struct loader_json_value *value,
+                              uint64_t *value_count) {
+    const char *next = NULL;
+
+    if (cur >= end) {
+        return NULL;
+    }
+    if (NULL != value_count) {
+        (*value_count)++;
+    }
+    value->start = cur;
+    switch (*cur) {
+        case 'n':
+            value->type = LOADER_JSON_TYPE_NULL;
+            next = scan_literal(cur, end, "null");
+            break;
+        case 'f':
+            value->type = LOADER_JSON_TYPE_FALSE;
+            next = scan_literal(cur, end, "false");
+            break;
+        case 't':
+            value->type = LOADER_JSON_TYPE_TRUE;
+            next = scan_literal(cur, end, "true");
+            break;
+        case '"':
+            value->type = LOADER_JSON_TYPE_STRING;
+            next = scan_string(cur, end);
+            break;
+        case '[':
+        case '{': {
+            bool is_object = *cur == '{';
+            char closing = is_object ? '}' : ']';
+            struct loader_json_value child;
+
+            if (depth >= LOADER_JSON_MAX_DEPTH) {
+                return NULL;
+            }
+            value->type = is_object ? LOADER_JSON_TYPE_OBJECT : LOADER_JSON_TYPE_ARRAY;
+            next = skip_whitespace(cur + 1, end);
+            if (next < end && *next == closing) {
+                next++;
+                break;
+            }
+            while (true) {
+                if (is_object) {
+                    if (next >= end || *next != '"') return NULL;
+                    next = scan_string(next, end);
+                    if (NULL == next) return NULL;
+                    next = skip_whitespace(next, end);
+                    if (next >= end || *next != ':') return NULL;
+                    next = skip_whitespace(next + 1, end);
+                }
+                next = scan_value(next, end, depth + 1, &child, value_count);
+                if (NULL == next) return NULL;
+                next = skip_whitespace(next, end);
+                if (next >= end) return NULL;
+                if (*next == closing) {
+                    next++;
+                    break;
+                }
+                if (*next != ',') return NULL;
+                next = skip_whitespace(next + 1, end);
+            }
+            break;
+        }
+        default:
+            value->type = LOADER_JSON_TYPE_NUMBER;
+            next = scan_number(cur, end);
+            break;
+    }
+    value->end = next;
+    return next;
+}
+
+bool loader_json_parse(const char *data, size_t size, struct loader_json_value *root, uint64_t *value_count) {
+    const char *end = data + size;
+
+    memset(root, 0, sizeof(struct loader_json_value));
+    if (NULL == data) {
+        return false;
+    }
+    if (NULL == scan_value(skip_whitespace(data, end), end, 0, root, value_count)) {
+        memset(root, 0, sizeof(struct loader_json_value));
+        return false;
+    }
+    return true;
+}
+
+void loader_json_iterate(const struct loader_json_value *container, struct loader_json_iterator *iter) {
+    if (container->type == LOADER_JSON_TYPE_OBJECT || container->type == LOADER_JSON_TYPE_ARRAY) {
+        // Leave off the closing bracket, so running out of text is the only way to stop
+        iter->cur = container->start + 1;
+        iter->end = container->end - 1;
+    } else {
+        iter->cur = NULL;
+        iter->end = NULL;
+    }
+}
+
+// The text was validated by loader_json_parse, so walking it again only needs to find where each value ends.
+static bool next_value(struct loader_json_iterator *iter, struct loader_json_value *value) {
+    iter->cur = skip_whitespace(iter->cur, iter->end);
+    if (iter->cur >= iter->end) {
+        return false;
+    }
+    iter->cur = scan_value(iter->cur, iter->end, 0, value, NULL);
+    if (NULL == iter->cur) {
+        iter->cur = iter->end;
+        return false;
+    }
+    iter->cur = skip_whitespace(iter->cur, iter->end);
+    if (iter->cur < iter->end && *iter->cur == ',') {
+        iter->cur++;
+    }
+    return true;
+}
+
+bool loader_json_next_member(struct loader_json_iterator *iter, struct loader_json_value *key, struct loader_json_value *value) {
+    if (NULL == iter->cur) {
+        return false;
+    }
+    iter->cur = skip_whitespace(iter->cur, iter->end);
+    if (iter->cur >= iter->end || *iter->cur != '"') {
+        return false;
+    }
+    key->type = LOADER_JSON_TYPE_STRING;
+    key->start = iter->cur;
+    key->end = scan_string(iter->cur, iter->end);
+    if (NULL == key->end) {
+        iter->cur = iter->end;
+        return false;
+    }
+    iter->cur = skip_whitespace(key->end, iter->end);
+    if (iter->cur >= iter->end || *iter->cur != ':') {
+        iter->cur = iter->end;
+        return false;
+    }
+    iter->cur++;
+    return next_value(iter, value);
+}
+
+bool loader_json_next_element(struct loader_json_iterator *iter, struct loader_json_value *value) {
+    if (NULL == iter->cur) {
+        return false;
+    }
+    return next_value(iter, value);
+}
+
+uint32_t loader_json_count(const struct loader_json_value *container) {
+    struct loader_json_iterator iter;
+    struct loader_json_value key, value;
+    uint32_t count = 0;
+
+    loader_json_iterate(container, &iter);
+    if (container->type == LOADER_JSON_TYPE_OBJECT) {
+        while (loader_json_next_member(&iter, &key, &value)) {
+            count++;
+        }
+    } else if (container->type == LOADER_JSON_TYPE_ARRAY) {
+        while (loader_json_next_element(&iter, &value)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// Decode the character at cur into out, which needs room for 4 bytes. Returns a pointer to the next character and sets
+// out_length to the number of bytes written.
+static const char *decode_character(const char *cur, const char *end, char *out, size_t *out_length) {
+    if (*cur != '\\' || end - cur < 2) {
+        out[0] = *cur;
+        *out_length = 1;
+        return cur + 1;
+    }
+    cur++;
+    *out_length = 1;
+    switch (*cur) {
+        case 'b':
+            out[0] = '\b';
+            return cur + 1;
+        case 'f':
+            out[0] = '\f';
+            return cur + 1;
+        case 'n':
+            out[0] = '\n';
+            return cur + 1;
+        case 'r':
+            out[0] = '\r';
+            return cur + 1;
+        case 't':
+            out[0] = '\t';
+            return cur + 1;
+        case 'u':
+            break;
+        default:
+            // Covers the quote, backslash and forward slash escapes, and passes anything unknown through as is
+            out[0] = *cur;
+            return cur + 1;
+    }
+
+    uint32_t code_point = 0;
+    for (int i = 1; i <= 4; i++) {
+        code_point = (code_point << 4) | hex_digit_value(cur[i]);
+    }
+    cur += 5;
+    // Combine a surrogate pair into one code point
+    if (code_point >= 0xD800 && code_point <= 0xDBFF && end - cur >= 6 && cur[0] == '\\' && cur[1] == 'u' &&
+        is_hex_digit(cur[2]) && is_hex_digit(cur[3]) && is_hex_digit(cur[4]) && is_hex_digit(cur[5])) {
+        uint32_t low = 0;
+        for (int i = 2; i <= 5; i++) {
+            low = (low << 4) | hex_digit_value(cur[i]);
+        }
+        if (low >= 0xDC00 && low <= 0xDFFF) {
+            code_point = 0x10000 + (((code_point & 0x3FF) << 10) | (low & 0x3FF));
+            cur += 6;
+        }
+    }
+
+    if (code_point < 0x80) {
+        out[0] = (char)code_point;
+    } else if (code_point < 0x800) {
+        out[0] = (char)(0xC0 | (code_point >> 6));
+        out[1] = (char)(0x80 | (code_point & 0x3F));
+        *out_length = 2;
+    } else if (code_point < 0x10000) {
+        out[0] = (char)(0xE0 | (code_point >> 12));
+        out[1] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (code_point & 0x3F));
+        *out_length = 3;
+    } else {
+        out[0] = (char)(0xF0 | (code_point >> 18));
+        out[1] = (char)(0x80 | ((code_point >> 12) & 0x3F));
+        out[2] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+        out[3] = (char)(0x80 | (code_point & 0x3F));
+        *out_length = 4;
+    }
+    return cur;
+}
+
+// The range of text holding the contents of the value, without the quotes for strings
+static void get_string_range(const struct loader_json_value *value, const char **start, const char **end) {
+    if (value->type == LOADER_JSON_TYPE_STRING) {
+        *start = value->start + 1;
+        *end = value->end - 1;
+    } else if (value->type == LOADER_JSON_TYPE_NONE) {
+        *start = NULL;
+        *end = NULL;
+    } else {
+        *start = value->start;
+        *end = value->end;
+    }
+}
+
+bool loader_json_string_equals(const struct loader_json_value *value, const char *str) {
+    const char *cur, *end;
+    char decoded[4];
+    size_t decoded_length;
+
+    if (value->type != LOADER_JSON_TYPE_STRING) {
+        return false;
+    }
+    get_string_range(value, &cur, &end);
+    while (cur < end) {
+        cur = decode_character(cur, end, decoded, &decoded_length);
+        if (strncmp(str, decoded, decoded_length) != 0) {
+            return false;
+        }
+        str += decoded_length;
+    }
+    return *str == '\0';
+}
+
+size_t loader_json_string_length(const struct loader_json_value *value) { return loader_json_copy_string(value, NULL, 0); }
+
+size_t loader_json_copy_string(const struct loader_json_value *value, char *out, size_t out_size) {
+    const char *cur, *end;
+    char decoded[4];
+    size_t decoded_length;
+    size_t length = 0;
+
+    get_string_range(value, &cur, &end);
+    while (cur < end) {
+        cur = decode_character(cur, end, decoded, &decoded_length);
+        for (size_t i = 0; i < decoded_length; i++, length++) {
+            if (length + 1 < out_size) {
+                out[length] = decoded[i];
+            }
+        }
+    }
+    if (out_size > 0) {
+        out[length < out_size ? length : out_size - 1] = '\0';
+    }
+    return length;
+}
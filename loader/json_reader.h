@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Pull style reader for JSON text that is already in memory, such as the contents of a manifest file.
+//
+// Nothing is ever allocated. loader_json_parse validates the document once, after which every value is described by the span
+// of text it occupies. Objects and arrays are walked member by member with an iterator, and strings are only decoded when and
+// where the caller asks for them, so any part of the document which the caller isn't interested in costs nothing beyond the
+// initial scan.
+
+enum loader_json_type {
+    LOADER_JSON_TYPE_NONE = 0,  // Not present
+    LOADER_JSON_TYPE_NULL,
+    LOADER_JSON_TYPE_FALSE,
+    LOADER_JSON_TYPE_TRUE,
+    LOADER_JSON_TYPE_NUMBER,
+    LOADER_JSON_TYPE_STRING,
+    LOADER_JSON_TYPE_ARRAY,
+    LOADER_JSON_TYPE_OBJECT,
+};
+
+// A single JSON value. For strings start points at the opening quote.
+struct loader_json_value {
+    enum loader_json_type type;
+    const char *start;
+    const char *end;  // One past the last character of the value
+};
+
+struct loader_json_iterator {
+    const char *cur;
+    const char *end;
+};
+
+// Validate the top level value in data and describe it in root. Anything after the top level value is ignored. Returns false
+// if the text isn't valid JSON. value_count may be NULL, otherwise the number of values scanned is added to it.
+bool loader_json_parse(const char *data, size_t size, struct loader_json_value *root, uint64_t *value_count);
+
+// Start walking the members of an object or the elements of an array. Only values which came out of loader_json_parse or one
+// of the iterators may be used.
+void loader_json_iterate(const struct loader_json_value *container, struct loader_json_iterator *iter);
+
+// Get the next member of an object. Returns false once every member has been visited.
+bool loader_json_next_member(struct loader_json_iterator *iter, struct loader_json_value *key, struct loader_json_value *value);
+
+// Get the next element of an array. Returns false once every element has been visited.
+bool loader_json_next_element(struct loader_json_iterator *iter, struct loader_json_value *value);
+
+// Number of members in an object or elements in an array, zero for any other value.
+uint32_t loader_json_count(const struct loader_json_value *container);
+
+// Compare the decoded contents of a string value with str.
+bool loader_json_string_equals(const struct loader_json_value *value, const char *str);
+
+// Length of the decoded contents of a string value, not including the null terminator. Any other value is treated as a
+// string holding its JSON text, so the number 12 reads back as "12".
+size_t loader_json_string_length(const struct loader_json_value *value);
+
+// Decode a value as described by loader_json_string_length into out, truncating it to fit and always null terminating it when
+// out_size isn't zero. Returns the full decoded length.
+size_t loader_json_copy_string(const struct loader_json_value *value, char *out, size_t out_size);
@@ -51,14 +51,29 @@
 #include <dirent.h>
 #endif  // _WIN32
 
+#if defined(__linux__) || defined(__APPLE__) || defined(__Fuchsia__) || defined(__QNXNTO__) || defined(__FreeBSD__)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include "allocation.h"
-#include "cJSON.h"
+#include "creation_feedback.h"
 #include "debug_utils.h"
+#include "device_map.h"
 #include "get_environment.h"
 #include "gpa_helper.h"
+#include "json_reader.h"
 #include "log.h"
+#include "log_file.h"
+#include "manifest_cache.h"
+#include "manifest_watch.h"
+#include "stats.h"
+#include "trace.h"
 #include "unknown_function_handling.h"
 #include "vk_loader_platform.h"
+#include "worker_pool.h"
 #include "wsi.h"
 
 #if defined(WIN32)
@@ -80,14 +95,16 @@ struct activated_layer_info {
     char *library;
     bool is_implicit;
     char *disable_env;
+    uint64_t setup_duration_ns;  // Opening the library and finding its entrypoints
 };
 
 // thread safety lock for accessing global data structures such as "loader"
-// all entrypoints on the instance chain need to be locked except GPA
-// additionally CreateDevice and DestroyDevice needs to be locked
+// It is only held for short stretches of the loader's own code and never across calls into layers or drivers, the entrypoints on
+// the instance chain lock the instance_lock of their loader_instance instead.
 loader_platform_thread_mutex loader_lock;
 loader_platform_thread_mutex loader_json_lock;
 loader_platform_thread_mutex loader_preload_icd_lock;
+loader_platform_thread_mutex loader_implicit_layer_cache_lock;
 
 // A list of ICDs that gets initialized when the loader does its global initialization. This list should never be used by anything
 // other than EnumerateInstanceExtensionProperties(), vkDestroyInstance, and loader_release(). This list does not change
@@ -266,26 +283,41 @@ static size_t loader_platform_combine_path(char *dest, size_t len, ...) {
     return required_len;
 }
 
+// Return the start of the next token in str, where tokens are separated by any of '.', '"', '\n' and '\r', and store the end
+// of it in token_end. Returns NULL when there are no tokens left. Unlike strtok this neither modifies str nor keeps any hidden
+// state, so it is safe to use while manifests are being parsed on several threads at once.
+static const char *loader_next_version_token(const char *str, const char **token_end) {
+    while (*str != '\0' && strchr(".\"\n\r", *str) != NULL) {
+        str++;
+    }
+    if (*str == '\0') {
+        return NULL;
+    }
+    *token_end = str + strcspn(str, ".\"\n\r");
+    return str;
+}
+
 // Given string of three part form "maj.min.pat" convert to a vulkan version number.
 // Also can understand four part form "variant.major.minor.patch" if provided.
 static uint32_t loader_parse_version_string(char *vers_str) {
     uint32_t variant = 0, major = 0, minor = 0, patch = 0;
-    char *vers_tok;
+    const char *vers_tok;
+    const char *vers_tok_end = NULL;
 
     if (!vers_str) {
         return 0;
     }
 
-    vers_tok = strtok(vers_str, ".\"\n\r");
+    vers_tok = loader_next_version_token(vers_str, &vers_tok_end);
     if (NULL != vers_tok) {
         major = (uint16_t)atoi(vers_tok);
-        vers_tok = strtok(NULL, ".\"\n\r");
+        vers_tok = loader_next_version_token(vers_tok_end, &vers_tok_end);
         if (NULL != vers_tok) {
             minor = (uint16_t)atoi(vers_tok);
-            vers_tok = strtok(NULL, ".\"\n\r");
+            vers_tok = loader_next_version_token(vers_tok_end, &vers_tok_end);
             if (NULL != vers_tok) {
                 patch = (uint16_t)atoi(vers_tok);
-                vers_tok = strtok(NULL, ".\"\n\r");
+                vers_tok = loader_next_version_token(vers_tok_end, &vers_tok_end);
                 // check that we are using a 4 part version string
                 if (NULL != vers_tok) {
                     // if we are, move the values over into the correct place
@@ -331,8 +363,8 @@ bool has_vk_dev_ext_property(const VkExtensionProperties *ext_prop, const struct
 }
 
 // Get the next unused layer property in the list. Init the property to zero.
-static struct loader_layer_properties *loader_get_next_layer_property_slot(const struct loader_instance *inst,
-                                                                           struct loader_layer_list *layer_list) {
+struct loader_layer_properties *loader_get_next_layer_property_slot(const struct loader_instance *inst,
+                                                                    struct loader_layer_list *layer_list) {
     if (layer_list->capacity == 0) {
         layer_list->list =
             loader_instance_heap_calloc(inst, sizeof(struct loader_layer_properties) * 64, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
@@ -1175,25 +1207,8 @@ out:
 }
 
 struct loader_icd_term *loader_get_icd_and_device(const void *device, struct loader_device **found_dev, uint32_t *icd_index) {
-    *found_dev = NULL;
-    for (struct loader_instance *inst = loader.instances; inst; inst = inst->next) {
-        uint32_t index = 0;
-        for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term; icd_term = icd_term->next) {
-            for (struct loader_device *dev = icd_term->logical_device_list; dev; dev = dev->next)
-                // Value comparison of device prevents object wrapping by layers
-                if (loader_get_dispatch(dev->icd_device) == loader_get_dispatch(device) ||
-                    (dev->chain_device != VK_NULL_HANDLE &&
-                     loader_get_dispatch(dev->chain_device) == loader_get_dispatch(device))) {
-                    *found_dev = dev;
-                    if (NULL != icd_index) {
-                        *icd_index = index;
-                    }
-                    return icd_term;
-                }
-            index++;
-        }
-    }
-    return NULL;
+    // Comparing the dispatch table pointers instead of the objects themselves prevents object wrapping by layers
+    return loader_device_map_find(device, found_dev, icd_index);
 }
 
 void loader_destroy_logical_device(const struct loader_instance *inst, struct loader_device *dev,
@@ -1201,12 +1216,14 @@ void loader_destroy_logical_device(const struct loader_instance *inst, struct lo
     if (pAllocator) {
         dev->alloc_callbacks = *pAllocator;
     }
+    loader_device_map_remove(dev);
     if (NULL != dev->expanded_activated_layer_list.list) {
         loader_deactivate_layers(inst, dev, &dev->expanded_activated_layer_list);
     }
     if (NULL != dev->app_activated_layer_list.list) {
         loader_destroy_layer_list(inst, dev, &dev->app_activated_layer_list);
     }
+    loader_free_dispatch_dev_ext(dev);
     loader_device_heap_free(dev, dev);
 }
 
@@ -1226,17 +1243,33 @@ struct loader_device *loader_create_logical_device(const struct loader_instance
     return new_dev;
 }
 
-void loader_add_logical_device(const struct loader_instance *inst, struct loader_icd_term *icd_term, struct loader_device *dev) {
-    dev->next = icd_term->logical_device_list;
-    icd_term->logical_device_list = dev;
+VkResult loader_add_logical_device(struct loader_instance *inst, struct loader_icd_term *icd_term, struct loader_device *dev) {
+    uint32_t icd_index = 0;
+    for (const struct loader_icd_term *cur = inst->icd_terms; NULL != cur && cur != icd_term; cur = cur->next) {
+        icd_index++;
+    }
+
+    loader_stats_lock_mutex(inst, &inst->device_list_lock);
+    // Make room in the dispatch table for the device functions unknown to the loader which are already in use
+    VkResult res = loader_alloc_dispatch_dev_ext(inst, dev);
+    if (VK_SUCCESS == res) {
+        res = loader_device_map_add(dev, icd_term, icd_index);
+    }
+    if (VK_SUCCESS == res) {
+        dev->next = icd_term->logical_device_list;
+        icd_term->logical_device_list = dev;
+    }
+    loader_platform_thread_unlock_mutex(&inst->device_list_lock);
+    return res;
 }
 
-void loader_remove_logical_device(const struct loader_instance *inst, struct loader_icd_term *icd_term,
-                                  struct loader_device *found_dev, const VkAllocationCallbacks *pAllocator) {
+void loader_remove_logical_device(struct loader_instance *inst, struct loader_icd_term *icd_term, struct loader_device *found_dev,
+                                  const VkAllocationCallbacks *pAllocator) {
     struct loader_device *dev, *prev_dev;
 
     if (!icd_term || !found_dev) return;
 
+    loader_stats_lock_mutex(inst, &inst->device_list_lock);
     prev_dev = NULL;
     dev = icd_term->logical_device_list;
     while (dev && dev != found_dev) {
@@ -1248,6 +1281,8 @@ void loader_remove_logical_device(const struct loader_instance *inst, struct loa
         prev_dev->next = found_dev->next;
     else
         icd_term->logical_device_list = found_dev->next;
+    loader_platform_thread_unlock_mutex(&inst->device_list_lock);
+
     loader_destroy_logical_device(inst, found_dev, pAllocator);
 }
 
@@ -1260,6 +1295,7 @@ void loader_icd_destroy(struct loader_instance *ptr_inst, struct loader_icd_term
         dev = next_dev;
     }
 
+    loader_free_icd_term_phys_dev_ext(ptr_inst, icd_term);
     loader_instance_heap_free(ptr_inst, icd_term);
 }
 
@@ -1320,6 +1356,7 @@ void loader_scanned_icd_clear(const struct loader_instance *inst, struct loader_
     if (0 != icd_tramp_list->capacity) {
         for (uint32_t i = 0; i < icd_tramp_list->count; i++) {
             loader_platform_close_library(icd_tramp_list->scanned_list[i].handle);
+            loader_stats_add(inst, VK_LOADER_STATISTIC_LIBRARIES_CLOSED, 1);
             loader_instance_heap_free(inst, icd_tramp_list->scanned_list[i].lib_name);
         }
         loader_instance_heap_free(inst, icd_tramp_list->scanned_list);
@@ -1342,8 +1379,11 @@ static VkResult loader_scanned_icd_init(const struct loader_instance *inst, stru
     return err;
 }
 
-static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list,
-                                       const char *filename, uint32_t api_version, enum loader_layer_library_status *lib_status) {
+// Open the driver library filename and negotiate the loader interface version with it, filling in scanned_icd with
+// everything but the library name. Nothing is shared with any other driver, so several drivers may be opened at once.
+// If the driver turns out to be unusable scanned_icd->handle is left NULL.
+static VkResult loader_scanned_icd_open(const struct loader_instance *inst, const char *filename, uint32_t api_version,
+                                        struct loader_scanned_icd *scanned_icd, enum loader_layer_library_status *lib_status) {
     loader_platform_dl_handle handle;
     PFN_vkCreateInstance fp_create_inst;
     PFN_vkEnumerateInstanceExtensionProperties fp_get_inst_ext_props;
@@ -1353,10 +1393,11 @@ static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struc
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
     PFN_vk_icdEnumerateAdapterPhysicalDevices fp_enum_dxgi_adapter_phys_devs = NULL;
 #endif
-    struct loader_scanned_icd *new_scanned_icd;
     uint32_t interface_vers;
     VkResult res = VK_SUCCESS;
 
+    memset(scanned_icd, 0, sizeof(struct loader_scanned_icd));
+
     // TODO implement smarter opening/closing of libraries. For now this
     // function leaves libraries open and the scanned_icd_clear closes them
 #if defined(__Fuchsia__)
@@ -1369,6 +1410,7 @@ static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struc
         res = VK_ERROR_INCOMPATIBLE_DRIVER;
         goto out;
     }
+    loader_stats_add(inst, VK_LOADER_STATISTIC_LIBRARIES_OPENED, 1);
 
     // Get and settle on an ICD interface version
     fp_negotiate_icd_version = loader_platform_get_proc_address(handle, "vk_icdNegotiateLoaderICDInterfaceVersion");
@@ -1448,15 +1490,43 @@ static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struc
 #endif
     }
 
+    loader_api_version api_version_struct = loader_make_version(api_version);
+    if (interface_vers <= 4 && loader_check_version_meets_required(LOADER_VERSION_1_1_0, api_version_struct)) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
+                   "loader_scanned_icd_add: Driver %s supports Vulkan %u.%u, but only supports loader interface version %u."
+                   " Interface version 5 or newer required to support this version of Vulkan (Policy #LDP_DRIVER_7)",
+                   filename, api_version_struct.major, api_version_struct.minor, interface_vers);
+    }
+
+    scanned_icd->handle = handle;
+    scanned_icd->api_version = api_version;
+    scanned_icd->GetInstanceProcAddr = fp_get_proc_addr;
+    scanned_icd->GetPhysicalDeviceProcAddr = fp_get_phys_dev_proc_addr;
+    scanned_icd->EnumerateInstanceExtensionProperties = fp_get_inst_ext_props;
+    scanned_icd->CreateInstance = fp_create_inst;
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    scanned_icd->EnumerateAdapterPhysicalDevices = fp_enum_dxgi_adapter_phys_devs;
+#endif
+    scanned_icd->interface_version = interface_vers;
+
+out:
+
+    return res;
+}
+
+// Append a driver opened by loader_scanned_icd_open to icd_tramp_list
+static VkResult loader_scanned_icd_commit(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list,
+                                          const char *filename, const struct loader_scanned_icd *scanned_icd) {
+    struct loader_scanned_icd *new_scanned_icd;
+
     // check for enough capacity
     if ((icd_tramp_list->count * sizeof(struct loader_scanned_icd)) >= icd_tramp_list->capacity) {
         void *new_ptr = loader_instance_heap_realloc(inst, icd_tramp_list->scanned_list, icd_tramp_list->capacity,
                                                      icd_tramp_list->capacity * 2, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
         if (NULL == new_ptr) {
-            res = VK_ERROR_OUT_OF_HOST_MEMORY;
             loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_scanned_icd_add: Realloc failed on icd library list for ICD %s",
                        filename);
-            goto out;
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
         }
         icd_tramp_list->scanned_list = new_ptr;
 
@@ -1464,37 +1534,31 @@ static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struc
         icd_tramp_list->capacity *= 2;
     }
 
-    loader_api_version api_version_struct = loader_make_version(api_version);
-    if (interface_vers <= 4 && loader_check_version_meets_required(LOADER_VERSION_1_1_0, api_version_struct)) {
-        loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
-                   "loader_scanned_icd_add: Driver %s supports Vulkan %u.%u, but only supports loader interface version %u."
-                   " Interface version 5 or newer required to support this version of Vulkan (Policy #LDP_DRIVER_7)",
-                   filename, api_version_struct.major, api_version_struct.minor, interface_vers);
-    }
-
     new_scanned_icd = &(icd_tramp_list->scanned_list[icd_tramp_list->count]);
-    new_scanned_icd->handle = handle;
-    new_scanned_icd->api_version = api_version;
-    new_scanned_icd->GetInstanceProcAddr = fp_get_proc_addr;
-    new_scanned_icd->GetPhysicalDeviceProcAddr = fp_get_phys_dev_proc_addr;
-    new_scanned_icd->EnumerateInstanceExtensionProperties = fp_get_inst_ext_props;
-    new_scanned_icd->CreateInstance = fp_create_inst;
-#if defined(VK_USE_PLATFORM_WIN32_KHR)
-    new_scanned_icd->EnumerateAdapterPhysicalDevices = fp_enum_dxgi_adapter_phys_devs;
-#endif
-    new_scanned_icd->interface_version = interface_vers;
-
+    *new_scanned_icd = *scanned_icd;
     new_scanned_icd->lib_name = (char *)loader_instance_heap_alloc(inst, strlen(filename) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
     if (NULL == new_scanned_icd->lib_name) {
         loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_scanned_icd_add: Out of memory can't add ICD %s", filename);
-        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-        goto out;
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
     }
     strcpy(new_scanned_icd->lib_name, filename);
     icd_tramp_list->count++;
+    return VK_SUCCESS;
+}
 
-out:
-
+static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list,
+                                       const char *filename, uint32_t api_version, enum loader_layer_library_status *lib_status) {
+    struct loader_scanned_icd scanned_icd;
+    loader_trace_begin("loader_scanned_icd_add", filename);
+    VkResult res = loader_scanned_icd_open(inst, filename, api_version, &scanned_icd, lib_status);
+    if (VK_SUCCESS == res && NULL != scanned_icd.handle) {
+        res = loader_scanned_icd_commit(inst, icd_tramp_list, filename, &scanned_icd);
+        if (VK_SUCCESS != res) {
+            loader_platform_close_library(scanned_icd.handle);
+            loader_stats_add(inst, VK_LOADER_STATISTIC_LIBRARIES_CLOSED, 1);
+        }
+    }
+    loader_trace_end("loader_scanned_icd_add");
     return res;
 }
 
@@ -1503,8 +1567,13 @@ void loader_initialize(void) {
     loader_platform_thread_create_mutex(&loader_lock);
     loader_platform_thread_create_mutex(&loader_json_lock);
     loader_platform_thread_create_mutex(&loader_preload_icd_lock);
+    loader_platform_thread_create_mutex(&loader_implicit_layer_cache_lock);
+    loader_manifest_watch_initialize();
+    loader_device_map_initialize();
     // initialize logging
     loader_debug_init();
+    loader_log_file_initialize();
+    loader_trace_initialize();
 #if defined(_WIN32)
     windows_initialization();
 #endif
@@ -1520,11 +1589,19 @@ void loader_initialize(void) {
 void loader_release() {
     // Guarantee release of the preloaded ICD libraries. This may have already been called in vkDestroyInstance.
     loader_unload_preloaded_icds();
+    loader_clear_implicit_layer_cache();
+    loader_manifest_watch_release();
+    loader_device_map_release();
 
     // release mutexes
     loader_platform_thread_delete_mutex(&loader_lock);
     loader_platform_thread_delete_mutex(&loader_json_lock);
     loader_platform_thread_delete_mutex(&loader_preload_icd_lock);
+    loader_platform_thread_delete_mutex(&loader_implicit_layer_cache_lock);
+
+    loader_trace_release();
+    // Last, so that everything logged while releasing still makes it into the log file
+    loader_log_file_release();
 }
 
 // Preload the ICD libraries that are likely to be needed so we don't repeatedly load/unload them later
@@ -1623,24 +1700,116 @@ static void loader_get_fullpath(const char *file, const char *in_dirs, size_t ou
     (void)snprintf(out_fullpath, out_size, "%s", file);
 }
 
-// Read a JSON file into a buffer.
+#if defined(__linux__) || defined(__APPLE__) || defined(__Fuchsia__) || defined(__QNXNTO__) || defined(__FreeBSD__)
+#define LOADER_FILE_MMAP_SUPPORTED 1
+// Regular files smaller than this are cheaper to read() than to map
+#define LOADER_FILE_MMAP_THRESHOLD (16 * 1024)
+#endif
+
+// Initial buffer size for files whose size isn't known up front, such as pipes
+#define LOADER_FILE_READ_CHUNK_SIZE 4096
+
+// The contents of a file read by loader_read_file, which must be released with loader_release_file. data holds exactly size
+// bytes. It is only null terminated when it was read into a buffer, so always go by size.
+struct loader_file_contents {
+    const char *data;
+    size_t size;
+    char *buffer;
+#if defined(LOADER_FILE_MMAP_SUPPORTED)
+    void *mapping;
+    size_t mapping_size;
+#endif
+};
+
+// Make sure there is room for at least one more byte of data past size, plus the null terminator.
+static VkResult loader_grow_file_buffer(const struct loader_instance *inst, struct loader_file_contents *contents,
+                                        size_t *capacity) {
+    if (NULL != contents->buffer && contents->size + 1 < *capacity) {
+        return VK_SUCCESS;
+    }
+    size_t new_capacity = *capacity == 0 ? LOADER_FILE_READ_CHUNK_SIZE : *capacity * 2;
+    char *new_buffer =
+        loader_instance_heap_realloc(inst, contents->buffer, *capacity, new_capacity, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == new_buffer) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    contents->buffer = new_buffer;
+    *capacity = new_capacity;
+    return VK_SUCCESS;
+}
+
+// Read the whole file in a single pass.
 //
-// @return -  A pointer to a cJSON object representing the JSON parse tree.
-//            This returned buffer should be freed by caller.
-static VkResult loader_get_json(const struct loader_instance *inst, const char *filename, cJSON **json) {
-    FILE *file = NULL;
-    char *json_buf = NULL;
-    size_t len;
+// Where available, regular files are opened with open() and sized with fstat(). Large files are then mapped and handed out
+// as-is, which avoids copying them at all. Everything else, including small files, pipes, and files which fail to map, is
+// read straight into a heap buffer that is sized from fstat() when possible.
+//
+// A mapping only ever covers the size fstat() reported, and nothing reads it past that size. A file which is truncated while
+// it is mapped would still fault when the missing pages are touched, so the size is checked again once the mapping exists and
+// the file is read instead if it changed in between.
+static VkResult loader_read_file(const struct loader_instance *inst, const char *filename, struct loader_file_contents *contents) {
     VkResult res = VK_SUCCESS;
+    size_t capacity = 0;
 
-    if (NULL == json) {
-        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_get_json: Received invalid JSON file");
-        res = VK_ERROR_INITIALIZATION_FAILED;
-        goto out;
+    memset(contents, 0, sizeof(struct loader_file_contents));
+
+#if defined(LOADER_FILE_MMAP_SUPPORTED)
+    int fd = open(filename, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_read_file: Failed to open JSON file %s", filename);
+        return VK_ERROR_INITIALIZATION_FAILED;
     }
 
-    *json = NULL;
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == 0 && S_ISREG(file_stat.st_mode) && file_stat.st_size > 0) {
+        size_t file_size = (size_t)file_stat.st_size;
+
+        if (file_size >= LOADER_FILE_MMAP_THRESHOLD) {
+            void *mapping = mmap(NULL, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (MAP_FAILED != mapping) {
+                struct stat mapped_stat;
+                if (fstat(fd, &mapped_stat) == 0 && mapped_stat.st_size == file_stat.st_size) {
+                    contents->mapping = mapping;
+                    contents->mapping_size = file_size;
+                    contents->data = (const char *)mapping;
+                    contents->size = file_size;
+                    goto out;
+                }
+                munmap(mapping, file_size);
+            }
+        }
+
+        // Leave room for the terminator plus one more byte, so that the read which detects the end of the file doesn't
+        // require growing the buffer.
+        capacity = file_size + 2;
+        contents->buffer = loader_instance_heap_alloc(inst, capacity, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (NULL == contents->buffer) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+            goto out;
+        }
+    }
 
+    while (true) {
+        res = loader_grow_file_buffer(inst, contents, &capacity);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+        ssize_t read_count = read(fd, contents->buffer + contents->size, capacity - contents->size - 1);
+        if (read_count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_read_file: Failed to read JSON file %s.", filename);
+            res = VK_ERROR_INITIALIZATION_FAILED;
+            goto out;
+        }
+        if (read_count == 0) {
+            break;
+        }
+        contents->size += (size_t)read_count;
+    }
+#else
+    FILE *file = NULL;
 #if defined(_WIN32)
     int filename_utf16_size = MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
     if (filename_utf16_size > 0) {
@@ -1652,59 +1821,160 @@ static VkResult loader_get_json(const struct loader_instance *inst, const char *
 #else
     file = fopen(filename, "rb");
 #endif
-
     if (!file) {
-        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_get_json: Failed to open JSON file %s", filename);
-        res = VK_ERROR_INITIALIZATION_FAILED;
-        goto out;
+        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_read_file: Failed to open JSON file %s", filename);
+        return VK_ERROR_INITIALIZATION_FAILED;
     }
-    // NOTE: We can't just use fseek(file, 0, SEEK_END) because that isn't guaranteed to be supported on all systems
-    size_t fread_ret_count = 0;
-    do {
-        char buffer[256];
-        fread_ret_count = fread(buffer, 1, 256, file);
-    } while (fread_ret_count == 256 && !feof(file));
-    len = ftell(file);
-    fseek(file, 0, SEEK_SET);
-    json_buf = (char *)loader_instance_heap_alloc(inst, len + 1, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
-    if (json_buf == NULL) {
-        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
-                   "loader_get_json: Failed to allocate space for JSON file %s buffer of length %d", filename, len);
-        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-        goto out;
+
+    while (true) {
+        res = loader_grow_file_buffer(inst, contents, &capacity);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+        size_t read_count = fread(contents->buffer + contents->size, 1, capacity - contents->size - 1, file);
+        contents->size += read_count;
+        if (read_count == 0 || feof(file)) {
+            if (ferror(file)) {
+                loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_read_file: Failed to read JSON file %s.", filename);
+                res = VK_ERROR_INITIALIZATION_FAILED;
+                goto out;
+            }
+            break;
+        }
     }
-    if (fread(json_buf, sizeof(char), len, file) != len) {
-        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_get_json: Failed to read JSON file %s.", filename);
-        res = VK_ERROR_INITIALIZATION_FAILED;
-        goto out;
+#endif
+    if (NULL == contents->buffer) {
+        // Nothing was read, or the file is empty
+        res = loader_grow_file_buffer(inst, contents, &capacity);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
     }
-    json_buf[len] = '\0';
+    contents->buffer[contents->size] = '\0';
+    contents->data = contents->buffer;
 
-    // Can't be a valid json if the string is of length zero
-    if (len == 0) {
-        res = VK_ERROR_INITIALIZATION_FAILED;
-        goto out;
+out:
+    if (VK_SUCCESS == res) {
+        loader_stats_add(inst, VK_LOADER_STATISTIC_MANIFEST_FILES_OPENED, 1);
+        loader_stats_add(inst, VK_LOADER_STATISTIC_MANIFEST_BYTES_READ, contents->size);
+    } else if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
+        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_read_file: Failed to allocate space for JSON file %s buffer",
+                   filename);
     }
-    // Parse text from file
-    *json = cJSON_Parse(inst ? &inst->alloc_callbacks : NULL, json_buf);
-    if (*json == NULL) {
-        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
-                   "loader_get_json: Failed to parse JSON file %s, this is usually because something ran out of memory.", filename);
-        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-        goto out;
+#if defined(LOADER_FILE_MMAP_SUPPORTED)
+    close(fd);
+#else
+    fclose(file);
+#endif
+    return res;
+}
+
+static void loader_release_file(const struct loader_instance *inst, struct loader_file_contents *contents) {
+#if defined(LOADER_FILE_MMAP_SUPPORTED)
+    if (NULL != contents->mapping) {
+        munmap(contents->mapping, contents->mapping_size);
     }
+#endif
+    loader_instance_heap_free(inst, contents->buffer);
+    memset(contents, 0, sizeof(struct loader_file_contents));
+}
 
-out:
-    if (NULL != json_buf) {
-        loader_instance_heap_free(inst, json_buf);
+// Validate the contents of the JSON file filename, which have already been read. On success root describes the top level value
+// of the file and points into contents.
+static VkResult loader_parse_json_contents(const struct loader_instance *inst, const char *filename,
+                                           const struct loader_file_contents *contents, struct loader_json_value *root) {
+    // Can't be a valid json if the string is of length zero
+    if (contents->size == 0) {
+        return VK_ERROR_INITIALIZATION_FAILED;
     }
-    if (NULL != file) {
-        fclose(file);
+    uint64_t value_count = 0;
+    bool parsed = loader_json_parse(contents->data, contents->size, root, &value_count);
+    loader_stats_add(inst, VK_LOADER_STATISTIC_JSON_VALUES_PARSED, value_count);
+    if (!parsed) {
+        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_read_json_file: Failed to parse JSON file %s", filename);
+        return VK_ERROR_INITIALIZATION_FAILED;
     }
+    return VK_SUCCESS;
+}
 
+// Read a JSON file and validate its contents.
+//
+// On success root describes the top level value of the file. It points into contents, which the caller must release with
+// loader_release_file once it is done with root.
+static VkResult loader_read_json_file(const struct loader_instance *inst, const char *filename,
+                                      struct loader_file_contents *contents, struct loader_json_value *root) {
+    loader_trace_begin("loader_read_json_file", filename);
+    VkResult res = loader_read_file(inst, filename, contents);
+    if (VK_SUCCESS == res) {
+        res = loader_parse_json_contents(inst, filename, contents, root);
+        if (VK_SUCCESS != res) {
+            loader_release_file(inst, contents);
+        }
+    }
+    loader_trace_end("loader_read_json_file");
     return res;
 }
 
+// One member of a JSON object which the loader looks for, and where to store its value
+struct loader_json_member {
+    const char *name;
+    size_t offset;
+};
+
+// Walk the members of object once, storing the value of each member listed in members at its offset into out. Members which
+// aren't listed are skipped, and only the first of any duplicated members is kept. Values which aren't found have a type of
+// LOADER_JSON_TYPE_NONE.
+static void loader_json_find_members(const struct loader_json_value *object, const struct loader_json_member *members,
+                                     uint32_t member_count, void *out) {
+    struct loader_json_iterator iter;
+    struct loader_json_value key, value;
+
+    for (uint32_t i = 0; i < member_count; i++) {
+        memset((char *)out + members[i].offset, 0, sizeof(struct loader_json_value));
+    }
+    if (object->type != LOADER_JSON_TYPE_OBJECT) {
+        return;
+    }
+    loader_json_iterate(object, &iter);
+    while (loader_json_next_member(&iter, &key, &value)) {
+        for (uint32_t i = 0; i < member_count; i++) {
+            if (loader_json_string_equals(&key, members[i].name)) {
+                struct loader_json_value *found = (struct loader_json_value *)((char *)out + members[i].offset);
+                if (found->type == LOADER_JSON_TYPE_NONE) {
+                    *found = value;
+                }
+                break;
+            }
+        }
+    }
+}
+
+// Copy each string in the array value into a newly allocated array of count strings. Elements which don't fit in
+// MAX_STRING_SIZE are truncated.
+static VkResult loader_copy_json_string_array(const struct loader_instance *inst, const struct loader_json_value *array,
+                                              uint32_t *count, char (**strings)[MAX_STRING_SIZE]) {
+    struct loader_json_iterator iter;
+    struct loader_json_value element;
+    uint32_t index = 0;
+
+    *count = loader_json_count(array);
+    *strings = NULL;
+    if (*count == 0 || array->type != LOADER_JSON_TYPE_ARRAY) {
+        *count = 0;
+        return VK_SUCCESS;
+    }
+    *strings = loader_instance_heap_alloc(inst, sizeof(char[MAX_STRING_SIZE]) * *count, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == *strings) {
+        *count = 0;
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    loader_json_iterate(array, &iter);
+    while (index < *count && loader_json_next_element(&iter, &element)) {
+        loader_json_copy_string(&element, (*strings)[index++], MAX_STRING_SIZE);
+    }
+    return VK_SUCCESS;
+}
+
 // Verify that all component layers in a meta-layer are valid.
 static bool verify_meta_layer_component_layers(const struct loader_instance *inst, struct loader_layer_properties *prop,
                                                struct loader_layer_list *instance_layers) {
@@ -1896,23 +2166,123 @@ static void remove_all_non_valid_override_layers(struct loader_instance *inst, s
     }
 }
 
+// The members of a "layer" object which the loader understands
+struct loader_layer_json {
+    struct loader_json_value name;
+    struct loader_json_value type;
+    struct loader_json_value api_version;
+    struct loader_json_value implementation_version;
+    struct loader_json_value description;
+    struct loader_json_value library_path;
+    struct loader_json_value component_layers;
+    struct loader_json_value expiration_date;
+    struct loader_json_value blacklisted_layers;
+    struct loader_json_value override_paths;
+    struct loader_json_value disable_environment;
+    struct loader_json_value enable_environment;
+    struct loader_json_value functions;
+    struct loader_json_value instance_extensions;
+    struct loader_json_value device_extensions;
+    struct loader_json_value pre_instance_functions;
+    struct loader_json_value app_keys;
+    struct loader_json_value library_arch;
+};
+
+#define LOADER_LAYER_JSON_MEMBER(var) \
+    { #var, offsetof(struct loader_layer_json, var) }
+static const struct loader_json_member loader_layer_json_members[] = {
+    LOADER_LAYER_JSON_MEMBER(name),
+    LOADER_LAYER_JSON_MEMBER(type),
+    LOADER_LAYER_JSON_MEMBER(api_version),
+    LOADER_LAYER_JSON_MEMBER(implementation_version),
+    LOADER_LAYER_JSON_MEMBER(description),
+    LOADER_LAYER_JSON_MEMBER(library_path),
+    LOADER_LAYER_JSON_MEMBER(component_layers),
+    LOADER_LAYER_JSON_MEMBER(expiration_date),
+    LOADER_LAYER_JSON_MEMBER(blacklisted_layers),
+    LOADER_LAYER_JSON_MEMBER(override_paths),
+    LOADER_LAYER_JSON_MEMBER(disable_environment),
+    LOADER_LAYER_JSON_MEMBER(enable_environment),
+    LOADER_LAYER_JSON_MEMBER(functions),
+    LOADER_LAYER_JSON_MEMBER(instance_extensions),
+    LOADER_LAYER_JSON_MEMBER(device_extensions),
+    LOADER_LAYER_JSON_MEMBER(pre_instance_functions),
+    LOADER_LAYER_JSON_MEMBER(app_keys),
+    LOADER_LAYER_JSON_MEMBER(library_arch),
+};
+#undef LOADER_LAYER_JSON_MEMBER
+
+// The members of the "functions" object in a layer
+struct loader_layer_functions_json {
+    struct loader_json_value vkNegotiateLoaderLayerInterfaceVersion;
+    struct loader_json_value vkGetInstanceProcAddr;
+    struct loader_json_value vkGetDeviceProcAddr;
+};
+
+static const struct loader_json_member loader_layer_functions_json_members[] = {
+    {"vkNegotiateLoaderLayerInterfaceVersion",
+     offsetof(struct loader_layer_functions_json, vkNegotiateLoaderLayerInterfaceVersion)},
+    {"vkGetInstanceProcAddr", offsetof(struct loader_layer_functions_json, vkGetInstanceProcAddr)},
+    {"vkGetDeviceProcAddr", offsetof(struct loader_layer_functions_json, vkGetDeviceProcAddr)},
+};
+
+// The members of each object in the "instance_extensions" and "device_extensions" arrays of a layer
+struct loader_layer_extension_json {
+    struct loader_json_value name;
+    struct loader_json_value spec_version;
+    struct loader_json_value entrypoints;
+};
+
+static const struct loader_json_member loader_layer_extension_json_members[] = {
+    {"name", offsetof(struct loader_layer_extension_json, name)},
+    {"spec_version", offsetof(struct loader_layer_extension_json, spec_version)},
+    {"entrypoints", offsetof(struct loader_layer_extension_json, entrypoints)},
+};
+
+// The members of the "pre_instance_functions" object in a layer
+struct loader_layer_pre_instance_json {
+    struct loader_json_value vkEnumerateInstanceExtensionProperties;
+    struct loader_json_value vkEnumerateInstanceLayerProperties;
+    struct loader_json_value vkEnumerateInstanceVersion;
+};
+
+static const struct loader_json_member loader_layer_pre_instance_json_members[] = {
+    {"vkEnumerateInstanceExtensionProperties",
+     offsetof(struct loader_layer_pre_instance_json, vkEnumerateInstanceExtensionProperties)},
+    {"vkEnumerateInstanceLayerProperties", offsetof(struct loader_layer_pre_instance_json, vkEnumerateInstanceLayerProperties)},
+    {"vkEnumerateInstanceVersion", offsetof(struct loader_layer_pre_instance_json, vkEnumerateInstanceVersion)},
+};
+
+// Copy the name and value of the single member of an environment variable object, such as "disable_environment", into
+// env_var. Returns false if the object is empty.
+static bool loader_read_layer_env_var_json(const struct loader_json_value *object, struct loader_name_value *env_var) {
+    struct loader_json_iterator iter;
+    struct loader_json_value key, value;
+
+    loader_json_iterate(object, &iter);
+    if (object->type != LOADER_JSON_TYPE_OBJECT || !loader_json_next_member(&iter, &key, &value)) {
+        return false;
+    }
+    loader_json_copy_string(&key, env_var->name, sizeof(env_var->name));
+    loader_json_copy_string(&value, env_var->value, sizeof(env_var->value));
+    return true;
+}
+
 static VkResult loader_read_layer_json(const struct loader_instance *inst, struct loader_layer_list *layer_instance_list,
-                                       cJSON *layer_node, loader_api_version version, cJSON *item, bool is_implicit,
+                                       const struct loader_json_value *layer_node, loader_api_version version, bool is_implicit,
                                        char *filename) {
-    char *temp;
-    char *name, *type, *library_path_str, *api_version;
-    char *implementation_version, *description;
-    cJSON *ext_item;
-    cJSON *library_path;
-    cJSON *component_layers;
-    cJSON *override_paths;
-    cJSON *blacklisted_layers;
-    cJSON *disable_environment = NULL;
+    struct loader_layer_json layer_json;
+    char name[MAX_STRING_SIZE], type[MAX_STRING_SIZE], api_version[MAX_STRING_SIZE];
+    char implementation_version[MAX_STRING_SIZE], description[MAX_STRING_SIZE];
+    char library_path_str[MAX_STRING_SIZE];
     VkExtensionProperties ext_prop;
     VkResult result = VK_ERROR_INITIALIZATION_FAILED;
     struct loader_layer_properties *props = NULL;
     uint32_t props_index = 0;
-    int i, j;
+
+    // All of the members are found in a single walk over the layer object, anything unknown is skipped over.
+    loader_json_find_members(layer_node, loader_layer_json_members,
+                             sizeof(loader_layer_json_members) / sizeof(loader_layer_json_members[0]), &layer_json);
 
 // The following are required in the "layer" object:
 // (required) "name"
@@ -1922,46 +2292,23 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
 // (required) "implementation_version"
 // (required) "description"
 // (required for implicit layers) "disable_environment"
-#define GET_JSON_OBJECT(node, var)                                         \
-    {                                                                      \
-        var = cJSON_GetObjectItem(node, #var);                             \
-        if (var == NULL) {                                                 \
-            loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,                    \
-                       "Didn't find required layer object %s in manifest " \
-                       "JSON file, skipping this layer",                   \
-                       #var);                                              \
-            goto out;                                                      \
-        }                                                                  \
-    }
-#define GET_JSON_ITEM(inst, node, var)                                         \
+#define GET_JSON_ITEM(inst, var)                                               \
     {                                                                          \
-        item = cJSON_GetObjectItem(node, #var);                                \
-        if (item == NULL) {                                                    \
+        if (layer_json.var.type == LOADER_JSON_TYPE_NONE) {                    \
             loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,                        \
                        "Didn't find required layer value %s in manifest JSON " \
                        "file, skipping this layer",                            \
                        #var);                                                  \
             goto out;                                                          \
         }                                                                      \
-        temp = cJSON_Print(item);                                              \
-        if (temp == NULL) {                                                    \
-            loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,                        \
-                       "Problem accessing layer value %s in manifest JSON "    \
-                       "file, skipping this layer",                            \
-                       #var);                                                  \
-            result = VK_ERROR_OUT_OF_HOST_MEMORY;                              \
-            goto out;                                                          \
-        }                                                                      \
-        temp[strlen(temp) - 1] = '\0';                                         \
-        var = loader_stack_alloc(strlen(temp) + 1);                            \
-        strcpy(var, &temp[1]);                                                 \
-        loader_instance_heap_free(inst, temp);                                 \
+        loader_json_copy_string(&layer_json.var, var, sizeof(var));            \
     }
-    GET_JSON_ITEM(inst, layer_node, name)
-    GET_JSON_ITEM(inst, layer_node, type)
-    GET_JSON_ITEM(inst, layer_node, api_version)
-    GET_JSON_ITEM(inst, layer_node, implementation_version)
-    GET_JSON_ITEM(inst, layer_node, description)
+    GET_JSON_ITEM(inst, name)
+    GET_JSON_ITEM(inst, type)
+    GET_JSON_ITEM(inst, api_version)
+    GET_JSON_ITEM(inst, implementation_version)
+    GET_JSON_ITEM(inst, description)
+#undef GET_JSON_ITEM
 
     // Add list entry
     if (!strcmp(type, "DEVICE")) {
@@ -1993,7 +2340,6 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
     // Expiration date for override layer.  Field starte with JSON file 1.1.2 and
     // is completely optional.  So, no check put in place.
     if (!strcmp(name, VK_OVERRIDE_LAYER_NAME)) {
-        cJSON *expiration;
         if (!loader_check_version_meets_required(loader_combine_version(1, 1, 2), version)) {
             loader_log(
                 inst, VULKAN_LOADER_WARN_BIT, 0,
@@ -2001,22 +2347,12 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
         }
 
         props->is_override = true;
-        expiration = cJSON_GetObjectItem(layer_node, "expiration_date");
-        if (NULL != expiration) {
+        if (layer_json.expiration_date.type != LOADER_JSON_TYPE_NONE) {
             char date_copy[32];
             uint8_t cur_item = 0;
 
             // Get the string for the current item
-            temp = cJSON_Print(expiration);
-            if (temp == NULL) {
-                loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
-                           "Problem accessing layer value 'expiration_date' in manifest JSON file, skipping this layer");
-                result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                goto out;
-            }
-            temp[strlen(temp) - 1] = '\0';
-            strcpy(date_copy, &temp[1]);
-            loader_instance_heap_free(inst, temp);
+            loader_json_copy_string(&layer_json.expiration_date, date_copy, sizeof(date_copy));
 
             if (strlen(date_copy) == 16) {
                 char *cur_start = &date_copy[0];
@@ -2058,10 +2394,8 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
     }
 
     // Library path no longer required unless component_layers is also not defined
-    library_path = cJSON_GetObjectItem(layer_node, "library_path");
-    component_layers = cJSON_GetObjectItem(layer_node, "component_layers");
-    if (NULL != library_path) {
-        if (NULL != component_layers) {
+    if (layer_json.library_path.type != LOADER_JSON_TYPE_NONE) {
+        if (layer_json.component_layers.type != LOADER_JSON_TYPE_NONE) {
             loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
                        "Indicating meta-layer-specific component_layers, but also defining layer library path.  Both are not "
                        "compatible, so skipping this layer");
@@ -2070,71 +2404,36 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
         props->num_component_layers = 0;
         props->component_layer_names = NULL;
 
-        temp = cJSON_Print(library_path);
-        if (NULL == temp) {
-            loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
-                       "Problem accessing layer value library_path in manifest JSON file, skipping this layer");
-            result = VK_ERROR_OUT_OF_HOST_MEMORY;
-            goto out;
-        }
-        temp[strlen(temp) - 1] = '\0';
-        library_path_str = loader_stack_alloc(strlen(temp) + 1);
-        strcpy(library_path_str, &temp[1]);
-        loader_instance_heap_free(inst, temp);
+        loader_json_copy_string(&layer_json.library_path, library_path_str, sizeof(library_path_str));
 
         strncpy(props->manifest_file_name, filename, MAX_STRING_SIZE);
         char *fullpath = props->lib_name;
         char *rel_base;
-        if (NULL != library_path_str) {
-            if (loader_platform_is_path(library_path_str)) {
-                // A relative or absolute path
-                char *name_copy = loader_stack_alloc(strlen(filename) + 1);
-                strcpy(name_copy, filename);
-                rel_base = loader_platform_dirname(name_copy);
-                loader_expand_path(library_path_str, rel_base, MAX_STRING_SIZE, fullpath);
-            } else {
-                // A filename which is assumed in a system directory
-                loader_get_fullpath(library_path_str, "", MAX_STRING_SIZE, fullpath);
-            }
+        if (loader_platform_is_path(library_path_str)) {
+            // A relative or absolute path
+            char *name_copy = loader_stack_alloc(strlen(filename) + 1);
+            strcpy(name_copy, filename);
+            rel_base = loader_platform_dirname(name_copy);
+            loader_expand_path(library_path_str, rel_base, MAX_STRING_SIZE, fullpath);
+        } else {
+            // A filename which is assumed in a system directory
+            loader_get_fullpath(library_path_str, "", MAX_STRING_SIZE, fullpath);
         }
-    } else if (NULL != component_layers) {
+    } else if (layer_json.component_layers.type != LOADER_JSON_TYPE_NONE) {
         if (!loader_check_version_meets_required(LOADER_VERSION_1_1_0, version)) {
             loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
                        "Indicating meta-layer-specific component_layers, but using older JSON file version.");
         }
-        int count = cJSON_GetArraySize(component_layers);
-        props->num_component_layers = count;
-
-        // Allocate buffer for layer names
-        props->component_layer_names =
-            loader_instance_heap_alloc(inst, sizeof(char[MAX_STRING_SIZE]) * count, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-        if (NULL == props->component_layer_names && count > 0) {
-            result = VK_ERROR_OUT_OF_HOST_MEMORY;
+        result = loader_copy_json_string_array(inst, &layer_json.component_layers, &props->num_component_layers,
+                                               &props->component_layer_names);
+        if (VK_SUCCESS != result) {
             goto out;
         }
-
-        // Copy the component layers into the array
-        for (i = 0; i < count; i++) {
-            cJSON *comp_layer = cJSON_GetArrayItem(component_layers, i);
-            if (NULL != comp_layer) {
-                temp = cJSON_Print(comp_layer);
-                if (NULL == temp) {
-                    result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    goto out;
-                }
-                temp[strlen(temp) - 1] = '\0';
-                strncpy(props->component_layer_names[i], temp + 1, MAX_STRING_SIZE - 1);
-                props->component_layer_names[i][MAX_STRING_SIZE - 1] = '\0';
-                loader_instance_heap_free(inst, temp);
-            }
-        }
+        result = VK_ERROR_INITIALIZATION_FAILED;
 
         // This is now, officially, a meta-layer
         props->type_flags |= VK_LAYER_TYPE_FLAG_META_LAYER;
         loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_LAYER_BIT, 0, "Encountered meta-layer %s", name);
-
-        // Make sure we set up other things so we head down the correct branches below
-        library_path_str = NULL;
     } else {
         loader_log(
             inst, VULKAN_LOADER_WARN_BIT, 0,
@@ -2144,84 +2443,40 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
 
     props->num_blacklist_layers = 0;
     props->blacklist_layer_names = NULL;
-    blacklisted_layers = cJSON_GetObjectItem(layer_node, "blacklisted_layers");
-    if (blacklisted_layers != NULL) {
+    if (layer_json.blacklisted_layers.type != LOADER_JSON_TYPE_NONE) {
         if (strcmp(name, VK_OVERRIDE_LAYER_NAME)) {
             loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
                        "Layer %s contains a blacklist, but a blacklist can only be provided by the override metalayer. This "
                        "blacklist will be ignored.",
                        name);
         } else {
-            props->num_blacklist_layers = cJSON_GetArraySize(blacklisted_layers);
-            if (props->num_blacklist_layers > 0) {
-                // Allocate the blacklist array
-                props->blacklist_layer_names = loader_instance_heap_alloc(
-                    inst, sizeof(char[MAX_STRING_SIZE]) * props->num_blacklist_layers, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-                if (props->blacklist_layer_names == NULL && props->num_blacklist_layers > 0) {
-                    result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    goto out;
-                }
-
-                // Copy the blacklisted layers into the array
-                for (i = 0; i < (int)props->num_blacklist_layers; ++i) {
-                    cJSON *black_layer = cJSON_GetArrayItem(blacklisted_layers, i);
-                    if (black_layer == NULL) {
-                        continue;
-                    }
-                    temp = cJSON_Print(black_layer);
-                    if (temp == NULL) {
-                        result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                        goto out;
-                    }
-                    temp[strlen(temp) - 1] = '\0';
-                    strncpy(props->blacklist_layer_names[i], temp + 1, MAX_STRING_SIZE - 1);
-                    props->blacklist_layer_names[i][MAX_STRING_SIZE - 1] = '\0';
-                    loader_instance_heap_free(inst, temp);
-                }
+            result = loader_copy_json_string_array(inst, &layer_json.blacklisted_layers, &props->num_blacklist_layers,
+                                                   &props->blacklist_layer_names);
+            if (VK_SUCCESS != result) {
+                goto out;
             }
+            result = VK_ERROR_INITIALIZATION_FAILED;
         }
     }
 
-    override_paths = cJSON_GetObjectItem(layer_node, "override_paths");
-    if (NULL != override_paths) {
+    if (layer_json.override_paths.type != LOADER_JSON_TYPE_NONE) {
         if (!loader_check_version_meets_required(loader_combine_version(1, 1, 0), version)) {
             loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
                        "Indicating meta-layer-specific override paths, but using older JSON file version.");
         }
-        int count = cJSON_GetArraySize(override_paths);
-        props->num_override_paths = count;
-        if (count > 0) {
-            // Allocate buffer for override paths
-            props->override_paths =
-                loader_instance_heap_alloc(inst, sizeof(char[MAX_STRING_SIZE]) * count, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-            if (NULL == props->override_paths && count > 0) {
-                result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                goto out;
-            }
-
-            // Copy the override paths into the array
-            for (i = 0; i < count; i++) {
-                cJSON *override_path = cJSON_GetArrayItem(override_paths, i);
-                if (NULL != override_path) {
-                    temp = cJSON_Print(override_path);
-                    if (NULL == temp) {
-                        result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                        goto out;
-                    }
-                    temp[strlen(temp) - 1] = '\0';
-                    strncpy(props->override_paths[i], temp + 1, MAX_STRING_SIZE - 1);
-                    props->override_paths[i][MAX_STRING_SIZE - 1] = '\0';
-                    loader_instance_heap_free(inst, temp);
-                }
-            }
+        result =
+            loader_copy_json_string_array(inst, &layer_json.override_paths, &props->num_override_paths, &props->override_paths);
+        if (VK_SUCCESS != result) {
+            goto out;
         }
+        result = VK_ERROR_INITIALIZATION_FAILED;
     }
 
-    if (is_implicit) {
-        GET_JSON_OBJECT(layer_node, disable_environment)
+    if (is_implicit && layer_json.disable_environment.type == LOADER_JSON_TYPE_NONE) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
+                   "Didn't find required layer object disable_environment in manifest JSON file, skipping this layer");
+        goto out;
     }
-#undef GET_JSON_ITEM
-#undef GET_JSON_OBJECT
 
     strncpy(props->info.layerName, name, sizeof(props->info.layerName));
     props->info.layerName[sizeof(props->info.layerName) - 1] = '\0';
@@ -2234,16 +2489,12 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
     strncpy((char *)props->info.description, description, sizeof(props->info.description));
     props->info.description[sizeof(props->info.description) - 1] = '\0';
     if (is_implicit) {
-        if (!disable_environment || !disable_environment->child) {
+        if (!loader_read_layer_env_var_json(&layer_json.disable_environment, &props->disable_env_var)) {
             loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
                        "Didn't find required layer child value disable_environment in manifest JSON file, skipping this layer "
                        "(Policy #LLP_LAYER_9)");
             goto out;
         }
-        strncpy(props->disable_env_var.name, disable_environment->child->string, sizeof(props->disable_env_var.name));
-        props->disable_env_var.name[sizeof(props->disable_env_var.name) - 1] = '\0';
-        strncpy(props->disable_env_var.value, disable_environment->child->valuestring, sizeof(props->disable_env_var.value));
-        props->disable_env_var.value[sizeof(props->disable_env_var.value) - 1] = '\0';
     }
 
     // Make sure the layer's manifest doesn't contain a non zero variant value
@@ -2255,60 +2506,31 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
         goto out;
     }
 
-// Now get all optional items and objects and put in list:
-// functions
-// instance_extensions
-// device_extensions
-// enable_environment (implicit layers only)
-// library_arch
-#define GET_JSON_OBJECT(node, var) \
-    { var = cJSON_GetObjectItem(node, #var); }
-#define GET_JSON_ITEM(inst, node, var)                      \
-    {                                                       \
-        item = cJSON_GetObjectItem(node, #var);             \
-        if (item != NULL) {                                 \
-            temp = cJSON_Print(item);                       \
-            if (temp != NULL) {                             \
-                temp[strlen(temp) - 1] = '\0';              \
-                var = loader_stack_alloc(strlen(temp) + 1); \
-                strcpy(var, &temp[1]);                      \
-                loader_instance_heap_free(inst, temp);      \
-            } else {                                        \
-                result = VK_ERROR_OUT_OF_HOST_MEMORY;       \
-                goto out;                                   \
-            }                                               \
-        }                                                   \
-    }
-
-    cJSON *instance_extensions, *device_extensions, *functions, *enable_environment;
-    cJSON *entrypoints = NULL;
-    char *vkGetInstanceProcAddr = NULL;
-    char *vkGetDeviceProcAddr = NULL;
-    char *vkNegotiateLoaderLayerInterfaceVersion = NULL;
-    char *spec_version = NULL;
-    char **entry_array = NULL;
-    char *library_arch = NULL;
-    cJSON *app_keys = NULL;
+    // Now get all optional items and objects and put in list:
+    // functions
+    // instance_extensions
+    // device_extensions
+    // enable_environment (implicit layers only)
+    // library_arch
 
     // Layer interface functions
     //    vkGetInstanceProcAddr
     //    vkGetDeviceProcAddr
     //    vkNegotiateLoaderLayerInterfaceVersion (starting with JSON file 1.1.0)
-    GET_JSON_OBJECT(layer_node, functions)
-    if (functions != NULL) {
+    if (layer_json.functions.type != LOADER_JSON_TYPE_NONE) {
+        struct loader_layer_functions_json functions;
+        loader_json_find_members(&layer_json.functions, loader_layer_functions_json_members,
+                                 sizeof(loader_layer_functions_json_members) / sizeof(loader_layer_functions_json_members[0]),
+                                 &functions);
         if (loader_check_version_meets_required(loader_combine_version(1, 1, 0), version)) {
-            GET_JSON_ITEM(inst, functions, vkNegotiateLoaderLayerInterfaceVersion)
-            if (vkNegotiateLoaderLayerInterfaceVersion != NULL)
-                strncpy(props->functions.str_negotiate_interface, vkNegotiateLoaderLayerInterfaceVersion,
-                        sizeof(props->functions.str_negotiate_interface));
-            props->functions.str_negotiate_interface[sizeof(props->functions.str_negotiate_interface) - 1] = '\0';
+            loader_json_copy_string(&functions.vkNegotiateLoaderLayerInterfaceVersion, props->functions.str_negotiate_interface,
+                                    sizeof(props->functions.str_negotiate_interface));
         } else {
             props->functions.str_negotiate_interface[0] = '\0';
         }
-        GET_JSON_ITEM(inst, functions, vkGetInstanceProcAddr)
-        GET_JSON_ITEM(inst, functions, vkGetDeviceProcAddr)
-        if (vkGetInstanceProcAddr != NULL) {
-            strncpy(props->functions.str_gipa, vkGetInstanceProcAddr, sizeof(props->functions.str_gipa));
+        if (functions.vkGetInstanceProcAddr.type != LOADER_JSON_TYPE_NONE) {
+            loader_json_copy_string(&functions.vkGetInstanceProcAddr, props->functions.str_gipa,
+                                    sizeof(props->functions.str_gipa));
             if (loader_check_version_meets_required(loader_combine_version(1, 1, 0), version)) {
                 loader_log(inst, VULKAN_LOADER_INFO_BIT, 0,
                            "Layer \"%s\" using deprecated \'vkGetInstanceProcAddr\' tag which was deprecated starting with JSON "
@@ -2317,9 +2539,8 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
                            name);
             }
         }
-        props->functions.str_gipa[sizeof(props->functions.str_gipa) - 1] = '\0';
-        if (vkGetDeviceProcAddr != NULL) {
-            strncpy(props->functions.str_gdpa, vkGetDeviceProcAddr, sizeof(props->functions.str_gdpa));
+        if (functions.vkGetDeviceProcAddr.type != LOADER_JSON_TYPE_NONE) {
+            loader_json_copy_string(&functions.vkGetDeviceProcAddr, props->functions.str_gdpa, sizeof(props->functions.str_gdpa));
             if (loader_check_version_meets_required(loader_combine_version(1, 1, 0), version)) {
                 loader_log(inst, VULKAN_LOADER_INFO_BIT, 0,
                            "Layer \"%s\" using deprecated \'vkGetDeviceProcAddr\' tag which was deprecated starting with JSON "
@@ -2328,7 +2549,6 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
                            name);
             }
         }
-        props->functions.str_gdpa[sizeof(props->functions.str_gdpa) - 1] = '\0';
     }
 
     // instance_extensions
@@ -2336,22 +2556,19 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
     //     name
     //     spec_version
     //   }
-    GET_JSON_OBJECT(layer_node, instance_extensions)
-    if (instance_extensions != NULL) {
-        int count = cJSON_GetArraySize(instance_extensions);
-        for (i = 0; i < count; i++) {
-            ext_item = cJSON_GetArrayItem(instance_extensions, i);
-            GET_JSON_ITEM(inst, ext_item, name)
-            if (name != NULL) {
-                strncpy(ext_prop.extensionName, name, sizeof(ext_prop.extensionName));
-                ext_prop.extensionName[sizeof(ext_prop.extensionName) - 1] = '\0';
-            }
-            GET_JSON_ITEM(inst, ext_item, spec_version)
-            if (NULL != spec_version) {
-                ext_prop.specVersion = atoi(spec_version);
-            } else {
-                ext_prop.specVersion = 0;
-            }
+    if (layer_json.instance_extensions.type == LOADER_JSON_TYPE_ARRAY) {
+        struct loader_json_iterator iter;
+        struct loader_json_value ext_item;
+        loader_json_iterate(&layer_json.instance_extensions, &iter);
+        while (loader_json_next_element(&iter, &ext_item)) {
+            struct loader_layer_extension_json ext_json;
+            char spec_version[32];
+            loader_json_find_members(&ext_item, loader_layer_extension_json_members,
+                                     sizeof(loader_layer_extension_json_members) / sizeof(loader_layer_extension_json_members[0]),
+                                     &ext_json);
+            loader_json_copy_string(&ext_json.name, ext_prop.extensionName, sizeof(ext_prop.extensionName));
+            loader_json_copy_string(&ext_json.spec_version, spec_version, sizeof(spec_version));
+            ext_prop.specVersion = atoi(spec_version);
             bool ext_unsupported = wsi_unsupported_instance_extension(&ext_prop);
             if (!ext_unsupported) {
                 loader_add_to_ext_list(inst, &props->instance_extension_list, 1, &ext_prop);
@@ -2365,66 +2582,49 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
     //     spec_version
     //     entrypoints
     //   }
-    GET_JSON_OBJECT(layer_node, device_extensions)
-    if (device_extensions != NULL) {
-        int count = cJSON_GetArraySize(device_extensions);
-        for (i = 0; i < count; i++) {
-            ext_item = cJSON_GetArrayItem(device_extensions, i);
-            GET_JSON_ITEM(inst, ext_item, name)
-            GET_JSON_ITEM(inst, ext_item, spec_version)
-            if (name != NULL) {
-                strncpy(ext_prop.extensionName, name, sizeof(ext_prop.extensionName));
-                ext_prop.extensionName[sizeof(ext_prop.extensionName) - 1] = '\0';
-            }
-            if (NULL != spec_version) {
-                ext_prop.specVersion = atoi(spec_version);
-            } else {
-                ext_prop.specVersion = 0;
-            }
-            // entrypoints = cJSON_GetObjectItem(ext_item, "entrypoints");
-            GET_JSON_OBJECT(ext_item, entrypoints)
-            int entry_count;
-            if (entrypoints == NULL) {
-                loader_add_to_dev_ext_list(inst, &props->device_extension_list, &ext_prop, 0, NULL);
-                continue;
-            }
-            entry_count = cJSON_GetArraySize(entrypoints);
-            if (entry_count) {
+    if (layer_json.device_extensions.type == LOADER_JSON_TYPE_ARRAY) {
+        struct loader_json_iterator iter;
+        struct loader_json_value ext_item;
+        loader_json_iterate(&layer_json.device_extensions, &iter);
+        while (loader_json_next_element(&iter, &ext_item)) {
+            struct loader_layer_extension_json ext_json;
+            char spec_version[32];
+            loader_json_find_members(&ext_item, loader_layer_extension_json_members,
+                                     sizeof(loader_layer_extension_json_members) / sizeof(loader_layer_extension_json_members[0]),
+                                     &ext_json);
+            loader_json_copy_string(&ext_json.name, ext_prop.extensionName, sizeof(ext_prop.extensionName));
+            loader_json_copy_string(&ext_json.spec_version, spec_version, sizeof(spec_version));
+            ext_prop.specVersion = atoi(spec_version);
+
+            uint32_t entry_count = 0;
+            char **entry_array = NULL;
+            if (ext_json.entrypoints.type == LOADER_JSON_TYPE_ARRAY) {
+                entry_count = loader_json_count(&ext_json.entrypoints);
+            }
+            if (entry_count > 0) {
+                struct loader_json_iterator entry_iter;
+                struct loader_json_value entry;
+                uint32_t j = 0;
                 entry_array = (char **)loader_stack_alloc(sizeof(char *) * entry_count);
-            }
-            for (j = 0; j < entry_count; j++) {
-                ext_item = cJSON_GetArrayItem(entrypoints, j);
-                if (ext_item != NULL) {
-                    temp = cJSON_Print(ext_item);
-                    if (NULL == temp) {
-                        entry_array[j] = NULL;
-                        result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                        goto out;
-                    }
-                    temp[strlen(temp) - 1] = '\0';
-                    entry_array[j] = loader_stack_alloc(strlen(temp) + 1);
-                    strcpy(entry_array[j], &temp[1]);
-                    loader_instance_heap_free(inst, temp);
+                loader_json_iterate(&ext_json.entrypoints, &entry_iter);
+                while (j < entry_count && loader_json_next_element(&entry_iter, &entry)) {
+                    size_t entry_length = loader_json_string_length(&entry);
+                    entry_array[j] = loader_stack_alloc(entry_length + 1);
+                    loader_json_copy_string(&entry, entry_array[j], entry_length + 1);
+                    j++;
                 }
             }
             loader_add_to_dev_ext_list(inst, &props->device_extension_list, &ext_prop, entry_count, entry_array);
         }
     }
-    if (is_implicit) {
-        GET_JSON_OBJECT(layer_node, enable_environment)
 
-        // enable_environment is optional
-        if (enable_environment) {
-            strncpy(props->enable_env_var.name, enable_environment->child->string, sizeof(props->enable_env_var.name));
-            props->enable_env_var.name[sizeof(props->enable_env_var.name) - 1] = '\0';
-            strncpy(props->enable_env_var.value, enable_environment->child->valuestring, sizeof(props->enable_env_var.value));
-            props->enable_env_var.value[sizeof(props->enable_env_var.value) - 1] = '\0';
-        }
+    // enable_environment is optional
+    if (is_implicit && layer_json.enable_environment.type != LOADER_JSON_TYPE_NONE) {
+        loader_read_layer_env_var_json(&layer_json.enable_environment, &props->enable_env_var);
     }
 
     // Read in the pre-instance stuff
-    cJSON *pre_instance = cJSON_GetObjectItem(layer_node, "pre_instance_functions");
-    if (NULL != pre_instance) {
+    if (layer_json.pre_instance_functions.type != LOADER_JSON_TYPE_NONE) {
         // Supported versions started in 1.1.2, so anything newer
         if (!loader_check_version_meets_required(loader_combine_version(1, 1, 2), version)) {
             loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
@@ -2437,88 +2637,42 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
                        "layers. The section will be ignored",
                        filename);
         } else {
-            cJSON *inst_ext_json = cJSON_GetObjectItem(pre_instance, "vkEnumerateInstanceExtensionProperties");
-            if (NULL != inst_ext_json) {
-                char *inst_ext_name = cJSON_Print(inst_ext_json);
-                if (NULL == inst_ext_name) {
-                    result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    goto out;
-                }
-                size_t len = strlen(inst_ext_name) >= MAX_STRING_SIZE ? MAX_STRING_SIZE - 3 : strlen(inst_ext_name) - 2;
-                strncpy(props->pre_instance_functions.enumerate_instance_extension_properties, inst_ext_name + 1, len);
-                props->pre_instance_functions.enumerate_instance_extension_properties[len] = '\0';
-                loader_instance_heap_free(inst, inst_ext_name);
-            }
-
-            cJSON *inst_layer_json = cJSON_GetObjectItem(pre_instance, "vkEnumerateInstanceLayerProperties");
-            if (NULL != inst_layer_json) {
-                char *inst_layer_name = cJSON_Print(inst_layer_json);
-                if (NULL == inst_layer_name) {
-                    result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    goto out;
-                }
-                size_t len = strlen(inst_layer_name) >= MAX_STRING_SIZE ? MAX_STRING_SIZE - 3 : strlen(inst_layer_name) - 2;
-                strncpy(props->pre_instance_functions.enumerate_instance_layer_properties, inst_layer_name + 1, len);
-                props->pre_instance_functions.enumerate_instance_layer_properties[len] = '\0';
-                loader_instance_heap_free(inst, inst_layer_name);
-            }
-
-            cJSON *inst_version_json = cJSON_GetObjectItem(pre_instance, "vkEnumerateInstanceVersion");
-            if (NULL != inst_version_json) {
-                char *inst_version_name = cJSON_Print(inst_version_json);
-                if (NULL == inst_version_name) {
-                    result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    goto out;
-                }
-                size_t len = strlen(inst_version_name) >= MAX_STRING_SIZE ? MAX_STRING_SIZE - 3 : strlen(inst_version_name) - 2;
-                strncpy(props->pre_instance_functions.enumerate_instance_version, inst_version_name + 1, len);
-                props->pre_instance_functions.enumerate_instance_version[len] = '\0';
-                loader_instance_heap_free(inst, inst_version_name);
-            }
+            struct loader_layer_pre_instance_json pre_instance;
+            loader_json_find_members(
+                &layer_json.pre_instance_functions, loader_layer_pre_instance_json_members,
+                sizeof(loader_layer_pre_instance_json_members) / sizeof(loader_layer_pre_instance_json_members[0]), &pre_instance);
+            loader_json_copy_string(&pre_instance.vkEnumerateInstanceExtensionProperties,
+                                    props->pre_instance_functions.enumerate_instance_extension_properties,
+                                    sizeof(props->pre_instance_functions.enumerate_instance_extension_properties));
+            loader_json_copy_string(&pre_instance.vkEnumerateInstanceLayerProperties,
+                                    props->pre_instance_functions.enumerate_instance_layer_properties,
+                                    sizeof(props->pre_instance_functions.enumerate_instance_layer_properties));
+            loader_json_copy_string(&pre_instance.vkEnumerateInstanceVersion,
+                                    props->pre_instance_functions.enumerate_instance_version,
+                                    sizeof(props->pre_instance_functions.enumerate_instance_version));
         }
     }
 
     props->num_app_key_paths = 0;
     props->app_key_paths = NULL;
-    app_keys = cJSON_GetObjectItem(layer_node, "app_keys");
-    if (app_keys != NULL) {
+    if (layer_json.app_keys.type != LOADER_JSON_TYPE_NONE) {
         if (strcmp(name, VK_OVERRIDE_LAYER_NAME)) {
             loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_LAYER_BIT, 0,
                        "Layer %s contains app_keys, but any app_keys can only be provided by the override metalayer. "
                        "These will be ignored.",
                        name);
         } else {
-            props->num_app_key_paths = cJSON_GetArraySize(app_keys);
-
-            // Allocate the blacklist array
-            props->app_key_paths = loader_instance_heap_alloc(inst, sizeof(char[MAX_STRING_SIZE]) * props->num_app_key_paths,
-                                                              VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-            if (props->app_key_paths == NULL) {
-                result = VK_ERROR_OUT_OF_HOST_MEMORY;
+            result = loader_copy_json_string_array(inst, &layer_json.app_keys, &props->num_app_key_paths, &props->app_key_paths);
+            if (VK_SUCCESS != result) {
                 goto out;
             }
-
-            // Copy the app_key_paths into the array
-            for (i = 0; i < (int)props->num_app_key_paths; ++i) {
-                cJSON *app_key_path = cJSON_GetArrayItem(app_keys, i);
-                if (app_key_path == NULL) {
-                    continue;
-                }
-                temp = cJSON_Print(app_key_path);
-                if (temp == NULL) {
-                    result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    goto out;
-                }
-                temp[strlen(temp) - 1] = '\0';
-                strncpy(props->app_key_paths[i], temp + 1, MAX_STRING_SIZE - 1);
-                props->app_key_paths[i][MAX_STRING_SIZE - 1] = '\0';
-                loader_instance_heap_free(inst, temp);
-            }
+            result = VK_ERROR_INITIALIZATION_FAILED;
         }
     }
 
-    GET_JSON_ITEM(inst, layer_node, library_arch)
-    if (library_arch != NULL) {
+    if (layer_json.library_arch.type != LOADER_JSON_TYPE_NONE) {
+        char library_arch[8];
+        loader_json_copy_string(&layer_json.library_arch, library_arch, sizeof(library_arch));
         if ((strncmp(library_arch, "32", 2) == 0 && sizeof(void *) != 4) ||
             (strncmp(library_arch, "64", 2) == 0 && sizeof(void *) != 8)) {
             loader_log(inst, VULKAN_LOADER_INFO_BIT, 0,
@@ -2530,9 +2684,6 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
     result = VK_SUCCESS;
 
 out:
-#undef GET_JSON_ITEM
-#undef GET_JSON_OBJECT
-
     if (VK_SUCCESS != result && NULL != props) {
         // Make sure to free anything that was allocated
         loader_remove_layer_in_list(inst, layer_instance_list, props_index);
@@ -2551,9 +2702,8 @@ static inline bool is_valid_layer_json_version(const loader_api_version *layer_j
     return false;
 }
 
-// Given a cJSON struct (json) of the top level JSON object from layer manifest
-// file, add entry to the layer_list. Fill out the layer_properties in this list
-// entry from the input cJSON object.
+// Given the top level JSON object (json) from a layer manifest file, add an entry to the layer_list for each layer it
+// describes. Fill out the layer_properties in these list entries from the JSON.
 //
 // \returns
 // void
@@ -2561,27 +2711,47 @@ static inline bool is_valid_layer_json_version(const loader_api_version *layer_j
 // If the json input object does not have all the required fields no entry
 // is added to the list.
 static VkResult loader_add_layer_properties(const struct loader_instance *inst, struct loader_layer_list *layer_instance_list,
-                                            cJSON *json, bool is_implicit, char *filename) {
+                                            const struct loader_json_value *json, bool is_implicit, char *filename) {
     // The following Fields in layer manifest file that are required:
     //   - "file_format_version"
     //   - If more than one "layer" object are used, then the "layers" array is
     //     required
     VkResult result = VK_ERROR_INITIALIZATION_FAILED;
-    cJSON *item, *layers_node, *layer_node;
+    struct loader_json_iterator iter;
+    struct loader_json_value key, value;
+    struct loader_json_value file_format_version, layers_node, layer_node;
+    uint32_t layer_count = 0;
     loader_api_version json_version = {0, 0, 0};
-    char *file_vers = NULL;
+    char file_vers[64];
+
     // Make sure sure the top level json value is an object
-    if (!json || json->type != 6) {
+    if (json->type != LOADER_JSON_TYPE_OBJECT) {
         goto out;
     }
-    item = cJSON_GetObjectItem(json, "file_format_version");
-    if (item == NULL) {
-        goto out;
+
+    // Any number of "layer" members may be present, so the top level is walked by hand rather than with
+    // loader_json_find_members.
+    memset(&file_format_version, 0, sizeof(file_format_version));
+    memset(&layers_node, 0, sizeof(layers_node));
+    memset(&layer_node, 0, sizeof(layer_node));
+    loader_json_iterate(json, &iter);
+    while (loader_json_next_member(&iter, &key, &value)) {
+        if (file_format_version.type == LOADER_JSON_TYPE_NONE && loader_json_string_equals(&key, "file_format_version")) {
+            file_format_version = value;
+        } else if (layers_node.type == LOADER_JSON_TYPE_NONE && loader_json_string_equals(&key, "layers")) {
+            layers_node = value;
+        } else if (loader_json_string_equals(&key, "layer")) {
+            if (layer_count == 0) {
+                layer_node = value;
+            }
+            layer_count++;
+        }
     }
-    file_vers = cJSON_PrintUnformatted(item);
-    if (NULL == file_vers) {
+
+    if (file_format_version.type == LOADER_JSON_TYPE_NONE) {
         goto out;
     }
+    loader_json_copy_string(&file_format_version, file_vers, sizeof(file_vers));
     loader_log(inst, VULKAN_LOADER_INFO_BIT, 0, "Found manifest file %s (file version %s)", filename, file_vers);
     // Get the major/minor/and patch as integers for easier comparison
     json_version = loader_make_version(loader_parse_version_string(file_vers));
@@ -2593,9 +2763,7 @@ static VkResult loader_add_layer_properties(const struct loader_instance *inst,
     }
 
     // If "layers" is present, read in the array of layer objects
-    layers_node = cJSON_GetObjectItem(json, "layers");
-    if (layers_node != NULL) {
-        int numItems = cJSON_GetArraySize(layers_node);
+    if (layers_node.type != LOADER_JSON_TYPE_NONE) {
         // Supported versions started in 1.0.1, so anything newer
         if (!loader_check_version_meets_required(loader_combine_version(1, 0, 1), json_version)) {
             loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_LAYER_BIT, 0,
@@ -2603,34 +2771,18 @@ static VkResult loader_add_layer_properties(const struct loader_instance *inst,
                        "version %s",
                        filename, file_vers);
         }
-        for (int curLayer = 0; curLayer < numItems; curLayer++) {
-            layer_node = cJSON_GetArrayItem(layers_node, curLayer);
-            if (layer_node == NULL) {
-                loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_LAYER_BIT, 0,
-                           "loader_add_layer_properties: Can not find 'layers' array element %d object in manifest JSON file %s.  "
-                           "Skipping this file",
-                           curLayer, filename);
-                goto out;
-            }
-            result = loader_read_layer_json(inst, layer_instance_list, layer_node, json_version, item, is_implicit, filename);
+        loader_json_iterate(&layers_node, &iter);
+        while (loader_json_next_element(&iter, &layer_node)) {
+            result = loader_read_layer_json(inst, layer_instance_list, &layer_node, json_version, is_implicit, filename);
         }
     } else {
         // Otherwise, try to read in individual layers
-        layer_node = cJSON_GetObjectItem(json, "layer");
-        if (layer_node == NULL) {
+        if (layer_count == 0) {
             loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_LAYER_BIT, 0,
                        "loader_add_layer_properties: Can not find 'layer' object in manifest JSON file %s.  Skipping this file.",
                        filename);
             goto out;
         }
-        // Loop through all "layer" objects in the file to get a count of them
-        // first.
-        uint16_t layer_count = 0;
-        cJSON *tempNode = layer_node;
-        do {
-            tempNode = tempNode->next;
-            layer_count++;
-        } while (tempNode != NULL);
 
         // Throw a warning if we encounter multiple "layer" objects in file
         // versions newer than 1.0.0.  Having multiple objects with the same
@@ -2641,19 +2793,181 @@ static VkResult loader_add_layer_properties(const struct loader_instance *inst,
                        "Please use 'layers' : [] array instead in %s.",
                        filename);
         } else {
-            do {
-                result = loader_read_layer_json(inst, layer_instance_list, layer_node, json_version, item, is_implicit, filename);
-                layer_node = layer_node->next;
-            } while (layer_node != NULL);
+            loader_json_iterate(json, &iter);
+            while (loader_json_next_member(&iter, &key, &value)) {
+                if (loader_json_string_equals(&key, "layer")) {
+                    result = loader_read_layer_json(inst, layer_instance_list, &value, json_version, is_implicit, filename);
+                }
+            }
         }
     }
 
 out:
-    if (NULL != file_vers) {
-        loader_instance_heap_free(inst, file_vers);
+    return result;
+}
+
+// Read the layer manifest file filename and add the layers it describes to layer_instance_list. If a manifest cache is open
+// and holds an up to date entry for the file, the layers are taken from the cache instead of parsing the JSON. If the file has
+// already been read, preread_contents holds what was read and the file isn't read again.
+static VkResult loader_parse_layer_manifest(const struct loader_instance *inst, struct loader_manifest_cache *manifest_cache,
+                                            struct loader_layer_list *layer_instance_list, bool is_implicit, char *filename,
+                                            const struct loader_file_contents *preread_contents) {
+    struct loader_manifest_cache_key cache_key;
+    struct loader_file_contents contents;
+    struct loader_json_value json;
+    uint32_t first_new_layer = layer_instance_list->count;
+    VkResult res = VK_SUCCESS;
+
+    enum loader_manifest_cache_kind cache_kind =
+        is_implicit ? LOADER_MANIFEST_CACHE_KIND_IMPLICIT_LAYER : LOADER_MANIFEST_CACHE_KIND_EXPLICIT_LAYER;
+    bool use_cache = NULL != manifest_cache && loader_manifest_cache_get_key(filename, cache_kind, &cache_key);
+    if (use_cache) {
+        bool found = false;
+        res = loader_manifest_cache_find_layers(inst, manifest_cache, &cache_key, layer_instance_list, &found);
+        if (found) {
+            loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_LAYER_BIT, 0,
+                       "Using cached contents of layer manifest file %s", filename);
+        }
+        if (VK_SUCCESS != res || found) {
+            return res;
+        }
     }
 
-    return result;
+    if (NULL != preread_contents) {
+        res = loader_parse_json_contents(inst, filename, preread_contents, &json);
+    } else {
+        res = loader_read_json_file(inst, filename, &contents, &json);
+    }
+    if (VK_SUCCESS != res) {
+        return res;
+    }
+
+    res = loader_add_layer_properties(inst, layer_instance_list, &json, is_implicit, filename);
+    if (NULL == preread_contents) {
+        loader_release_file(inst, &contents);
+    }
+
+    if (use_cache && VK_ERROR_OUT_OF_HOST_MEMORY != res) {
+        uint32_t new_layer_count = layer_instance_list->count - first_new_layer;
+        const struct loader_layer_properties *new_layers =
+            new_layer_count > 0 ? &layer_instance_list->list[first_new_layer] : NULL;
+        VkResult cache_res = loader_manifest_cache_store_layers(inst, manifest_cache, &cache_key, new_layers, new_layer_count);
+        if (VK_ERROR_OUT_OF_HOST_MEMORY == cache_res) {
+            res = cache_res;
+        }
+    }
+    return res;
+}
+
+static const struct loader_file_contents *loader_get_preread_contents(const struct loader_file_contents *preread_contents,
+                                                                      uint32_t index) {
+    if (NULL == preread_contents || NULL == preread_contents[index].data) {
+        return NULL;
+    }
+    return &preread_contents[index];
+}
+
+// Layers decoded out of a single manifest file while the manifests are being parsed on several threads
+struct loader_layer_manifest_job {
+    char *filename;
+    const struct loader_file_contents *preread_contents;
+    struct loader_layer_list layers;
+    VkResult result;
+};
+
+struct loader_layer_manifest_jobs {
+    const struct loader_instance *inst;
+    struct loader_manifest_cache *manifest_cache;
+    bool is_implicit;
+    struct loader_layer_manifest_job *jobs;
+};
+
+static void loader_run_layer_manifest_job(void *user_data, uint32_t index) {
+    struct loader_layer_manifest_jobs *jobs = (struct loader_layer_manifest_jobs *)user_data;
+    struct loader_layer_manifest_job *job = &jobs->jobs[index];
+    job->result = loader_parse_layer_manifest(jobs->inst, jobs->manifest_cache, &job->layers, jobs->is_implicit, job->filename,
+                                              job->preread_contents);
+}
+
+// Parse every layer manifest in manifest_files and add the layers to instance_layers. The layers always end up in the order
+// of manifest_files, even when VK_LOADER_MANIFEST_THREADS lets the files be read and parsed on several threads, since each
+// file is parsed into a list of its own which is only merged into instance_layers once every file is done.
+// Only running out of memory is reported, a manifest with problems is skipped.
+//
+// preread_contents may be NULL, otherwise it holds the contents of each file in manifest_files which has already been read. An
+// entry whose data is NULL wasn't read, and that file is read as usual.
+static VkResult loader_parse_layer_manifests(const struct loader_instance *inst, struct loader_manifest_cache *manifest_cache,
+                                             struct loader_layer_list *instance_layers, bool is_implicit,
+                                             const struct loader_data_files *manifest_files,
+                                             const struct loader_file_contents *preread_contents) {
+    struct loader_layer_manifest_jobs jobs;
+    uint32_t thread_count = 1;
+    uint32_t job_count = 0;
+    VkResult res = VK_SUCCESS;
+
+    if (manifest_files->count > 1) {
+        thread_count = loader_get_worker_thread_count(inst, "VK_LOADER_MANIFEST_THREADS");
+    }
+    if (thread_count > 1) {
+        jobs.jobs = loader_instance_heap_calloc(inst, sizeof(struct loader_layer_manifest_job) * manifest_files->count,
+                                                VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (NULL == jobs.jobs) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+    } else {
+        // Parse the files one after the other straight into instance_layers
+        for (uint32_t i = 0; i < manifest_files->count; i++) {
+            if (NULL == manifest_files->filename_list[i]) {
+                continue;
+            }
+            // If the error is anything other than out of memory we still want to try to load the other layers
+            res = loader_parse_layer_manifest(inst, manifest_cache, instance_layers, is_implicit, manifest_files->filename_list[i],
+                                              loader_get_preread_contents(preread_contents, i));
+            if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
+                return res;
+            }
+        }
+        return VK_SUCCESS;
+    }
+
+    jobs.inst = inst;
+    jobs.manifest_cache = manifest_cache;
+    jobs.is_implicit = is_implicit;
+    for (uint32_t i = 0; i < manifest_files->count; i++) {
+        if (NULL != manifest_files->filename_list[i]) {
+            jobs.jobs[job_count].filename = manifest_files->filename_list[i];
+            jobs.jobs[job_count].preread_contents = loader_get_preread_contents(preread_contents, i);
+            job_count++;
+        }
+    }
+
+    loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_LAYER_BIT, 0,
+               "loader_parse_layer_manifests: Parsing %u layer manifest files on up to %u threads", job_count, thread_count);
+    loader_run_parallel(inst, thread_count, job_count, loader_run_layer_manifest_job, &jobs);
+
+    for (uint32_t i = 0; i < job_count; i++) {
+        struct loader_layer_manifest_job *job = &jobs.jobs[i];
+        for (uint32_t j = 0; j < job->layers.count; j++) {
+            struct loader_layer_properties *props = NULL;
+            if (VK_ERROR_OUT_OF_HOST_MEMORY != res) {
+                props = loader_get_next_layer_property_slot(inst, instance_layers);
+            }
+            if (NULL == props) {
+                // Whatever couldn't be moved over has to be freed here instead
+                loader_free_layer_properties(inst, &job->layers.list[j]);
+                res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                continue;
+            }
+            memcpy(props, &job->layers.list[j], sizeof(struct loader_layer_properties));
+        }
+        loader_instance_heap_free(inst, job->layers.list);
+        // Same as parsing the files one at a time, stop at the first file which ran out of memory
+        if (VK_ERROR_OUT_OF_HOST_MEMORY == job->result) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+    }
+    loader_instance_heap_free(inst, jobs.jobs);
+    return res;
 }
 
 static inline size_t determine_data_file_path_size(const char *cur_path, size_t relative_path_size) {
@@ -2902,6 +3216,9 @@ static VkResult read_data_files_in_search_paths(const struct loader_instance *in
     char *search_path = NULL;
     char *cur_path_ptr = NULL;
     bool use_first_found_manifest = false;
+    uint64_t watch_generation = 0;
+    bool found_in_watch = false;
+    char *watched_search_path = NULL;
 #ifndef _WIN32
     size_t rel_size = 0;  // unused in windows, dont declare so no compiler warnings are generated
     bool xdg_config_home_secenv_alloc = true;
@@ -2910,6 +3227,9 @@ static VkResult read_data_files_in_search_paths(const struct loader_instance *in
     bool xdg_data_dirs_secenv_alloc = true;
 #endif
 
+    static const char *const manifest_type_names[LOADER_DATA_FILE_NUM_TYPES] = {"drivers", "explicit layers", "implicit layers"};
+    loader_trace_begin("read_data_files_in_search_paths", manifest_type_names[manifest_type]);
+
 #if defined(_WIN32)
     char *package_path = NULL;
 #else
@@ -3203,8 +3523,38 @@ static VkResult read_data_files_in_search_paths(const struct loader_instance *in
         }
     }
 
-    // Now, parse the paths and add any manifest files found in them.
-    vk_result = add_data_files(inst, search_path, out_files, use_first_found_manifest);
+    // If the search paths are being watched and nothing in them changed since the last time they were searched, reuse the files
+    // which were found back then rather than reading the directories again.
+    if (loader_manifest_watch_poll(inst, &watch_generation)) {
+        vk_result =
+            loader_manifest_watch_find_files(inst, manifest_type, search_path, watch_generation, out_files, &found_in_watch);
+        if (VK_SUCCESS != vk_result) {
+            goto out;
+        }
+        if (!found_in_watch) {
+            // add_data_files splits up search_path in place
+            watched_search_path = loader_instance_heap_alloc(inst, search_path_size + 1, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+            if (NULL != watched_search_path) {
+                memcpy(watched_search_path, search_path, search_path_size + 1);
+                loader_manifest_watch_add_search_path(inst, watched_search_path);
+            }
+        }
+    }
+
+    if (found_in_watch) {
+        loader_log(inst, log_flags, 0, "   Nothing changed in these folders since they were last searched");
+    } else {
+        // Now, parse the paths and add any manifest files found in them.
+        vk_result = add_data_files(inst, search_path, out_files, use_first_found_manifest);
+
+        if (VK_SUCCESS == vk_result && NULL != watched_search_path) {
+            // Manifest files may be links to somewhere outside of the watched directories
+            for (uint32_t i = 0; i < out_files->count; ++i) {
+                loader_manifest_watch_add_path(inst, out_files->filename_list[i]);
+            }
+            loader_manifest_watch_store_files(manifest_type, watched_search_path, watch_generation, out_files);
+        }
+    }
 
     if (log_flags != 0 && out_files->count > 0) {
         loader_log(inst, log_flags, 0, "   Found the following files:");
@@ -3263,7 +3613,11 @@ out:
     if (NULL != search_path) {
         loader_instance_heap_free(inst, search_path);
     }
+    if (NULL != watched_search_path) {
+        loader_instance_heap_free(inst, watched_search_path);
+    }
 
+    loader_trace_end("read_data_files_in_search_paths");
     return vk_result;
 }
 
@@ -3364,6 +3718,236 @@ void loader_init_icd_lib_list() {}
 
 void loader_destroy_icd_lib_list() {}
 
+// The members of the "ICD" object in a driver manifest which the loader understands
+struct loader_icd_json {
+    struct loader_json_value library_path;
+    struct loader_json_value api_version;
+    struct loader_json_value is_portability_driver;
+    struct loader_json_value library_arch;
+};
+
+static const struct loader_json_member loader_icd_json_members[] = {
+    {"library_path", offsetof(struct loader_icd_json, library_path)},
+    {"api_version", offsetof(struct loader_icd_json, api_version)},
+    {"is_portability_driver", offsetof(struct loader_icd_json, is_portability_driver)},
+    {"library_arch", offsetof(struct loader_icd_json, library_arch)},
+};
+
+// The members at the top level of a driver manifest
+struct loader_icd_manifest_json {
+    struct loader_json_value file_format_version;
+    struct loader_json_value ICD;
+};
+
+static const struct loader_json_member loader_icd_manifest_json_members[] = {
+    {"file_format_version", offsetof(struct loader_icd_manifest_json, file_format_version)},
+    {"ICD", offsetof(struct loader_icd_manifest_json, ICD)},
+};
+
+// Read the driver manifest file file_str into icd_manifest.
+//
+// \returns
+// VK_SUCCESS if icd_manifest describes a driver to load,
+// VK_ERROR_INCOMPATIBLE_DRIVER if the manifest doesn't describe a usable driver but is otherwise not an error,
+// or the error encountered while reading the manifest.
+static VkResult loader_parse_icd_manifest(const struct loader_instance *inst, char *file_str,
+                                          struct loader_icd_manifest *icd_manifest) {
+    loader_api_version json_file_version = {0, 0, 0};
+    struct loader_file_contents contents;
+    struct loader_json_value json;
+    struct loader_icd_manifest_json manifest_json;
+    struct loader_icd_json icd_json;
+    char file_vers[64];
+    char version_str[64];
+    char library_arch[8];
+
+    memset(icd_manifest, 0, sizeof(struct loader_icd_manifest));
+
+    VkResult res = loader_read_json_file(inst, file_str, &contents, &json);
+    if (res != VK_SUCCESS) {
+        return res;
+    }
+
+    loader_json_find_members(&json, loader_icd_manifest_json_members,
+                             sizeof(loader_icd_manifest_json_members) / sizeof(loader_icd_manifest_json_members[0]),
+                             &manifest_json);
+    if (manifest_json.file_format_version.type == LOADER_JSON_TYPE_NONE) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "loader_icd_scan: ICD JSON %s does not have a \'file_format_version\' field. Skipping ICD JSON.", file_str);
+        res = VK_ERROR_INITIALIZATION_FAILED;
+        goto out;
+    }
+
+    loader_json_copy_string(&manifest_json.file_format_version, file_vers, sizeof(file_vers));
+    loader_log(inst, VULKAN_LOADER_DRIVER_BIT, 0, "Found ICD manifest file %s, version %s", file_str, file_vers);
+
+    // Get the version of the driver manifest
+    json_file_version = loader_make_version(loader_parse_version_string(file_vers));
+
+    // Loader only knows versions 1.0.0 and 1.0.1, anything above it is unknown
+    if (loader_check_version_meets_required(loader_combine_version(1, 0, 2), json_file_version)) {
+        loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "loader_icd_scan: %s has unknown icd manifest file version %d.%d.%d. May cause errors.", file_str,
+                   json_file_version.major, json_file_version.minor, json_file_version.patch);
+    }
+
+    if (manifest_json.ICD.type == LOADER_JSON_TYPE_NONE) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "loader_icd_scan: Can not find \'ICD\' object in ICD JSON file %s.  Skipping ICD JSON", file_str);
+        res = VK_ERROR_INCOMPATIBLE_DRIVER;
+        goto out;
+    }
+
+    loader_json_find_members(&manifest_json.ICD, loader_icd_json_members,
+                             sizeof(loader_icd_json_members) / sizeof(loader_icd_json_members[0]), &icd_json);
+    if (icd_json.library_path.type == LOADER_JSON_TYPE_NONE) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "loader_icd_scan: Failed to find \'library_path\' object in ICD JSON file %s.  Skipping ICD JSON.", file_str);
+        res = VK_ERROR_INCOMPATIBLE_DRIVER;
+        goto out;
+    }
+    if (loader_json_string_length(&icd_json.library_path) == 0) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "loader_icd_scan: ICD JSON %s \'library_path\' field is empty.  Skipping ICD JSON.", file_str);
+        res = VK_ERROR_INCOMPATIBLE_DRIVER;
+        goto out;
+    }
+    loader_json_copy_string(&icd_json.library_path, icd_manifest->library_path, sizeof(icd_manifest->library_path));
+
+    if (icd_json.api_version.type != LOADER_JSON_TYPE_NONE) {
+        loader_json_copy_string(&icd_json.api_version, version_str, sizeof(version_str));
+        icd_manifest->api_version = loader_parse_version_string(version_str);
+    } else {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "loader_icd_scan: ICD JSON %s does not have an \'api_version\' field.", file_str);
+    }
+
+    icd_manifest->is_portability_driver = icd_json.is_portability_driver.type == LOADER_JSON_TYPE_TRUE;
+
+    if (icd_json.library_arch.type == LOADER_JSON_TYPE_STRING) {
+        loader_json_copy_string(&icd_json.library_arch, library_arch, sizeof(library_arch));
+        if (strcmp(library_arch, "32") == 0) {
+            icd_manifest->library_arch = 32;
+        } else if (strcmp(library_arch, "64") == 0) {
+            icd_manifest->library_arch = 64;
+        }
+    }
+
+out:
+    loader_release_file(inst, &contents);
+    return res;
+}
+
+// Get the contents of the driver manifest file_str, out of the manifest cache if it holds an up to date copy
+static VkResult loader_get_icd_manifest(const struct loader_instance *inst, struct loader_manifest_cache *manifest_cache,
+                                        char *file_str, struct loader_icd_manifest *icd_manifest) {
+    struct loader_manifest_cache_key cache_key;
+    bool use_cache =
+        NULL != manifest_cache && loader_manifest_cache_get_key(file_str, LOADER_MANIFEST_CACHE_KIND_DRIVER, &cache_key);
+    VkResult res = VK_SUCCESS;
+    if (use_cache && loader_manifest_cache_find_driver(manifest_cache, &cache_key, icd_manifest)) {
+        loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_DRIVER_BIT, 0, "Using cached contents of ICD manifest file %s",
+                   file_str);
+    } else {
+        res = loader_parse_icd_manifest(inst, file_str, icd_manifest);
+        if (use_cache && VK_SUCCESS == res) {
+            res = loader_manifest_cache_store_driver(inst, manifest_cache, &cache_key, icd_manifest);
+        }
+    }
+    return res;
+}
+
+// Resolve the library named in the driver manifest file_str to the path it gets loaded from
+static void loader_get_icd_library_path(const char *file_str, const struct loader_icd_manifest *icd_manifest, char *fullpath,
+                                        size_t fullpath_size) {
+    if (loader_platform_is_path(icd_manifest->library_path)) {
+        // a relative or absolute path
+        char *name_copy = loader_stack_alloc(strlen(file_str) + 1);
+        char *rel_base;
+        strcpy(name_copy, file_str);
+        rel_base = loader_platform_dirname(name_copy);
+        loader_expand_path(icd_manifest->library_path, rel_base, fullpath_size, fullpath);
+    } else {
+// a filename which is assumed in a system directory
+#if defined(DEFAULT_VK_DRIVERS_PATH)
+        loader_get_fullpath(icd_manifest->library_path, DEFAULT_VK_DRIVERS_PATH, fullpath_size, fullpath);
+#else
+        loader_get_fullpath(icd_manifest->library_path, "", fullpath_size, fullpath);
+#endif
+    }
+}
+
+enum loader_icd_skip_reason {
+    LOADER_ICD_SKIP_NONE = 0,
+    LOADER_ICD_SKIP_API_VERSION_VARIANT,
+    LOADER_ICD_SKIP_PORTABILITY_DRIVER,
+    LOADER_ICD_SKIP_WRONG_ARCHITECTURE,
+};
+
+// Why a successfully parsed driver manifest shouldn't have its library loaded, if there is any reason not to
+static enum loader_icd_skip_reason loader_get_icd_skip_reason(const struct loader_instance *inst,
+                                                              const struct loader_icd_manifest *icd_manifest) {
+    if (VK_API_VERSION_VARIANT(icd_manifest->api_version) != 0) {
+        return LOADER_ICD_SKIP_API_VERSION_VARIANT;
+    }
+    // Skip over ICD's which contain a true "is_portability_driver" value whenever the application doesn't enable
+    // portability enumeration.
+    if (icd_manifest->is_portability_driver && inst && !inst->portability_enumeration_enabled) {
+        return LOADER_ICD_SKIP_PORTABILITY_DRIVER;
+    }
+    if ((icd_manifest->library_arch == 32 && sizeof(void *) != 4) || (icd_manifest->library_arch == 64 && sizeof(void *) != 8)) {
+        return LOADER_ICD_SKIP_WRONG_ARCHITECTURE;
+    }
+    return LOADER_ICD_SKIP_NONE;
+}
+
+// A single driver manifest when the manifests are parsed, or the driver libraries opened, on several threads
+struct loader_icd_job {
+    struct loader_icd_manifest icd_manifest;
+    VkResult result;
+
+    // Only filled in when the driver library was opened ahead of time
+    bool library_opened;
+    char fullpath[MAX_STRING_SIZE];
+    struct loader_scanned_icd scanned_icd;
+    enum loader_layer_library_status lib_status;
+    VkResult open_result;
+};
+
+struct loader_icd_jobs {
+    const struct loader_instance *inst;
+    struct loader_manifest_cache *manifest_cache;
+    const struct loader_data_files *manifest_files;
+    struct loader_icd_job *jobs;
+};
+
+static void loader_run_icd_manifest_job(void *user_data, uint32_t index) {
+    struct loader_icd_jobs *jobs = (struct loader_icd_jobs *)user_data;
+    struct loader_icd_job *job = &jobs->jobs[index];
+    char *file_str = jobs->manifest_files->filename_list[index];
+    if (NULL != file_str) {
+        job->result = loader_get_icd_manifest(jobs->inst, jobs->manifest_cache, file_str, &job->icd_manifest);
+    }
+}
+
+static void loader_run_icd_library_job(void *user_data, uint32_t index) {
+    struct loader_icd_jobs *jobs = (struct loader_icd_jobs *)user_data;
+    struct loader_icd_job *job = &jobs->jobs[index];
+    char *file_str = jobs->manifest_files->filename_list[index];
+    if (NULL == file_str || VK_SUCCESS != job->result ||
+        LOADER_ICD_SKIP_NONE != loader_get_icd_skip_reason(jobs->inst, &job->icd_manifest)) {
+        return;
+    }
+    loader_get_icd_library_path(file_str, &job->icd_manifest, job->fullpath, sizeof(job->fullpath));
+    job->lib_status = LOADER_LAYER_LIB_NOT_LOADED;
+    // The worker threads' half of loader_scanned_icd_add
+    loader_trace_begin("loader_scanned_icd_open", job->fullpath);
+    job->open_result =
+        loader_scanned_icd_open(jobs->inst, job->fullpath, job->icd_manifest.api_version, &job->scanned_icd, &job->lib_status);
+    loader_trace_end("loader_scanned_icd_open");
+    job->library_opened = true;
+}
+
 // Try to find the Vulkan ICD driver(s).
 //
 // This function scans the default system loader path(s) or path specified by either the
@@ -3381,11 +3965,11 @@ void loader_destroy_icd_lib_list() {}
 VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list,
                          bool *skipped_portability_drivers) {
     char *file_str;
-    loader_api_version json_file_version = {0, 0, 0};
     struct loader_data_files manifest_files;
+    struct loader_manifest_cache *manifest_cache = NULL;
+    struct loader_icd_job *icd_jobs = NULL;
     VkResult res = VK_SUCCESS;
     bool lockedMutex = false;
-    cJSON *json = NULL;
     uint32_t num_good_icds = 0;
 
     memset(&manifest_files, 0, sizeof(struct loader_data_files));
@@ -3401,246 +3985,154 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
     }
     loader_platform_thread_lock_mutex(&loader_json_lock);
     lockedMutex = true;
+    manifest_cache = loader_manifest_cache_acquire(inst);
+
+    // With VK_LOADER_MANIFEST_THREADS set, read and parse every manifest up front on a pool of threads, and with
+    // VK_LOADER_DRIVER_THREADS set, open the driver libraries and negotiate with them up front in the same way. The drivers are
+    // still added one after the other below, in the same order as when nothing is done in parallel.
+    uint32_t manifest_thread_count = 1;
+    uint32_t driver_thread_count = 1;
+    if (manifest_files.count > 1) {
+        manifest_thread_count = loader_get_worker_thread_count(inst, "VK_LOADER_MANIFEST_THREADS");
+#if !defined(_WIN32)
+        // Windows runs every DllMain under the OS loader lock, so loading drivers on several threads gains nothing there
+        driver_thread_count = loader_get_worker_thread_count(inst, "VK_LOADER_DRIVER_THREADS");
+#endif
+    }
+    if (manifest_thread_count > 1 || driver_thread_count > 1) {
+        icd_jobs = loader_instance_heap_calloc(inst, sizeof(struct loader_icd_job) * manifest_files.count,
+                                               VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (NULL == icd_jobs) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+            goto out;
+        }
+        struct loader_icd_jobs jobs = {inst, manifest_cache, &manifest_files, icd_jobs};
+        if (manifest_thread_count > 1) {
+            loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                       "loader_icd_scan: Parsing %u ICD manifest files on up to %u threads", manifest_files.count,
+                       manifest_thread_count);
+        }
+        loader_run_parallel(inst, manifest_thread_count, manifest_files.count, loader_run_icd_manifest_job, &jobs);
+        if (driver_thread_count > 1) {
+            loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                       "loader_icd_scan: Loading ICD libraries on up to %u threads", driver_thread_count);
+            loader_run_parallel(inst, driver_thread_count, manifest_files.count, loader_run_icd_library_job, &jobs);
+        }
+    }
+
     for (uint32_t i = 0; i < manifest_files.count; i++) {
         file_str = manifest_files.filename_list[i];
         if (file_str == NULL) {
             continue;
         }
 
-        VkResult temp_res = loader_get_json(inst, file_str, &json);
-        if (NULL == json || temp_res != VK_SUCCESS) {
-            if (NULL != json) {
-                cJSON_Delete(json);
-                json = NULL;
-            }
-            // If we haven't already found an ICD, copy this result to
-            // the returned result.
-            if (num_good_icds == 0) {
-                res = temp_res;
-            }
-            if (temp_res == VK_ERROR_OUT_OF_HOST_MEMORY) {
-                res = VK_ERROR_OUT_OF_HOST_MEMORY;
-                break;
-            } else {
-                continue;
-            }
+        struct loader_icd_manifest icd_manifest;
+        VkResult parse_res = VK_SUCCESS;
+        if (NULL != icd_jobs) {
+            icd_manifest = icd_jobs[i].icd_manifest;
+            parse_res = icd_jobs[i].result;
+        } else {
+            parse_res = loader_get_icd_manifest(inst, manifest_cache, file_str, &icd_manifest);
         }
-        res = temp_res;
-
-        cJSON *item, *itemICD;
-        item = cJSON_GetObjectItem(json, "file_format_version");
-        if (item == NULL) {
-            if (num_good_icds == 0) {
-                res = VK_ERROR_INITIALIZATION_FAILED;
-            }
-            loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                       "loader_icd_scan: ICD JSON %s does not have a \'file_format_version\' field. Skipping ICD JSON.", file_str);
-            cJSON_Delete(json);
-            json = NULL;
+        if (VK_ERROR_OUT_OF_HOST_MEMORY == parse_res) {
+            res = parse_res;
+            goto out;
+        } else if (VK_ERROR_INCOMPATIBLE_DRIVER == parse_res) {
+            res = VK_SUCCESS;
             continue;
-        }
-
-        char *file_vers = cJSON_Print(item);
-        if (NULL == file_vers) {
-            // Only reason the print can fail is if there was an allocation issue
+        } else if (VK_SUCCESS != parse_res) {
+            // If we haven't already found an ICD, copy this result to
+            // the returned result.
             if (num_good_icds == 0) {
-                res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                res = parse_res;
             }
-            loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                       "loader_icd_scan: Failed retrieving ICD JSON %s \'file_format_version\' field.  Skipping ICD JSON",
-                       file_str);
-            cJSON_Delete(json);
-            json = NULL;
             continue;
         }
-        loader_log(inst, VULKAN_LOADER_DRIVER_BIT, 0, "Found ICD manifest file %s, version %s", file_str, file_vers);
+        res = VK_SUCCESS;
 
-        // Get the version of the driver manifest
-        json_file_version = loader_make_version(loader_parse_version_string(file_vers));
+        char fullpath[MAX_STRING_SIZE];
+        // Print out the paths being searched if debugging is enabled
+        loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "Searching for ICD drivers named %s", icd_manifest.library_path);
+        loader_get_icd_library_path(file_str, &icd_manifest, fullpath, sizeof(fullpath));
 
-        // Loader only knows versions 1.0.0 and 1.0.1, anything above it is unknown
-        if (loader_check_version_meets_required(loader_combine_version(1, 0, 2), json_file_version)) {
-            loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                       "loader_icd_scan: %s has unknown icd manifest file version %d.%d.%d. May cause errors.", file_str,
-                       json_file_version.major, json_file_version.minor, json_file_version.patch);
+        switch (loader_get_icd_skip_reason(inst, &icd_manifest)) {
+            case LOADER_ICD_SKIP_NONE:
+                break;
+            case LOADER_ICD_SKIP_API_VERSION_VARIANT:
+                loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                           "loader_icd_scan: Driver's ICD JSON %s \'api_version\' field contains a non-zero variant value of %d. "
+                           " Skipping ICD JSON.",
+                           file_str, VK_API_VERSION_VARIANT(icd_manifest.api_version));
+                continue;
+            case LOADER_ICD_SKIP_PORTABILITY_DRIVER:
+                if (skipped_portability_drivers) *skipped_portability_drivers = true;
+                continue;
+            case LOADER_ICD_SKIP_WRONG_ARCHITECTURE:
+                loader_log(inst, VULKAN_LOADER_INFO_BIT, 0,
+                           "loader_icd_scan: Driver library architecture doesn't match the current running "
+                           "architecture, skipping this driver");
+                continue;
         }
-        loader_instance_heap_free(inst, file_vers);
 
-        itemICD = cJSON_GetObjectItem(json, "ICD");
-        if (itemICD != NULL) {
-            item = cJSON_GetObjectItem(itemICD, "library_path");
-            if (item != NULL) {
-                char *temp = cJSON_Print(item);
-                if (!temp || strlen(temp) == 0) {
-                    if (num_good_icds == 0) {
-                        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    }
-                    loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                               "loader_icd_scan: Failed retrieving ICD JSON %s \'library_path\' field.  Skipping ICD JSON.",
-                               file_str);
-                    loader_instance_heap_free(inst, temp);
-                    cJSON_Delete(json);
-                    json = NULL;
-                    continue;
+        VkResult icd_add_res = VK_SUCCESS;
+        enum loader_layer_library_status lib_status;
+        if (NULL != icd_jobs && icd_jobs[i].library_opened) {
+            // Already opened on one of the worker threads, all that is left is adding it to the list
+            lib_status = icd_jobs[i].lib_status;
+            icd_add_res = icd_jobs[i].open_result;
+            if (VK_SUCCESS == icd_add_res && NULL != icd_jobs[i].scanned_icd.handle) {
+                icd_add_res = loader_scanned_icd_commit(inst, icd_tramp_list, fullpath, &icd_jobs[i].scanned_icd);
+                if (VK_SUCCESS != icd_add_res) {
+                    loader_platform_close_library(icd_jobs[i].scanned_icd.handle);
+                    loader_stats_add(inst, VK_LOADER_STATISTIC_LIBRARIES_CLOSED, 1);
                 }
-                // strip out extra quotes
-                temp[strlen(temp) - 1] = '\0';
-                char *library_path = loader_stack_alloc(strlen(temp) + 1);
-                if (NULL == library_path) {
-                    loader_log(
-                        inst, VULKAN_LOADER_ERROR_BIT, 0,
-                        "loader_icd_scan: Failed to allocate space for ICD JSON %s \'library_path\' value.  Skipping ICD JSON.",
-                        file_str);
-                    res = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    loader_instance_heap_free(inst, temp);
-                    cJSON_Delete(json);
-                    json = NULL;
-                    goto out;
-                }
-                strcpy(library_path, &temp[1]);
-                loader_instance_heap_free(inst, temp);
-                if (strlen(library_path) == 0) {
-                    loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                               "loader_icd_scan: ICD JSON %s \'library_path\' field is empty.  Skipping ICD JSON.", file_str);
-                    cJSON_Delete(json);
-                    json = NULL;
-                    continue;
-                }
-                char fullpath[MAX_STRING_SIZE];
-                // Print out the paths being searched if debugging is enabled
-                loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "Searching for ICD drivers named %s", library_path);
-                if (loader_platform_is_path(library_path)) {
-                    // a relative or absolute path
-                    char *name_copy = loader_stack_alloc(strlen(file_str) + 1);
-                    char *rel_base;
-                    strcpy(name_copy, file_str);
-                    rel_base = loader_platform_dirname(name_copy);
-                    loader_expand_path(library_path, rel_base, sizeof(fullpath), fullpath);
-                } else {
-// a filename which is assumed in a system directory
-#if defined(DEFAULT_VK_DRIVERS_PATH)
-                    loader_get_fullpath(library_path, DEFAULT_VK_DRIVERS_PATH, sizeof(fullpath), fullpath);
-#else
-                    loader_get_fullpath(library_path, "", sizeof(fullpath), fullpath);
-#endif
+                // The handle now belongs to icd_tramp_list, or has been closed
+                icd_jobs[i].scanned_icd.handle = NULL;
+            }
+        } else {
+            icd_add_res = loader_scanned_icd_add(inst, icd_tramp_list, fullpath, icd_manifest.api_version, &lib_status);
+        }
+        if (VK_ERROR_OUT_OF_HOST_MEMORY == icd_add_res) {
+            res = icd_add_res;
+            goto out;
+        } else if (VK_SUCCESS != icd_add_res) {
+            switch (lib_status) {
+                case LOADER_LAYER_LIB_NOT_LOADED:
+                case LOADER_LAYER_LIB_ERROR_FAILED_TO_LOAD:
+                    loader_log(inst, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                               "loader_icd_scan: Failed loading library associated with ICD JSON %s.Ignoring this JSON", fullpath);
+                    break;
+                case LOADER_LAYER_LIB_ERROR_WRONG_BIT_TYPE: {
+                    loader_log(inst, VULKAN_LOADER_DRIVER_BIT, 0, "Requested layer %s was wrong bit-type. Ignoring this JSON",
+                               fullpath);
+                    break;
                 }
-
-                uint32_t vers = 0;
-                item = cJSON_GetObjectItem(itemICD, "api_version");
-                if (item != NULL) {
-                    temp = cJSON_Print(item);
-                    if (NULL == temp) {
-                        loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                                   "loader_icd_scan: Failed retrieving ICD JSON %s \'api_version\' field.  Skipping ICD JSON.",
-                                   file_str);
-
-                        // Only reason the print can fail is if there was an
-                        // allocation issue
-                        if (num_good_icds == 0) {
-                            res = VK_ERROR_OUT_OF_HOST_MEMORY;
-                        }
-
-                        loader_instance_heap_free(inst, temp);
-                        cJSON_Delete(json);
-                        json = NULL;
-                        continue;
-                    }
-                    vers = loader_parse_version_string(temp);
-                    loader_instance_heap_free(inst, temp);
-                } else {
+                case LOADER_LAYER_LIB_SUCCESS_LOADED:
+                    // Shouldn't be able to reach this but if it is, best to report a debug
                     loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                               "loader_icd_scan: ICD JSON %s does not have an \'api_version\' field.", file_str);
-                }
-                if (VK_API_VERSION_VARIANT(vers) != 0) {
-                    loader_log(
-                        inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                        "loader_icd_scan: Driver's ICD JSON %s \'api_version\' field contains a non-zero variant value of %d. "
-                        " Skipping ICD JSON.",
-                        file_str, VK_API_VERSION_VARIANT(vers));
-                    cJSON_Delete(json);
-                    json = NULL;
-                    continue;
-                }
-                // Skip over ICD's which contain a true "is_portability_driver" value whenever the application doesn't enable
-                // portability enumeration.
-                item = cJSON_GetObjectItem(itemICD, "is_portability_driver");
-                if (item != NULL && item->type == cJSON_True && inst && !inst->portability_enumeration_enabled) {
-                    if (skipped_portability_drivers) *skipped_portability_drivers = true;
-                    cJSON_Delete(json);
-                    json = NULL;
-                    continue;
-                }
-
-                item = cJSON_GetObjectItem(itemICD, "library_arch");
-                if (item != NULL) {
-                    temp = cJSON_Print(item);
-                    if (NULL != temp) {
-                        // cJSON includes the quotes by default, so we need to look for those here
-                        if ((strncmp(temp, "\"32\"", 4) == 0 && sizeof(void *) != 4) ||
-                            (strncmp(temp, "\"64\"", 4) == 0 && sizeof(void *) != 8)) {
-                            loader_log(inst, VULKAN_LOADER_INFO_BIT, 0,
-                                       "loader_icd_scan: Driver library architecture doesn't match the current running "
-                                       "architecture, skipping this driver");
-                            loader_instance_heap_free(inst, temp);
-                            cJSON_Delete(json);
-                            json = NULL;
-                            continue;
-                        }
-                    }
-                    loader_instance_heap_free(inst, temp);
-                }
-
-                VkResult icd_add_res = VK_SUCCESS;
-                enum loader_layer_library_status lib_status;
-                icd_add_res = loader_scanned_icd_add(inst, icd_tramp_list, fullpath, vers, &lib_status);
-                if (VK_ERROR_OUT_OF_HOST_MEMORY == icd_add_res) {
-                    res = icd_add_res;
-                    goto out;
-                } else if (VK_SUCCESS != icd_add_res) {
-                    switch (lib_status) {
-                        case LOADER_LAYER_LIB_NOT_LOADED:
-                        case LOADER_LAYER_LIB_ERROR_FAILED_TO_LOAD:
-                            loader_log(inst, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                                       "loader_icd_scan: Failed loading library associated with ICD JSON %s.Ignoring this JSON",
-                                       fullpath);
-                            break;
-                        case LOADER_LAYER_LIB_ERROR_WRONG_BIT_TYPE: {
-                            loader_log(inst, VULKAN_LOADER_DRIVER_BIT, 0,
-                                       "Requested layer %s was wrong bit-type. Ignoring this JSON", fullpath);
-                            break;
-                        }
-                        case LOADER_LAYER_LIB_SUCCESS_LOADED:
-                            // Shouldn't be able to reach this but if it is, best to report a debug
-                            loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                                       "Shouldn't reach this. A valid version of requested ICD %s was loaded but something bad "
-                                       "happened afterwards.",
-                                       fullpath);
-                            break;
-                    }
-                    cJSON_Delete(json);
-                    json = NULL;
-                    continue;
-                }
-                num_good_icds++;
-            } else {
-                loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                           "loader_icd_scan: Failed to find \'library_path\' object in ICD JSON file %s.  Skipping ICD JSON.",
-                           file_str);
+                               "Shouldn't reach this. A valid version of requested ICD %s was loaded but something bad "
+                               "happened afterwards.",
+                               fullpath);
+                    break;
             }
-        } else {
-            loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                       "loader_icd_scan: Can not find \'ICD\' object in ICD JSON file %s.  Skipping ICD JSON", file_str);
+            continue;
         }
-
-        cJSON_Delete(json);
-        json = NULL;
+        num_good_icds++;
     }
 
 out:
 
-    if (NULL != json) {
-        cJSON_Delete(json);
+    if (NULL != icd_jobs) {
+        // Close any driver libraries which were opened ahead of time but never made it into icd_tramp_list
+        for (uint32_t i = 0; i < manifest_files.count; i++) {
+            if (NULL != icd_jobs[i].scanned_icd.handle) {
+                loader_platform_close_library(icd_jobs[i].scanned_icd.handle);
+                loader_stats_add(inst, VK_LOADER_STATISTIC_LIBRARIES_CLOSED, 1);
+            }
+        }
+        loader_instance_heap_free(inst, icd_jobs);
     }
+    loader_manifest_cache_release(inst, manifest_cache);
 
     if (NULL != manifest_files.filename_list) {
         for (uint32_t i = 0; i < manifest_files.count; i++) {
@@ -3658,9 +4150,8 @@ out:
 }
 
 void loader_scan_for_layers(struct loader_instance *inst, struct loader_layer_list *instance_layers) {
-    char *file_str;
     struct loader_data_files manifest_files;
-    cJSON *json;
+    struct loader_manifest_cache *manifest_cache = NULL;
     bool override_layer_valid = false;
     char *override_paths = NULL;
     uint32_t total_count = 0;
@@ -3671,6 +4162,7 @@ void loader_scan_for_layers(struct loader_instance *inst, struct loader_layer_li
     loader_delete_layer_list_and_properties(inst, instance_layers);
 
     loader_platform_thread_lock_mutex(&loader_json_lock);
+    manifest_cache = loader_manifest_cache_acquire(inst);
 
     // Get a list of manifest files for any implicit layers
     if (VK_SUCCESS != loader_get_data_files(inst, LOADER_DATA_FILE_MANIFEST_IMPLICIT_LAYER, NULL, &manifest_files)) {
@@ -3679,27 +4171,9 @@ void loader_scan_for_layers(struct loader_instance *inst, struct loader_layer_li
 
     if (manifest_files.count != 0) {
         total_count += manifest_files.count;
-        for (uint32_t i = 0; i < manifest_files.count; i++) {
-            file_str = manifest_files.filename_list[i];
-            if (file_str == NULL) {
-                continue;
-            }
-
-            // Parse file into JSON struct
-            VkResult res = loader_get_json(inst, file_str, &json);
-            if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
-                goto out;
-            } else if (VK_SUCCESS != res || NULL == json) {
-                continue;
-            }
-
-            VkResult local_res = loader_add_layer_properties(inst, instance_layers, json, true, file_str);
-            cJSON_Delete(json);
-
-            // If the error is anything other than out of memory we still want to try to load the other layers
-            if (VK_ERROR_OUT_OF_HOST_MEMORY == local_res) {
-                goto out;
-            }
+        if (VK_ERROR_OUT_OF_HOST_MEMORY ==
+            loader_parse_layer_manifests(inst, manifest_cache, instance_layers, true, &manifest_files, NULL)) {
+            goto out;
         }
     }
 
@@ -3740,204 +4214,519 @@ void loader_scan_for_layers(struct loader_instance *inst, struct loader_layer_li
     // Make sure we have at least one layer, if not, go ahead and return
     if (manifest_files.count == 0 && total_count == 0) {
         goto out;
-    } else {
+    } else if (VK_ERROR_OUT_OF_HOST_MEMORY ==
+               loader_parse_layer_manifests(inst, manifest_cache, instance_layers, false, &manifest_files, NULL)) {
+        goto out;
+    }
+
+    // Verify any meta-layers in the list are valid and all the component layers are
+    // actually present in the available layer list
+    verify_all_meta_layers(inst, instance_layers, &override_layer_valid);
+
+    if (override_layer_valid) {
+        loader_remove_layers_in_blacklist(inst, instance_layers);
+        if (NULL != inst) {
+            inst->override_layer_present = true;
+        }
+    }
+
+out:
+
+    if (NULL != override_paths) {
+        loader_instance_heap_free(inst, override_paths);
+    }
+    if (NULL != manifest_files.filename_list) {
         for (uint32_t i = 0; i < manifest_files.count; i++) {
-            file_str = manifest_files.filename_list[i];
-            if (file_str == NULL) {
-                continue;
+            if (NULL != manifest_files.filename_list[i]) {
+                loader_instance_heap_free(inst, manifest_files.filename_list[i]);
             }
+        }
+        loader_instance_heap_free(inst, manifest_files.filename_list);
+    }
+    loader_manifest_cache_release(inst, manifest_cache);
+    loader_platform_thread_unlock_mutex(&loader_json_lock);
+}
 
-            // Parse file into JSON struct
-            VkResult res = loader_get_json(inst, file_str, &json);
-            if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
-                goto out;
-            } else if (VK_SUCCESS != res || NULL == json) {
-                continue;
+// Scan the implicit layers described by implicit_files, see loader_scan_for_implicit_layers. preread_contents is as for
+// loader_parse_layer_manifests.
+static void loader_scan_implicit_layer_files(struct loader_instance *inst, struct loader_layer_list *instance_layers,
+                                             const struct loader_data_files *implicit_files,
+                                             const struct loader_file_contents *preread_contents) {
+    struct loader_data_files explicit_files;
+    struct loader_manifest_cache *manifest_cache = NULL;
+    bool override_layer_valid = false;
+    char *override_paths = NULL;
+    bool implicit_metalayer_present = false;
+
+    memset(&explicit_files, 0, sizeof(struct loader_data_files));
+
+    // Cleanup any previously scanned libraries
+    loader_delete_layer_list_and_properties(inst, instance_layers);
+
+    loader_platform_thread_lock_mutex(&loader_json_lock);
+    manifest_cache = loader_manifest_cache_acquire(inst);
+
+    VkResult res = loader_parse_layer_manifests(inst, manifest_cache, instance_layers, true, implicit_files, preread_contents);
+    if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
+        goto out;
+    }
+
+    // Remove any extraneous override layers.
+    remove_all_non_valid_override_layers(inst, instance_layers);
+
+    // Check to see if either the override layer is present, or another implicit meta-layer.
+    // Each of these may require explicit layers to be enabled at this time.
+    for (int32_t i = 0; i < (int32_t)instance_layers->count; i++) {
+        struct loader_layer_properties *prop = &instance_layers->list[i];
+        if (prop->is_override && loader_implicit_layer_is_enabled(inst, prop)) {
+            override_layer_valid = true;
+            if (prop->num_override_paths > 0) {
+                char *cur_write_ptr = NULL;
+                size_t override_path_size = 0;
+                for (uint32_t j = 0; j < prop->num_override_paths; j++) {
+                    override_path_size += determine_data_file_path_size(prop->override_paths[j], 0);
+                }
+                override_paths = loader_instance_heap_alloc(inst, override_path_size, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+                if (override_paths == NULL) {
+                    goto out;
+                }
+                cur_write_ptr = &override_paths[0];
+                for (uint32_t j = 0; j < prop->num_override_paths; j++) {
+                    copy_data_file_info(prop->override_paths[j], NULL, 0, &cur_write_ptr);
+                }
+                // Remove the last path separator
+                --cur_write_ptr;
+                assert(cur_write_ptr - override_paths < (ptrdiff_t)override_path_size);
+                *cur_write_ptr = '\0';
+                loader_log(NULL, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_LAYER_BIT, 0,
+                           "loader_scan_for_implicit_layers: Override layer has override paths set to %s", override_paths);
             }
+        } else if (!prop->is_override && prop->type_flags & VK_LAYER_TYPE_FLAG_META_LAYER) {
+            implicit_metalayer_present = true;
+        }
+    }
+
+    // If either the override layer or an implicit meta-layer are present, we need to add
+    // explicit layer info as well.  Not to worry, though, all explicit layers not included
+    // in the override layer will be removed below in loader_remove_layers_in_blacklist().
+    if (override_layer_valid || implicit_metalayer_present) {
+        if (VK_SUCCESS != loader_get_data_files(inst, LOADER_DATA_FILE_MANIFEST_EXPLICIT_LAYER, override_paths, &explicit_files)) {
+            goto out;
+        }
+
+        res = loader_parse_layer_manifests(inst, manifest_cache, instance_layers, false, &explicit_files, NULL);
+        if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
+            goto out;
+        }
+    }
+
+    // Verify any meta-layers in the list are valid and all the component layers are
+    // actually present in the available layer list
+    verify_all_meta_layers(inst, instance_layers, &override_layer_valid);
+
+    if (override_layer_valid || implicit_metalayer_present) {
+        loader_remove_layers_not_in_implicit_meta_layers(inst, instance_layers);
+        if (override_layer_valid && inst != NULL) {
+            inst->override_layer_present = true;
+        }
+    }
+
+out:
+
+    if (NULL != override_paths) {
+        loader_instance_heap_free(inst, override_paths);
+    }
+    for (uint32_t i = 0; i < explicit_files.count; i++) {
+        if (NULL != explicit_files.filename_list[i]) {
+            loader_instance_heap_free(inst, explicit_files.filename_list[i]);
+        }
+    }
+    if (NULL != explicit_files.filename_list) {
+        loader_instance_heap_free(inst, explicit_files.filename_list);
+    }
+
+    loader_manifest_cache_release(inst, manifest_cache);
+    loader_platform_thread_unlock_mutex(&loader_json_lock);
+}
+
+void loader_scan_for_implicit_layers(struct loader_instance *inst, struct loader_layer_list *instance_layers) {
+    struct loader_data_files manifest_files;
+
+    // Before we begin anything, init manifest_files to avoid a delete of garbage memory if
+    // a failure occurs before allocating the manifest filename_list.
+    memset(&manifest_files, 0, sizeof(struct loader_data_files));
+
+    VkResult res = loader_get_data_files(inst, LOADER_DATA_FILE_MANIFEST_IMPLICIT_LAYER, NULL, &manifest_files);
+    if (VK_SUCCESS == res && manifest_files.count > 0) {
+        loader_scan_implicit_layer_files(inst, instance_layers, &manifest_files, NULL);
+    }
+
+    for (uint32_t i = 0; i < manifest_files.count; i++) {
+        if (NULL != manifest_files.filename_list[i]) {
+            loader_instance_heap_free(inst, manifest_files.filename_list[i]);
+        }
+    }
+    if (NULL != manifest_files.filename_list) {
+        loader_instance_heap_free(inst, manifest_files.filename_list);
+    }
+}
+
+// Reuse the result of loader_scan_for_implicit_layers between the entrypoints which are called before an instance exists.
+//
+// Applications commonly call vkEnumerateInstanceExtensionProperties, vkEnumerateInstanceLayerProperties and
+// vkEnumerateInstanceVersion several times before creating an instance. Each of them needs the implicit layers, and each layer
+// which intercepts one of them needs its library opened. Rather than scanning, opening and closing everything on every call, the
+// scanned layer list and the opened libraries are kept until vkDestroyInstance or loader_release.
+//
+// An entry is tied to the contents of the implicit layer manifests it was built from, which are read and hashed on every
+// acquire unless the manifest watch shows that nothing changed. Adding, removing or editing a manifest, or replacing a library
+// which was opened through the entry, causes a rescan.
+// Results which depend on the explicit layers, because of an override layer or an implicit meta-layer, are never cached.
+static struct loader_implicit_layer_cache *implicit_layer_cache;
+
+static uint64_t loader_hash_manifest_contents(const char *data, size_t size) {
+    // 64 bit FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= (uint8_t)data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static void loader_free_implicit_layer_manifest_ids(uint32_t count, struct loader_implicit_layer_manifest_id *manifests) {
+    if (NULL == manifests) {
+        return;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        loader_instance_heap_free(NULL, manifests[i].path);
+    }
+    loader_instance_heap_free(NULL, manifests);
+}
+
+// Find every implicit layer manifest. Only the paths are filled in, see loader_hash_implicit_layer_manifests.
+static VkResult loader_get_implicit_layer_manifest_ids(uint32_t *count, struct loader_implicit_layer_manifest_id **manifests) {
+    struct loader_data_files manifest_files;
+    struct loader_implicit_layer_manifest_id *ids = NULL;
+
+    memset(&manifest_files, 0, sizeof(struct loader_data_files));
+    *count = 0;
+    *manifests = NULL;
+
+    VkResult res = loader_get_data_files(NULL, LOADER_DATA_FILE_MANIFEST_IMPLICIT_LAYER, NULL, &manifest_files);
+    if (VK_SUCCESS != res || manifest_files.count == 0) {
+        goto out;
+    }
+
+    ids = loader_instance_heap_calloc(NULL, sizeof(struct loader_implicit_layer_manifest_id) * manifest_files.count,
+                                      VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == ids) {
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    }
+
+    // Take ownership of the filenames
+    for (uint32_t i = 0; i < manifest_files.count; i++) {
+        ids[i].path = manifest_files.filename_list[i];
+        manifest_files.filename_list[i] = NULL;
+    }
+
+    *count = manifest_files.count;
+    *manifests = ids;
+
+out:
+    for (uint32_t i = 0; i < manifest_files.count; i++) {
+        loader_instance_heap_free(NULL, manifest_files.filename_list[i]);
+    }
+    loader_instance_heap_free(NULL, manifest_files.filename_list);
+    return res;
+}
+
+static void loader_release_implicit_layer_manifest_contents(uint32_t count, struct loader_file_contents *contents) {
+    if (NULL == contents) {
+        return;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        loader_release_file(NULL, &contents[i]);
+    }
+    loader_instance_heap_free(NULL, contents);
+}
+
+// Read every manifest and fill in the size and hash of its contents. complete is set to false if any of them couldn't be read,
+// in which case the scan shouldn't be cached. The contents are handed back in out_contents, so that a rescan can parse them
+// rather than reading the files again, and must be released with loader_release_implicit_layer_manifest_contents.
+static VkResult loader_hash_implicit_layer_manifests(uint32_t count, struct loader_implicit_layer_manifest_id *manifests,
+                                                     bool *complete, struct loader_file_contents **out_contents) {
+    *out_contents = NULL;
+    if (count == 0) {
+        return VK_SUCCESS;
+    }
+    struct loader_file_contents *contents =
+        loader_instance_heap_calloc(NULL, sizeof(struct loader_file_contents) * count, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == contents) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
 
-            VkResult local_res = loader_add_layer_properties(inst, instance_layers, json, false, file_str);
-            cJSON_Delete(json);
+    for (uint32_t i = 0; i < count; i++) {
+        if (NULL == manifests[i].path) {
+            *complete = false;
+            continue;
+        }
 
-            // If the error is anything other than out of memory we still want to try to load the other layers
-            if (VK_ERROR_OUT_OF_HOST_MEMORY == local_res) {
-                goto out;
+        VkResult res = loader_read_file(NULL, manifests[i].path, &contents[i]);
+        if (VK_SUCCESS != res) {
+            loader_release_file(NULL, &contents[i]);
+            if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
+                loader_release_implicit_layer_manifest_contents(count, contents);
+                return res;
             }
+            *complete = false;
+            continue;
         }
+        manifests[i].size = contents[i].size;
+        manifests[i].hash = loader_hash_manifest_contents(contents[i].data, contents[i].size);
     }
+    *out_contents = contents;
+    return VK_SUCCESS;
+}
 
-    // Verify any meta-layers in the list are valid and all the component layers are
-    // actually present in the available layer list
-    verify_all_meta_layers(inst, instance_layers, &override_layer_valid);
+// Identify the file a layer library is opened from. Returns false where that isn't possible, such as for libraries which are
+// found through the system search path rather than by path.
+static bool loader_get_implicit_layer_lib_id(const char *lib_name, struct loader_implicit_layer_lib *lib) {
+    struct loader_manifest_cache_key key;
+    if (!loader_manifest_cache_get_key(lib_name, LOADER_MANIFEST_CACHE_KIND_IMPLICIT_LAYER, &key)) {
+        return false;
+    }
+    lib->device = key.device;
+    lib->inode = key.inode;
+    lib->size = key.size;
+    lib->mtime_sec = key.mtime_sec;
+    lib->mtime_nsec = key.mtime_nsec;
+    return true;
+}
 
-    if (override_layer_valid) {
-        loader_remove_layers_in_blacklist(inst, instance_layers);
-        if (NULL != inst) {
-            inst->override_layer_present = true;
+// Must be called with loader_implicit_layer_cache_lock held. The contents of the manifests are only compared when
+// compare_contents is set, otherwise only their paths are.
+static bool loader_implicit_layer_cache_matches(const struct loader_implicit_layer_cache *cache, uint32_t manifest_count,
+                                                const struct loader_implicit_layer_manifest_id *manifests, bool compare_contents) {
+    if (cache->manifest_count != manifest_count) {
+        return false;
+    }
+    for (uint32_t i = 0; i < manifest_count; i++) {
+        if (strcmp(cache->manifests[i].path, manifests[i].path) != 0) {
+            return false;
+        }
+        if (compare_contents && (cache->manifests[i].size != manifests[i].size || cache->manifests[i].hash != manifests[i].hash)) {
+            return false;
         }
     }
-
-out:
-
-    if (NULL != override_paths) {
-        loader_instance_heap_free(inst, override_paths);
+    for (uint32_t i = 0; i < cache->layers.count; i++) {
+        const struct loader_implicit_layer_lib *lib = &cache->libs[i];
+        if (NULL == lib->handle) {
+            continue;
+        }
+        struct loader_implicit_layer_lib current;
+        memset(&current, 0, sizeof(current));
+        current.has_file_id = loader_get_implicit_layer_lib_id(cache->layers.list[i].lib_name, &current);
+        if (current.has_file_id != lib->has_file_id || current.device != lib->device || current.inode != lib->inode ||
+            current.size != lib->size || current.mtime_sec != lib->mtime_sec || current.mtime_nsec != lib->mtime_nsec) {
+            return false;
+        }
     }
-    if (NULL != manifest_files.filename_list) {
-        for (uint32_t i = 0; i < manifest_files.count; i++) {
-            if (NULL != manifest_files.filename_list[i]) {
-                loader_instance_heap_free(inst, manifest_files.filename_list[i]);
+    return true;
+}
+
+static void loader_destroy_implicit_layer_cache(struct loader_implicit_layer_cache *cache) {
+    if (NULL != cache->libs) {
+        for (uint32_t i = 0; i < cache->layers.count; i++) {
+            if (NULL != cache->libs[i].handle) {
+                loader_platform_close_library(cache->libs[i].handle);
+                loader_stats_add(NULL, VK_LOADER_STATISTIC_LIBRARIES_CLOSED, 1);
             }
         }
-        loader_instance_heap_free(inst, manifest_files.filename_list);
+        loader_instance_heap_free(NULL, cache->libs);
     }
-    loader_platform_thread_unlock_mutex(&loader_json_lock);
+    loader_delete_layer_list_and_properties(NULL, &cache->layers);
+    loader_free_implicit_layer_manifest_ids(cache->manifest_count, cache->manifests);
+    loader_instance_heap_free(NULL, cache);
 }
 
-void loader_scan_for_implicit_layers(struct loader_instance *inst, struct loader_layer_list *instance_layers) {
-    char *file_str;
-    struct loader_data_files manifest_files;
-    cJSON *json;
-    bool override_layer_valid = false;
-    char *override_paths = NULL;
-    bool implicit_metalayer_present = false;
-    bool have_json_lock = false;
+VkResult loader_acquire_implicit_layers(struct loader_implicit_layer_cache **out_cache) {
+    struct loader_implicit_layer_cache *cache = NULL;
+    struct loader_implicit_layer_cache *replaced = NULL;
+    struct loader_implicit_layer_manifest_id *manifests = NULL;
+    struct loader_file_contents *manifest_contents = NULL;
+    char **manifest_paths = NULL;
+    uint32_t manifest_count = 0;
+    bool cacheable = true;
+    uint64_t watch_generation = 0;
 
-    // Before we begin anything, init manifest_files to avoid a delete of garbage memory if
-    // a failure occurs before allocating the manifest filename_list.
-    memset(&manifest_files, 0, sizeof(struct loader_data_files));
+    *out_cache = NULL;
 
-    VkResult res = loader_get_data_files(inst, LOADER_DATA_FILE_MANIFEST_IMPLICIT_LAYER, NULL, &manifest_files);
-    if (VK_SUCCESS != res || manifest_files.count == 0) {
+    // Poll before looking at any files, so that a change made while they're being looked at shows up as a new generation
+    bool watching = loader_manifest_watch_poll(NULL, &watch_generation);
+
+    VkResult res = loader_get_implicit_layer_manifest_ids(&manifest_count, &manifests);
+    if (VK_SUCCESS != res) {
         goto out;
     }
 
-    // Cleanup any previously scanned libraries
-    loader_delete_layer_list_and_properties(inst, instance_layers);
-
-    loader_platform_thread_lock_mutex(&loader_json_lock);
-    have_json_lock = true;
-
-    for (uint32_t i = 0; i < manifest_files.count; i++) {
-        file_str = manifest_files.filename_list[i];
-        if (file_str == NULL) {
-            continue;
+    // Nothing needs to be read if none of the watched manifests changed since the cached scan was checked last
+    if (watching) {
+        loader_platform_thread_lock_mutex(&loader_implicit_layer_cache_lock);
+        if (NULL != implicit_layer_cache && implicit_layer_cache->watched &&
+            implicit_layer_cache->watch_generation == watch_generation &&
+            loader_implicit_layer_cache_matches(implicit_layer_cache, manifest_count, manifests, false)) {
+            implicit_layer_cache->ref_count++;
+            *out_cache = implicit_layer_cache;
         }
-
-        // parse file into JSON struct
-        res = loader_get_json(inst, file_str, &json);
-        if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
+        loader_platform_thread_unlock_mutex(&loader_implicit_layer_cache_lock);
+        if (NULL != *out_cache) {
             goto out;
-        } else if (VK_SUCCESS != res || NULL == json) {
-            continue;
         }
+    }
 
-        res = loader_add_layer_properties(inst, instance_layers, json, true, file_str);
-
-        loader_instance_heap_free(inst, file_str);
-        manifest_files.filename_list[i] = NULL;
-        cJSON_Delete(json);
+    res = loader_hash_implicit_layer_manifests(manifest_count, manifests, &cacheable, &manifest_contents);
+    if (VK_SUCCESS != res) {
+        goto out;
+    }
 
-        if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
+    if (cacheable) {
+        loader_platform_thread_lock_mutex(&loader_implicit_layer_cache_lock);
+        if (NULL != implicit_layer_cache &&
+            loader_implicit_layer_cache_matches(implicit_layer_cache, manifest_count, manifests, true)) {
+            implicit_layer_cache->ref_count++;
+            implicit_layer_cache->watched = watching;
+            implicit_layer_cache->watch_generation = watch_generation;
+            *out_cache = implicit_layer_cache;
+        }
+        loader_platform_thread_unlock_mutex(&loader_implicit_layer_cache_lock);
+        if (NULL != *out_cache) {
             goto out;
         }
     }
 
-    // Remove any extraneous override layers.
-    remove_all_non_valid_override_layers(inst, instance_layers);
-
-    // Check to see if either the override layer is present, or another implicit meta-layer.
-    // Each of these may require explicit layers to be enabled at this time.
-    for (int32_t i = 0; i < (int32_t)instance_layers->count; i++) {
-        struct loader_layer_properties *prop = &instance_layers->list[i];
-        if (prop->is_override && loader_implicit_layer_is_enabled(inst, prop)) {
-            override_layer_valid = true;
-            if (prop->num_override_paths > 0) {
-                char *cur_write_ptr = NULL;
-                size_t override_path_size = 0;
-                for (uint32_t j = 0; j < prop->num_override_paths; j++) {
-                    override_path_size += determine_data_file_path_size(prop->override_paths[j], 0);
-                }
-                override_paths = loader_instance_heap_alloc(inst, override_path_size, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
-                if (override_paths == NULL) {
-                    goto out;
-                }
-                cur_write_ptr = &override_paths[0];
-                for (uint32_t j = 0; j < prop->num_override_paths; j++) {
-                    copy_data_file_info(prop->override_paths[j], NULL, 0, &cur_write_ptr);
-                }
-                // Remove the last path separator
-                --cur_write_ptr;
-                assert(cur_write_ptr - override_paths < (ptrdiff_t)override_path_size);
-                *cur_write_ptr = '\0';
-                loader_log(NULL, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_LAYER_BIT, 0,
-                           "loader_scan_for_implicit_layers: Override layer has override paths set to %s", override_paths);
-            }
-        } else if (!prop->is_override && prop->type_flags & VK_LAYER_TYPE_FLAG_META_LAYER) {
-            implicit_metalayer_present = true;
+    cache = loader_instance_heap_calloc(NULL, sizeof(struct loader_implicit_layer_cache), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == cache) {
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    }
+    cache->ref_count = 1;
+    cache->watched = watching;
+    cache->watch_generation = watch_generation;
+    cache->manifest_count = manifest_count;
+    cache->manifests = manifests;
+    manifests = NULL;
+
+    // Parse the manifests out of the contents which were just hashed, rather than finding and reading them all over again
+    if (manifest_count > 0) {
+        manifest_paths = loader_instance_heap_calloc(NULL, sizeof(char *) * manifest_count, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (NULL == manifest_paths) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+            goto out;
+        }
+        for (uint32_t i = 0; i < manifest_count; i++) {
+            manifest_paths[i] = cache->manifests[i].path;
         }
+        struct loader_data_files implicit_files = {manifest_count, manifest_count, manifest_paths};
+        loader_scan_implicit_layer_files(NULL, &cache->layers, &implicit_files, manifest_contents);
     }
-
-    // If either the override layer or an implicit meta-layer are present, we need to add
-    // explicit layer info as well.  Not to worry, though, all explicit layers not included
-    // in the override layer will be removed below in loader_remove_layers_in_blacklist().
-    if (override_layer_valid || implicit_metalayer_present) {
-        if (VK_SUCCESS != loader_get_data_files(inst, LOADER_DATA_FILE_MANIFEST_EXPLICIT_LAYER, override_paths, &manifest_files)) {
+    if (cache->layers.count > 0) {
+        cache->libs = loader_instance_heap_calloc(NULL, sizeof(struct loader_implicit_layer_lib) * cache->layers.count,
+                                                  VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (NULL == cache->libs) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
             goto out;
         }
+    }
 
-        for (uint32_t i = 0; i < manifest_files.count; i++) {
-            file_str = manifest_files.filename_list[i];
-            if (file_str == NULL) {
-                continue;
-            }
-
-            // parse file into JSON struct
-            res = loader_get_json(inst, file_str, &json);
-            if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
-                goto out;
-            } else if (VK_SUCCESS != res || NULL == json) {
-                continue;
-            }
-
-            res = loader_add_layer_properties(inst, instance_layers, json, false, file_str);
-
-            loader_instance_heap_free(inst, file_str);
-            manifest_files.filename_list[i] = NULL;
-            cJSON_Delete(json);
-
-            if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
-                goto out;
-            }
+    for (uint32_t i = 0; i < cache->layers.count; i++) {
+        const struct loader_layer_properties *prop = &cache->layers.list[i];
+        if (prop->is_override || (prop->type_flags & (VK_LAYER_TYPE_FLAG_EXPLICIT_LAYER | VK_LAYER_TYPE_FLAG_META_LAYER)) != 0) {
+            cacheable = false;
         }
     }
 
-    // Verify any meta-layers in the list are valid and all the component layers are
-    // actually present in the available layer list
-    verify_all_meta_layers(inst, instance_layers, &override_layer_valid);
-
-    if (override_layer_valid || implicit_metalayer_present) {
-        loader_remove_layers_not_in_implicit_meta_layers(inst, instance_layers);
-        if (override_layer_valid && inst != NULL) {
-            inst->override_layer_present = true;
+    if (cacheable) {
+        loader_platform_thread_lock_mutex(&loader_implicit_layer_cache_lock);
+        replaced = implicit_layer_cache;
+        implicit_layer_cache = cache;
+        cache->ref_count++;
+        loader_platform_thread_unlock_mutex(&loader_implicit_layer_cache_lock);
+        if (NULL != replaced) {
+            loader_release_implicit_layers(replaced);
         }
     }
 
+    *out_cache = cache;
+    cache = NULL;
+
 out:
+    if (NULL != cache) {
+        loader_destroy_implicit_layer_cache(cache);
+    }
+    loader_instance_heap_free(NULL, manifest_paths);
+    loader_release_implicit_layer_manifest_contents(manifest_count, manifest_contents);
+    loader_free_implicit_layer_manifest_ids(manifest_count, manifests);
+    return res;
+}
 
-    if (NULL != override_paths) {
-        loader_instance_heap_free(inst, override_paths);
+void loader_release_implicit_layers(struct loader_implicit_layer_cache *cache) {
+    if (NULL == cache) {
+        return;
     }
-    for (uint32_t i = 0; i < manifest_files.count; i++) {
-        if (NULL != manifest_files.filename_list[i]) {
-            loader_instance_heap_free(inst, manifest_files.filename_list[i]);
-        }
+    loader_platform_thread_lock_mutex(&loader_implicit_layer_cache_lock);
+    bool destroy = --cache->ref_count == 0;
+    loader_platform_thread_unlock_mutex(&loader_implicit_layer_cache_lock);
+    if (destroy) {
+        loader_destroy_implicit_layer_cache(cache);
     }
-    if (NULL != manifest_files.filename_list) {
-        loader_instance_heap_free(inst, manifest_files.filename_list);
+}
+
+loader_platform_dl_handle loader_get_implicit_layer_library(struct loader_implicit_layer_cache *cache, uint32_t index) {
+    loader_platform_thread_lock_mutex(&loader_implicit_layer_cache_lock);
+    loader_platform_dl_handle handle = cache->libs[index].handle;
+    loader_platform_thread_unlock_mutex(&loader_implicit_layer_cache_lock);
+    if (NULL != handle) {
+        return handle;
+    }
+
+    // The library is opened without holding the lock. Its constructor may call back into the loader's pre-instance entrypoints,
+    // and the dynamic linker takes its own lock while opening it.
+    const char *lib_name = cache->layers.list[index].lib_name;
+    struct loader_implicit_layer_lib opened;
+    memset(&opened, 0, sizeof(opened));
+    opened.has_file_id = loader_get_implicit_layer_lib_id(lib_name, &opened);
+    opened.handle = loader_platform_open_library(lib_name);
+    if (NULL == opened.handle) {
+        return NULL;
     }
 
-    if (have_json_lock) {
-        loader_platform_thread_unlock_mutex(&loader_json_lock);
+    loader_platform_thread_lock_mutex(&loader_implicit_layer_cache_lock);
+    struct loader_implicit_layer_lib *lib = &cache->libs[index];
+    bool published = NULL == lib->handle;
+    if (published) {
+        *lib = opened;
     }
+    handle = lib->handle;
+    loader_platform_thread_unlock_mutex(&loader_implicit_layer_cache_lock);
+
+    if (published) {
+        // The cache is shared by every instance, so this only counts for the process
+        loader_stats_add(NULL, VK_LOADER_STATISTIC_LIBRARIES_OPENED, 1);
+    } else {
+        // Another thread opened the library first, drop the extra reference taken here
+        loader_platform_close_library(opened.handle);
+    }
+    return handle;
+}
+
+void loader_clear_implicit_layer_cache(void) {
+    loader_platform_thread_lock_mutex(&loader_implicit_layer_cache_lock);
+    struct loader_implicit_layer_cache *cache = implicit_layer_cache;
+    implicit_layer_cache = NULL;
+    loader_platform_thread_unlock_mutex(&loader_implicit_layer_cache_lock);
+    loader_release_implicit_layers(cache);
 }
 
 static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL loader_gpdpa_instance_internal(VkInstance inst, const char *pName) {
@@ -4076,34 +4865,107 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL loader_gpa_device_internal(VkDevice dev
     return icd_term->dispatch.GetDeviceProcAddr(device, pName);
 }
 
+void loader_add_instance(struct loader_instance *inst) {
+    loader_stats_lock_mutex(inst, &loader_lock);
+    inst->next = loader.instances;
+    loader.instances = inst;
+    loader_platform_thread_unlock_mutex(&loader_lock);
+}
+
+void loader_remove_instance(struct loader_instance *inst) {
+    loader_stats_lock_mutex(inst, &loader_lock);
+    for (struct loader_instance **cur = &loader.instances; NULL != *cur; cur = &(*cur)->next) {
+        if (*cur == inst) {
+            *cur = inst->next;
+            break;
+        }
+    }
+    loader_platform_thread_unlock_mutex(&loader_lock);
+}
+
+// Nothing is published when the current snapshot already holds the same, so that calls which don't change anything don't pile up
+// retired snapshots.
+VkResult loader_publish_instance_snapshot(struct loader_instance *inst) {
+    const struct loader_instance_snapshot *current = inst->snapshot;
+    uint32_t layer_count = inst->app_activated_layer_list.count;
+    uint32_t phys_dev_count = inst->phys_dev_count_tramp;
+
+    if (NULL != current && current->layer_count == layer_count && current->phys_dev_count == phys_dev_count) {
+        bool same = true;
+        for (uint32_t i = 0; same && i < phys_dev_count; i++) {
+            same = current->phys_devs[i].tramp == (VkPhysicalDevice)inst->phys_devs_tramp[i] &&
+                   current->phys_devs[i].phys_dev == inst->phys_devs_tramp[i]->phys_dev;
+        }
+        if (same) {
+            return VK_SUCCESS;
+        }
+    }
+
+    // The snapshot and both of its arrays are a single allocation
+    size_t size = sizeof(struct loader_instance_snapshot) + sizeof(VkLayerProperties) * layer_count +
+                  sizeof(struct loader_snapshot_phys_dev) * phys_dev_count;
+    struct loader_instance_snapshot *snapshot = loader_instance_heap_calloc(inst, size, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == snapshot) {
+        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_publish_instance_snapshot: Failed to allocate snapshot of size %zu",
+                   size);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    snapshot->layer_count = layer_count;
+    snapshot->layers = (VkLayerProperties *)(snapshot + 1);
+    for (uint32_t i = 0; i < layer_count; i++) {
+        snapshot->layers[i] = inst->app_activated_layer_list.list[i].info;
+    }
+    snapshot->phys_dev_count = phys_dev_count;
+    snapshot->phys_devs = (struct loader_snapshot_phys_dev *)(snapshot->layers + layer_count);
+    for (uint32_t i = 0; i < phys_dev_count; i++) {
+        snapshot->phys_devs[i].phys_dev = inst->phys_devs_tramp[i]->phys_dev;
+        snapshot->phys_devs[i].tramp = (VkPhysicalDevice)inst->phys_devs_tramp[i];
+    }
+
+    snapshot->retired_next = inst->snapshot;
+    loader_platform_atomic_store_ptr((void **)&inst->snapshot, snapshot);
+    return VK_SUCCESS;
+}
+
+const struct loader_instance_snapshot *loader_get_instance_snapshot(const struct loader_instance *inst) {
+    return (const struct loader_instance_snapshot *)loader_platform_atomic_load_ptr((void *const *)&inst->snapshot);
+}
+
+void loader_free_instance_snapshots(struct loader_instance *inst) {
+    struct loader_instance_snapshot *snapshot = inst->snapshot;
+    while (NULL != snapshot) {
+        struct loader_instance_snapshot *retired = snapshot->retired_next;
+        loader_instance_heap_free(inst, snapshot);
+        snapshot = retired;
+    }
+    inst->snapshot = NULL;
+}
+
 struct loader_instance *loader_get_instance(const VkInstance instance) {
-    // look up the loader_instance in our list by comparing dispatch tables, as
-    // there is no guarantee the instance is still a loader_instance* after any
-    // layers which wrap the instance object.
-    const VkLayerInstanceDispatchTable *disp;
+    // The dispatch table points back at the loader_instance it belongs to, which saves walking the list of instances to find
+    // the one using it. The table isn't there yet early on in vkCreateInstance, when the object itself is the loader_instance.
     struct loader_instance *ptr_instance = (struct loader_instance *)instance;
     if (VK_NULL_HANDLE == instance || LOADER_MAGIC_NUMBER != ptr_instance->magic) {
         return NULL;
-    } else {
-        disp = loader_get_instance_layer_dispatch(instance);
-        for (struct loader_instance *inst = loader.instances; inst; inst = inst->next) {
-            if (&inst->disp->layer_inst_disp == disp) {
-                ptr_instance = inst;
-                break;
-            }
-        }
+    }
+    const struct loader_instance_dispatch_table *disp = loader_get_instance_dispatch(instance);
+    if (NULL != disp) {
+        ptr_instance = disp->instance;
     }
     return ptr_instance;
 }
 
 static loader_platform_dl_handle loader_open_layer_file(const struct loader_instance *inst, const char *chain_type,
                                                         struct loader_layer_properties *prop) {
+    loader_trace_begin("loader_open_layer_file", prop->info.layerName);
     if ((prop->lib_handle = loader_platform_open_library(prop->lib_name)) == NULL) {
         loader_handle_load_library_error(inst, prop->lib_name, &prop->lib_status);
     } else {
         prop->lib_status = LOADER_LAYER_LIB_SUCCESS_LOADED;
+        loader_stats_add(inst, VK_LOADER_STATISTIC_LIBRARIES_OPENED, 1);
         loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_LAYER_BIT, 0, "Loading layer library %s", prop->lib_name);
     }
+    loader_trace_end("loader_open_layer_file");
 
     return prop->lib_handle;
 }
@@ -4111,6 +4973,7 @@ static loader_platform_dl_handle loader_open_layer_file(const struct loader_inst
 static void loader_close_layer_file(const struct loader_instance *inst, struct loader_layer_properties *prop) {
     if (prop->lib_handle) {
         loader_platform_close_library(prop->lib_handle);
+        loader_stats_add(inst, VK_LOADER_STATISTIC_LIBRARIES_CLOSED, 1);
         loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_LAYER_BIT, 0, "Unloading layer library %s", prop->lib_name);
         prop->lib_handle = NULL;
     }
@@ -4265,6 +5128,8 @@ VKAPI_ATTR VkResult VKAPI_CALL loader_layer_create_device(VkInstance instance, V
     VkPhysicalDevice internal_device = VK_NULL_HANDLE;
     struct loader_device *dev = NULL;
     struct loader_instance *inst = NULL;
+    struct loader_creation_feedback creation_feedback;
+    VkDeviceCreateInfo device_create_info = *pCreateInfo;
 
     if (instance != VK_NULL_HANDLE) {
         inst = loader_get_instance(instance);
@@ -4275,6 +5140,8 @@ VKAPI_ATTR VkResult VKAPI_CALL loader_layer_create_device(VkInstance instance, V
         inst = (struct loader_instance *)phys_dev->this_instance;
     }
 
+    device_create_info.pNext = loader_creation_feedback_begin(inst, &creation_feedback, pCreateInfo->pNext);
+
     // Get the physical device (ICD) extensions
     struct loader_extension_list icd_exts;
     icd_exts.list = NULL;
@@ -4298,7 +5165,7 @@ VKAPI_ATTR VkResult VKAPI_CALL loader_layer_create_device(VkInstance instance, V
     }
 
     // Make sure requested extensions to be enabled are supported
-    res = loader_validate_device_extensions(inst, &inst->expanded_activated_layer_list, &icd_exts, pCreateInfo);
+    res = loader_validate_device_extensions(inst, &inst->expanded_activated_layer_list, &icd_exts, &device_create_info);
     if (res != VK_SUCCESS) {
         loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "vkCreateDevice: Failed to validate extensions in list");
         goto out;
@@ -4352,7 +5219,10 @@ VKAPI_ATTR VkResult VKAPI_CALL loader_layer_create_device(VkInstance instance, V
         dev->expanded_activated_layer_list.list = NULL;
     }
 
-    res = loader_create_device_chain(internal_device, pCreateInfo, pAllocator, inst, dev, layerGIPA, nextGDPA);
+    loader_creation_feedback_discovery(&creation_feedback);
+    dev->creation_feedback = &creation_feedback;
+    res = loader_create_device_chain(internal_device, &device_create_info, pAllocator, inst, dev, layerGIPA, nextGDPA);
+    dev->creation_feedback = NULL;
     if (res != VK_SUCCESS) {
         loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "vkCreateDevice:  Failed to create device chain.");
         goto out;
@@ -4377,6 +5247,7 @@ out:
             // Need to iterate the linked lists and remove the device from it. Don't delete
             // the device here since it may not have been added to the icd_term and there
             // are other allocations attached to it.
+            loader_stats_lock_mutex(inst, &inst->device_list_lock);
             struct loader_icd_term *icd_term = inst->icd_terms;
             bool found = false;
             while (!found && NULL != icd_term) {
@@ -4398,6 +5269,7 @@ out:
                 }
                 icd_term = icd_term->next;
             }
+            loader_platform_thread_unlock_mutex(&inst->device_list_lock);
             // Now destroy the device and the allocations associated with it.
             loader_destroy_logical_device(inst, dev, pAllocator);
         }
@@ -4406,6 +5278,7 @@ out:
     if (NULL != icd_exts.list) {
         loader_destroy_generic_list(inst, (struct loader_generic_list *)&icd_exts);
     }
+    loader_creation_feedback_end(&creation_feedback);
     return res;
 }
 
@@ -4418,7 +5291,7 @@ VKAPI_ATTR void VKAPI_CALL loader_layer_destroy_device(VkDevice device, const Vk
     }
 
     struct loader_icd_term *icd_term = loader_get_icd_and_device(device, &dev, NULL);
-    const struct loader_instance *inst = icd_term->this_instance;
+    struct loader_instance *inst = (struct loader_instance *)icd_term->this_instance;
 
     destroyFunction(device, pAllocator);
     dev->chain_device = NULL;
@@ -4484,6 +5357,7 @@ VkResult loader_create_instance_chain(const VkInstanceCreateInfo *pCreateInfo, c
         for (int32_t i = inst->expanded_activated_layer_list.count - 1; i >= 0; i--) {
             struct loader_layer_properties *layer_prop = &inst->expanded_activated_layer_list.list[i];
             loader_platform_dl_handle lib_handle;
+            uint64_t layer_start_ns = loader_platform_monotonic_time_ns();
 
             // Skip it if a Layer with the same name has been already successfully activated
             if (loader_names_array_has_layer_property(&layer_prop->info, num_activated_layers, activated_layers)) {
@@ -4590,12 +5464,18 @@ VkResult loader_create_instance_chain(const VkInstanceCreateInfo *pCreateInfo, c
                 activated_layers[num_activated_layers].disable_env = layer_prop->disable_env_var.name;
             }
 
+            activated_layers[num_activated_layers].setup_duration_ns = loader_platform_monotonic_time_ns() - layer_start_ns;
+
             loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_LAYER_BIT, 0, "Insert instance layer %s (%s)",
                        layer_prop->info.layerName, layer_prop->lib_name);
 
             num_activated_layers++;
         }
     }
+    for (uint32_t act = 0; act < num_activated_layers; ++act) {
+        loader_creation_feedback_layer(inst->creation_feedback, num_activated_layers - act - 1, activated_layers[act].name,
+                                       activated_layers[act].setup_duration_ns);
+    }
 
     // Make sure each layer requested by the application was actually loaded
     for (uint32_t exp = 0; exp < inst->expanded_activated_layer_list.count; ++exp) {
@@ -4703,7 +5583,9 @@ VkResult loader_create_instance_chain(const VkInstanceCreateInfo *pCreateInfo, c
             loader_log(inst, VULKAN_LOADER_LAYER_BIT, 0, "   <Drivers>\n");
         }
 
+        uint64_t chain_start_ns = loader_platform_monotonic_time_ns();
         res = fpCreateInstance(&loader_create_info, pAllocator, created_instance);
+        loader_creation_feedback_layer_chain(inst->creation_feedback, loader_platform_monotonic_time_ns() - chain_start_ns);
     } else {
         loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_create_instance_chain: Failed to find \'vkCreateInstance\'");
         // Couldn't find CreateInstance function!
@@ -4810,6 +5692,7 @@ VkResult loader_create_device_chain(const VkPhysicalDevice pd, const VkDeviceCre
         for (int32_t i = dev->expanded_activated_layer_list.count - 1; i >= 0; i--) {
             struct loader_layer_properties *layer_prop = &dev->expanded_activated_layer_list.list[i];
             loader_platform_dl_handle lib_handle;
+            uint64_t layer_start_ns = loader_platform_monotonic_time_ns();
 
             // Skip it if a Layer with the same name has been already successfully activated
             if (loader_names_array_has_layer_property(&layer_prop->info, num_activated_layers, activated_layers)) {
@@ -4874,12 +5757,18 @@ VkResult loader_create_device_chain(const VkPhysicalDevice pd, const VkDeviceCre
                 activated_layers[num_activated_layers].disable_env = layer_prop->disable_env_var.name;
             }
 
+            activated_layers[num_activated_layers].setup_duration_ns = loader_platform_monotonic_time_ns() - layer_start_ns;
+
             loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_LAYER_BIT, 0, "Inserted device layer %s (%s)",
                        layer_prop->info.layerName, layer_prop->lib_name);
 
             num_activated_layers++;
         }
     }
+    for (uint32_t act = 0; act < num_activated_layers; ++act) {
+        loader_creation_feedback_layer(dev->creation_feedback, num_activated_layers - act - 1, activated_layers[act].name,
+                                       activated_layers[act].setup_duration_ns);
+    }
 
     VkDevice created_device = (VkDevice)dev;
     PFN_vkCreateDevice fpCreateDevice = (PFN_vkCreateDevice)nextGIPA(inst->instance, "vkCreateDevice");
@@ -4919,7 +5808,9 @@ VkResult loader_create_device_chain(const VkPhysicalDevice pd, const VkDeviceCre
         }
         create_info_disp.pNext = loader_create_info.pNext;
         loader_create_info.pNext = &create_info_disp;
+        uint64_t chain_start_ns = loader_platform_monotonic_time_ns();
         res = fpCreateDevice(pd, &loader_create_info, pAllocator, &created_device);
+        loader_creation_feedback_layer_chain(dev->creation_feedback, loader_platform_monotonic_time_ns() - chain_start_ns);
         if (res != VK_SUCCESS) {
             return res;
         }
@@ -5328,8 +6219,13 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateInstance(const VkInstanceCreateI
             icd_app_info.apiVersion = icd_version;
             icd_create_info.pApplicationInfo = &icd_app_info;
         }
+        loader_trace_begin("terminator_CreateInstance", ptr_instance->icd_tramp_list.scanned_list[i].lib_name);
+        uint64_t icd_start_ns = loader_platform_monotonic_time_ns();
         icd_result =
             ptr_instance->icd_tramp_list.scanned_list[i].CreateInstance(&icd_create_info, pAllocator, &(icd_term->instance));
+        loader_creation_feedback_driver(ptr_instance->creation_feedback, ptr_instance->icd_tramp_list.scanned_list[i].lib_name,
+                                        loader_platform_monotonic_time_ns() - icd_start_ns);
+        loader_trace_end("terminator_CreateInstance");
         if (VK_ERROR_OUT_OF_HOST_MEMORY == icd_result) {
             // If out of memory, bail immediately.
             res = VK_ERROR_OUT_OF_HOST_MEMORY;
@@ -5448,21 +6344,7 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroyInstance(VkInstance instance, const
     struct loader_icd_term *icd_terms = ptr_instance->icd_terms;
     struct loader_icd_term *next_icd_term;
 
-    // Remove this instance from the list of instances:
-    struct loader_instance *prev = NULL;
-    struct loader_instance *next = loader.instances;
-    while (next != NULL) {
-        if (next == ptr_instance) {
-            // Remove this instance from the list:
-            if (prev)
-                prev->next = next->next;
-            else
-                loader.instances = next->next;
-            break;
-        }
-        prev = next;
-        next = next->next;
-    }
+    loader_remove_instance(ptr_instance);
 
     while (NULL != icd_terms) {
         if (icd_terms->instance) {
@@ -5717,15 +6599,29 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDevice(VkPhysicalDevice physical
     loader_log(icd_term->this_instance, VULKAN_LOADER_LAYER_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
                "       Using \"%s\" with driver: \"%s\"\n", properties.deviceName, icd_term->scanned_icd->lib_name);
 
+    uint64_t driver_start_ns = loader_platform_monotonic_time_ns();
     res = fpCreateDevice(phys_dev_term->phys_dev, &localCreateInfo, pAllocator, &dev->icd_device);
+    loader_creation_feedback_driver(dev->creation_feedback, icd_term->scanned_icd->lib_name,
+                                    loader_platform_monotonic_time_ns() - driver_start_ns);
     if (res != VK_SUCCESS) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
                    "terminator_CreateDevice: Failed in ICD %s vkCreateDevice call", icd_term->scanned_icd->lib_name);
         goto out;
     }
 
+    res = loader_add_logical_device((struct loader_instance *)icd_term->this_instance, icd_term, dev);
+    if (res != VK_SUCCESS) {
+        loader_log(icd_term->this_instance, VULKAN_LOADER_ERROR_BIT, 0,
+                   "terminator_CreateDevice: Failed to keep track of the new device");
+        PFN_vkDestroyDevice fpDestroyDevice =
+            (PFN_vkDestroyDevice)icd_term->dispatch.GetDeviceProcAddr(dev->icd_device, "vkDestroyDevice");
+        if (NULL != fpDestroyDevice) {
+            fpDestroyDevice(dev->icd_device, pAllocator);
+        }
+        dev->icd_device = VK_NULL_HANDLE;
+        goto out;
+    }
     *pDevice = dev->icd_device;
-    loader_add_logical_device(icd_term->this_instance, icd_term, dev);
 
     // Init dispatch pointer in new device object
     loader_init_dispatch(*pDevice, &dev->loader_dispatch);
@@ -5744,10 +6640,39 @@ out:
     return res;
 }
 
+// Replace phys_devs with the trampoline physical devices wrapping them, when all of them are in the snapshot. Returns false and
+// leaves phys_devs alone otherwise.
+static bool wrap_phys_devs_from_snapshot(const struct loader_instance_snapshot *snapshot, uint32_t phys_dev_count,
+                                         VkPhysicalDevice *phys_devs) {
+    if (NULL == snapshot || snapshot->phys_dev_count != phys_dev_count) {
+        return false;
+    }
+    VkPhysicalDevice *wrapped = (VkPhysicalDevice *)loader_stack_alloc(sizeof(VkPhysicalDevice) * phys_dev_count);
+    if (NULL == wrapped) {
+        return false;
+    }
+    for (uint32_t new_idx = 0; new_idx < phys_dev_count; ++new_idx) {
+        bool found = false;
+        for (uint32_t cur_idx = 0; cur_idx < snapshot->phys_dev_count; ++cur_idx) {
+            if (snapshot->phys_devs[cur_idx].phys_dev == phys_devs[new_idx]) {
+                wrapped[new_idx] = snapshot->phys_devs[cur_idx].tramp;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            return false;
+        }
+    }
+    memcpy(phys_devs, wrapped, sizeof(VkPhysicalDevice) * phys_dev_count);
+    return true;
+}
+
 // Update the trampoline physical devices with the wrapped version.
 // We always want to re-use previous physical device pointers since they may be used by an application
 // after returning previously.
-VkResult setup_loader_tramp_phys_devs(struct loader_instance *inst, uint32_t phys_dev_count, VkPhysicalDevice *phys_devs) {
+// Must be called with instance_lock held.
+static VkResult update_loader_tramp_phys_devs(struct loader_instance *inst, uint32_t phys_dev_count, VkPhysicalDevice *phys_devs) {
     VkResult res = VK_SUCCESS;
     uint32_t found_count = 0;
     uint32_t old_count = inst->phys_dev_count_tramp;
@@ -5923,6 +6848,26 @@ out:
     return res;
 }
 
+VkResult setup_loader_tramp_phys_devs(struct loader_instance *inst, uint32_t phys_dev_count, VkPhysicalDevice *phys_devs) {
+    if (0 == phys_dev_count) {
+        return VK_SUCCESS;
+    }
+
+    // Usually the devices are the same ones the application was handed last time, which is answered from the snapshot without
+    // taking the lock
+    if (wrap_phys_devs_from_snapshot(loader_get_instance_snapshot(inst), phys_dev_count, phys_devs)) {
+        return VK_SUCCESS;
+    }
+
+    loader_stats_lock_mutex(inst, &inst->instance_lock);
+    VkResult res = update_loader_tramp_phys_devs(inst, phys_dev_count, phys_devs);
+    if (VK_SUCCESS == res) {
+        res = loader_publish_instance_snapshot(inst);
+    }
+    loader_platform_thread_unlock_mutex(&inst->instance_lock);
+    return res;
+}
+
 #ifdef LOADER_ENABLE_LINUX_SORT
 bool is_linux_sort_enabled(struct loader_instance *inst) {
     bool sort_items = inst->supports_get_dev_prop_2;
@@ -5993,6 +6938,8 @@ VkResult setup_loader_term_phys_devs(struct loader_instance *inst) {
     uint32_t new_phys_devs_count = 0;
     struct loader_physical_device_term **new_phys_devs = NULL;
 
+    loader_trace_begin("setup_loader_term_phys_devs", NULL);
+
 #if defined(_WIN32)
     // Get the physical devices supported by platform sorting mechanism into a separate list
     res = windows_read_sorted_physical_devices(inst, &windows_sorted_devices_count, &windows_sorted_devices_array);
@@ -6220,6 +7167,7 @@ out:
         loader_instance_heap_free(inst, windows_sorted_devices_array);
     }
 
+    loader_trace_end("setup_loader_term_phys_devs");
     return res;
 }
 
@@ -6272,6 +7220,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumeratePhysicalDevices(VkInstance in
     struct loader_instance *inst = (struct loader_instance *)instance;
     VkResult res = VK_SUCCESS;
 
+    loader_stats_lock_mutex(inst, &inst->instance_lock);
+
     // Always call the setup loader terminator physical devices because they may
     // have changed at any point.
     res = setup_loader_term_phys_devs(inst);
@@ -6298,6 +7248,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumeratePhysicalDevices(VkInstance in
 
 out:
 
+    loader_platform_thread_unlock_mutex(&inst->instance_lock);
     return res;
 }
 
@@ -6507,6 +7458,7 @@ terminator_EnumerateInstanceExtensionProperties(const VkEnumerateInstanceExtensi
                                                 uint32_t *pPropertyCount, VkExtensionProperties *pProperties) {
     struct loader_extension_list *global_ext_list = NULL;
     struct loader_layer_list instance_layers;
+    struct loader_implicit_layer_cache *implicit_layers = NULL;
     struct loader_extension_list local_ext_list;
     struct loader_icd_tramp_list icd_tramp_list;
     uint32_t copy_size;
@@ -6550,12 +7502,15 @@ terminator_EnumerateInstanceExtensionProperties(const VkEnumerateInstanceExtensi
         loader_scanned_icd_clear(NULL, &icd_tramp_list);
 
         // Append enabled implicit layers.
-        loader_scan_for_implicit_layers(NULL, &instance_layers);
-        for (uint32_t i = 0; i < instance_layers.count; i++) {
-            if (!loader_implicit_layer_is_enabled(NULL, &instance_layers.list[i])) {
+        res = loader_acquire_implicit_layers(&implicit_layers);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+        for (uint32_t i = 0; i < implicit_layers->layers.count; i++) {
+            if (!loader_implicit_layer_is_enabled(NULL, &implicit_layers->layers.list[i])) {
                 continue;
             }
-            struct loader_extension_list *ext_list = &instance_layers.list[i].instance_extension_list;
+            struct loader_extension_list *ext_list = &implicit_layers->layers.list[i].instance_extension_list;
             loader_add_to_ext_list(NULL, &local_ext_list, ext_list->count, ext_list->list);
         }
 
@@ -6587,6 +7542,7 @@ out:
     loader_destroy_generic_list(NULL, (struct loader_generic_list *)&icd_tramp_list);
     loader_destroy_generic_list(NULL, (struct loader_generic_list *)&local_ext_list);
     loader_delete_layer_list_and_properties(NULL, &instance_layers);
+    loader_release_implicit_layers(implicit_layers);
     return res;
 }
 
@@ -6629,10 +7585,9 @@ out:
 
 // ---- Vulkan Core 1.1 terminators
 
-VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumeratePhysicalDeviceGroups(
-    VkInstance instance, uint32_t *pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties *pPhysicalDeviceGroupProperties) {
-    struct loader_instance *inst = (struct loader_instance *)instance;
-
+// Must be called with instance_lock held
+static VkResult enumerate_phys_dev_groups_term(struct loader_instance *inst, uint32_t *pPhysicalDeviceGroupCount,
+                                               VkPhysicalDeviceGroupProperties *pPhysicalDeviceGroupProperties) {
     VkResult res = VK_SUCCESS;
     struct loader_icd_term *icd_term;
     uint32_t total_count = 0;
@@ -7015,3 +7970,12 @@ out:
     }
     return res;
 }
+
+VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumeratePhysicalDeviceGroups(
+    VkInstance instance, uint32_t *pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties *pPhysicalDeviceGroupProperties) {
+    struct loader_instance *inst = (struct loader_instance *)instance;
+    loader_stats_lock_mutex(inst, &inst->instance_lock);
+    VkResult res = enumerate_phys_dev_groups_term(inst, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+    loader_platform_thread_unlock_mutex(&inst->instance_lock);
+    return res;
+}
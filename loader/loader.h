@@ -82,6 +82,7 @@ extern struct loader_struct loader;
 extern loader_platform_thread_mutex loader_lock;
 extern loader_platform_thread_mutex loader_json_lock;
 extern loader_platform_thread_mutex loader_preload_icd_lock;
+extern loader_platform_thread_mutex loader_implicit_layer_cache_lock;
 
 bool compare_vk_extension_properties(const VkExtensionProperties *op1, const VkExtensionProperties *op2);
 
@@ -101,6 +102,8 @@ bool has_vk_extension_property_array(const VkExtensionProperties *vk_ext_prop, c
 bool has_vk_extension_property(const VkExtensionProperties *vk_ext_prop, const struct loader_extension_list *ext_list);
 
 void loader_free_layer_properties(const struct loader_instance *inst, struct loader_layer_properties *layer_properties);
+struct loader_layer_properties *loader_get_next_layer_property_slot(const struct loader_instance *inst,
+                                                                    struct loader_layer_list *layer_list);
 VkResult loader_add_to_ext_list(const struct loader_instance *inst, struct loader_extension_list *ext_list,
                                 uint32_t prop_list_count, const VkExtensionProperties *props);
 VkResult loader_add_to_dev_ext_list(const struct loader_instance *inst, struct loader_device_extension_list *ext_list,
@@ -125,16 +128,32 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
 void loader_scan_for_layers(struct loader_instance *inst, struct loader_layer_list *instance_layers);
 void loader_scan_for_implicit_layers(struct loader_instance *inst, struct loader_layer_list *instance_layers);
 bool loader_implicit_layer_is_enabled(const struct loader_instance *inst, const struct loader_layer_properties *prop);
+
+// Get the implicit layers for use by an entrypoint which is called before an instance exists. The result is shared between
+// callers and must be handed back with loader_release_implicit_layers. *out_cache is NULL if an error is returned.
+VkResult loader_acquire_implicit_layers(struct loader_implicit_layer_cache **out_cache);
+void loader_release_implicit_layers(struct loader_implicit_layer_cache *cache);
+// Open the library of the layer at index in cache->layers, or return the handle it was already opened with. Returns NULL if the
+// library can't be loaded.
+loader_platform_dl_handle loader_get_implicit_layer_library(struct loader_implicit_layer_cache *cache, uint32_t index);
+// Forget the cached implicit layers and close their libraries once nothing is using them anymore.
+void loader_clear_implicit_layer_cache(void);
 VkResult loader_get_icd_loader_instance_extensions(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list,
                                                    struct loader_extension_list *inst_exts);
 struct loader_icd_term *loader_get_icd_and_device(const void *device, struct loader_device **found_dev, uint32_t *icd_index);
 struct loader_instance *loader_get_instance(const VkInstance instance);
+// Add to or remove from the list of instances, which does nothing if inst isn't in it
+void loader_add_instance(struct loader_instance *inst);
+void loader_remove_instance(struct loader_instance *inst);
+// Publish a new snapshot of inst, with instance_lock held or before inst is handed to the application
+VkResult loader_publish_instance_snapshot(struct loader_instance *inst);
+const struct loader_instance_snapshot *loader_get_instance_snapshot(const struct loader_instance *inst);
+void loader_free_instance_snapshots(struct loader_instance *inst);
 void loader_deactivate_layers(const struct loader_instance *instance, struct loader_device *device, struct loader_layer_list *list);
 struct loader_device *loader_create_logical_device(const struct loader_instance *inst, const VkAllocationCallbacks *pAllocator);
-void loader_add_logical_device(const struct loader_instance *inst, struct loader_icd_term *icd_term,
-                               struct loader_device *found_dev);
-void loader_remove_logical_device(const struct loader_instance *inst, struct loader_icd_term *icd_term,
-                                  struct loader_device *found_dev, const VkAllocationCallbacks *pAllocator);
+VkResult loader_add_logical_device(struct loader_instance *inst, struct loader_icd_term *icd_term, struct loader_device *found_dev);
+void loader_remove_logical_device(struct loader_instance *inst, struct loader_icd_term *icd_term, struct loader_device *found_dev,
+                                  const VkAllocationCallbacks *pAllocator);
 // NOTE: Outside of loader, this entry-point is only provided for error
 // cleanup.
 void loader_destroy_logical_device(const struct loader_instance *inst, struct loader_device *dev,
@@ -37,6 +37,8 @@
 
 #include "vk_loader_platform.h"
 #include "vk_loader_layer.h"
+#include "vk_loader_creation_feedback.h"
+#include "vk_loader_statistics.h"
 #include "vk_layer_dispatch_table.h"
 #include "vk_loader_extensions.h"
 
@@ -170,9 +172,21 @@ struct loader_layer_list {
 
 typedef VkResult(VKAPI_PTR *PFN_vkDevExt)(VkDevice device);
 
+// Everything stored per function unknown to the loader is split into chunks of LOADER_UNKNOWN_FUNCTION_CHUNK_SIZE entries, which
+// are only allocated once a function they hold is used. Chunks never move once allocated, so that the trampolines can find an
+// entry with two loads: the chunk at (index >> LOADER_UNKNOWN_FUNCTION_CHUNK_SHIFT) and the entry at
+// (index & LOADER_UNKNOWN_FUNCTION_CHUNK_MASK) within it.
+#define LOADER_UNKNOWN_FUNCTION_CHUNK_SHIFT 5
+#define LOADER_UNKNOWN_FUNCTION_CHUNK_SIZE (1 << LOADER_UNKNOWN_FUNCTION_CHUNK_SHIFT)
+#define LOADER_UNKNOWN_FUNCTION_CHUNK_MASK (LOADER_UNKNOWN_FUNCTION_CHUNK_SIZE - 1)
+#define LOADER_UNKNOWN_FUNCTION_CHUNK_COUNT \
+    ((MAX_NUM_UNKNOWN_FUNCTIONS + LOADER_UNKNOWN_FUNCTION_CHUNK_MASK) >> LOADER_UNKNOWN_FUNCTION_CHUNK_SHIFT)
+#define LOADER_UNKNOWN_FUNCTION_ENTRY(array, index) \
+    (array)[(index) >> LOADER_UNKNOWN_FUNCTION_CHUNK_SHIFT][(index)&LOADER_UNKNOWN_FUNCTION_CHUNK_MASK]
+
 struct loader_dev_dispatch_table {
     VkLayerDispatchTable core_dispatch;
-    PFN_vkDevExt ext_dispatch[MAX_NUM_UNKNOWN_EXTS];
+    PFN_vkDevExt *ext_dispatch[LOADER_UNKNOWN_FUNCTION_CHUNK_COUNT];
 };
 
 // per CreateDevice structure
@@ -202,6 +216,9 @@ struct loader_device {
         bool ext_full_screen_exclusive_enabled;
     } extensions;
 
+    // Only set while vkCreateDevice runs, so that terminator_CreateDevice can time the driver
+    struct loader_creation_feedback *creation_feedback;
+
     struct loader_device *next;
 };
 
@@ -218,10 +235,46 @@ struct loader_icd_term {
 
     struct loader_icd_term *next;
 
-    PFN_PhysDevExt phys_dev_ext[MAX_NUM_UNKNOWN_EXTS];
+    PFN_PhysDevExt *phys_dev_ext[LOADER_UNKNOWN_FUNCTION_CHUNK_COUNT];
     bool supports_get_dev_prop_2;
 };
 
+// Identity of one of the implicit layer manifest files a cached scan was built from
+struct loader_implicit_layer_manifest_id {
+    char *path;
+    size_t size;
+    uint64_t hash;
+};
+
+// Library of a layer in the implicit layer cache. The file it was opened from is remembered where the platform allows, so that
+// replacing the library on disk invalidates the cache even when the manifest pointing at it is unchanged.
+struct loader_implicit_layer_lib {
+    loader_platform_dl_handle handle;
+    bool has_file_id;
+    uint64_t device;
+    uint64_t inode;
+    uint64_t size;
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+};
+
+// Process wide result of loader_scan_for_implicit_layers, shared by the entrypoints which are called before an instance
+// exists. Entries are reference counted, so a stale entry can be replaced while other threads are still using it.
+struct loader_implicit_layer_cache {
+    uint32_t ref_count;
+    struct loader_layer_list layers;
+
+    // One entry per layer in the list, with the library opened the first time the layer is needed
+    struct loader_implicit_layer_lib *libs;
+
+    uint32_t manifest_count;
+    struct loader_implicit_layer_manifest_id *manifests;
+
+    // Set when the manifests were known to be unchanged as of this generation of loader_manifest_watch_poll
+    bool watched;
+    uint64_t watch_generation;
+};
+
 // Per ICD library structure
 struct loader_icd_tramp_list {
     size_t capacity;
@@ -232,8 +285,47 @@ struct loader_icd_tramp_list {
 struct loader_instance_dispatch_table {
     VkLayerInstanceDispatchTable layer_inst_disp;  // must be first entry in structure
 
+    // The instance this table belongs to, so that it can be found from any object dispatched through the table
+    struct loader_instance *instance;
+
     // Physical device functions unknown to the loader
-    PFN_PhysDevExt phys_dev_ext[MAX_NUM_UNKNOWN_EXTS];
+    PFN_PhysDevExt *phys_dev_ext[LOADER_UNKNOWN_FUNCTION_CHUNK_COUNT];
+};
+
+// Slot of an open addressing hash map from the name of an unknown function to where it is stored
+struct loader_unknown_function_map_entry {
+    uint32_t hash;
+    // One more than the index of the function, so that zero marks an empty slot
+    uint32_t index;
+    // Only tracked for physical device functions, which need an ICD to support them before the terminator can be used
+    bool supported_by_icd;
+};
+
+struct loader_unknown_function_map {
+    uint32_t capacity;  // Zero or a power of two
+    uint32_t count;
+    struct loader_unknown_function_map_entry *entries;
+};
+
+// A physical device the application was handed, along with the object it wraps
+struct loader_snapshot_phys_dev {
+    VkPhysicalDevice phys_dev;  // object from layers/loader terminator
+    VkPhysicalDevice tramp;     // the loader_physical_device_tramp handed to the application
+};
+
+// What the enumerate and query entrypoints read from an instance, without taking any lock. A snapshot never changes once it
+// is published: what it holds is changed under instance_lock, after which a new snapshot is published in place of the old one.
+// Replaced snapshots are kept until the instance is destroyed, as readers may still be looking at them.
+struct loader_instance_snapshot {
+    struct loader_instance_snapshot *retired_next;
+
+    // The layers the application enabled
+    uint32_t layer_count;
+    VkLayerProperties *layers;
+
+    // The physical devices the application was handed so far
+    uint32_t phys_dev_count;
+    struct loader_snapshot_phys_dev *phys_devs;
 };
 
 // Unique magic number identifier for the loader.
@@ -244,6 +336,22 @@ struct loader_instance {
     struct loader_instance_dispatch_table *disp;  // must be first entry in structure
     uint64_t magic;                               // Should be LOADER_MAGIC_NUMBER
 
+    // Protects what changes in the instance after it was created, such as its physical devices and debug callbacks, so only
+    // calls on the same instance wait on it. Entrypoints which only read go through the snapshot instead.
+    loader_platform_thread_mutex instance_lock;
+    // Protects the logical_device_list of each of the icd_terms, along with every device in them having room in its dispatch table
+    // for the device functions unknown to the loader. It is never held across calls out of the loader, so that devices can be
+    // created and destroyed on several threads at once without waiting on each other's drivers and layers.
+    loader_platform_thread_mutex device_list_lock;
+    // Protects the maps, function names and counts of the unknown device and physical device functions, which are looked up and
+    // added by vkGetInstanceProcAddr and vkGetDeviceProcAddr on any thread. Taken before device_list_lock when both are needed,
+    // and never held across calls out of the loader, since drivers and layers asked about a function can look it up in turn.
+    loader_platform_thread_mutex unknown_function_lock;
+
+    // Counters for work done on behalf of this instance alone, indexed by VkLoaderStatistic. Only updated through
+    // loader_stats_add.
+    uint64_t statistics[VK_LOADER_STATISTIC_COUNT];
+
     // Vulkan API version the app is intending to use.
     loader_api_version app_api_version;
 
@@ -255,6 +363,8 @@ struct loader_instance {
     struct loader_physical_device_term **phys_devs_term;
     uint32_t phys_dev_count_tramp;
     struct loader_physical_device_tramp **phys_devs_tramp;
+    // Only read through loader_get_instance_snapshot, see struct loader_instance_snapshot
+    struct loader_instance_snapshot *snapshot;
 
     // We also need to manually track physical device groups, but we don't need
     // loader specific structures since we have that content in the physical
@@ -269,9 +379,11 @@ struct loader_instance {
     struct loader_icd_tramp_list icd_tramp_list;
 
     uint32_t dev_ext_disp_function_count;
-    char *dev_ext_disp_functions[MAX_NUM_UNKNOWN_EXTS];
+    char **dev_ext_disp_functions[LOADER_UNKNOWN_FUNCTION_CHUNK_COUNT];
     uint32_t phys_dev_ext_disp_function_count;
-    char *phys_dev_ext_disp_functions[MAX_NUM_UNKNOWN_EXTS];
+    char **phys_dev_ext_disp_functions[LOADER_UNKNOWN_FUNCTION_CHUNK_COUNT];
+    struct loader_unknown_function_map dev_ext_function_map;
+    struct loader_unknown_function_map phys_dev_ext_function_map;
 
     struct loader_msg_callback_map_entry *icd_msg_callback_map;
 
@@ -294,6 +406,13 @@ struct loader_instance {
     // Stores debug callbacks - used in the log
     VkLayerDbgFunctionNode *DbgFunctionHead;
 
+    // Everything some callback in DbgFunctionHead listens for, kept up to date by util_UpdateDebugCallbackInterest.
+    // loader_log checks these before formatting so messages nobody listens for cost next to nothing. Only accessed through
+    // loader_platform_atomic_load_u32 and loader_platform_atomic_store_u32, since loader_log doesn't take instance_lock.
+    VkDebugUtilsMessageSeverityFlagsEXT debug_callback_severities;
+    VkDebugUtilsMessageTypeFlagsEXT debug_callback_types;
+    VkDebugReportFlagsEXT debug_callback_report_flags;
+
     // Stores the debug callbacks set during instance creation
     // These are kept separate because they aren't to be used outside of instance creation and destruction
     // So they are swapped out at the end of instance creation and swapped in at instance destruction
@@ -348,6 +467,12 @@ struct loader_instance {
     bool wsi_display_props2_enabled;
     bool create_terminator_invalid_extension;
     bool supports_get_dev_prop_2;
+
+    // Only set while vkCreateInstance runs, so that terminator_CreateInstance can time each driver
+    struct loader_creation_feedback *creation_feedback;
+
+    // Only set while vkCreateInstance runs, so that its layer and driver scans share one load and write of the manifest cache
+    struct loader_manifest_cache *manifest_cache;
 };
 
 // VkPhysicalDevice requires special treatment by loader.  Firstly, terminator
@@ -438,6 +563,14 @@ struct loader_scanned_icd {
 #endif
 };
 
+// The values read out of a driver manifest file, before the driver library itself is loaded.
+struct loader_icd_manifest {
+    char library_path[MAX_STRING_SIZE];  // As written in the manifest, not yet resolved to a full path
+    uint32_t api_version;
+    bool is_portability_driver;
+    uint8_t library_arch;  // 0 when not present in the manifest, otherwise 32 or 64
+};
+
 enum loader_data_files_type {
     LOADER_DATA_FILE_MANIFEST_DRIVER = 0,
     LOADER_DATA_FILE_MANIFEST_EXPLICIT_LAYER,
@@ -33,6 +33,7 @@
 
 #include "debug_utils.h"
 #include "get_environment.h"
+#include "log_file.h"
 
 uint32_t g_loader_debug = 0;
 
@@ -92,6 +93,46 @@ void loader_log(const struct loader_instance *inst, VkFlags msg_type, int32_t ms
     size_t num_used = 0;
     va_list ap;
     int ret;
+    VkDebugUtilsMessageSeverityFlagBitsEXT severity = 0;
+    VkDebugUtilsMessageTypeFlagsEXT type;
+    bool send_to_callbacks = false;
+
+    if ((msg_type & VULKAN_LOADER_INFO_BIT) != 0) {
+        severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
+    } else if ((msg_type & VULKAN_LOADER_WARN_BIT) != 0) {
+        severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT;
+    } else if ((msg_type & VULKAN_LOADER_ERROR_BIT) != 0) {
+        severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    } else if ((msg_type & VULKAN_LOADER_DEBUG_BIT) != 0) {
+        severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT;
+    } else if ((msg_type & VULKAN_LOADER_LAYER_BIT) != 0 || (msg_type & VULKAN_LOADER_DRIVER_BIT) != 0) {
+        // Just driver or just layer bit should be treated as an info message in debug utils.
+        severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
+    }
+
+    if ((msg_type & VULKAN_LOADER_PERF_BIT) != 0) {
+        type = VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+    } else if ((msg_type & VULKAN_LOADER_VALIDATION_BIT) != 0) {
+        // For loader logging, if it's a validation message, we still want to also keep the general flag as well
+        // so messages of type validation can still be triggered for general message callbacks.
+        type = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    } else {
+        type = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT;
+    }
+
+    if (inst) {
+        VkDebugReportFlagsEXT report_flags = 0;
+        debug_utils_AnnotFlagsToReportFlags(severity, type, &report_flags);
+        send_to_callbacks = ((loader_platform_atomic_load_u32(&inst->debug_callback_severities) & severity) != 0 &&
+                             (loader_platform_atomic_load_u32(&inst->debug_callback_types) & type) != 0) ||
+                            (loader_platform_atomic_load_u32(&inst->debug_callback_report_flags) & report_flags) != 0;
+    }
+
+    // Most calls are filtered out by both VK_LOADER_DEBUG and the application's callbacks, so bail before paying for
+    // the formatting below.
+    if (!send_to_callbacks && 0 == (msg_type & g_loader_debug)) {
+        return;
+    }
 
     va_start(ap, format);
     ret = vsnprintf(msg, sizeof(msg), format, ap);
@@ -100,35 +141,10 @@ void loader_log(const struct loader_instance *inst, VkFlags msg_type, int32_t ms
     }
     va_end(ap);
 
-    if (inst) {
-        VkDebugUtilsMessageSeverityFlagBitsEXT severity = 0;
-        VkDebugUtilsMessageTypeFlagsEXT type;
+    if (send_to_callbacks) {
         VkDebugUtilsMessengerCallbackDataEXT callback_data;
         VkDebugUtilsObjectNameInfoEXT object_name;
 
-        if ((msg_type & VULKAN_LOADER_INFO_BIT) != 0) {
-            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
-        } else if ((msg_type & VULKAN_LOADER_WARN_BIT) != 0) {
-            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT;
-        } else if ((msg_type & VULKAN_LOADER_ERROR_BIT) != 0) {
-            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
-        } else if ((msg_type & VULKAN_LOADER_DEBUG_BIT) != 0) {
-            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT;
-        } else if ((msg_type & VULKAN_LOADER_LAYER_BIT) != 0 || (msg_type & VULKAN_LOADER_DRIVER_BIT) != 0) {
-            // Just driver or just layer bit should be treated as an info message in debug utils.
-            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
-        }
-
-        if ((msg_type & VULKAN_LOADER_PERF_BIT) != 0) {
-            type = VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
-        } else if ((msg_type & VULKAN_LOADER_VALIDATION_BIT) != 0) {
-            // For loader logging, if it's a validation message, we still want to also keep the general flag as well
-            // so messages of type validation can still be triggered for general message callbacks.
-            type = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
-        } else {
-            type = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT;
-        }
-
         callback_data.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT;
         callback_data.pNext = NULL;
         callback_data.flags = 0;
@@ -216,6 +232,10 @@ void loader_log(const struct loader_instance *inst, VkFlags msg_type, int32_t ms
         }
         strncat(cmd_line_msg, msg, cmd_line_size);
 
+        if (loader_log_file_write(cmd_line_msg)) {
+            return;
+        }
+
 #if defined(WIN32)
         OutputDebugString(cmd_line_msg);
         OutputDebugString("\n");
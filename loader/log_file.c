@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "log_file.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "allocation.h"
+#include "get_environment.h"
+#include "log.h"
+
+// Joining the writer thread from DllMain would deadlock on the loader lock, so this is only done where loader_release runs
+// from a library destructor.
+#if !defined(_WIN32)
+#include <inttypes.h>
+#define LOADER_LOG_FILE_SUPPORTED 1
+#endif
+
+#if defined(LOADER_LOG_FILE_SUPPORTED)
+
+#define LOADER_LOG_FILE_RECORD_COUNT 4096
+
+// Nothing is opened or started until the first line is logged, so a configured log file costs nothing until it is used
+enum loader_log_file_state {
+    LOADER_LOG_FILE_OFF = 0,
+    LOADER_LOG_FILE_CONFIGURED,  // VK_LOADER_DEBUG_FILE was set, lines can be queued
+    LOADER_LOG_FILE_STARTING,    // The first line is opening the file and starting the writer thread, lines can be queued
+    LOADER_LOG_FILE_RUNNING,
+};
+
+// A record is free for the writer claiming position pos when its sequence equals pos, and holds a finished line for the reader
+// once its sequence is pos + 1. After the line is written out the sequence moves on to pos + LOADER_LOG_FILE_RECORD_COUNT, the
+// position which next maps to the same record.
+struct loader_log_file_record {
+    uint64_t sequence;
+    uint64_t timestamp_ns;
+    uint64_t thread_id;
+    char line[512];
+};
+
+// Static storage so that a thread which is still logging while the loader is released never touches freed memory. It is only
+// paged in once a log file is actually used.
+static struct {
+    uint64_t state;  // enum loader_log_file_state
+    char *path;
+    FILE *file;
+    loader_platform_thread thread;
+    // The writer thread waits on wake with lock held when there is nothing to write. Loggers only take the lock to wake it up.
+    loader_platform_thread_mutex lock;
+    loader_platform_thread_cond wake;
+    uint64_t sleeping;
+    uint64_t stopping;  // Only changed with lock held
+    uint64_t start_time_ns;
+    uint64_t write_position;
+    uint64_t dropped;
+    // Only used by the writer thread
+    uint64_t read_position;
+    uint64_t reported_dropped;
+    struct loader_log_file_record records[LOADER_LOG_FILE_RECORD_COUNT];
+} log_file;
+
+static bool loader_log_file_has_work(void) {
+    const struct loader_log_file_record *record = &log_file.records[log_file.read_position % LOADER_LOG_FILE_RECORD_COUNT];
+    return loader_platform_atomic_load_u64(&record->sequence) == log_file.read_position + 1 ||
+           loader_platform_atomic_load_u64(&log_file.dropped) != log_file.reported_dropped;
+}
+
+// Write every finished record to the file, stopping at the first one which isn't finished yet
+static void loader_log_file_drain(void) {
+    bool wrote = false;
+    for (;;) {
+        struct loader_log_file_record *record = &log_file.records[log_file.read_position % LOADER_LOG_FILE_RECORD_COUNT];
+        if (loader_platform_atomic_load_u64(&record->sequence) != log_file.read_position + 1) {
+            break;
+        }
+        uint64_t elapsed_us = (record->timestamp_ns - log_file.start_time_ns) / 1000;
+        fprintf(log_file.file, "[%" PRIu64 ".%06" PRIu64 "] [tid %" PRIu64 "] %s\n", elapsed_us / 1000000, elapsed_us % 1000000,
+                record->thread_id, record->line);
+        loader_platform_atomic_store_u64(&record->sequence, log_file.read_position + LOADER_LOG_FILE_RECORD_COUNT);
+        log_file.read_position++;
+        wrote = true;
+    }
+
+    uint64_t dropped = loader_platform_atomic_load_u64(&log_file.dropped);
+    if (dropped != log_file.reported_dropped) {
+        fprintf(log_file.file, "%" PRIu64 " loader messages were dropped because the log buffer was full\n",
+                dropped - log_file.reported_dropped);
+        log_file.reported_dropped = dropped;
+        wrote = true;
+    }
+
+    if (wrote) {
+        fflush(log_file.file);
+    }
+}
+
+static loader_platform_thread_result LOADER_PLATFORM_THREAD_CALL loader_log_file_thread(void *arg) {
+    (void)arg;
+    bool stopping = false;
+    while (!stopping) {
+        loader_log_file_drain();
+
+        loader_platform_thread_lock_mutex(&log_file.lock);
+        // Set with an atomic add rather than a store so that it can't be ordered after the check for lines below. A line queued
+        // after that check then sees the thread asleep and wakes it, see loader_log_file_wake.
+        loader_platform_atomic_fetch_add_u64(&log_file.sleeping, 1);
+        while (0 == log_file.stopping && !loader_log_file_has_work()) {
+            loader_platform_thread_cond_wait(&log_file.wake, &log_file.lock);
+        }
+        loader_platform_atomic_fetch_add_u64(&log_file.sleeping, (uint64_t)-1);
+        stopping = 0 != log_file.stopping;
+        loader_platform_thread_unlock_mutex(&log_file.lock);
+    }
+    loader_log_file_drain();
+    return 0;
+}
+
+static void loader_log_file_wake(void) {
+    // Read with an atomic add rather than a load so that it can't be ordered before the line was queued
+    if (0 != loader_platform_atomic_fetch_add_u64(&log_file.sleeping, 0)) {
+        loader_platform_thread_lock_mutex(&log_file.lock);
+        loader_platform_thread_cond_signal(&log_file.wake);
+        loader_platform_thread_unlock_mutex(&log_file.lock);
+    }
+}
+
+// Called by whichever line is logged first. Lines logged on other threads in the meantime are queued and written once the
+// thread is running, or lost if the file can't be opened.
+static bool loader_log_file_start(void) {
+    uint64_t state = LOADER_LOG_FILE_CONFIGURED;
+    if (!loader_platform_atomic_compare_exchange_u64(&log_file.state, &state, LOADER_LOG_FILE_STARTING)) {
+        return LOADER_LOG_FILE_OFF != state;
+    }
+
+    log_file.file = fopen(log_file.path, "a");
+    if (NULL == log_file.file) {
+        fprintf(stderr, "Unable to open VK_LOADER_DEBUG_FILE %s, loader messages will be written to stderr\n", log_file.path);
+        loader_platform_atomic_store_u64(&log_file.state, LOADER_LOG_FILE_OFF);
+        return false;
+    }
+    if (!loader_platform_thread_create(&log_file.thread, loader_log_file_thread, NULL)) {
+        fclose(log_file.file);
+        log_file.file = NULL;
+        loader_platform_atomic_store_u64(&log_file.state, LOADER_LOG_FILE_OFF);
+        return false;
+    }
+    loader_platform_atomic_store_u64(&log_file.state, LOADER_LOG_FILE_RUNNING);
+    return true;
+}
+
+#endif  // LOADER_LOG_FILE_SUPPORTED
+
+void loader_log_file_initialize(void) {
+#if defined(LOADER_LOG_FILE_SUPPORTED)
+    if (0 == loader_get_debug_level()) {
+        return;
+    }
+    char *path = loader_secure_getenv("VK_LOADER_DEBUG_FILE", NULL);
+    if (NULL == path) {
+        return;
+    }
+    if (path[0] == '\0') {
+        fprintf(stderr, "VK_LOADER_DEBUG_FILE is empty, loader messages will be written to stderr\n");
+        loader_free_getenv(path, NULL);
+        return;
+    }
+    // The environment can change before the first line is logged, so keep a copy
+    size_t path_size = strlen(path) + 1;
+    log_file.path = loader_instance_heap_alloc(NULL, path_size, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL != log_file.path) {
+        memcpy(log_file.path, path, path_size);
+    }
+    loader_free_getenv(path, NULL);
+    if (NULL == log_file.path) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < LOADER_LOG_FILE_RECORD_COUNT; i++) {
+        log_file.records[i].sequence = i;
+    }
+    log_file.write_position = 0;
+    log_file.read_position = 0;
+    log_file.dropped = 0;
+    log_file.reported_dropped = 0;
+    log_file.sleeping = 0;
+    log_file.stopping = 0;
+    log_file.start_time_ns = loader_platform_monotonic_time_ns();
+    loader_platform_thread_create_mutex(&log_file.lock);
+    loader_platform_thread_create_cond(&log_file.wake);
+    loader_platform_atomic_store_u64(&log_file.state, LOADER_LOG_FILE_CONFIGURED);
+#endif
+}
+
+void loader_log_file_release(void) {
+#if defined(LOADER_LOG_FILE_SUPPORTED)
+    if (NULL == log_file.path) {
+        return;
+    }
+    // Anything logged from here on goes to stderr. The writer thread writes what is already queued before it exits.
+    uint64_t state = loader_platform_atomic_load_u64(&log_file.state);
+    loader_platform_atomic_store_u64(&log_file.state, LOADER_LOG_FILE_OFF);
+    if (LOADER_LOG_FILE_RUNNING == state) {
+        loader_platform_thread_lock_mutex(&log_file.lock);
+        log_file.stopping = 1;
+        loader_platform_thread_cond_signal(&log_file.wake);
+        loader_platform_thread_unlock_mutex(&log_file.lock);
+        loader_platform_thread_join(log_file.thread);
+        fclose(log_file.file);
+        log_file.file = NULL;
+    }
+    loader_platform_thread_delete_cond(&log_file.wake);
+    loader_platform_thread_delete_mutex(&log_file.lock);
+    loader_instance_heap_free(NULL, log_file.path);
+    log_file.path = NULL;
+#endif
+}
+
+bool loader_log_file_write(const char *line) {
+#if defined(LOADER_LOG_FILE_SUPPORTED)
+    uint64_t state = loader_platform_atomic_load_u64(&log_file.state);
+    if (LOADER_LOG_FILE_OFF == state || (LOADER_LOG_FILE_CONFIGURED == state && !loader_log_file_start())) {
+        return false;
+    }
+
+    struct loader_log_file_record *record = NULL;
+    uint64_t position = loader_platform_atomic_load_u64(&log_file.write_position);
+    for (;;) {
+        record = &log_file.records[position % LOADER_LOG_FILE_RECORD_COUNT];
+        uint64_t sequence = loader_platform_atomic_load_u64(&record->sequence);
+        if (sequence == position) {
+            // On failure position is reloaded, so just try again with whatever position is next now
+            if (loader_platform_atomic_compare_exchange_u64(&log_file.write_position, &position, position + 1)) {
+                break;
+            }
+        } else if (sequence < position) {
+            // The record still holds a line from the previous trip around the buffer, so the buffer is full. The writer thread
+            // is busy emptying it, so there is no need to wake it.
+            loader_platform_atomic_fetch_add_u64(&log_file.dropped, 1);
+            return true;
+        } else {
+            // Another thread claimed this position first
+            position = loader_platform_atomic_load_u64(&log_file.write_position);
+        }
+    }
+
+    record->timestamp_ns = loader_platform_monotonic_time_ns();
+    record->thread_id = loader_platform_get_thread_id();
+    strncpy(record->line, line, sizeof(record->line) - 1);
+    record->line[sizeof(record->line) - 1] = '\0';
+    loader_platform_atomic_store_u64(&record->sequence, position + 1);
+    loader_log_file_wake();
+    return true;
+#else
+    (void)line;
+    return false;
+#endif
+}
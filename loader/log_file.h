@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "loader_common.h"
+
+// Optional asynchronous destination for VK_LOADER_DEBUG output.
+//
+// When VK_LOADER_DEBUG_FILE names a file and VK_LOADER_DEBUG enables any messages, the lines loader_log would print to stderr
+// are instead copied into a fixed size ring buffer of 4096 lines, together with a monotonic timestamp and the id of the logging
+// thread. The file is opened and a background thread started when the first line is logged. The thread sleeps until lines are
+// queued and appends them to the file, so logging never waits on I/O. Writers never block either: if the buffer is full the
+// line is dropped, and the number of dropped lines is written to the file once there is room again.
+//
+// Not supported on Windows, where loader_release runs from DllMain and so can't join the thread. VK_LOADER_DEBUG_FILE is
+// ignored there and messages keep going to stderr.
+
+// Reads VK_LOADER_DEBUG_FILE. Must be called after loader_debug_init.
+void loader_log_file_initialize(void);
+
+// Writes everything still in the buffer, then stops the writer thread and closes the file
+void loader_log_file_release(void);
+
+// Queues line for the file. Returns false if there is no log file, in which case the caller should print the line itself.
+bool loader_log_file_write(const char *line);
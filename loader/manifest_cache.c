@@ -0,0 +1,846 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "manifest_cache.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "allocation.h"
+#include "get_environment.h"
+#include "loader.h"
+#include "log.h"
+
+#if defined(__linux__) || defined(__APPLE__) || defined(__Fuchsia__) || defined(__QNXNTO__) || defined(__FreeBSD__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#define LOADER_MANIFEST_CACHE_SUPPORTED 1
+#endif
+
+#define LOADER_MANIFEST_CACHE_MAGIC "VKLDRMC"
+#define LOADER_MANIFEST_CACHE_FORMAT_VERSION 2
+#define LOADER_MANIFEST_CACHE_FILE_NAME "loader_manifest_cache.bin"
+// Anything larger than this is not something the loader wrote
+#define LOADER_MANIFEST_CACHE_MAX_FILE_SIZE (64 * 1024 * 1024)
+
+// Everything in the header must match for the file contents to be used, a cache written by a different loader build is discarded
+// rather than interpreted. Entries hold the manifest contents one field at a time, never raw copies of loader structures, so the
+// file can't hand the loader pointers or unterminated strings.
+struct loader_manifest_cache_file_header {
+    char magic[8];
+    uint32_t format_version;
+    uint32_t header_version;
+    uint32_t entry_count;
+    uint32_t reserved;
+};
+
+struct loader_manifest_cache_entry_header {
+    uint32_t kind;
+    uint32_t path_size;  // Includes the null terminator
+    uint32_t payload_size;
+    uint32_t reserved;
+    uint64_t device;
+    uint64_t inode;
+    uint64_t size;
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+};
+
+struct loader_manifest_cache_entry {
+    struct loader_manifest_cache_entry_header header;
+    const char *path;
+    const uint8_t *payload;
+    uint8_t *owned_data;  // Only set for entries added during this scan, holds both the path and the payload
+    bool removed;
+};
+
+struct loader_manifest_cache {
+    // Manifests may be parsed on several threads at once, so lookups and new entries go through this lock
+    loader_platform_thread_mutex lock;
+    char directory[MAX_STRING_SIZE];
+    char file_path[MAX_STRING_SIZE];
+    uint8_t *file_data;
+    struct loader_manifest_cache_entry *entries;
+    uint32_t entry_count;
+    uint32_t entry_capacity;
+    bool dirty;
+};
+
+// Growable byte buffer used to build up entry payloads
+struct loader_manifest_cache_writer {
+    const struct loader_instance *inst;
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+    VkResult result;
+};
+
+struct loader_manifest_cache_reader {
+    const uint8_t *data;
+    size_t size;
+    size_t offset;
+};
+
+static void cache_write(struct loader_manifest_cache_writer *writer, const void *data, size_t size) {
+    if (VK_SUCCESS != writer->result) {
+        return;
+    }
+    if (writer->size + size > writer->capacity) {
+        size_t new_capacity = writer->capacity == 0 ? 4096 : writer->capacity;
+        while (writer->size + size > new_capacity) {
+            new_capacity *= 2;
+        }
+        void *new_ptr = loader_instance_heap_realloc(writer->inst, writer->data, writer->capacity, new_capacity,
+                                                     VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (NULL == new_ptr) {
+            writer->result = VK_ERROR_OUT_OF_HOST_MEMORY;
+            return;
+        }
+        writer->data = new_ptr;
+        writer->capacity = new_capacity;
+    }
+    memcpy(writer->data + writer->size, data, size);
+    writer->size += size;
+}
+
+static void cache_write_u32(struct loader_manifest_cache_writer *writer, uint32_t value) {
+    cache_write(writer, &value, sizeof(value));
+}
+
+static void cache_write_string(struct loader_manifest_cache_writer *writer, const char *str) {
+    uint32_t size = (uint32_t)strlen(str) + 1;
+    cache_write_u32(writer, size);
+    cache_write(writer, str, size);
+}
+
+// Writes the contents of a fixed size char array, stopping at the end of the array if it isn't terminated
+static void cache_write_char_array(struct loader_manifest_cache_writer *writer, const char *str, size_t array_size) {
+    size_t length = 0;
+    while (length < array_size - 1 && str[length] != '\0') {
+        length++;
+    }
+    cache_write_u32(writer, (uint32_t)length + 1);
+    cache_write(writer, str, length);
+    cache_write(writer, "", 1);
+}
+
+static void cache_write_string_array(struct loader_manifest_cache_writer *writer, char (*strings)[MAX_STRING_SIZE],
+                                     uint32_t count) {
+    cache_write_u32(writer, count);
+    for (uint32_t i = 0; i < count; i++) {
+        cache_write_char_array(writer, strings[i], MAX_STRING_SIZE);
+    }
+}
+
+static void cache_write_extension(struct loader_manifest_cache_writer *writer, const VkExtensionProperties *ext_prop) {
+    cache_write_char_array(writer, ext_prop->extensionName, sizeof(ext_prop->extensionName));
+    cache_write_u32(writer, ext_prop->specVersion);
+}
+
+static bool cache_read(struct loader_manifest_cache_reader *reader, void *data, size_t size) {
+    if (size > reader->size - reader->offset) {
+        return false;
+    }
+    memcpy(data, reader->data + reader->offset, size);
+    reader->offset += size;
+    return true;
+}
+
+static bool cache_read_u32(struct loader_manifest_cache_reader *reader, uint32_t *value) {
+    return cache_read(reader, value, sizeof(*value));
+}
+
+static bool cache_read_bool(struct loader_manifest_cache_reader *reader, bool *value) {
+    uint32_t stored = 0;
+    if (!cache_read_u32(reader, &stored)) {
+        return false;
+    }
+    *value = stored != 0;
+    return true;
+}
+
+// Returns a pointer into the reader's data, which is valid for as long as the cache is open
+static const char *cache_read_string(struct loader_manifest_cache_reader *reader) {
+    uint32_t size = 0;
+    if (!cache_read_u32(reader, &size) || size == 0 || size > reader->size - reader->offset) {
+        return NULL;
+    }
+    const char *str = (const char *)(reader->data + reader->offset);
+    if (str[size - 1] != '\0') {
+        return NULL;
+    }
+    reader->offset += size;
+    return str;
+}
+
+// Copies a string into a fixed size char array, which is always left null terminated
+static bool cache_read_char_array(struct loader_manifest_cache_reader *reader, char *str, size_t array_size) {
+    const char *stored = cache_read_string(reader);
+    if (NULL == stored) {
+        return false;
+    }
+    strncpy(str, stored, array_size - 1);
+    str[array_size - 1] = '\0';
+    return true;
+}
+
+static bool cache_read_extension(struct loader_manifest_cache_reader *reader, VkExtensionProperties *ext_prop) {
+    memset(ext_prop, 0, sizeof(VkExtensionProperties));
+    return cache_read_char_array(reader, ext_prop->extensionName, sizeof(ext_prop->extensionName)) &&
+           cache_read_u32(reader, &ext_prop->specVersion);
+}
+
+static VkResult cache_read_string_array(const struct loader_instance *inst, struct loader_manifest_cache_reader *reader,
+                                        uint32_t *out_count, char (**out_strings)[MAX_STRING_SIZE]) {
+    uint32_t count = 0;
+    if (!cache_read_u32(reader, &count)) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    if (count == 0) {
+        return VK_SUCCESS;
+    }
+    // Every string takes at least five bytes, reject counts that can't possibly fit before allocating
+    if (count > (reader->size - reader->offset) / 5) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    char(*strings)[MAX_STRING_SIZE] =
+        loader_instance_heap_calloc(inst, sizeof(char[MAX_STRING_SIZE]) * count, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == strings) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (!cache_read_char_array(reader, strings[i], MAX_STRING_SIZE)) {
+            loader_instance_heap_free(inst, strings);
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+    }
+    *out_count = count;
+    *out_strings = strings;
+    return VK_SUCCESS;
+}
+
+static bool cache_key_matches(const struct loader_manifest_cache_entry_header *header,
+                              const struct loader_manifest_cache_key *key) {
+    return header->device == key->device && header->inode == key->inode && header->size == key->size &&
+           header->mtime_sec == key->mtime_sec && header->mtime_nsec == key->mtime_nsec;
+}
+
+// Finds the entry for the given key. An entry for the same file that no longer matches is dropped.
+static struct loader_manifest_cache_entry *cache_find_entry(struct loader_manifest_cache *cache,
+                                                           const struct loader_manifest_cache_key *key) {
+    for (uint32_t i = 0; i < cache->entry_count; i++) {
+        struct loader_manifest_cache_entry *entry = &cache->entries[i];
+        if (entry->removed || entry->header.kind != (uint32_t)key->kind || strcmp(entry->path, key->path) != 0) {
+            continue;
+        }
+        if (cache_key_matches(&entry->header, key)) {
+            return entry;
+        }
+        entry->removed = true;
+        cache->dirty = true;
+    }
+    return NULL;
+}
+
+static VkResult cache_add_entry(const struct loader_instance *inst, struct loader_manifest_cache *cache,
+                                const struct loader_manifest_cache_key *key, const uint8_t *payload, size_t payload_size) {
+    size_t path_size = strlen(key->path) + 1;
+    if (path_size > UINT32_MAX || payload_size > UINT32_MAX) {
+        return VK_SUCCESS;
+    }
+
+    // Anything stored for the same file is out of date now
+    for (uint32_t i = 0; i < cache->entry_count; i++) {
+        struct loader_manifest_cache_entry *entry = &cache->entries[i];
+        if (!entry->removed && entry->header.kind == (uint32_t)key->kind && strcmp(entry->path, key->path) == 0) {
+            entry->removed = true;
+        }
+    }
+
+    if (cache->entry_count == cache->entry_capacity) {
+        uint32_t new_capacity = cache->entry_capacity == 0 ? 32 : cache->entry_capacity * 2;
+        void *new_ptr = loader_instance_heap_realloc(inst, cache->entries,
+                                                     sizeof(struct loader_manifest_cache_entry) * cache->entry_capacity,
+                                                     sizeof(struct loader_manifest_cache_entry) * new_capacity,
+                                                     VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (NULL == new_ptr) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        cache->entries = new_ptr;
+        cache->entry_capacity = new_capacity;
+    }
+
+    uint8_t *data = loader_instance_heap_alloc(inst, path_size + payload_size, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == data) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    memcpy(data, key->path, path_size);
+    if (payload_size > 0) {
+        memcpy(data + path_size, payload, payload_size);
+    }
+
+    struct loader_manifest_cache_entry *entry = &cache->entries[cache->entry_count++];
+    memset(entry, 0, sizeof(struct loader_manifest_cache_entry));
+    entry->header.kind = (uint32_t)key->kind;
+    entry->header.path_size = (uint32_t)path_size;
+    entry->header.payload_size = (uint32_t)payload_size;
+    entry->header.device = key->device;
+    entry->header.inode = key->inode;
+    entry->header.size = key->size;
+    entry->header.mtime_sec = key->mtime_sec;
+    entry->header.mtime_nsec = key->mtime_nsec;
+    entry->path = (const char *)data;
+    entry->payload = data + path_size;
+    entry->owned_data = data;
+    cache->dirty = true;
+    return VK_SUCCESS;
+}
+
+static void cache_fill_file_header(struct loader_manifest_cache_file_header *header) {
+    memset(header, 0, sizeof(struct loader_manifest_cache_file_header));
+    memcpy(header->magic, LOADER_MANIFEST_CACHE_MAGIC, sizeof(header->magic));
+    header->format_version = LOADER_MANIFEST_CACHE_FORMAT_VERSION;
+    header->header_version = VK_HEADER_VERSION_COMPLETE;
+}
+
+#if defined(LOADER_MANIFEST_CACHE_SUPPORTED)
+
+// Reads the existing cache file, if there is one. Any problem with the file results in an empty cache.
+static void cache_load_file(const struct loader_instance *inst, struct loader_manifest_cache *cache) {
+    FILE *file = fopen(cache->file_path, "rb");
+    if (NULL == file) {
+        return;
+    }
+    struct stat file_stat;
+    if (fstat(fileno(file), &file_stat) != 0 || file_stat.st_size <= 0 || file_stat.st_size > LOADER_MANIFEST_CACHE_MAX_FILE_SIZE) {
+        goto out;
+    }
+    size_t file_size = (size_t)file_stat.st_size;
+    cache->file_data = loader_instance_heap_alloc(inst, file_size, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == cache->file_data || fread(cache->file_data, 1, file_size, file) != file_size) {
+        goto out;
+    }
+
+    struct loader_manifest_cache_reader reader = {cache->file_data, file_size, 0};
+    struct loader_manifest_cache_file_header expected_header, header;
+    cache_fill_file_header(&expected_header);
+    if (!cache_read(&reader, &header, sizeof(header))) {
+        goto out;
+    }
+    uint32_t entry_count = header.entry_count;
+    header.entry_count = 0;
+    if (memcmp(&header, &expected_header, sizeof(header)) != 0 ||
+        entry_count > file_size / sizeof(struct loader_manifest_cache_entry_header)) {
+        loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "Ignoring manifest cache %s written by a different loader build",
+                   cache->file_path);
+        goto out;
+    }
+    if (entry_count == 0) {
+        goto out;
+    }
+
+    cache->entries = loader_instance_heap_calloc(inst, sizeof(struct loader_manifest_cache_entry) * entry_count,
+                                                 VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == cache->entries) {
+        goto out;
+    }
+    cache->entry_capacity = entry_count;
+    for (uint32_t i = 0; i < entry_count; i++) {
+        struct loader_manifest_cache_entry *entry = &cache->entries[i];
+        if (!cache_read(&reader, &entry->header, sizeof(entry->header)) || entry->header.path_size == 0 ||
+            entry->header.path_size > file_size - reader.offset ||
+            entry->header.payload_size > file_size - reader.offset - entry->header.path_size) {
+            goto corrupt;
+        }
+        entry->path = (const char *)(reader.data + reader.offset);
+        reader.offset += entry->header.path_size;
+        entry->payload = reader.data + reader.offset;
+        reader.offset += entry->header.payload_size;
+        if (entry->path[entry->header.path_size - 1] != '\0') {
+            goto corrupt;
+        }
+    }
+    cache->entry_count = entry_count;
+    goto out;
+
+corrupt:
+    loader_log(inst, VULKAN_LOADER_WARN_BIT, 0, "Manifest cache %s is corrupt and will be rebuilt", cache->file_path);
+    loader_instance_heap_free(inst, cache->entries);
+    cache->entries = NULL;
+    cache->entry_capacity = 0;
+    cache->dirty = true;
+
+out:
+    fclose(file);
+}
+
+// Writes the cache out to a temporary file which then replaces the cache file, so that concurrent readers never see a partial
+// cache.
+static void cache_write_file(const struct loader_instance *inst, struct loader_manifest_cache *cache) {
+    char temp_path[MAX_STRING_SIZE];
+    struct loader_manifest_cache_file_header header;
+    FILE *file = NULL;
+    bool success = true;
+
+    // Create the cache directory, along with its parent in the $HOME/.cache case
+    char *parent_end = strrchr(cache->directory, '/');
+    if (NULL != parent_end && parent_end != cache->directory) {
+        *parent_end = '\0';
+        mkdir(cache->directory, S_IRWXU);
+        *parent_end = '/';
+    }
+    mkdir(cache->directory, S_IRWXU);
+
+    if ((size_t)snprintf(temp_path, sizeof(temp_path), "%s.%d.tmp", cache->file_path, (int)getpid()) >= sizeof(temp_path)) {
+        return;
+    }
+    file = fopen(temp_path, "wb");
+    if (NULL == file) {
+        loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "Unable to write manifest cache %s", temp_path);
+        return;
+    }
+
+    cache_fill_file_header(&header);
+    for (uint32_t i = 0; i < cache->entry_count; i++) {
+        if (!cache->entries[i].removed) {
+            header.entry_count++;
+        }
+    }
+    success = fwrite(&header, sizeof(header), 1, file) == 1;
+    for (uint32_t i = 0; success && i < cache->entry_count; i++) {
+        const struct loader_manifest_cache_entry *entry = &cache->entries[i];
+        if (entry->removed) {
+            continue;
+        }
+        success = fwrite(&entry->header, sizeof(entry->header), 1, file) == 1 &&
+                  fwrite(entry->path, 1, entry->header.path_size, file) == entry->header.path_size &&
+                  fwrite(entry->payload, 1, entry->header.payload_size, file) == entry->header.payload_size;
+    }
+    if (fclose(file) != 0) {
+        success = false;
+    }
+    if (!success || rename(temp_path, cache->file_path) != 0) {
+        loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "Unable to write manifest cache %s", cache->file_path);
+        remove(temp_path);
+    }
+}
+
+#endif  // LOADER_MANIFEST_CACHE_SUPPORTED
+
+struct loader_manifest_cache *loader_manifest_cache_open(const struct loader_instance *inst) {
+#if defined(LOADER_MANIFEST_CACHE_SUPPORTED)
+    struct loader_manifest_cache *cache = NULL;
+    char *enable = loader_secure_getenv("VK_LOADER_MANIFEST_CACHE", inst);
+    char *xdg_cache_home = NULL;
+    char *home = NULL;
+    int written = -1;
+
+    if (NULL == enable || strcmp(enable, "1") != 0) {
+        goto out;
+    }
+
+    cache = loader_instance_heap_calloc(inst, sizeof(struct loader_manifest_cache), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == cache) {
+        goto out;
+    }
+
+    xdg_cache_home = loader_secure_getenv("XDG_CACHE_HOME", inst);
+    if (NULL != xdg_cache_home && xdg_cache_home[0] == '/') {
+        written = snprintf(cache->directory, sizeof(cache->directory), "%s/vulkan", xdg_cache_home);
+    } else {
+        home = loader_secure_getenv("HOME", inst);
+        if (NULL != home && home[0] == '/') {
+            written = snprintf(cache->directory, sizeof(cache->directory), "%s/.cache/vulkan", home);
+        }
+    }
+    if (written < 0 || (size_t)written >= sizeof(cache->directory)) {
+        loader_instance_heap_free(inst, cache);
+        cache = NULL;
+        goto out;
+    }
+    written = snprintf(cache->file_path, sizeof(cache->file_path), "%s/%s", cache->directory, LOADER_MANIFEST_CACHE_FILE_NAME);
+    if (written < 0 || (size_t)written >= sizeof(cache->file_path)) {
+        loader_instance_heap_free(inst, cache);
+        cache = NULL;
+        goto out;
+    }
+
+    loader_platform_thread_create_mutex(&cache->lock);
+    cache_load_file(inst, cache);
+    loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "Using manifest cache %s (%u entries)", cache->file_path, cache->entry_count);
+
+out:
+    loader_free_getenv(home, inst);
+    loader_free_getenv(xdg_cache_home, inst);
+    loader_free_getenv(enable, inst);
+    return cache;
+#else
+    (void)inst;
+    return NULL;
+#endif
+}
+
+void loader_manifest_cache_close(const struct loader_instance *inst, struct loader_manifest_cache *cache) {
+    if (NULL == cache) {
+        return;
+    }
+#if defined(LOADER_MANIFEST_CACHE_SUPPORTED)
+    if (cache->dirty) {
+        cache_write_file(inst, cache);
+    }
+#endif
+    for (uint32_t i = 0; i < cache->entry_count; i++) {
+        loader_instance_heap_free(inst, cache->entries[i].owned_data);
+    }
+    loader_instance_heap_free(inst, cache->entries);
+    loader_instance_heap_free(inst, cache->file_data);
+    loader_platform_thread_delete_mutex(&cache->lock);
+    loader_instance_heap_free(inst, cache);
+}
+
+struct loader_manifest_cache *loader_manifest_cache_acquire(const struct loader_instance *inst) {
+    if (NULL != inst && NULL != inst->manifest_cache) {
+        return inst->manifest_cache;
+    }
+    return loader_manifest_cache_open(inst);
+}
+
+void loader_manifest_cache_release(const struct loader_instance *inst, struct loader_manifest_cache *cache) {
+    if (NULL != inst && cache == inst->manifest_cache) {
+        return;
+    }
+    loader_manifest_cache_close(inst, cache);
+}
+
+bool loader_manifest_cache_get_key(const char *path, enum loader_manifest_cache_kind kind, struct loader_manifest_cache_key *key) {
+#if defined(LOADER_MANIFEST_CACHE_SUPPORTED)
+    // Go through open rather than stat so the identity is that of the file the manifest is actually read from
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat file_stat;
+    int ret = fstat(fd, &file_stat);
+    close(fd);
+    if (ret != 0) {
+        return false;
+    }
+    memset(key, 0, sizeof(struct loader_manifest_cache_key));
+    key->path = path;
+    key->kind = kind;
+    key->device = (uint64_t)file_stat.st_dev;
+    key->inode = (uint64_t)file_stat.st_ino;
+    key->size = (uint64_t)file_stat.st_size;
+    key->mtime_sec = (int64_t)file_stat.st_mtime;
+#if defined(__APPLE__)
+    key->mtime_nsec = (int64_t)file_stat.st_mtimespec.tv_nsec;
+#elif defined(__linux__) || defined(__Fuchsia__) || defined(__FreeBSD__)
+    key->mtime_nsec = (int64_t)file_stat.st_mtim.tv_nsec;
+#endif
+    return true;
+#else
+    (void)path;
+    (void)kind;
+    (void)key;
+    return false;
+#endif
+}
+
+// Only the decoded manifest contents are stored, nothing that is filled in once the layer library is loaded. Every field is written
+// on its own so that neither pointers nor uninitialized padding end up in the file.
+static void cache_write_layer(struct loader_manifest_cache_writer *writer, const struct loader_layer_properties *props) {
+    cache_write_char_array(writer, props->info.layerName, sizeof(props->info.layerName));
+    cache_write_u32(writer, props->info.specVersion);
+    cache_write_u32(writer, props->info.implementationVersion);
+    cache_write_char_array(writer, props->info.description, sizeof(props->info.description));
+    cache_write_u32(writer, (uint32_t)props->type_flags);
+    cache_write_u32(writer, props->interface_version);
+    cache_write_char_array(writer, props->manifest_file_name, sizeof(props->manifest_file_name));
+    cache_write_char_array(writer, props->lib_name, sizeof(props->lib_name));
+    cache_write_char_array(writer, props->functions.str_gipa, sizeof(props->functions.str_gipa));
+    cache_write_char_array(writer, props->functions.str_gdpa, sizeof(props->functions.str_gdpa));
+    cache_write_char_array(writer, props->functions.str_negotiate_interface, sizeof(props->functions.str_negotiate_interface));
+    cache_write_char_array(writer, props->disable_env_var.name, sizeof(props->disable_env_var.name));
+    cache_write_char_array(writer, props->disable_env_var.value, sizeof(props->disable_env_var.value));
+    cache_write_char_array(writer, props->enable_env_var.name, sizeof(props->enable_env_var.name));
+    cache_write_char_array(writer, props->enable_env_var.value, sizeof(props->enable_env_var.value));
+    cache_write_char_array(writer, props->pre_instance_functions.enumerate_instance_extension_properties,
+                           sizeof(props->pre_instance_functions.enumerate_instance_extension_properties));
+    cache_write_char_array(writer, props->pre_instance_functions.enumerate_instance_layer_properties,
+                           sizeof(props->pre_instance_functions.enumerate_instance_layer_properties));
+    cache_write_char_array(writer, props->pre_instance_functions.enumerate_instance_version,
+                           sizeof(props->pre_instance_functions.enumerate_instance_version));
+    cache_write_u32(writer, props->is_override);
+    cache_write_u32(writer, props->has_expiration);
+    cache_write_u32(writer, props->expiration.year);
+    cache_write_u32(writer, props->expiration.month);
+    cache_write_u32(writer, props->expiration.day);
+    cache_write_u32(writer, props->expiration.hour);
+    cache_write_u32(writer, props->expiration.minute);
+
+    cache_write_u32(writer, props->instance_extension_list.count);
+    for (uint32_t j = 0; j < props->instance_extension_list.count; j++) {
+        cache_write_extension(writer, &props->instance_extension_list.list[j]);
+    }
+    cache_write_u32(writer, props->device_extension_list.count);
+    for (uint32_t j = 0; j < props->device_extension_list.count; j++) {
+        const struct loader_dev_ext_props *dev_ext = &props->device_extension_list.list[j];
+        cache_write_extension(writer, &dev_ext->props);
+        cache_write_u32(writer, dev_ext->entrypoint_count);
+        for (uint32_t k = 0; k < dev_ext->entrypoint_count; k++) {
+            cache_write_string(writer, dev_ext->entrypoints[k]);
+        }
+    }
+    cache_write_string_array(writer, props->component_layer_names, props->num_component_layers);
+    cache_write_string_array(writer, props->override_paths, props->num_override_paths);
+    cache_write_string_array(writer, props->blacklist_layer_names, props->num_blacklist_layers);
+    cache_write_string_array(writer, props->app_key_paths, props->num_app_key_paths);
+}
+
+// Reads the fields written by cache_write_layer up to the extension lists into zeroed properties. Everything else, in particular
+// the library handle and function pointers, is left cleared no matter what the file contains.
+static bool cache_read_layer_fields(struct loader_manifest_cache_reader *reader, struct loader_layer_properties *props) {
+    uint32_t type_flags = 0;
+    uint32_t expiration[5] = {0};
+    if (!cache_read_char_array(reader, props->info.layerName, sizeof(props->info.layerName)) ||
+        !cache_read_u32(reader, &props->info.specVersion) || !cache_read_u32(reader, &props->info.implementationVersion) ||
+        !cache_read_char_array(reader, props->info.description, sizeof(props->info.description)) ||
+        !cache_read_u32(reader, &type_flags) || !cache_read_u32(reader, &props->interface_version) ||
+        !cache_read_char_array(reader, props->manifest_file_name, sizeof(props->manifest_file_name)) ||
+        !cache_read_char_array(reader, props->lib_name, sizeof(props->lib_name)) ||
+        !cache_read_char_array(reader, props->functions.str_gipa, sizeof(props->functions.str_gipa)) ||
+        !cache_read_char_array(reader, props->functions.str_gdpa, sizeof(props->functions.str_gdpa)) ||
+        !cache_read_char_array(reader, props->functions.str_negotiate_interface,
+                               sizeof(props->functions.str_negotiate_interface)) ||
+        !cache_read_char_array(reader, props->disable_env_var.name, sizeof(props->disable_env_var.name)) ||
+        !cache_read_char_array(reader, props->disable_env_var.value, sizeof(props->disable_env_var.value)) ||
+        !cache_read_char_array(reader, props->enable_env_var.name, sizeof(props->enable_env_var.name)) ||
+        !cache_read_char_array(reader, props->enable_env_var.value, sizeof(props->enable_env_var.value)) ||
+        !cache_read_char_array(reader, props->pre_instance_functions.enumerate_instance_extension_properties,
+                               sizeof(props->pre_instance_functions.enumerate_instance_extension_properties)) ||
+        !cache_read_char_array(reader, props->pre_instance_functions.enumerate_instance_layer_properties,
+                               sizeof(props->pre_instance_functions.enumerate_instance_layer_properties)) ||
+        !cache_read_char_array(reader, props->pre_instance_functions.enumerate_instance_version,
+                               sizeof(props->pre_instance_functions.enumerate_instance_version)) ||
+        !cache_read_bool(reader, &props->is_override) || !cache_read_bool(reader, &props->has_expiration)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < 5; i++) {
+        if (!cache_read_u32(reader, &expiration[i])) {
+            return false;
+        }
+    }
+    type_flags &= VK_LAYER_TYPE_FLAG_INSTANCE_LAYER | VK_LAYER_TYPE_FLAG_EXPLICIT_LAYER | VK_LAYER_TYPE_FLAG_META_LAYER;
+    props->type_flags = (enum layer_type_flags)type_flags;
+    props->lib_status = LOADER_LAYER_LIB_NOT_LOADED;
+    props->expiration.year = (uint16_t)expiration[0];
+    props->expiration.month = (uint8_t)expiration[1];
+    props->expiration.day = (uint8_t)expiration[2];
+    props->expiration.hour = (uint8_t)expiration[3];
+    props->expiration.minute = (uint8_t)expiration[4];
+    return true;
+}
+
+VkResult loader_manifest_cache_find_layers(const struct loader_instance *inst, struct loader_manifest_cache *cache,
+                                           const struct loader_manifest_cache_key *key, struct loader_layer_list *layer_list,
+                                           bool *found) {
+    VkResult res = VK_SUCCESS;
+    uint32_t first_new_layer = layer_list->count;
+    uint32_t layer_count = 0;
+
+    *found = false;
+    loader_platform_thread_lock_mutex(&cache->lock);
+    struct loader_manifest_cache_entry *entry = cache_find_entry(cache, key);
+    if (NULL == entry) {
+        goto out;
+    }
+
+    struct loader_manifest_cache_reader reader = {entry->payload, entry->header.payload_size, 0};
+    if (!cache_read_u32(&reader, &layer_count)) {
+        res = VK_ERROR_INITIALIZATION_FAILED;
+        goto out;
+    }
+    for (uint32_t i = 0; i < layer_count; i++) {
+        struct loader_layer_properties *props = loader_get_next_layer_property_slot(inst, layer_list);
+        if (NULL == props) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+            goto out;
+        }
+        memset(props, 0, sizeof(struct loader_layer_properties));
+        if (!cache_read_layer_fields(&reader, props)) {
+            res = VK_ERROR_INITIALIZATION_FAILED;
+            goto out;
+        }
+
+        uint32_t instance_extension_count = 0;
+        if (!cache_read_u32(&reader, &instance_extension_count)) {
+            res = VK_ERROR_INITIALIZATION_FAILED;
+            goto out;
+        }
+        for (uint32_t j = 0; j < instance_extension_count; j++) {
+            VkExtensionProperties ext_prop;
+            if (!cache_read_extension(&reader, &ext_prop)) {
+                res = VK_ERROR_INITIALIZATION_FAILED;
+                goto out;
+            }
+            res = loader_add_to_ext_list(inst, &props->instance_extension_list, 1, &ext_prop);
+            if (VK_SUCCESS != res) {
+                goto out;
+            }
+        }
+
+        uint32_t device_extension_count = 0;
+        if (!cache_read_u32(&reader, &device_extension_count)) {
+            res = VK_ERROR_INITIALIZATION_FAILED;
+            goto out;
+        }
+        for (uint32_t j = 0; j < device_extension_count; j++) {
+            VkExtensionProperties ext_prop;
+            uint32_t entrypoint_count = 0;
+            if (!cache_read_extension(&reader, &ext_prop) || !cache_read_u32(&reader, &entrypoint_count) ||
+                entrypoint_count > (reader.size - reader.offset) / 5) {
+                res = VK_ERROR_INITIALIZATION_FAILED;
+                goto out;
+            }
+            // The count comes from the file, so the array goes on the heap rather than the stack
+            char **entrypoints = NULL;
+            if (entrypoint_count > 0) {
+                entrypoints =
+                    loader_instance_heap_alloc(inst, sizeof(char *) * entrypoint_count, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+                if (NULL == entrypoints) {
+                    res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                    goto out;
+                }
+                for (uint32_t k = 0; k < entrypoint_count; k++) {
+                    entrypoints[k] = (char *)cache_read_string(&reader);
+                    if (NULL == entrypoints[k]) {
+                        res = VK_ERROR_INITIALIZATION_FAILED;
+                        break;
+                    }
+                }
+            }
+            if (VK_SUCCESS == res) {
+                res = loader_add_to_dev_ext_list(inst, &props->device_extension_list, &ext_prop, entrypoint_count, entrypoints);
+            }
+            loader_instance_heap_free(inst, entrypoints);
+            if (VK_SUCCESS != res) {
+                goto out;
+            }
+        }
+
+        res = cache_read_string_array(inst, &reader, &props->num_component_layers, &props->component_layer_names);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+        res = cache_read_string_array(inst, &reader, &props->num_override_paths, &props->override_paths);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+        res = cache_read_string_array(inst, &reader, &props->num_blacklist_layers, &props->blacklist_layer_names);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+        res = cache_read_string_array(inst, &reader, &props->num_app_key_paths, &props->app_key_paths);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+    }
+    *found = true;
+
+out:
+    if (VK_SUCCESS != res) {
+        // Undo any partially read layers. A damaged entry is dropped and gets parsed again, only running out of memory is an error.
+        for (uint32_t i = first_new_layer; i < layer_list->count; i++) {
+            loader_free_layer_properties(inst, &layer_list->list[i]);
+        }
+        layer_list->count = first_new_layer;
+        if (VK_ERROR_OUT_OF_HOST_MEMORY != res) {
+            entry->removed = true;
+            cache->dirty = true;
+            res = VK_SUCCESS;
+        }
+    }
+    loader_platform_thread_unlock_mutex(&cache->lock);
+    return res;
+}
+
+VkResult loader_manifest_cache_store_layers(const struct loader_instance *inst, struct loader_manifest_cache *cache,
+                                            const struct loader_manifest_cache_key *key,
+                                            const struct loader_layer_properties *layers, uint32_t layer_count) {
+    struct loader_manifest_cache_writer writer = {inst, NULL, 0, 0, VK_SUCCESS};
+
+    cache_write_u32(&writer, layer_count);
+    for (uint32_t i = 0; i < layer_count; i++) {
+        cache_write_layer(&writer, &layers[i]);
+    }
+
+    VkResult res = writer.result;
+    if (VK_SUCCESS == res) {
+        loader_platform_thread_lock_mutex(&cache->lock);
+        res = cache_add_entry(inst, cache, key, writer.data, writer.size);
+        loader_platform_thread_unlock_mutex(&cache->lock);
+    }
+    loader_instance_heap_free(inst, writer.data);
+    return res;
+}
+
+bool loader_manifest_cache_find_driver(struct loader_manifest_cache *cache, const struct loader_manifest_cache_key *key,
+                                       struct loader_icd_manifest *icd_manifest) {
+    bool found = false;
+    loader_platform_thread_lock_mutex(&cache->lock);
+    struct loader_manifest_cache_entry *entry = cache_find_entry(cache, key);
+    if (NULL != entry) {
+        struct loader_manifest_cache_reader reader = {entry->payload, entry->header.payload_size, 0};
+        uint32_t library_arch = 0;
+        memset(icd_manifest, 0, sizeof(struct loader_icd_manifest));
+        if (cache_read_char_array(&reader, icd_manifest->library_path, sizeof(icd_manifest->library_path)) &&
+            cache_read_u32(&reader, &icd_manifest->api_version) && cache_read_bool(&reader, &icd_manifest->is_portability_driver) &&
+            cache_read_u32(&reader, &library_arch) && reader.offset == reader.size) {
+            icd_manifest->library_arch = (uint8_t)library_arch;
+            found = true;
+        } else {
+            memset(icd_manifest, 0, sizeof(struct loader_icd_manifest));
+            entry->removed = true;
+            cache->dirty = true;
+        }
+    }
+    loader_platform_thread_unlock_mutex(&cache->lock);
+    return found;
+}
+
+VkResult loader_manifest_cache_store_driver(const struct loader_instance *inst, struct loader_manifest_cache *cache,
+                                            const struct loader_manifest_cache_key *key,
+                                            const struct loader_icd_manifest *icd_manifest) {
+    struct loader_manifest_cache_writer writer = {inst, NULL, 0, 0, VK_SUCCESS};
+    cache_write_char_array(&writer, icd_manifest->library_path, sizeof(icd_manifest->library_path));
+    cache_write_u32(&writer, icd_manifest->api_version);
+    cache_write_u32(&writer, icd_manifest->is_portability_driver);
+    cache_write_u32(&writer, icd_manifest->library_arch);
+
+    VkResult res = writer.result;
+    if (VK_SUCCESS == res) {
+        loader_platform_thread_lock_mutex(&cache->lock);
+        res = cache_add_entry(inst, cache, key, writer.data, writer.size);
+        loader_platform_thread_unlock_mutex(&cache->lock);
+    }
+    loader_instance_heap_free(inst, writer.data);
+    return res;
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "loader_common.h"
+
+// Optional on-disk cache of already decoded manifest files.
+//
+// When VK_LOADER_MANIFEST_CACHE is set to 1, the decoded contents of every driver and layer manifest file are stored in
+// $XDG_CACHE_HOME/vulkan/loader_manifest_cache.bin (or $HOME/.cache/vulkan/ if XDG_CACHE_HOME is not set). Each entry is
+// keyed by the manifest path together with the device, inode, size, and modification time of the file, so editing,
+// replacing, or touching a manifest file invalidates its entry. A cache hit skips reading and parsing the JSON entirely.
+//
+// A cache is opened at the start of a manifest scan and closed at the end of it, at which point any new entries are written
+// back. vkCreateInstance keeps one cache open across all of its scans, so that the file is only read and written once per
+// call. Nothing is kept in memory between calls.
+
+enum loader_manifest_cache_kind {
+    LOADER_MANIFEST_CACHE_KIND_DRIVER = 1,
+    LOADER_MANIFEST_CACHE_KIND_IMPLICIT_LAYER = 2,
+    LOADER_MANIFEST_CACHE_KIND_EXPLICIT_LAYER = 3,
+};
+
+// Identity of a manifest file on disk
+struct loader_manifest_cache_key {
+    const char *path;
+    enum loader_manifest_cache_kind kind;
+    uint64_t device;
+    uint64_t inode;
+    uint64_t size;
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+};
+
+struct loader_manifest_cache;
+
+// Returns NULL if the cache is disabled, unsupported on this platform, or could not be set up.
+struct loader_manifest_cache *loader_manifest_cache_open(const struct loader_instance *inst);
+
+// Writes any new entries back to disk and frees the cache.
+void loader_manifest_cache_close(const struct loader_instance *inst, struct loader_manifest_cache *cache);
+
+// Returns the cache inst holds open during vkCreateInstance if there is one, otherwise opens a new one. Every acquire must be
+// paired with a release, which only closes the cache if it was opened by the acquire.
+struct loader_manifest_cache *loader_manifest_cache_acquire(const struct loader_instance *inst);
+void loader_manifest_cache_release(const struct loader_instance *inst, struct loader_manifest_cache *cache);
+
+// Fill out the key for the manifest at path. Returns false if the file can't be examined, in which case it shouldn't be cached.
+bool loader_manifest_cache_get_key(const char *path, enum loader_manifest_cache_kind kind, struct loader_manifest_cache_key *key);
+
+// Appends the layers previously stored for key to layer_list. found is set to false on a cache miss.
+VkResult loader_manifest_cache_find_layers(const struct loader_instance *inst, struct loader_manifest_cache *cache,
+                                           const struct loader_manifest_cache_key *key, struct loader_layer_list *layer_list,
+                                           bool *found);
+
+// Records the layers decoded out of the manifest identified by key. layer_count may be zero for manifests with no valid layers.
+VkResult loader_manifest_cache_store_layers(const struct loader_instance *inst, struct loader_manifest_cache *cache,
+                                            const struct loader_manifest_cache_key *key,
+                                            const struct loader_layer_properties *layers, uint32_t layer_count);
+
+bool loader_manifest_cache_find_driver(struct loader_manifest_cache *cache, const struct loader_manifest_cache_key *key,
+                                       struct loader_icd_manifest *icd_manifest);
+
+VkResult loader_manifest_cache_store_driver(const struct loader_instance *inst, struct loader_manifest_cache *cache,
+                                            const struct loader_manifest_cache_key *key,
+                                            const struct loader_icd_manifest *icd_manifest);
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "manifest_watch.h"
+
+#include <string.h>
+
+#include "allocation.h"
+#include "get_environment.h"
+#include "log.h"
+
+#if defined(__linux__)
+#include <errno.h>
+#include <limits.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#define LOADER_MANIFEST_WATCH_SUPPORTED 1
+#endif
+
+#if defined(LOADER_MANIFEST_WATCH_SUPPORTED)
+
+// Anything which could change the result of a search. IN_MASK_ADD keeps the events requested by earlier watches on the same
+// directory, which may have been added for a different reason.
+#define LOADER_MANIFEST_WATCH_MASK                                                                                      \
+    (IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | \
+     IN_MOVE_SELF | IN_MASK_ADD)
+
+// Result of an earlier search for one type of manifest
+struct loader_manifest_watch_files {
+    char *search_path;
+    uint64_t generation;
+    uint32_t count;
+    char **filename_list;
+};
+
+static struct {
+    loader_platform_thread_mutex lock;
+    int fd;
+    bool init_failed;
+    uint64_t generation;
+    struct loader_manifest_watch_files files[LOADER_DATA_FILE_NUM_TYPES];
+} manifest_watch;
+
+static void loader_manifest_watch_clear_files(struct loader_manifest_watch_files *files) {
+    for (uint32_t i = 0; i < files->count; i++) {
+        loader_instance_heap_free(NULL, files->filename_list[i]);
+    }
+    loader_instance_heap_free(NULL, files->filename_list);
+    loader_instance_heap_free(NULL, files->search_path);
+    memset(files, 0, sizeof(struct loader_manifest_watch_files));
+}
+
+static char *loader_manifest_watch_copy_string(const char *str) {
+    size_t size = strlen(str) + 1;
+    char *copy = loader_instance_heap_alloc(NULL, size, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL != copy) {
+        memcpy(copy, str, size);
+    }
+    return copy;
+}
+
+// Watch path, or if it doesn't exist, the closest parent directory which does so that its creation is noticed.
+// Must be called with manifest_watch.lock held.
+static void loader_manifest_watch_add_locked(const struct loader_instance *inst, const char *path, size_t path_len) {
+    char watch_path[PATH_MAX];
+    if (path_len == 0 || path_len >= sizeof(watch_path)) {
+        return;
+    }
+    memcpy(watch_path, path, path_len);
+    watch_path[path_len] = '\0';
+
+    while (true) {
+        if (inotify_add_watch(manifest_watch.fd, watch_path, LOADER_MANIFEST_WATCH_MASK) >= 0) {
+            return;
+        }
+        if (errno != ENOENT && errno != ENOTDIR) {
+            loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "Unable to watch %s for changes to manifest files", watch_path);
+            return;
+        }
+        char *last_separator = strrchr(watch_path, DIRECTORY_SYMBOL);
+        if (NULL == last_separator) {
+            // A relative path with nothing left to strip, so watch the working directory
+            if (strcmp(watch_path, ".") == 0) {
+                return;
+            }
+            strcpy(watch_path, ".");
+        } else if (last_separator == watch_path) {
+            if (watch_path[1] == '\0') {
+                return;
+            }
+            watch_path[1] = '\0';
+        } else {
+            *last_separator = '\0';
+        }
+    }
+}
+
+#endif  // LOADER_MANIFEST_WATCH_SUPPORTED
+
+void loader_manifest_watch_initialize(void) {
+#if defined(LOADER_MANIFEST_WATCH_SUPPORTED)
+    loader_platform_thread_create_mutex(&manifest_watch.lock);
+    manifest_watch.fd = -1;
+#endif
+}
+
+void loader_manifest_watch_release(void) {
+#if defined(LOADER_MANIFEST_WATCH_SUPPORTED)
+    if (manifest_watch.fd >= 0) {
+        close(manifest_watch.fd);
+        manifest_watch.fd = -1;
+    }
+    for (uint32_t i = 0; i < LOADER_DATA_FILE_NUM_TYPES; i++) {
+        loader_manifest_watch_clear_files(&manifest_watch.files[i]);
+    }
+    loader_platform_thread_delete_mutex(&manifest_watch.lock);
+#endif
+}
+
+bool loader_manifest_watch_poll(const struct loader_instance *inst, uint64_t *generation) {
+#if defined(LOADER_MANIFEST_WATCH_SUPPORTED)
+    bool watching = false;
+    char *enable = loader_secure_getenv("VK_LOADER_MANIFEST_WATCH", inst);
+    if (NULL == enable || strcmp(enable, "1") != 0) {
+        goto out;
+    }
+
+    loader_platform_thread_lock_mutex(&manifest_watch.lock);
+    if (manifest_watch.fd < 0 && !manifest_watch.init_failed) {
+        manifest_watch.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (manifest_watch.fd < 0) {
+            manifest_watch.init_failed = true;
+            loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
+                       "loader_manifest_watch_poll: Unable to watch for changes to manifest files");
+        }
+    }
+    if (manifest_watch.fd >= 0) {
+        // The contents of the events don't matter, only whether there were any. This includes IN_Q_OVERFLOW, after which
+        // nothing can be trusted anymore, and IN_IGNORED, which means something that was watched no longer exists.
+        char events[4096];
+        while (true) {
+            ssize_t read_count = read(manifest_watch.fd, events, sizeof(events));
+            if (read_count > 0) {
+                manifest_watch.generation++;
+                continue;
+            }
+            if (read_count < 0 && errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        *generation = manifest_watch.generation;
+        watching = true;
+    }
+    loader_platform_thread_unlock_mutex(&manifest_watch.lock);
+
+out:
+    loader_free_getenv(enable, inst);
+    return watching;
+#else
+    (void)inst;
+    (void)generation;
+    return false;
+#endif
+}
+
+void loader_manifest_watch_add_search_path(const struct loader_instance *inst, const char *search_path) {
+#if defined(LOADER_MANIFEST_WATCH_SUPPORTED)
+    loader_platform_thread_lock_mutex(&manifest_watch.lock);
+    if (manifest_watch.fd >= 0) {
+        const char *cur = search_path;
+        while (*cur != '\0') {
+            const char *end = strchr(cur, PATH_SEPARATOR);
+            size_t len = NULL != end ? (size_t)(end - cur) : strlen(cur);
+            loader_manifest_watch_add_locked(inst, cur, len);
+            cur += len;
+            if (*cur == PATH_SEPARATOR) {
+                cur++;
+            }
+        }
+    }
+    loader_platform_thread_unlock_mutex(&manifest_watch.lock);
+#else
+    (void)inst;
+    (void)search_path;
+#endif
+}
+
+void loader_manifest_watch_add_path(const struct loader_instance *inst, const char *path) {
+#if defined(LOADER_MANIFEST_WATCH_SUPPORTED)
+    loader_platform_thread_lock_mutex(&manifest_watch.lock);
+    if (manifest_watch.fd >= 0) {
+        loader_manifest_watch_add_locked(inst, path, strlen(path));
+    }
+    loader_platform_thread_unlock_mutex(&manifest_watch.lock);
+#else
+    (void)inst;
+    (void)path;
+#endif
+}
+
+VkResult loader_manifest_watch_find_files(const struct loader_instance *inst, enum loader_data_files_type manifest_type,
+                                          const char *search_path, uint64_t generation, struct loader_data_files *out_files,
+                                          bool *found) {
+    *found = false;
+#if defined(LOADER_MANIFEST_WATCH_SUPPORTED)
+    VkResult res = VK_SUCCESS;
+    char **filename_list = NULL;
+    uint32_t count = 0;
+
+    loader_platform_thread_lock_mutex(&manifest_watch.lock);
+    const struct loader_manifest_watch_files *files = &manifest_watch.files[manifest_type];
+    if (NULL == files->search_path || files->generation != generation || strcmp(files->search_path, search_path) != 0) {
+        goto out;
+    }
+
+    if (files->count > 0) {
+        filename_list = loader_instance_heap_calloc(inst, sizeof(char *) * files->count, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (NULL == filename_list) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+            goto out;
+        }
+        for (count = 0; count < files->count; count++) {
+            size_t size = strlen(files->filename_list[count]) + 1;
+            filename_list[count] = loader_instance_heap_alloc(inst, size, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+            if (NULL == filename_list[count]) {
+                res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                goto out;
+            }
+            memcpy(filename_list[count], files->filename_list[count], size);
+        }
+    }
+
+    out_files->count = count;
+    out_files->alloc_count = count;
+    out_files->filename_list = filename_list;
+    filename_list = NULL;
+    *found = true;
+
+out:
+    loader_platform_thread_unlock_mutex(&manifest_watch.lock);
+    if (NULL != filename_list) {
+        for (uint32_t i = 0; i < count; i++) {
+            loader_instance_heap_free(inst, filename_list[i]);
+        }
+        loader_instance_heap_free(inst, filename_list);
+    }
+    return res;
+#else
+    (void)inst;
+    (void)manifest_type;
+    (void)search_path;
+    (void)generation;
+    (void)out_files;
+    return VK_SUCCESS;
+#endif
+}
+
+void loader_manifest_watch_store_files(enum loader_data_files_type manifest_type, const char *search_path, uint64_t generation,
+                                       const struct loader_data_files *files) {
+#if defined(LOADER_MANIFEST_WATCH_SUPPORTED)
+    struct loader_manifest_watch_files stored;
+    memset(&stored, 0, sizeof(stored));
+    stored.generation = generation;
+    stored.search_path = loader_manifest_watch_copy_string(search_path);
+    if (NULL == stored.search_path) {
+        goto out;
+    }
+    if (files->count > 0) {
+        stored.filename_list =
+            loader_instance_heap_calloc(NULL, sizeof(char *) * files->count, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == stored.filename_list) {
+            goto out;
+        }
+        for (; stored.count < files->count; stored.count++) {
+            stored.filename_list[stored.count] = loader_manifest_watch_copy_string(files->filename_list[stored.count]);
+            if (NULL == stored.filename_list[stored.count]) {
+                goto out;
+            }
+        }
+    }
+
+    loader_platform_thread_lock_mutex(&manifest_watch.lock);
+    struct loader_manifest_watch_files previous = manifest_watch.files[manifest_type];
+    manifest_watch.files[manifest_type] = stored;
+    loader_platform_thread_unlock_mutex(&manifest_watch.lock);
+    stored = previous;
+
+out:
+    loader_manifest_watch_clear_files(&stored);
+#else
+    (void)manifest_type;
+    (void)search_path;
+    (void)generation;
+    (void)files;
+#endif
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "loader_common.h"
+
+// Optional change tracking for the places manifest files are searched for.
+//
+// When VK_LOADER_MANIFEST_WATCH is set to 1 on Linux, every directory and manifest file visited while searching for manifests
+// is watched with inotify. Directories which don't exist are covered by watching their closest existing parent. Any change to a
+// watched path bumps a process wide generation counter, which lets cached discovery results be reused for as long as the
+// generation they were built in is still current, without looking at the file system again.
+//
+// The list of manifest files found by each kind of search is cached this way, keyed by the search path it came from. The
+// implicit layer cache used before an instance is created also relies on it to skip reading the manifests again.
+
+void loader_manifest_watch_initialize(void);
+
+// Stops watching and forgets every cached search
+void loader_manifest_watch_release(void);
+
+// Returns false if watching is disabled or unavailable. Otherwise handles any pending change notifications and returns the
+// current generation in *generation.
+bool loader_manifest_watch_poll(const struct loader_instance *inst, uint64_t *generation);
+
+// Watch every directory or file in search_path, a list of paths separated by PATH_SEPARATOR. This needs to happen before the
+// paths are read so that no change can go unnoticed.
+void loader_manifest_watch_add_search_path(const struct loader_instance *inst, const char *search_path);
+
+// Watch a single directory or file
+void loader_manifest_watch_add_path(const struct loader_instance *inst, const char *path);
+
+// Copy the files previously found for the same kind of search through search_path into out_files. found is set to false if
+// there's no such search, or if anything changed since it was made.
+VkResult loader_manifest_watch_find_files(const struct loader_instance *inst, enum loader_data_files_type manifest_type,
+                                          const char *search_path, uint64_t generation, struct loader_data_files *out_files,
+                                          bool *found);
+
+// Remember the files found by a search which started in generation
+void loader_manifest_watch_store_files(enum loader_data_files_type manifest_type, const char *search_path, uint64_t generation,
+                                       const struct loader_data_files *files);
@@ -285,6 +285,756 @@ VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp246(VkPhysicalDevice);
 VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp247(VkPhysicalDevice);
 VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp248(VkPhysicalDevice);
 VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp249(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp250(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp251(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp252(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp253(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp254(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp255(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp256(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp257(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp258(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp259(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp260(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp261(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp262(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp263(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp264(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp265(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp266(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp267(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp268(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp269(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp270(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp271(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp272(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp273(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp274(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp275(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp276(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp277(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp278(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp279(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp280(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp281(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp282(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp283(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp284(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp285(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp286(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp287(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp288(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp289(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp290(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp291(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp292(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp293(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp294(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp295(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp296(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp297(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp298(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp299(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp300(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp301(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp302(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp303(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp304(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp305(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp306(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp307(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp308(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp309(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp310(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp311(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp312(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp313(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp314(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp315(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp316(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp317(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp318(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp319(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp320(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp321(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp322(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp323(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp324(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp325(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp326(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp327(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp328(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp329(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp330(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp331(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp332(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp333(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp334(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp335(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp336(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp337(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp338(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp339(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp340(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp341(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp342(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp343(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp344(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp345(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp346(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp347(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp348(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp349(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp350(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp351(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp352(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp353(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp354(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp355(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp356(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp357(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp358(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp359(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp360(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp361(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp362(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp363(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp364(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp365(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp366(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp367(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp368(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp369(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp370(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp371(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp372(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp373(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp374(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp375(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp376(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp377(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp378(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp379(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp380(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp381(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp382(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp383(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp384(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp385(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp386(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp387(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp388(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp389(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp390(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp391(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp392(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp393(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp394(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp395(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp396(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp397(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp398(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp399(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp400(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp401(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp402(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp403(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp404(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp405(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp406(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp407(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp408(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp409(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp410(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp411(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp412(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp413(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp414(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp415(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp416(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp417(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp418(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp419(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp420(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp421(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp422(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp423(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp424(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp425(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp426(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp427(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp428(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp429(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp430(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp431(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp432(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp433(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp434(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp435(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp436(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp437(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp438(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp439(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp440(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp441(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp442(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp443(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp444(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp445(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp446(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp447(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp448(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp449(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp450(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp451(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp452(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp453(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp454(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp455(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp456(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp457(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp458(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp459(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp460(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp461(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp462(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp463(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp464(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp465(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp466(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp467(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp468(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp469(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp470(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp471(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp472(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp473(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp474(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp475(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp476(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp477(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp478(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp479(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp480(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp481(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp482(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp483(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp484(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp485(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp486(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp487(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp488(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp489(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp490(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp491(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp492(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp493(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp494(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp495(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp496(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp497(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp498(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp499(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp500(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp501(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp502(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp503(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp504(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp505(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp506(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp507(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp508(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp509(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp510(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp511(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp512(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp513(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp514(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp515(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp516(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp517(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp518(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp519(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp520(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp521(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp522(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp523(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp524(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp525(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp526(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp527(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp528(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp529(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp530(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp531(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp532(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp533(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp534(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp535(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp536(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp537(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp538(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp539(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp540(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp541(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp542(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp543(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp544(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp545(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp546(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp547(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp548(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp549(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp550(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp551(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp552(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp553(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp554(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp555(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp556(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp557(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp558(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp559(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp560(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp561(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp562(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp563(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp564(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp565(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp566(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp567(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp568(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp569(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp570(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp571(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp572(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp573(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp574(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp575(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp576(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp577(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp578(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp579(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp580(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp581(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp582(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp583(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp584(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp585(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp586(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp587(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp588(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp589(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp590(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp591(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp592(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp593(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp594(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp595(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp596(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp597(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp598(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp599(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp600(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp601(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp602(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp603(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp604(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp605(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp606(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp607(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp608(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp609(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp610(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp611(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp612(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp613(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp614(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp615(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp616(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp617(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp618(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp619(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp620(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp621(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp622(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp623(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp624(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp625(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp626(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp627(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp628(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp629(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp630(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp631(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp632(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp633(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp634(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp635(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp636(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp637(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp638(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp639(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp640(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp641(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp642(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp643(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp644(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp645(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp646(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp647(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp648(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp649(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp650(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp651(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp652(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp653(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp654(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp655(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp656(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp657(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp658(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp659(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp660(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp661(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp662(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp663(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp664(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp665(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp666(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp667(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp668(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp669(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp670(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp671(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp672(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp673(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp674(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp675(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp676(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp677(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp678(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp679(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp680(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp681(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp682(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp683(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp684(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp685(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp686(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp687(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp688(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp689(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp690(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp691(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp692(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp693(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp694(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp695(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp696(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp697(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp698(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp699(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp700(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp701(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp702(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp703(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp704(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp705(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp706(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp707(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp708(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp709(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp710(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp711(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp712(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp713(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp714(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp715(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp716(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp717(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp718(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp719(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp720(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp721(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp722(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp723(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp724(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp725(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp726(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp727(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp728(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp729(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp730(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp731(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp732(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp733(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp734(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp735(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp736(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp737(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp738(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp739(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp740(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp741(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp742(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp743(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp744(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp745(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp746(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp747(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp748(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp749(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp750(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp751(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp752(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp753(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp754(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp755(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp756(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp757(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp758(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp759(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp760(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp761(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp762(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp763(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp764(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp765(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp766(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp767(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp768(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp769(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp770(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp771(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp772(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp773(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp774(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp775(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp776(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp777(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp778(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp779(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp780(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp781(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp782(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp783(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp784(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp785(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp786(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp787(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp788(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp789(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp790(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp791(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp792(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp793(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp794(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp795(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp796(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp797(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp798(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp799(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp800(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp801(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp802(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp803(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp804(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp805(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp806(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp807(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp808(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp809(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp810(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp811(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp812(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp813(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp814(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp815(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp816(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp817(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp818(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp819(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp820(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp821(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp822(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp823(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp824(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp825(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp826(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp827(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp828(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp829(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp830(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp831(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp832(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp833(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp834(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp835(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp836(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp837(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp838(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp839(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp840(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp841(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp842(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp843(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp844(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp845(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp846(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp847(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp848(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp849(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp850(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp851(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp852(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp853(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp854(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp855(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp856(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp857(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp858(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp859(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp860(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp861(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp862(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp863(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp864(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp865(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp866(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp867(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp868(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp869(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp870(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp871(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp872(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp873(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp874(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp875(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp876(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp877(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp878(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp879(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp880(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp881(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp882(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp883(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp884(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp885(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp886(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp887(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp888(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp889(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp890(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp891(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp892(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp893(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp894(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp895(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp896(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp897(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp898(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp899(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp900(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp901(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp902(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp903(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp904(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp905(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp906(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp907(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp908(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp909(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp910(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp911(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp912(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp913(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp914(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp915(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp916(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp917(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp918(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp919(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp920(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp921(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp922(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp923(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp924(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp925(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp926(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp927(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp928(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp929(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp930(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp931(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp932(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp933(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp934(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp935(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp936(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp937(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp938(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp939(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp940(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp941(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp942(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp943(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp944(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp945(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp946(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp947(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp948(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp949(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp950(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp951(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp952(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp953(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp954(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp955(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp956(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp957(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp958(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp959(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp960(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp961(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp962(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp963(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp964(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp965(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp966(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp967(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp968(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp969(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp970(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp971(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp972(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp973(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp974(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp975(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp976(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp977(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp978(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp979(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp980(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp981(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp982(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp983(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp984(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp985(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp986(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp987(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp988(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp989(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp990(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp991(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp992(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp993(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp994(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp995(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp996(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp997(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp998(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTramp999(VkPhysicalDevice);
 
 // Disable clang-format for lists of macros
 // clang-format off
@@ -539,6 +1289,756 @@ VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin246(VkPhysicalDevice);
 VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin247(VkPhysicalDevice);
 VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin248(VkPhysicalDevice);
 VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin249(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin250(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin251(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin252(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin253(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin254(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin255(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin256(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin257(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin258(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin259(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin260(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin261(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin262(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin263(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin264(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin265(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin266(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin267(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin268(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin269(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin270(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin271(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin272(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin273(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin274(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin275(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin276(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin277(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin278(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin279(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin280(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin281(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin282(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin283(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin284(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin285(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin286(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin287(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin288(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin289(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin290(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin291(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin292(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin293(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin294(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin295(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin296(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin297(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin298(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin299(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin300(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin301(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin302(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin303(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin304(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin305(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin306(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin307(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin308(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin309(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin310(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin311(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin312(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin313(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin314(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin315(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin316(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin317(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin318(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin319(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin320(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin321(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin322(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin323(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin324(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin325(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin326(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin327(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin328(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin329(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin330(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin331(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin332(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin333(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin334(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin335(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin336(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin337(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin338(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin339(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin340(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin341(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin342(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin343(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin344(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin345(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin346(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin347(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin348(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin349(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin350(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin351(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin352(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin353(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin354(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin355(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin356(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin357(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin358(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin359(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin360(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin361(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin362(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin363(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin364(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin365(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin366(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin367(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin368(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin369(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin370(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin371(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin372(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin373(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin374(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin375(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin376(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin377(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin378(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin379(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin380(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin381(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin382(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin383(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin384(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin385(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin386(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin387(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin388(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin389(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin390(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin391(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin392(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin393(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin394(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin395(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin396(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin397(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin398(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin399(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin400(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin401(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin402(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin403(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin404(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin405(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin406(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin407(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin408(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin409(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin410(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin411(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin412(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin413(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin414(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin415(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin416(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin417(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin418(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin419(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin420(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin421(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin422(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin423(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin424(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin425(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin426(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin427(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin428(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin429(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin430(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin431(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin432(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin433(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin434(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin435(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin436(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin437(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin438(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin439(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin440(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin441(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin442(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin443(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin444(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin445(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin446(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin447(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin448(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin449(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin450(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin451(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin452(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin453(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin454(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin455(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin456(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin457(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin458(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin459(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin460(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin461(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin462(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin463(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin464(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin465(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin466(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin467(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin468(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin469(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin470(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin471(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin472(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin473(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin474(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin475(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin476(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin477(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin478(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin479(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin480(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin481(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin482(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin483(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin484(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin485(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin486(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin487(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin488(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin489(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin490(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin491(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin492(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin493(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin494(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin495(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin496(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin497(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin498(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin499(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin500(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin501(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin502(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin503(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin504(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin505(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin506(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin507(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin508(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin509(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin510(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin511(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin512(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin513(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin514(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin515(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin516(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin517(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin518(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin519(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin520(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin521(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin522(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin523(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin524(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin525(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin526(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin527(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin528(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin529(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin530(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin531(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin532(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin533(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin534(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin535(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin536(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin537(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin538(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin539(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin540(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin541(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin542(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin543(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin544(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin545(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin546(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin547(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin548(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin549(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin550(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin551(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin552(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin553(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin554(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin555(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin556(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin557(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin558(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin559(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin560(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin561(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin562(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin563(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin564(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin565(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin566(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin567(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin568(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin569(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin570(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin571(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin572(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin573(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin574(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin575(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin576(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin577(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin578(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin579(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin580(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin581(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin582(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin583(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin584(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin585(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin586(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin587(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin588(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin589(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin590(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin591(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin592(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin593(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin594(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin595(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin596(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin597(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin598(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin599(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin600(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin601(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin602(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin603(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin604(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin605(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin606(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin607(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin608(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin609(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin610(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin611(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin612(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin613(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin614(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin615(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin616(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin617(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin618(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin619(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin620(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin621(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin622(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin623(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin624(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin625(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin626(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin627(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin628(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin629(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin630(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin631(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin632(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin633(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin634(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin635(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin636(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin637(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin638(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin639(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin640(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin641(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin642(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin643(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin644(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin645(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin646(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin647(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin648(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin649(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin650(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin651(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin652(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin653(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin654(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin655(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin656(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin657(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin658(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin659(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin660(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin661(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin662(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin663(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin664(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin665(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin666(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin667(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin668(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin669(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin670(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin671(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin672(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin673(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin674(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin675(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin676(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin677(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin678(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin679(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin680(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin681(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin682(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin683(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin684(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin685(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin686(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin687(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin688(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin689(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin690(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin691(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin692(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin693(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin694(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin695(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin696(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin697(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin698(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin699(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin700(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin701(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin702(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin703(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin704(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin705(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin706(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin707(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin708(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin709(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin710(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin711(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin712(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin713(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin714(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin715(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin716(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin717(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin718(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin719(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin720(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin721(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin722(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin723(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin724(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin725(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin726(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin727(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin728(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin729(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin730(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin731(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin732(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin733(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin734(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin735(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin736(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin737(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin738(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin739(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin740(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin741(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin742(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin743(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin744(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin745(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin746(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin747(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin748(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin749(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin750(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin751(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin752(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin753(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin754(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin755(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin756(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin757(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin758(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin759(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin760(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin761(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin762(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin763(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin764(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin765(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin766(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin767(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin768(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin769(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin770(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin771(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin772(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin773(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin774(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin775(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin776(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin777(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin778(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin779(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin780(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin781(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin782(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin783(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin784(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin785(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin786(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin787(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin788(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin789(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin790(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin791(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin792(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin793(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin794(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin795(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin796(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin797(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin798(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin799(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin800(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin801(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin802(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin803(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin804(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin805(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin806(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin807(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin808(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin809(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin810(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin811(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin812(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin813(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin814(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin815(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin816(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin817(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin818(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin819(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin820(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin821(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin822(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin823(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin824(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin825(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin826(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin827(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin828(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin829(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin830(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin831(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin832(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin833(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin834(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin835(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin836(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin837(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin838(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin839(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin840(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin841(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin842(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin843(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin844(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin845(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin846(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin847(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin848(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin849(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin850(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin851(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin852(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin853(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin854(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin855(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin856(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin857(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin858(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin859(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin860(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin861(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin862(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin863(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin864(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin865(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin866(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin867(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin868(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin869(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin870(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin871(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin872(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin873(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin874(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin875(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin876(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin877(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin878(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin879(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin880(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin881(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin882(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin883(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin884(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin885(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin886(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin887(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin888(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin889(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin890(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin891(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin892(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin893(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin894(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin895(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin896(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin897(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin898(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin899(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin900(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin901(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin902(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin903(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin904(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin905(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin906(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin907(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin908(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin909(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin910(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin911(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin912(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin913(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin914(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin915(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin916(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin917(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin918(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin919(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin920(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin921(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin922(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin923(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin924(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin925(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin926(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin927(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin928(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin929(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin930(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin931(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin932(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin933(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin934(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin935(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin936(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin937(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin938(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin939(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin940(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin941(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin942(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin943(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin944(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin945(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin946(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin947(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin948(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin949(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin950(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin951(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin952(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin953(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin954(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin955(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin956(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin957(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin958(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin959(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin960(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin961(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin962(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin963(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin964(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin965(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin966(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin967(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin968(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin969(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin970(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin971(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin972(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin973(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin974(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin975(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin976(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin977(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin978(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin979(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin980(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin981(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin982(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin983(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin984(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin985(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin986(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin987(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin988(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin989(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin990(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin991(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin992(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin993(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin994(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin995(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin996(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin997(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin998(VkPhysicalDevice);
+VKAPI_ATTR void VKAPI_CALL vkPhysDevExtTermin999(VkPhysicalDevice);
 
 
 void *loader_get_phys_dev_ext_tramp(uint32_t index) {
@@ -794,6 +2294,756 @@ void *loader_get_phys_dev_ext_tramp(uint32_t index) {
         TRAMP_CASE_HANDLE(247);
         TRAMP_CASE_HANDLE(248);
         TRAMP_CASE_HANDLE(249);
+        TRAMP_CASE_HANDLE(250);
+        TRAMP_CASE_HANDLE(251);
+        TRAMP_CASE_HANDLE(252);
+        TRAMP_CASE_HANDLE(253);
+        TRAMP_CASE_HANDLE(254);
+        TRAMP_CASE_HANDLE(255);
+        TRAMP_CASE_HANDLE(256);
+        TRAMP_CASE_HANDLE(257);
+        TRAMP_CASE_HANDLE(258);
+        TRAMP_CASE_HANDLE(259);
+        TRAMP_CASE_HANDLE(260);
+        TRAMP_CASE_HANDLE(261);
+        TRAMP_CASE_HANDLE(262);
+        TRAMP_CASE_HANDLE(263);
+        TRAMP_CASE_HANDLE(264);
+        TRAMP_CASE_HANDLE(265);
+        TRAMP_CASE_HANDLE(266);
+        TRAMP_CASE_HANDLE(267);
+        TRAMP_CASE_HANDLE(268);
+        TRAMP_CASE_HANDLE(269);
+        TRAMP_CASE_HANDLE(270);
+        TRAMP_CASE_HANDLE(271);
+        TRAMP_CASE_HANDLE(272);
+        TRAMP_CASE_HANDLE(273);
+        TRAMP_CASE_HANDLE(274);
+        TRAMP_CASE_HANDLE(275);
+        TRAMP_CASE_HANDLE(276);
+        TRAMP_CASE_HANDLE(277);
+        TRAMP_CASE_HANDLE(278);
+        TRAMP_CASE_HANDLE(279);
+        TRAMP_CASE_HANDLE(280);
+        TRAMP_CASE_HANDLE(281);
+        TRAMP_CASE_HANDLE(282);
+        TRAMP_CASE_HANDLE(283);
+        TRAMP_CASE_HANDLE(284);
+        TRAMP_CASE_HANDLE(285);
+        TRAMP_CASE_HANDLE(286);
+        TRAMP_CASE_HANDLE(287);
+        TRAMP_CASE_HANDLE(288);
+        TRAMP_CASE_HANDLE(289);
+        TRAMP_CASE_HANDLE(290);
+        TRAMP_CASE_HANDLE(291);
+        TRAMP_CASE_HANDLE(292);
+        TRAMP_CASE_HANDLE(293);
+        TRAMP_CASE_HANDLE(294);
+        TRAMP_CASE_HANDLE(295);
+        TRAMP_CASE_HANDLE(296);
+        TRAMP_CASE_HANDLE(297);
+        TRAMP_CASE_HANDLE(298);
+        TRAMP_CASE_HANDLE(299);
+        TRAMP_CASE_HANDLE(300);
+        TRAMP_CASE_HANDLE(301);
+        TRAMP_CASE_HANDLE(302);
+        TRAMP_CASE_HANDLE(303);
+        TRAMP_CASE_HANDLE(304);
+        TRAMP_CASE_HANDLE(305);
+        TRAMP_CASE_HANDLE(306);
+        TRAMP_CASE_HANDLE(307);
+        TRAMP_CASE_HANDLE(308);
+        TRAMP_CASE_HANDLE(309);
+        TRAMP_CASE_HANDLE(310);
+        TRAMP_CASE_HANDLE(311);
+        TRAMP_CASE_HANDLE(312);
+        TRAMP_CASE_HANDLE(313);
+        TRAMP_CASE_HANDLE(314);
+        TRAMP_CASE_HANDLE(315);
+        TRAMP_CASE_HANDLE(316);
+        TRAMP_CASE_HANDLE(317);
+        TRAMP_CASE_HANDLE(318);
+        TRAMP_CASE_HANDLE(319);
+        TRAMP_CASE_HANDLE(320);
+        TRAMP_CASE_HANDLE(321);
+        TRAMP_CASE_HANDLE(322);
+        TRAMP_CASE_HANDLE(323);
+        TRAMP_CASE_HANDLE(324);
+        TRAMP_CASE_HANDLE(325);
+        TRAMP_CASE_HANDLE(326);
+        TRAMP_CASE_HANDLE(327);
+        TRAMP_CASE_HANDLE(328);
+        TRAMP_CASE_HANDLE(329);
+        TRAMP_CASE_HANDLE(330);
+        TRAMP_CASE_HANDLE(331);
+        TRAMP_CASE_HANDLE(332);
+        TRAMP_CASE_HANDLE(333);
+        TRAMP_CASE_HANDLE(334);
+        TRAMP_CASE_HANDLE(335);
+        TRAMP_CASE_HANDLE(336);
+        TRAMP_CASE_HANDLE(337);
+        TRAMP_CASE_HANDLE(338);
+        TRAMP_CASE_HANDLE(339);
+        TRAMP_CASE_HANDLE(340);
+        TRAMP_CASE_HANDLE(341);
+        TRAMP_CASE_HANDLE(342);
+        TRAMP_CASE_HANDLE(343);
+        TRAMP_CASE_HANDLE(344);
+        TRAMP_CASE_HANDLE(345);
+        TRAMP_CASE_HANDLE(346);
+        TRAMP_CASE_HANDLE(347);
+        TRAMP_CASE_HANDLE(348);
+        TRAMP_CASE_HANDLE(349);
+        TRAMP_CASE_HANDLE(350);
+        TRAMP_CASE_HANDLE(351);
+        TRAMP_CASE_HANDLE(352);
+        TRAMP_CASE_HANDLE(353);
+        TRAMP_CASE_HANDLE(354);
+        TRAMP_CASE_HANDLE(355);
+        TRAMP_CASE_HANDLE(356);
+        TRAMP_CASE_HANDLE(357);
+        TRAMP_CASE_HANDLE(358);
+        TRAMP_CASE_HANDLE(359);
+        TRAMP_CASE_HANDLE(360);
+        TRAMP_CASE_HANDLE(361);
+        TRAMP_CASE_HANDLE(362);
+        TRAMP_CASE_HANDLE(363);
+        TRAMP_CASE_HANDLE(364);
+        TRAMP_CASE_HANDLE(365);
+        TRAMP_CASE_HANDLE(366);
+        TRAMP_CASE_HANDLE(367);
+        TRAMP_CASE_HANDLE(368);
+        TRAMP_CASE_HANDLE(369);
+        TRAMP_CASE_HANDLE(370);
+        TRAMP_CASE_HANDLE(371);
+        TRAMP_CASE_HANDLE(372);
+        TRAMP_CASE_HANDLE(373);
+        TRAMP_CASE_HANDLE(374);
+        TRAMP_CASE_HANDLE(375);
+        TRAMP_CASE_HANDLE(376);
+        TRAMP_CASE_HANDLE(377);
+        TRAMP_CASE_HANDLE(378);
+        TRAMP_CASE_HANDLE(379);
+        TRAMP_CASE_HANDLE(380);
+        TRAMP_CASE_HANDLE(381);
+        TRAMP_CASE_HANDLE(382);
+        TRAMP_CASE_HANDLE(383);
+        TRAMP_CASE_HANDLE(384);
+        TRAMP_CASE_HANDLE(385);
+        TRAMP_CASE_HANDLE(386);
+        TRAMP_CASE_HANDLE(387);
+        TRAMP_CASE_HANDLE(388);
+        TRAMP_CASE_HANDLE(389);
+        TRAMP_CASE_HANDLE(390);
+        TRAMP_CASE_HANDLE(391);
+        TRAMP_CASE_HANDLE(392);
+        TRAMP_CASE_HANDLE(393);
+        TRAMP_CASE_HANDLE(394);
+        TRAMP_CASE_HANDLE(395);
+        TRAMP_CASE_HANDLE(396);
+        TRAMP_CASE_HANDLE(397);
+        TRAMP_CASE_HANDLE(398);
+        TRAMP_CASE_HANDLE(399);
+        TRAMP_CASE_HANDLE(400);
+        TRAMP_CASE_HANDLE(401);
+        TRAMP_CASE_HANDLE(402);
+        TRAMP_CASE_HANDLE(403);
+        TRAMP_CASE_HANDLE(404);
+        TRAMP_CASE_HANDLE(405);
+        TRAMP_CASE_HANDLE(406);
+        TRAMP_CASE_HANDLE(407);
+        TRAMP_CASE_HANDLE(408);
+        TRAMP_CASE_HANDLE(409);
+        TRAMP_CASE_HANDLE(410);
+        TRAMP_CASE_HANDLE(411);
+        TRAMP_CASE_HANDLE(412);
+        TRAMP_CASE_HANDLE(413);
+        TRAMP_CASE_HANDLE(414);
+        TRAMP_CASE_HANDLE(415);
+        TRAMP_CASE_HANDLE(416);
+        TRAMP_CASE_HANDLE(417);
+        TRAMP_CASE_HANDLE(418);
+        TRAMP_CASE_HANDLE(419);
+        TRAMP_CASE_HANDLE(420);
+        TRAMP_CASE_HANDLE(421);
+        TRAMP_CASE_HANDLE(422);
+        TRAMP_CASE_HANDLE(423);
+        TRAMP_CASE_HANDLE(424);
+        TRAMP_CASE_HANDLE(425);
+        TRAMP_CASE_HANDLE(426);
+        TRAMP_CASE_HANDLE(427);
+        TRAMP_CASE_HANDLE(428);
+        TRAMP_CASE_HANDLE(429);
+        TRAMP_CASE_HANDLE(430);
+        TRAMP_CASE_HANDLE(431);
+        TRAMP_CASE_HANDLE(432);
+        TRAMP_CASE_HANDLE(433);
+        TRAMP_CASE_HANDLE(434);
+        TRAMP_CASE_HANDLE(435);
+        TRAMP_CASE_HANDLE(436);
+        TRAMP_CASE_HANDLE(437);
+        TRAMP_CASE_HANDLE(438);
+        TRAMP_CASE_HANDLE(439);
+        TRAMP_CASE_HANDLE(440);
+        TRAMP_CASE_HANDLE(441);
+        TRAMP_CASE_HANDLE(442);
+        TRAMP_CASE_HANDLE(443);
+        TRAMP_CASE_HANDLE(444);
+        TRAMP_CASE_HANDLE(445);
+        TRAMP_CASE_HANDLE(446);
+        TRAMP_CASE_HANDLE(447);
+        TRAMP_CASE_HANDLE(448);
+        TRAMP_CASE_HANDLE(449);
+        TRAMP_CASE_HANDLE(450);
+        TRAMP_CASE_HANDLE(451);
+        TRAMP_CASE_HANDLE(452);
+        TRAMP_CASE_HANDLE(453);
+        TRAMP_CASE_HANDLE(454);
+        TRAMP_CASE_HANDLE(455);
+        TRAMP_CASE_HANDLE(456);
+        TRAMP_CASE_HANDLE(457);
+        TRAMP_CASE_HANDLE(458);
+        TRAMP_CASE_HANDLE(459);
+        TRAMP_CASE_HANDLE(460);
+        TRAMP_CASE_HANDLE(461);
+        TRAMP_CASE_HANDLE(462);
+        TRAMP_CASE_HANDLE(463);
+        TRAMP_CASE_HANDLE(464);
+        TRAMP_CASE_HANDLE(465);
+        TRAMP_CASE_HANDLE(466);
+        TRAMP_CASE_HANDLE(467);
+        TRAMP_CASE_HANDLE(468);
+        TRAMP_CASE_HANDLE(469);
+        TRAMP_CASE_HANDLE(470);
+        TRAMP_CASE_HANDLE(471);
+        TRAMP_CASE_HANDLE(472);
+        TRAMP_CASE_HANDLE(473);
+        TRAMP_CASE_HANDLE(474);
+        TRAMP_CASE_HANDLE(475);
+        TRAMP_CASE_HANDLE(476);
+        TRAMP_CASE_HANDLE(477);
+        TRAMP_CASE_HANDLE(478);
+        TRAMP_CASE_HANDLE(479);
+        TRAMP_CASE_HANDLE(480);
+        TRAMP_CASE_HANDLE(481);
+        TRAMP_CASE_HANDLE(482);
+        TRAMP_CASE_HANDLE(483);
+        TRAMP_CASE_HANDLE(484);
+        TRAMP_CASE_HANDLE(485);
+        TRAMP_CASE_HANDLE(486);
+        TRAMP_CASE_HANDLE(487);
+        TRAMP_CASE_HANDLE(488);
+        TRAMP_CASE_HANDLE(489);
+        TRAMP_CASE_HANDLE(490);
+        TRAMP_CASE_HANDLE(491);
+        TRAMP_CASE_HANDLE(492);
+        TRAMP_CASE_HANDLE(493);
+        TRAMP_CASE_HANDLE(494);
+        TRAMP_CASE_HANDLE(495);
+        TRAMP_CASE_HANDLE(496);
+        TRAMP_CASE_HANDLE(497);
+        TRAMP_CASE_HANDLE(498);
+        TRAMP_CASE_HANDLE(499);
+        TRAMP_CASE_HANDLE(500);
+        TRAMP_CASE_HANDLE(501);
+        TRAMP_CASE_HANDLE(502);
+        TRAMP_CASE_HANDLE(503);
+        TRAMP_CASE_HANDLE(504);
+        TRAMP_CASE_HANDLE(505);
+        TRAMP_CASE_HANDLE(506);
+        TRAMP_CASE_HANDLE(507);
+        TRAMP_CASE_HANDLE(508);
+        TRAMP_CASE_HANDLE(509);
+        TRAMP_CASE_HANDLE(510);
+        TRAMP_CASE_HANDLE(511);
+        TRAMP_CASE_HANDLE(512);
+        TRAMP_CASE_HANDLE(513);
+        TRAMP_CASE_HANDLE(514);
+        TRAMP_CASE_HANDLE(515);
+        TRAMP_CASE_HANDLE(516);
+        TRAMP_CASE_HANDLE(517);
+        TRAMP_CASE_HANDLE(518);
+        TRAMP_CASE_HANDLE(519);
+        TRAMP_CASE_HANDLE(520);
+        TRAMP_CASE_HANDLE(521);
+        TRAMP_CASE_HANDLE(522);
+        TRAMP_CASE_HANDLE(523);
+        TRAMP_CASE_HANDLE(524);
+        TRAMP_CASE_HANDLE(525);
+        TRAMP_CASE_HANDLE(526);
+        TRAMP_CASE_HANDLE(527);
+        TRAMP_CASE_HANDLE(528);
+        TRAMP_CASE_HANDLE(529);
+        TRAMP_CASE_HANDLE(530);
+        TRAMP_CASE_HANDLE(531);
+        TRAMP_CASE_HANDLE(532);
+        TRAMP_CASE_HANDLE(533);
+        TRAMP_CASE_HANDLE(534);
+        TRAMP_CASE_HANDLE(535);
+        TRAMP_CASE_HANDLE(536);
+        TRAMP_CASE_HANDLE(537);
+        TRAMP_CASE_HANDLE(538);
+        TRAMP_CASE_HANDLE(539);
+        TRAMP_CASE_HANDLE(540);
+        TRAMP_CASE_HANDLE(541);
+        TRAMP_CASE_HANDLE(542);
+        TRAMP_CASE_HANDLE(543);
+        TRAMP_CASE_HANDLE(544);
+        TRAMP_CASE_HANDLE(545);
+        TRAMP_CASE_HANDLE(546);
+        TRAMP_CASE_HANDLE(547);
+        TRAMP_CASE_HANDLE(548);
+        TRAMP_CASE_HANDLE(549);
+        TRAMP_CASE_HANDLE(550);
+        TRAMP_CASE_HANDLE(551);
+        TRAMP_CASE_HANDLE(552);
+        TRAMP_CASE_HANDLE(553);
+        TRAMP_CASE_HANDLE(554);
+        TRAMP_CASE_HANDLE(555);
+        TRAMP_CASE_HANDLE(556);
+        TRAMP_CASE_HANDLE(557);
+        TRAMP_CASE_HANDLE(558);
+        TRAMP_CASE_HANDLE(559);
+        TRAMP_CASE_HANDLE(560);
+        TRAMP_CASE_HANDLE(561);
+        TRAMP_CASE_HANDLE(562);
+        TRAMP_CASE_HANDLE(563);
+        TRAMP_CASE_HANDLE(564);
+        TRAMP_CASE_HANDLE(565);
+        TRAMP_CASE_HANDLE(566);
+        TRAMP_CASE_HANDLE(567);
+        TRAMP_CASE_HANDLE(568);
+        TRAMP_CASE_HANDLE(569);
+        TRAMP_CASE_HANDLE(570);
+        TRAMP_CASE_HANDLE(571);
+        TRAMP_CASE_HANDLE(572);
+        TRAMP_CASE_HANDLE(573);
+        TRAMP_CASE_HANDLE(574);
+        TRAMP_CASE_HANDLE(575);
+        TRAMP_CASE_HANDLE(576);
+        TRAMP_CASE_HANDLE(577);
+        TRAMP_CASE_HANDLE(578);
+        TRAMP_CASE_HANDLE(579);
+        TRAMP_CASE_HANDLE(580);
+        TRAMP_CASE_HANDLE(581);
+        TRAMP_CASE_HANDLE(582);
+        TRAMP_CASE_HANDLE(583);
+        TRAMP_CASE_HANDLE(584);
+        TRAMP_CASE_HANDLE(585);
+        TRAMP_CASE_HANDLE(586);
+        TRAMP_CASE_HANDLE(587);
+        TRAMP_CASE_HANDLE(588);
+        TRAMP_CASE_HANDLE(589);
+        TRAMP_CASE_HANDLE(590);
+        TRAMP_CASE_HANDLE(591);
+        TRAMP_CASE_HANDLE(592);
+        TRAMP_CASE_HANDLE(593);
+        TRAMP_CASE_HANDLE(594);
+        TRAMP_CASE_HANDLE(595);
+        TRAMP_CASE_HANDLE(596);
+        TRAMP_CASE_HANDLE(597);
+        TRAMP_CASE_HANDLE(598);
+        TRAMP_CASE_HANDLE(599);
+        TRAMP_CASE_HANDLE(600);
+        TRAMP_CASE_HANDLE(601);
+        TRAMP_CASE_HANDLE(602);
+        TRAMP_CASE_HANDLE(603);
+        TRAMP_CASE_HANDLE(604);
+        TRAMP_CASE_HANDLE(605);
+        TRAMP_CASE_HANDLE(606);
+        TRAMP_CASE_HANDLE(607);
+        TRAMP_CASE_HANDLE(608);
+        TRAMP_CASE_HANDLE(609);
+        TRAMP_CASE_HANDLE(610);
+        TRAMP_CASE_HANDLE(611);
+        TRAMP_CASE_HANDLE(612);
+        TRAMP_CASE_HANDLE(613);
+        TRAMP_CASE_HANDLE(614);
+        TRAMP_CASE_HANDLE(615);
+        TRAMP_CASE_HANDLE(616);
+        TRAMP_CASE_HANDLE(617);
+        TRAMP_CASE_HANDLE(618);
+        TRAMP_CASE_HANDLE(619);
+        TRAMP_CASE_HANDLE(620);
+        TRAMP_CASE_HANDLE(621);
+        TRAMP_CASE_HANDLE(622);
+        TRAMP_CASE_HANDLE(623);
+        TRAMP_CASE_HANDLE(624);
+        TRAMP_CASE_HANDLE(625);
+        TRAMP_CASE_HANDLE(626);
+        TRAMP_CASE_HANDLE(627);
+        TRAMP_CASE_HANDLE(628);
+        TRAMP_CASE_HANDLE(629);
+        TRAMP_CASE_HANDLE(630);
+        TRAMP_CASE_HANDLE(631);
+        TRAMP_CASE_HANDLE(632);
+        TRAMP_CASE_HANDLE(633);
+        TRAMP_CASE_HANDLE(634);
+        TRAMP_CASE_HANDLE(635);
+        TRAMP_CASE_HANDLE(636);
+        TRAMP_CASE_HANDLE(637);
+        TRAMP_CASE_HANDLE(638);
+        TRAMP_CASE_HANDLE(639);
+        TRAMP_CASE_HANDLE(640);
+        TRAMP_CASE_HANDLE(641);
+        TRAMP_CASE_HANDLE(642);
+        TRAMP_CASE_HANDLE(643);
+        TRAMP_CASE_HANDLE(644);
+        TRAMP_CASE_HANDLE(645);
+        TRAMP_CASE_HANDLE(646);
+        TRAMP_CASE_HANDLE(647);
+        TRAMP_CASE_HANDLE(648);
+        TRAMP_CASE_HANDLE(649);
+        TRAMP_CASE_HANDLE(650);
+        TRAMP_CASE_HANDLE(651);
+        TRAMP_CASE_HANDLE(652);
+        TRAMP_CASE_HANDLE(653);
+        TRAMP_CASE_HANDLE(654);
+        TRAMP_CASE_HANDLE(655);
+        TRAMP_CASE_HANDLE(656);
+        TRAMP_CASE_HANDLE(657);
+        TRAMP_CASE_HANDLE(658);
+        TRAMP_CASE_HANDLE(659);
+        TRAMP_CASE_HANDLE(660);
+        TRAMP_CASE_HANDLE(661);
+        TRAMP_CASE_HANDLE(662);
+        TRAMP_CASE_HANDLE(663);
+        TRAMP_CASE_HANDLE(664);
+        TRAMP_CASE_HANDLE(665);
+        TRAMP_CASE_HANDLE(666);
+        TRAMP_CASE_HANDLE(667);
+        TRAMP_CASE_HANDLE(668);
+        TRAMP_CASE_HANDLE(669);
+        TRAMP_CASE_HANDLE(670);
+        TRAMP_CASE_HANDLE(671);
+        TRAMP_CASE_HANDLE(672);
+        TRAMP_CASE_HANDLE(673);
+        TRAMP_CASE_HANDLE(674);
+        TRAMP_CASE_HANDLE(675);
+        TRAMP_CASE_HANDLE(676);
+        TRAMP_CASE_HANDLE(677);
+        TRAMP_CASE_HANDLE(678);
+        TRAMP_CASE_HANDLE(679);
+        TRAMP_CASE_HANDLE(680);
+        TRAMP_CASE_HANDLE(681);
+        TRAMP_CASE_HANDLE(682);
+        TRAMP_CASE_HANDLE(683);
+        TRAMP_CASE_HANDLE(684);
+        TRAMP_CASE_HANDLE(685);
+        TRAMP_CASE_HANDLE(686);
+        TRAMP_CASE_HANDLE(687);
+        TRAMP_CASE_HANDLE(688);
+        TRAMP_CASE_HANDLE(689);
+        TRAMP_CASE_HANDLE(690);
+        TRAMP_CASE_HANDLE(691);
+        TRAMP_CASE_HANDLE(692);
+        TRAMP_CASE_HANDLE(693);
+        TRAMP_CASE_HANDLE(694);
+        TRAMP_CASE_HANDLE(695);
+        TRAMP_CASE_HANDLE(696);
+        TRAMP_CASE_HANDLE(697);
+        TRAMP_CASE_HANDLE(698);
+        TRAMP_CASE_HANDLE(699);
+        TRAMP_CASE_HANDLE(700);
+        TRAMP_CASE_HANDLE(701);
+        TRAMP_CASE_HANDLE(702);
+        TRAMP_CASE_HANDLE(703);
+        TRAMP_CASE_HANDLE(704);
+        TRAMP_CASE_HANDLE(705);
+        TRAMP_CASE_HANDLE(706);
+        TRAMP_CASE_HANDLE(707);
+        TRAMP_CASE_HANDLE(708);
+        TRAMP_CASE_HANDLE(709);
+        TRAMP_CASE_HANDLE(710);
+        TRAMP_CASE_HANDLE(711);
+        TRAMP_CASE_HANDLE(712);
+        TRAMP_CASE_HANDLE(713);
+        TRAMP_CASE_HANDLE(714);
+        TRAMP_CASE_HANDLE(715);
+        TRAMP_CASE_HANDLE(716);
+        TRAMP_CASE_HANDLE(717);
+        TRAMP_CASE_HANDLE(718);
+        TRAMP_CASE_HANDLE(719);
+        TRAMP_CASE_HANDLE(720);
+        TRAMP_CASE_HANDLE(721);
+        TRAMP_CASE_HANDLE(722);
+        TRAMP_CASE_HANDLE(723);
+        TRAMP_CASE_HANDLE(724);
+        TRAMP_CASE_HANDLE(725);
+        TRAMP_CASE_HANDLE(726);
+        TRAMP_CASE_HANDLE(727);
+        TRAMP_CASE_HANDLE(728);
+        TRAMP_CASE_HANDLE(729);
+        TRAMP_CASE_HANDLE(730);
+        TRAMP_CASE_HANDLE(731);
+        TRAMP_CASE_HANDLE(732);
+        TRAMP_CASE_HANDLE(733);
+        TRAMP_CASE_HANDLE(734);
+        TRAMP_CASE_HANDLE(735);
+        TRAMP_CASE_HANDLE(736);
+        TRAMP_CASE_HANDLE(737);
+        TRAMP_CASE_HANDLE(738);
+        TRAMP_CASE_HANDLE(739);
+        TRAMP_CASE_HANDLE(740);
+        TRAMP_CASE_HANDLE(741);
+        TRAMP_CASE_HANDLE(742);
+        TRAMP_CASE_HANDLE(743);
+        TRAMP_CASE_HANDLE(744);
+        TRAMP_CASE_HANDLE(745);
+        TRAMP_CASE_HANDLE(746);
+        TRAMP_CASE_HANDLE(747);
+        TRAMP_CASE_HANDLE(748);
+        TRAMP_CASE_HANDLE(749);
+        TRAMP_CASE_HANDLE(750);
+        TRAMP_CASE_HANDLE(751);
+        TRAMP_CASE_HANDLE(752);
+        TRAMP_CASE_HANDLE(753);
+        TRAMP_CASE_HANDLE(754);
+        TRAMP_CASE_HANDLE(755);
+        TRAMP_CASE_HANDLE(756);
+        TRAMP_CASE_HANDLE(757);
+        TRAMP_CASE_HANDLE(758);
+        TRAMP_CASE_HANDLE(759);
+        TRAMP_CASE_HANDLE(760);
+        TRAMP_CASE_HANDLE(761);
+        TRAMP_CASE_HANDLE(762);
+        TRAMP_CASE_HANDLE(763);
+        TRAMP_CASE_HANDLE(764);
+        TRAMP_CASE_HANDLE(765);
+        TRAMP_CASE_HANDLE(766);
+        TRAMP_CASE_HANDLE(767);
+        TRAMP_CASE_HANDLE(768);
+        TRAMP_CASE_HANDLE(769);
+        TRAMP_CASE_HANDLE(770);
+        TRAMP_CASE_HANDLE(771);
+        TRAMP_CASE_HANDLE(772);
+        TRAMP_CASE_HANDLE(773);
+        TRAMP_CASE_HANDLE(774);
+        TRAMP_CASE_HANDLE(775);
+        TRAMP_CASE_HANDLE(776);
+        TRAMP_CASE_HANDLE(777);
+        TRAMP_CASE_HANDLE(778);
+        TRAMP_CASE_HANDLE(779);
+        TRAMP_CASE_HANDLE(780);
+        TRAMP_CASE_HANDLE(781);
+        TRAMP_CASE_HANDLE(782);
+        TRAMP_CASE_HANDLE(783);
+        TRAMP_CASE_HANDLE(784);
+        TRAMP_CASE_HANDLE(785);
+        TRAMP_CASE_HANDLE(786);
+        TRAMP_CASE_HANDLE(787);
+        TRAMP_CASE_HANDLE(788);
+        TRAMP_CASE_HANDLE(789);
+        TRAMP_CASE_HANDLE(790);
+        TRAMP_CASE_HANDLE(791);
+        TRAMP_CASE_HANDLE(792);
+        TRAMP_CASE_HANDLE(793);
+        TRAMP_CASE_HANDLE(794);
+        TRAMP_CASE_HANDLE(795);
+        TRAMP_CASE_HANDLE(796);
+        TRAMP_CASE_HANDLE(797);
+        TRAMP_CASE_HANDLE(798);
+        TRAMP_CASE_HANDLE(799);
+        TRAMP_CASE_HANDLE(800);
+        TRAMP_CASE_HANDLE(801);
+        TRAMP_CASE_HANDLE(802);
+        TRAMP_CASE_HANDLE(803);
+        TRAMP_CASE_HANDLE(804);
+        TRAMP_CASE_HANDLE(805);
+        TRAMP_CASE_HANDLE(806);
+        TRAMP_CASE_HANDLE(807);
+        TRAMP_CASE_HANDLE(808);
+        TRAMP_CASE_HANDLE(809);
+        TRAMP_CASE_HANDLE(810);
+        TRAMP_CASE_HANDLE(811);
+        TRAMP_CASE_HANDLE(812);
+        TRAMP_CASE_HANDLE(813);
+        TRAMP_CASE_HANDLE(814);
+        TRAMP_CASE_HANDLE(815);
+        TRAMP_CASE_HANDLE(816);
+        TRAMP_CASE_HANDLE(817);
+        TRAMP_CASE_HANDLE(818);
+        TRAMP_CASE_HANDLE(819);
+        TRAMP_CASE_HANDLE(820);
+        TRAMP_CASE_HANDLE(821);
+        TRAMP_CASE_HANDLE(822);
+        TRAMP_CASE_HANDLE(823);
+        TRAMP_CASE_HANDLE(824);
+        TRAMP_CASE_HANDLE(825);
+        TRAMP_CASE_HANDLE(826);
+        TRAMP_CASE_HANDLE(827);
+        TRAMP_CASE_HANDLE(828);
+        TRAMP_CASE_HANDLE(829);
+        TRAMP_CASE_HANDLE(830);
+        TRAMP_CASE_HANDLE(831);
+        TRAMP_CASE_HANDLE(832);
+        TRAMP_CASE_HANDLE(833);
+        TRAMP_CASE_HANDLE(834);
+        TRAMP_CASE_HANDLE(835);
+        TRAMP_CASE_HANDLE(836);
+        TRAMP_CASE_HANDLE(837);
+        TRAMP_CASE_HANDLE(838);
+        TRAMP_CASE_HANDLE(839);
+        TRAMP_CASE_HANDLE(840);
+        TRAMP_CASE_HANDLE(841);
+        TRAMP_CASE_HANDLE(842);
+        TRAMP_CASE_HANDLE(843);
+        TRAMP_CASE_HANDLE(844);
+        TRAMP_CASE_HANDLE(845);
+        TRAMP_CASE_HANDLE(846);
+        TRAMP_CASE_HANDLE(847);
+        TRAMP_CASE_HANDLE(848);
+        TRAMP_CASE_HANDLE(849);
+        TRAMP_CASE_HANDLE(850);
+        TRAMP_CASE_HANDLE(851);
+        TRAMP_CASE_HANDLE(852);
+        TRAMP_CASE_HANDLE(853);
+        TRAMP_CASE_HANDLE(854);
+        TRAMP_CASE_HANDLE(855);
+        TRAMP_CASE_HANDLE(856);
+        TRAMP_CASE_HANDLE(857);
+        TRAMP_CASE_HANDLE(858);
+        TRAMP_CASE_HANDLE(859);
+        TRAMP_CASE_HANDLE(860);
+        TRAMP_CASE_HANDLE(861);
+        TRAMP_CASE_HANDLE(862);
+        TRAMP_CASE_HANDLE(863);
+        TRAMP_CASE_HANDLE(864);
+        TRAMP_CASE_HANDLE(865);
+        TRAMP_CASE_HANDLE(866);
+        TRAMP_CASE_HANDLE(867);
+        TRAMP_CASE_HANDLE(868);
+        TRAMP_CASE_HANDLE(869);
+        TRAMP_CASE_HANDLE(870);
+        TRAMP_CASE_HANDLE(871);
+        TRAMP_CASE_HANDLE(872);
+        TRAMP_CASE_HANDLE(873);
+        TRAMP_CASE_HANDLE(874);
+        TRAMP_CASE_HANDLE(875);
+        TRAMP_CASE_HANDLE(876);
+        TRAMP_CASE_HANDLE(877);
+        TRAMP_CASE_HANDLE(878);
+        TRAMP_CASE_HANDLE(879);
+        TRAMP_CASE_HANDLE(880);
+        TRAMP_CASE_HANDLE(881);
+        TRAMP_CASE_HANDLE(882);
+        TRAMP_CASE_HANDLE(883);
+        TRAMP_CASE_HANDLE(884);
+        TRAMP_CASE_HANDLE(885);
+        TRAMP_CASE_HANDLE(886);
+        TRAMP_CASE_HANDLE(887);
+        TRAMP_CASE_HANDLE(888);
+        TRAMP_CASE_HANDLE(889);
+        TRAMP_CASE_HANDLE(890);
+        TRAMP_CASE_HANDLE(891);
+        TRAMP_CASE_HANDLE(892);
+        TRAMP_CASE_HANDLE(893);
+        TRAMP_CASE_HANDLE(894);
+        TRAMP_CASE_HANDLE(895);
+        TRAMP_CASE_HANDLE(896);
+        TRAMP_CASE_HANDLE(897);
+        TRAMP_CASE_HANDLE(898);
+        TRAMP_CASE_HANDLE(899);
+        TRAMP_CASE_HANDLE(900);
+        TRAMP_CASE_HANDLE(901);
+        TRAMP_CASE_HANDLE(902);
+        TRAMP_CASE_HANDLE(903);
+        TRAMP_CASE_HANDLE(904);
+        TRAMP_CASE_HANDLE(905);
+        TRAMP_CASE_HANDLE(906);
+        TRAMP_CASE_HANDLE(907);
+        TRAMP_CASE_HANDLE(908);
+        TRAMP_CASE_HANDLE(909);
+        TRAMP_CASE_HANDLE(910);
+        TRAMP_CASE_HANDLE(911);
+        TRAMP_CASE_HANDLE(912);
+        TRAMP_CASE_HANDLE(913);
+        TRAMP_CASE_HANDLE(914);
+        TRAMP_CASE_HANDLE(915);
+        TRAMP_CASE_HANDLE(916);
+        TRAMP_CASE_HANDLE(917);
+        TRAMP_CASE_HANDLE(918);
+        TRAMP_CASE_HANDLE(919);
+        TRAMP_CASE_HANDLE(920);
+        TRAMP_CASE_HANDLE(921);
+        TRAMP_CASE_HANDLE(922);
+        TRAMP_CASE_HANDLE(923);
+        TRAMP_CASE_HANDLE(924);
+        TRAMP_CASE_HANDLE(925);
+        TRAMP_CASE_HANDLE(926);
+        TRAMP_CASE_HANDLE(927);
+        TRAMP_CASE_HANDLE(928);
+        TRAMP_CASE_HANDLE(929);
+        TRAMP_CASE_HANDLE(930);
+        TRAMP_CASE_HANDLE(931);
+        TRAMP_CASE_HANDLE(932);
+        TRAMP_CASE_HANDLE(933);
+        TRAMP_CASE_HANDLE(934);
+        TRAMP_CASE_HANDLE(935);
+        TRAMP_CASE_HANDLE(936);
+        TRAMP_CASE_HANDLE(937);
+        TRAMP_CASE_HANDLE(938);
+        TRAMP_CASE_HANDLE(939);
+        TRAMP_CASE_HANDLE(940);
+        TRAMP_CASE_HANDLE(941);
+        TRAMP_CASE_HANDLE(942);
+        TRAMP_CASE_HANDLE(943);
+        TRAMP_CASE_HANDLE(944);
+        TRAMP_CASE_HANDLE(945);
+        TRAMP_CASE_HANDLE(946);
+        TRAMP_CASE_HANDLE(947);
+        TRAMP_CASE_HANDLE(948);
+        TRAMP_CASE_HANDLE(949);
+        TRAMP_CASE_HANDLE(950);
+        TRAMP_CASE_HANDLE(951);
+        TRAMP_CASE_HANDLE(952);
+        TRAMP_CASE_HANDLE(953);
+        TRAMP_CASE_HANDLE(954);
+        TRAMP_CASE_HANDLE(955);
+        TRAMP_CASE_HANDLE(956);
+        TRAMP_CASE_HANDLE(957);
+        TRAMP_CASE_HANDLE(958);
+        TRAMP_CASE_HANDLE(959);
+        TRAMP_CASE_HANDLE(960);
+        TRAMP_CASE_HANDLE(961);
+        TRAMP_CASE_HANDLE(962);
+        TRAMP_CASE_HANDLE(963);
+        TRAMP_CASE_HANDLE(964);
+        TRAMP_CASE_HANDLE(965);
+        TRAMP_CASE_HANDLE(966);
+        TRAMP_CASE_HANDLE(967);
+        TRAMP_CASE_HANDLE(968);
+        TRAMP_CASE_HANDLE(969);
+        TRAMP_CASE_HANDLE(970);
+        TRAMP_CASE_HANDLE(971);
+        TRAMP_CASE_HANDLE(972);
+        TRAMP_CASE_HANDLE(973);
+        TRAMP_CASE_HANDLE(974);
+        TRAMP_CASE_HANDLE(975);
+        TRAMP_CASE_HANDLE(976);
+        TRAMP_CASE_HANDLE(977);
+        TRAMP_CASE_HANDLE(978);
+        TRAMP_CASE_HANDLE(979);
+        TRAMP_CASE_HANDLE(980);
+        TRAMP_CASE_HANDLE(981);
+        TRAMP_CASE_HANDLE(982);
+        TRAMP_CASE_HANDLE(983);
+        TRAMP_CASE_HANDLE(984);
+        TRAMP_CASE_HANDLE(985);
+        TRAMP_CASE_HANDLE(986);
+        TRAMP_CASE_HANDLE(987);
+        TRAMP_CASE_HANDLE(988);
+        TRAMP_CASE_HANDLE(989);
+        TRAMP_CASE_HANDLE(990);
+        TRAMP_CASE_HANDLE(991);
+        TRAMP_CASE_HANDLE(992);
+        TRAMP_CASE_HANDLE(993);
+        TRAMP_CASE_HANDLE(994);
+        TRAMP_CASE_HANDLE(995);
+        TRAMP_CASE_HANDLE(996);
+        TRAMP_CASE_HANDLE(997);
+        TRAMP_CASE_HANDLE(998);
+        TRAMP_CASE_HANDLE(999);
     }
     return NULL;
 }
@@ -1051,6 +3301,756 @@ void *loader_get_phys_dev_ext_termin(uint32_t index) {
         TERM_CASE_HANDLE(247);
         TERM_CASE_HANDLE(248);
         TERM_CASE_HANDLE(249);
+        TERM_CASE_HANDLE(250);
+        TERM_CASE_HANDLE(251);
+        TERM_CASE_HANDLE(252);
+        TERM_CASE_HANDLE(253);
+        TERM_CASE_HANDLE(254);
+        TERM_CASE_HANDLE(255);
+        TERM_CASE_HANDLE(256);
+        TERM_CASE_HANDLE(257);
+        TERM_CASE_HANDLE(258);
+        TERM_CASE_HANDLE(259);
+        TERM_CASE_HANDLE(260);
+        TERM_CASE_HANDLE(261);
+        TERM_CASE_HANDLE(262);
+        TERM_CASE_HANDLE(263);
+        TERM_CASE_HANDLE(264);
+        TERM_CASE_HANDLE(265);
+        TERM_CASE_HANDLE(266);
+        TERM_CASE_HANDLE(267);
+        TERM_CASE_HANDLE(268);
+        TERM_CASE_HANDLE(269);
+        TERM_CASE_HANDLE(270);
+        TERM_CASE_HANDLE(271);
+        TERM_CASE_HANDLE(272);
+        TERM_CASE_HANDLE(273);
+        TERM_CASE_HANDLE(274);
+        TERM_CASE_HANDLE(275);
+        TERM_CASE_HANDLE(276);
+        TERM_CASE_HANDLE(277);
+        TERM_CASE_HANDLE(278);
+        TERM_CASE_HANDLE(279);
+        TERM_CASE_HANDLE(280);
+        TERM_CASE_HANDLE(281);
+        TERM_CASE_HANDLE(282);
+        TERM_CASE_HANDLE(283);
+        TERM_CASE_HANDLE(284);
+        TERM_CASE_HANDLE(285);
+        TERM_CASE_HANDLE(286);
+        TERM_CASE_HANDLE(287);
+        TERM_CASE_HANDLE(288);
+        TERM_CASE_HANDLE(289);
+        TERM_CASE_HANDLE(290);
+        TERM_CASE_HANDLE(291);
+        TERM_CASE_HANDLE(292);
+        TERM_CASE_HANDLE(293);
+        TERM_CASE_HANDLE(294);
+        TERM_CASE_HANDLE(295);
+        TERM_CASE_HANDLE(296);
+        TERM_CASE_HANDLE(297);
+        TERM_CASE_HANDLE(298);
+        TERM_CASE_HANDLE(299);
+        TERM_CASE_HANDLE(300);
+        TERM_CASE_HANDLE(301);
+        TERM_CASE_HANDLE(302);
+        TERM_CASE_HANDLE(303);
+        TERM_CASE_HANDLE(304);
+        TERM_CASE_HANDLE(305);
+        TERM_CASE_HANDLE(306);
+        TERM_CASE_HANDLE(307);
+        TERM_CASE_HANDLE(308);
+        TERM_CASE_HANDLE(309);
+        TERM_CASE_HANDLE(310);
+        TERM_CASE_HANDLE(311);
+        TERM_CASE_HANDLE(312);
+        TERM_CASE_HANDLE(313);
+        TERM_CASE_HANDLE(314);
+        TERM_CASE_HANDLE(315);
+        TERM_CASE_HANDLE(316);
+        TERM_CASE_HANDLE(317);
+        TERM_CASE_HANDLE(318);
+        TERM_CASE_HANDLE(319);
+        TERM_CASE_HANDLE(320);
+        TERM_CASE_HANDLE(321);
+        TERM_CASE_HANDLE(322);
+        TERM_CASE_HANDLE(323);
+        TERM_CASE_HANDLE(324);
+        TERM_CASE_HANDLE(325);
+        TERM_CASE_HANDLE(326);
+        TERM_CASE_HANDLE(327);
+        TERM_CASE_HANDLE(328);
+        TERM_CASE_HANDLE(329);
+        TERM_CASE_HANDLE(330);
+        TERM_CASE_HANDLE(331);
+        TERM_CASE_HANDLE(332);
+        TERM_CASE_HANDLE(333);
+        TERM_CASE_HANDLE(334);
+        TERM_CASE_HANDLE(335);
+        TERM_CASE_HANDLE(336);
+        TERM_CASE_HANDLE(337);
+        TERM_CASE_HANDLE(338);
+        TERM_CASE_HANDLE(339);
+        TERM_CASE_HANDLE(340);
+        TERM_CASE_HANDLE(341);
+        TERM_CASE_HANDLE(342);
+        TERM_CASE_HANDLE(343);
+        TERM_CASE_HANDLE(344);
+        TERM_CASE_HANDLE(345);
+        TERM_CASE_HANDLE(346);
+        TERM_CASE_HANDLE(347);
+        TERM_CASE_HANDLE(348);
+        TERM_CASE_HANDLE(349);
+        TERM_CASE_HANDLE(350);
+        TERM_CASE_HANDLE(351);
+        TERM_CASE_HANDLE(352);
+        TERM_CASE_HANDLE(353);
+        TERM_CASE_HANDLE(354);
+        TERM_CASE_HANDLE(355);
+        TERM_CASE_HANDLE(356);
+        TERM_CASE_HANDLE(357);
+        TERM_CASE_HANDLE(358);
+        TERM_CASE_HANDLE(359);
+        TERM_CASE_HANDLE(360);
+        TERM_CASE_HANDLE(361);
+        TERM_CASE_HANDLE(362);
+        TERM_CASE_HANDLE(363);
+        TERM_CASE_HANDLE(364);
+        TERM_CASE_HANDLE(365);
+        TERM_CASE_HANDLE(366);
+        TERM_CASE_HANDLE(367);
+        TERM_CASE_HANDLE(368);
+        TERM_CASE_HANDLE(369);
+        TERM_CASE_HANDLE(370);
+        TERM_CASE_HANDLE(371);
+        TERM_CASE_HANDLE(372);
+        TERM_CASE_HANDLE(373);
+        TERM_CASE_HANDLE(374);
+        TERM_CASE_HANDLE(375);
+        TERM_CASE_HANDLE(376);
+        TERM_CASE_HANDLE(377);
+        TERM_CASE_HANDLE(378);
+        TERM_CASE_HANDLE(379);
+        TERM_CASE_HANDLE(380);
+        TERM_CASE_HANDLE(381);
+        TERM_CASE_HANDLE(382);
+        TERM_CASE_HANDLE(383);
+        TERM_CASE_HANDLE(384);
+        TERM_CASE_HANDLE(385);
+        TERM_CASE_HANDLE(386);
+        TERM_CASE_HANDLE(387);
+        TERM_CASE_HANDLE(388);
+        TERM_CASE_HANDLE(389);
+        TERM_CASE_HANDLE(390);
+        TERM_CASE_HANDLE(391);
+        TERM_CASE_HANDLE(392);
+        TERM_CASE_HANDLE(393);
+        TERM_CASE_HANDLE(394);
+        TERM_CASE_HANDLE(395);
+        TERM_CASE_HANDLE(396);
+        TERM_CASE_HANDLE(397);
+        TERM_CASE_HANDLE(398);
+        TERM_CASE_HANDLE(399);
+        TERM_CASE_HANDLE(400);
+        TERM_CASE_HANDLE(401);
+        TERM_CASE_HANDLE(402);
+        TERM_CASE_HANDLE(403);
+        TERM_CASE_HANDLE(404);
+        TERM_CASE_HANDLE(405);
+        TERM_CASE_HANDLE(406);
+        TERM_CASE_HANDLE(407);
+        TERM_CASE_HANDLE(408);
+        TERM_CASE_HANDLE(409);
+        TERM_CASE_HANDLE(410);
+        TERM_CASE_HANDLE(411);
+        TERM_CASE_HANDLE(412);
+        TERM_CASE_HANDLE(413);
+        TERM_CASE_HANDLE(414);
+        TERM_CASE_HANDLE(415);
+        TERM_CASE_HANDLE(416);
+        TERM_CASE_HANDLE(417);
+        TERM_CASE_HANDLE(418);
+        TERM_CASE_HANDLE(419);
+        TERM_CASE_HANDLE(420);
+        TERM_CASE_HANDLE(421);
+        TERM_CASE_HANDLE(422);
+        TERM_CASE_HANDLE(423);
+        TERM_CASE_HANDLE(424);
+        TERM_CASE_HANDLE(425);
+        TERM_CASE_HANDLE(426);
+        TERM_CASE_HANDLE(427);
+        TERM_CASE_HANDLE(428);
+        TERM_CASE_HANDLE(429);
+        TERM_CASE_HANDLE(430);
+        TERM_CASE_HANDLE(431);
+        TERM_CASE_HANDLE(432);
+        TERM_CASE_HANDLE(433);
+        TERM_CASE_HANDLE(434);
+        TERM_CASE_HANDLE(435);
+        TERM_CASE_HANDLE(436);
+        TERM_CASE_HANDLE(437);
+        TERM_CASE_HANDLE(438);
+        TERM_CASE_HANDLE(439);
+        TERM_CASE_HANDLE(440);
+        TERM_CASE_HANDLE(441);
+        TERM_CASE_HANDLE(442);
+        TERM_CASE_HANDLE(443);
+        TERM_CASE_HANDLE(444);
+        TERM_CASE_HANDLE(445);
+        TERM_CASE_HANDLE(446);
+        TERM_CASE_HANDLE(447);
+        TERM_CASE_HANDLE(448);
+        TERM_CASE_HANDLE(449);
+        TERM_CASE_HANDLE(450);
+        TERM_CASE_HANDLE(451);
+        TERM_CASE_HANDLE(452);
+        TERM_CASE_HANDLE(453);
+        TERM_CASE_HANDLE(454);
+        TERM_CASE_HANDLE(455);
+        TERM_CASE_HANDLE(456);
+        TERM_CASE_HANDLE(457);
+        TERM_CASE_HANDLE(458);
+        TERM_CASE_HANDLE(459);
+        TERM_CASE_HANDLE(460);
+        TERM_CASE_HANDLE(461);
+        TERM_CASE_HANDLE(462);
+        TERM_CASE_HANDLE(463);
+        TERM_CASE_HANDLE(464);
+        TERM_CASE_HANDLE(465);
+        TERM_CASE_HANDLE(466);
+        TERM_CASE_HANDLE(467);
+        TERM_CASE_HANDLE(468);
+        TERM_CASE_HANDLE(469);
+        TERM_CASE_HANDLE(470);
+        TERM_CASE_HANDLE(471);
+        TERM_CASE_HANDLE(472);
+        TERM_CASE_HANDLE(473);
+        TERM_CASE_HANDLE(474);
+        TERM_CASE_HANDLE(475);
+        TERM_CASE_HANDLE(476);
+        TERM_CASE_HANDLE(477);
+        TERM_CASE_HANDLE(478);
+        TERM_CASE_HANDLE(479);
+        TERM_CASE_HANDLE(480);
+        TERM_CASE_HANDLE(481);
+        TERM_CASE_HANDLE(482);
+        TERM_CASE_HANDLE(483);
+        TERM_CASE_HANDLE(484);
+        TERM_CASE_HANDLE(485);
+        TERM_CASE_HANDLE(486);
+        TERM_CASE_HANDLE(487);
+        TERM_CASE_HANDLE(488);
+        TERM_CASE_HANDLE(489);
+        TERM_CASE_HANDLE(490);
+        TERM_CASE_HANDLE(491);
+        TERM_CASE_HANDLE(492);
+        TERM_CASE_HANDLE(493);
+        TERM_CASE_HANDLE(494);
+        TERM_CASE_HANDLE(495);
+        TERM_CASE_HANDLE(496);
+        TERM_CASE_HANDLE(497);
+        TERM_CASE_HANDLE(498);
+        TERM_CASE_HANDLE(499);
+        TERM_CASE_HANDLE(500);
+        TERM_CASE_HANDLE(501);
+        TERM_CASE_HANDLE(502);
+        TERM_CASE_HANDLE(503);
+        TERM_CASE_HANDLE(504);
+        TERM_CASE_HANDLE(505);
+        TERM_CASE_HANDLE(506);
+        TERM_CASE_HANDLE(507);
+        TERM_CASE_HANDLE(508);
+        TERM_CASE_HANDLE(509);
+        TERM_CASE_HANDLE(510);
+        TERM_CASE_HANDLE(511);
+        TERM_CASE_HANDLE(512);
+        TERM_CASE_HANDLE(513);
+        TERM_CASE_HANDLE(514);
+        TERM_CASE_HANDLE(515);
+        TERM_CASE_HANDLE(516);
+        TERM_CASE_HANDLE(517);
+        TERM_CASE_HANDLE(518);
+        TERM_CASE_HANDLE(519);
+        TERM_CASE_HANDLE(520);
+        TERM_CASE_HANDLE(521);
+        TERM_CASE_HANDLE(522);
+        TERM_CASE_HANDLE(523);
+        TERM_CASE_HANDLE(524);
+        TERM_CASE_HANDLE(525);
+        TERM_CASE_HANDLE(526);
+        TERM_CASE_HANDLE(527);
+        TERM_CASE_HANDLE(528);
+        TERM_CASE_HANDLE(529);
+        TERM_CASE_HANDLE(530);
+        TERM_CASE_HANDLE(531);
+        TERM_CASE_HANDLE(532);
+        TERM_CASE_HANDLE(533);
+        TERM_CASE_HANDLE(534);
+        TERM_CASE_HANDLE(535);
+        TERM_CASE_HANDLE(536);
+        TERM_CASE_HANDLE(537);
+        TERM_CASE_HANDLE(538);
+        TERM_CASE_HANDLE(539);
+        TERM_CASE_HANDLE(540);
+        TERM_CASE_HANDLE(541);
+        TERM_CASE_HANDLE(542);
+        TERM_CASE_HANDLE(543);
+        TERM_CASE_HANDLE(544);
+        TERM_CASE_HANDLE(545);
+        TERM_CASE_HANDLE(546);
+        TERM_CASE_HANDLE(547);
+        TERM_CASE_HANDLE(548);
+        TERM_CASE_HANDLE(549);
+        TERM_CASE_HANDLE(550);
+        TERM_CASE_HANDLE(551);
+        TERM_CASE_HANDLE(552);
+        TERM_CASE_HANDLE(553);
+        TERM_CASE_HANDLE(554);
+        TERM_CASE_HANDLE(555);
+        TERM_CASE_HANDLE(556);
+        TERM_CASE_HANDLE(557);
+        TERM_CASE_HANDLE(558);
+        TERM_CASE_HANDLE(559);
+        TERM_CASE_HANDLE(560);
+        TERM_CASE_HANDLE(561);
+        TERM_CASE_HANDLE(562);
+        TERM_CASE_HANDLE(563);
+        TERM_CASE_HANDLE(564);
+        TERM_CASE_HANDLE(565);
+        TERM_CASE_HANDLE(566);
+        TERM_CASE_HANDLE(567);
+        TERM_CASE_HANDLE(568);
+        TERM_CASE_HANDLE(569);
+        TERM_CASE_HANDLE(570);
+        TERM_CASE_HANDLE(571);
+        TERM_CASE_HANDLE(572);
+        TERM_CASE_HANDLE(573);
+        TERM_CASE_HANDLE(574);
+        TERM_CASE_HANDLE(575);
+        TERM_CASE_HANDLE(576);
+        TERM_CASE_HANDLE(577);
+        TERM_CASE_HANDLE(578);
+        TERM_CASE_HANDLE(579);
+        TERM_CASE_HANDLE(580);
+        TERM_CASE_HANDLE(581);
+        TERM_CASE_HANDLE(582);
+        TERM_CASE_HANDLE(583);
+        TERM_CASE_HANDLE(584);
+        TERM_CASE_HANDLE(585);
+        TERM_CASE_HANDLE(586);
+        TERM_CASE_HANDLE(587);
+        TERM_CASE_HANDLE(588);
+        TERM_CASE_HANDLE(589);
+        TERM_CASE_HANDLE(590);
+        TERM_CASE_HANDLE(591);
+        TERM_CASE_HANDLE(592);
+        TERM_CASE_HANDLE(593);
+        TERM_CASE_HANDLE(594);
+        TERM_CASE_HANDLE(595);
+        TERM_CASE_HANDLE(596);
+        TERM_CASE_HANDLE(597);
+        TERM_CASE_HANDLE(598);
+        TERM_CASE_HANDLE(599);
+        TERM_CASE_HANDLE(600);
+        TERM_CASE_HANDLE(601);
+        TERM_CASE_HANDLE(602);
+        TERM_CASE_HANDLE(603);
+        TERM_CASE_HANDLE(604);
+        TERM_CASE_HANDLE(605);
+        TERM_CASE_HANDLE(606);
+        TERM_CASE_HANDLE(607);
+        TERM_CASE_HANDLE(608);
+        TERM_CASE_HANDLE(609);
+        TERM_CASE_HANDLE(610);
+        TERM_CASE_HANDLE(611);
+        TERM_CASE_HANDLE(612);
+        TERM_CASE_HANDLE(613);
+        TERM_CASE_HANDLE(614);
+        TERM_CASE_HANDLE(615);
+        TERM_CASE_HANDLE(616);
+        TERM_CASE_HANDLE(617);
+        TERM_CASE_HANDLE(618);
+        TERM_CASE_HANDLE(619);
+        TERM_CASE_HANDLE(620);
+        TERM_CASE_HANDLE(621);
+        TERM_CASE_HANDLE(622);
+        TERM_CASE_HANDLE(623);
+        TERM_CASE_HANDLE(624);
+        TERM_CASE_HANDLE(625);
+        TERM_CASE_HANDLE(626);
+        TERM_CASE_HANDLE(627);
+        TERM_CASE_HANDLE(628);
+        TERM_CASE_HANDLE(629);
+        TERM_CASE_HANDLE(630);
+        TERM_CASE_HANDLE(631);
+        TERM_CASE_HANDLE(632);
+        TERM_CASE_HANDLE(633);
+        TERM_CASE_HANDLE(634);
+        TERM_CASE_HANDLE(635);
+        TERM_CASE_HANDLE(636);
+        TERM_CASE_HANDLE(637);
+        TERM_CASE_HANDLE(638);
+        TERM_CASE_HANDLE(639);
+        TERM_CASE_HANDLE(640);
+        TERM_CASE_HANDLE(641);
+        TERM_CASE_HANDLE(642);
+        TERM_CASE_HANDLE(643);
+        TERM_CASE_HANDLE(644);
+        TERM_CASE_HANDLE(645);
+        TERM_CASE_HANDLE(646);
+        TERM_CASE_HANDLE(647);
+        TERM_CASE_HANDLE(648);
+        TERM_CASE_HANDLE(649);
+        TERM_CASE_HANDLE(650);
+        TERM_CASE_HANDLE(651);
+        TERM_CASE_HANDLE(652);
+        TERM_CASE_HANDLE(653);
+        TERM_CASE_HANDLE(654);
+        TERM_CASE_HANDLE(655);
+        TERM_CASE_HANDLE(656);
+        TERM_CASE_HANDLE(657);
+        TERM_CASE_HANDLE(658);
+        TERM_CASE_HANDLE(659);
+        TERM_CASE_HANDLE(660);
+        TERM_CASE_HANDLE(661);
+        TERM_CASE_HANDLE(662);
+        TERM_CASE_HANDLE(663);
+        TERM_CASE_HANDLE(664);
+        TERM_CASE_HANDLE(665);
+        TERM_CASE_HANDLE(666);
+        TERM_CASE_HANDLE(667);
+        TERM_CASE_HANDLE(668);
+        TERM_CASE_HANDLE(669);
+        TERM_CASE_HANDLE(670);
+        TERM_CASE_HANDLE(671);
+        TERM_CASE_HANDLE(672);
+        TERM_CASE_HANDLE(673);
+        TERM_CASE_HANDLE(674);
+        TERM_CASE_HANDLE(675);
+        TERM_CASE_HANDLE(676);
+        TERM_CASE_HANDLE(677);
+        TERM_CASE_HANDLE(678);
+        TERM_CASE_HANDLE(679);
+        TERM_CASE_HANDLE(680);
+        TERM_CASE_HANDLE(681);
+        TERM_CASE_HANDLE(682);
+        TERM_CASE_HANDLE(683);
+        TERM_CASE_HANDLE(684);
+        TERM_CASE_HANDLE(685);
+        TERM_CASE_HANDLE(686);
+        TERM_CASE_HANDLE(687);
+        TERM_CASE_HANDLE(688);
+        TERM_CASE_HANDLE(689);
+        TERM_CASE_HANDLE(690);
+        TERM_CASE_HANDLE(691);
+        TERM_CASE_HANDLE(692);
+        TERM_CASE_HANDLE(693);
+        TERM_CASE_HANDLE(694);
+        TERM_CASE_HANDLE(695);
+        TERM_CASE_HANDLE(696);
+        TERM_CASE_HANDLE(697);
+        TERM_CASE_HANDLE(698);
+        TERM_CASE_HANDLE(699);
+        TERM_CASE_HANDLE(700);
+        TERM_CASE_HANDLE(701);
+        TERM_CASE_HANDLE(702);
+        TERM_CASE_HANDLE(703);
+        TERM_CASE_HANDLE(704);
+        TERM_CASE_HANDLE(705);
+        TERM_CASE_HANDLE(706);
+        TERM_CASE_HANDLE(707);
+        TERM_CASE_HANDLE(708);
+        TERM_CASE_HANDLE(709);
+        TERM_CASE_HANDLE(710);
+        TERM_CASE_HANDLE(711);
+        TERM_CASE_HANDLE(712);
+        TERM_CASE_HANDLE(713);
+        TERM_CASE_HANDLE(714);
+        TERM_CASE_HANDLE(715);
+        TERM_CASE_HANDLE(716);
+        TERM_CASE_HANDLE(717);
+        TERM_CASE_HANDLE(718);
+        TERM_CASE_HANDLE(719);
+        TERM_CASE_HANDLE(720);
+        TERM_CASE_HANDLE(721);
+        TERM_CASE_HANDLE(722);
+        TERM_CASE_HANDLE(723);
+        TERM_CASE_HANDLE(724);
+        TERM_CASE_HANDLE(725);
+        TERM_CASE_HANDLE(726);
+        TERM_CASE_HANDLE(727);
+        TERM_CASE_HANDLE(728);
+        TERM_CASE_HANDLE(729);
+        TERM_CASE_HANDLE(730);
+        TERM_CASE_HANDLE(731);
+        TERM_CASE_HANDLE(732);
+        TERM_CASE_HANDLE(733);
+        TERM_CASE_HANDLE(734);
+        TERM_CASE_HANDLE(735);
+        TERM_CASE_HANDLE(736);
+        TERM_CASE_HANDLE(737);
+        TERM_CASE_HANDLE(738);
+        TERM_CASE_HANDLE(739);
+        TERM_CASE_HANDLE(740);
+        TERM_CASE_HANDLE(741);
+        TERM_CASE_HANDLE(742);
+        TERM_CASE_HANDLE(743);
+        TERM_CASE_HANDLE(744);
+        TERM_CASE_HANDLE(745);
+        TERM_CASE_HANDLE(746);
+        TERM_CASE_HANDLE(747);
+        TERM_CASE_HANDLE(748);
+        TERM_CASE_HANDLE(749);
+        TERM_CASE_HANDLE(750);
+        TERM_CASE_HANDLE(751);
+        TERM_CASE_HANDLE(752);
+        TERM_CASE_HANDLE(753);
+        TERM_CASE_HANDLE(754);
+        TERM_CASE_HANDLE(755);
+        TERM_CASE_HANDLE(756);
+        TERM_CASE_HANDLE(757);
+        TERM_CASE_HANDLE(758);
+        TERM_CASE_HANDLE(759);
+        TERM_CASE_HANDLE(760);
+        TERM_CASE_HANDLE(761);
+        TERM_CASE_HANDLE(762);
+        TERM_CASE_HANDLE(763);
+        TERM_CASE_HANDLE(764);
+        TERM_CASE_HANDLE(765);
+        TERM_CASE_HANDLE(766);
+        TERM_CASE_HANDLE(767);
+        TERM_CASE_HANDLE(768);
+        TERM_CASE_HANDLE(769);
+        TERM_CASE_HANDLE(770);
+        TERM_CASE_HANDLE(771);
+        TERM_CASE_HANDLE(772);
+        TERM_CASE_HANDLE(773);
+        TERM_CASE_HANDLE(774);
+        TERM_CASE_HANDLE(775);
+        TERM_CASE_HANDLE(776);
+        TERM_CASE_HANDLE(777);
+        TERM_CASE_HANDLE(778);
+        TERM_CASE_HANDLE(779);
+        TERM_CASE_HANDLE(780);
+        TERM_CASE_HANDLE(781);
+        TERM_CASE_HANDLE(782);
+        TERM_CASE_HANDLE(783);
+        TERM_CASE_HANDLE(784);
+        TERM_CASE_HANDLE(785);
+        TERM_CASE_HANDLE(786);
+        TERM_CASE_HANDLE(787);
+        TERM_CASE_HANDLE(788);
+        TERM_CASE_HANDLE(789);
+        TERM_CASE_HANDLE(790);
+        TERM_CASE_HANDLE(791);
+        TERM_CASE_HANDLE(792);
+        TERM_CASE_HANDLE(793);
+        TERM_CASE_HANDLE(794);
+        TERM_CASE_HANDLE(795);
+        TERM_CASE_HANDLE(796);
+        TERM_CASE_HANDLE(797);
+        TERM_CASE_HANDLE(798);
+        TERM_CASE_HANDLE(799);
+        TERM_CASE_HANDLE(800);
+        TERM_CASE_HANDLE(801);
+        TERM_CASE_HANDLE(802);
+        TERM_CASE_HANDLE(803);
+        TERM_CASE_HANDLE(804);
+        TERM_CASE_HANDLE(805);
+        TERM_CASE_HANDLE(806);
+        TERM_CASE_HANDLE(807);
+        TERM_CASE_HANDLE(808);
+        TERM_CASE_HANDLE(809);
+        TERM_CASE_HANDLE(810);
+        TERM_CASE_HANDLE(811);
+        TERM_CASE_HANDLE(812);
+        TERM_CASE_HANDLE(813);
+        TERM_CASE_HANDLE(814);
+        TERM_CASE_HANDLE(815);
+        TERM_CASE_HANDLE(816);
+        TERM_CASE_HANDLE(817);
+        TERM_CASE_HANDLE(818);
+        TERM_CASE_HANDLE(819);
+        TERM_CASE_HANDLE(820);
+        TERM_CASE_HANDLE(821);
+        TERM_CASE_HANDLE(822);
+        TERM_CASE_HANDLE(823);
+        TERM_CASE_HANDLE(824);
+        TERM_CASE_HANDLE(825);
+        TERM_CASE_HANDLE(826);
+        TERM_CASE_HANDLE(827);
+        TERM_CASE_HANDLE(828);
+        TERM_CASE_HANDLE(829);
+        TERM_CASE_HANDLE(830);
+        TERM_CASE_HANDLE(831);
+        TERM_CASE_HANDLE(832);
+        TERM_CASE_HANDLE(833);
+        TERM_CASE_HANDLE(834);
+        TERM_CASE_HANDLE(835);
+        TERM_CASE_HANDLE(836);
+        TERM_CASE_HANDLE(837);
+        TERM_CASE_HANDLE(838);
+        TERM_CASE_HANDLE(839);
+        TERM_CASE_HANDLE(840);
+        TERM_CASE_HANDLE(841);
+        TERM_CASE_HANDLE(842);
+        TERM_CASE_HANDLE(843);
+        TERM_CASE_HANDLE(844);
+        TERM_CASE_HANDLE(845);
+        TERM_CASE_HANDLE(846);
+        TERM_CASE_HANDLE(847);
+        TERM_CASE_HANDLE(848);
+        TERM_CASE_HANDLE(849);
+        TERM_CASE_HANDLE(850);
+        TERM_CASE_HANDLE(851);
+        TERM_CASE_HANDLE(852);
+        TERM_CASE_HANDLE(853);
+        TERM_CASE_HANDLE(854);
+        TERM_CASE_HANDLE(855);
+        TERM_CASE_HANDLE(856);
+        TERM_CASE_HANDLE(857);
+        TERM_CASE_HANDLE(858);
+        TERM_CASE_HANDLE(859);
+        TERM_CASE_HANDLE(860);
+        TERM_CASE_HANDLE(861);
+        TERM_CASE_HANDLE(862);
+        TERM_CASE_HANDLE(863);
+        TERM_CASE_HANDLE(864);
+        TERM_CASE_HANDLE(865);
+        TERM_CASE_HANDLE(866);
+        TERM_CASE_HANDLE(867);
+        TERM_CASE_HANDLE(868);
+        TERM_CASE_HANDLE(869);
+        TERM_CASE_HANDLE(870);
+        TERM_CASE_HANDLE(871);
+        TERM_CASE_HANDLE(872);
+        TERM_CASE_HANDLE(873);
+        TERM_CASE_HANDLE(874);
+        TERM_CASE_HANDLE(875);
+        TERM_CASE_HANDLE(876);
+        TERM_CASE_HANDLE(877);
+        TERM_CASE_HANDLE(878);
+        TERM_CASE_HANDLE(879);
+        TERM_CASE_HANDLE(880);
+        TERM_CASE_HANDLE(881);
+        TERM_CASE_HANDLE(882);
+        TERM_CASE_HANDLE(883);
+        TERM_CASE_HANDLE(884);
+        TERM_CASE_HANDLE(885);
+        TERM_CASE_HANDLE(886);
+        TERM_CASE_HANDLE(887);
+        TERM_CASE_HANDLE(888);
+        TERM_CASE_HANDLE(889);
+        TERM_CASE_HANDLE(890);
+        TERM_CASE_HANDLE(891);
+        TERM_CASE_HANDLE(892);
+        TERM_CASE_HANDLE(893);
+        TERM_CASE_HANDLE(894);
+        TERM_CASE_HANDLE(895);
+        TERM_CASE_HANDLE(896);
+        TERM_CASE_HANDLE(897);
+        TERM_CASE_HANDLE(898);
+        TERM_CASE_HANDLE(899);
+        TERM_CASE_HANDLE(900);
+        TERM_CASE_HANDLE(901);
+        TERM_CASE_HANDLE(902);
+        TERM_CASE_HANDLE(903);
+        TERM_CASE_HANDLE(904);
+        TERM_CASE_HANDLE(905);
+        TERM_CASE_HANDLE(906);
+        TERM_CASE_HANDLE(907);
+        TERM_CASE_HANDLE(908);
+        TERM_CASE_HANDLE(909);
+        TERM_CASE_HANDLE(910);
+        TERM_CASE_HANDLE(911);
+        TERM_CASE_HANDLE(912);
+        TERM_CASE_HANDLE(913);
+        TERM_CASE_HANDLE(914);
+        TERM_CASE_HANDLE(915);
+        TERM_CASE_HANDLE(916);
+        TERM_CASE_HANDLE(917);
+        TERM_CASE_HANDLE(918);
+        TERM_CASE_HANDLE(919);
+        TERM_CASE_HANDLE(920);
+        TERM_CASE_HANDLE(921);
+        TERM_CASE_HANDLE(922);
+        TERM_CASE_HANDLE(923);
+        TERM_CASE_HANDLE(924);
+        TERM_CASE_HANDLE(925);
+        TERM_CASE_HANDLE(926);
+        TERM_CASE_HANDLE(927);
+        TERM_CASE_HANDLE(928);
+        TERM_CASE_HANDLE(929);
+        TERM_CASE_HANDLE(930);
+        TERM_CASE_HANDLE(931);
+        TERM_CASE_HANDLE(932);
+        TERM_CASE_HANDLE(933);
+        TERM_CASE_HANDLE(934);
+        TERM_CASE_HANDLE(935);
+        TERM_CASE_HANDLE(936);
+        TERM_CASE_HANDLE(937);
+        TERM_CASE_HANDLE(938);
+        TERM_CASE_HANDLE(939);
+        TERM_CASE_HANDLE(940);
+        TERM_CASE_HANDLE(941);
+        TERM_CASE_HANDLE(942);
+        TERM_CASE_HANDLE(943);
+        TERM_CASE_HANDLE(944);
+        TERM_CASE_HANDLE(945);
+        TERM_CASE_HANDLE(946);
+        TERM_CASE_HANDLE(947);
+        TERM_CASE_HANDLE(948);
+        TERM_CASE_HANDLE(949);
+        TERM_CASE_HANDLE(950);
+        TERM_CASE_HANDLE(951);
+        TERM_CASE_HANDLE(952);
+        TERM_CASE_HANDLE(953);
+        TERM_CASE_HANDLE(954);
+        TERM_CASE_HANDLE(955);
+        TERM_CASE_HANDLE(956);
+        TERM_CASE_HANDLE(957);
+        TERM_CASE_HANDLE(958);
+        TERM_CASE_HANDLE(959);
+        TERM_CASE_HANDLE(960);
+        TERM_CASE_HANDLE(961);
+        TERM_CASE_HANDLE(962);
+        TERM_CASE_HANDLE(963);
+        TERM_CASE_HANDLE(964);
+        TERM_CASE_HANDLE(965);
+        TERM_CASE_HANDLE(966);
+        TERM_CASE_HANDLE(967);
+        TERM_CASE_HANDLE(968);
+        TERM_CASE_HANDLE(969);
+        TERM_CASE_HANDLE(970);
+        TERM_CASE_HANDLE(971);
+        TERM_CASE_HANDLE(972);
+        TERM_CASE_HANDLE(973);
+        TERM_CASE_HANDLE(974);
+        TERM_CASE_HANDLE(975);
+        TERM_CASE_HANDLE(976);
+        TERM_CASE_HANDLE(977);
+        TERM_CASE_HANDLE(978);
+        TERM_CASE_HANDLE(979);
+        TERM_CASE_HANDLE(980);
+        TERM_CASE_HANDLE(981);
+        TERM_CASE_HANDLE(982);
+        TERM_CASE_HANDLE(983);
+        TERM_CASE_HANDLE(984);
+        TERM_CASE_HANDLE(985);
+        TERM_CASE_HANDLE(986);
+        TERM_CASE_HANDLE(987);
+        TERM_CASE_HANDLE(988);
+        TERM_CASE_HANDLE(989);
+        TERM_CASE_HANDLE(990);
+        TERM_CASE_HANDLE(991);
+        TERM_CASE_HANDLE(992);
+        TERM_CASE_HANDLE(993);
+        TERM_CASE_HANDLE(994);
+        TERM_CASE_HANDLE(995);
+        TERM_CASE_HANDLE(996);
+        TERM_CASE_HANDLE(997);
+        TERM_CASE_HANDLE(998);
+        TERM_CASE_HANDLE(999);
     }
     return NULL;
 }
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "stats.h"
+
+#include "loader.h"
+#include "log.h"
+
+static uint64_t loader_process_statistics[VK_LOADER_STATISTIC_COUNT];
+
+void loader_stats_add(const struct loader_instance *inst, VkLoaderStatistic statistic, uint64_t count) {
+    loader_platform_atomic_fetch_add_u64(&loader_process_statistics[statistic], count);
+    if (NULL != inst) {
+        // Only ever touched atomically, so updating it through a const instance is safe
+        loader_platform_atomic_fetch_add_u64((uint64_t *)&inst->statistics[statistic], count);
+    }
+}
+
+void loader_stats_lock_mutex(const struct loader_instance *inst, loader_platform_thread_mutex *mutex) {
+    loader_stats_add(inst, VK_LOADER_STATISTIC_LOCK_ACQUISITIONS, 1);
+    if (!loader_platform_thread_try_lock_mutex(mutex)) {
+        loader_stats_add(inst, VK_LOADER_STATISTIC_LOCK_CONTENTIONS, 1);
+        loader_platform_thread_lock_mutex(mutex);
+    }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL vk_loaderGetStatistics(VkInstance instance, uint32_t *pStatisticCount, uint64_t *pStatistics) {
+    const uint64_t *statistics = loader_process_statistics;
+    if (VK_NULL_HANDLE != instance) {
+        const struct loader_instance *inst = loader_get_instance(instance);
+        if (NULL == inst) {
+            loader_log(NULL, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_VALIDATION_BIT, 0, "vk_loaderGetStatistics: Invalid instance");
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+        statistics = inst->statistics;
+    }
+
+    if (NULL == pStatistics) {
+        *pStatisticCount = VK_LOADER_STATISTIC_COUNT;
+        return VK_SUCCESS;
+    }
+
+    uint32_t count = *pStatisticCount < VK_LOADER_STATISTIC_COUNT ? *pStatisticCount : VK_LOADER_STATISTIC_COUNT;
+    for (uint32_t i = 0; i < count; i++) {
+        pStatistics[i] = loader_platform_atomic_load_u64(&statistics[i]);
+    }
+    *pStatisticCount = count;
+    return count < VK_LOADER_STATISTIC_COUNT ? VK_INCOMPLETE : VK_SUCCESS;
+}
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "loader_common.h"
+
+// Counters behind vk_loaderGetStatistics, see vk_loader_statistics.h.
+//
+// Every counter exists once for the whole process and once in each loader_instance. They are updated atomically without any
+// lock, so counting costs no more than an atomic add per counter.
+
+// Adds count to the counter for the process, and to the one in inst unless inst is NULL
+void loader_stats_add(const struct loader_instance *inst, VkLoaderStatistic statistic, uint64_t count);
+
+// Locks mutex, counting the acquisition against inst along with whether it had to wait for another thread to release it
+void loader_stats_lock_mutex(const struct loader_instance *inst, loader_platform_thread_mutex *mutex);
+
+VKAPI_ATTR VkResult VKAPI_CALL vk_loaderGetStatistics(VkInstance instance, uint32_t *pStatisticCount, uint64_t *pStatistics);
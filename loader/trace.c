@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "trace.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "allocation.h"
+#include "get_environment.h"
+
+// Events are buffered up to this many, and then appended to the file, so the memory used doesn't grow with how long the process
+// runs
+#define LOADER_TRACE_MAX_BUFFERED_EVENTS 1024
+
+struct loader_trace_event {
+    const char *name;
+    char *detail;
+    char phase;
+    uint64_t timestamp_ns;
+    uint64_t thread_id;
+};
+
+static struct {
+    // Only changed by loader_trace_initialize and loader_trace_release, so it can be read without the lock
+    bool enabled;
+    char *path;
+    uint64_t process_id;
+    uint64_t start_time_ns;
+    loader_platform_thread_mutex lock;
+    uint32_t count;
+    struct loader_trace_event *events;  // LOADER_TRACE_MAX_BUFFERED_EVENTS of them
+    // Opened by the first write. Every write leaves the file holding a complete trace, and the next one overwrites the closing
+    // brackets at footer_offset with the new events before writing them out again.
+    FILE *file;
+    long footer_offset;
+    uint64_t written;
+} loader_trace;
+
+static void loader_trace_write_string(FILE *file, const char *str) {
+    fputc('"', file);
+    for (const char *c = str; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', file);
+            fputc(*c, file);
+        } else if ((unsigned char)*c < 0x20) {
+            fprintf(file, "\\u%04x", (unsigned int)(unsigned char)*c);
+        } else {
+            fputc(*c, file);
+        }
+    }
+    fputc('"', file);
+}
+
+// Append the buffered events to the file and empty the buffer. Must be called with the lock held.
+static void loader_trace_flush(void) {
+    if (0 == loader_trace.count) {
+        return;
+    }
+    if (NULL == loader_trace.file) {
+        loader_trace.file = fopen(loader_trace.path, "wb");
+        if (NULL != loader_trace.file) {
+            fputs("{\"traceEvents\":[\n", loader_trace.file);
+        }
+    } else {
+        fseek(loader_trace.file, loader_trace.footer_offset, SEEK_SET);
+    }
+
+    FILE *file = loader_trace.file;
+    for (uint32_t i = 0; i < loader_trace.count; i++) {
+        struct loader_trace_event *event = &loader_trace.events[i];
+        if (NULL != file) {
+            // Timestamps are in microseconds
+            uint64_t elapsed_ns = event->timestamp_ns - loader_trace.start_time_ns;
+            fputs(0 == loader_trace.written++ ? "{\"name\":" : ",\n{\"name\":", file);
+            loader_trace_write_string(file, event->name);
+            fprintf(file, ",\"cat\":\"loader\",\"ph\":\"%c\",\"ts\":%" PRIu64 ".%03" PRIu64 ",\"pid\":%" PRIu64 ",\"tid\":%" PRIu64,
+                    event->phase, elapsed_ns / 1000, elapsed_ns % 1000, loader_trace.process_id, event->thread_id);
+            if (NULL != event->detail) {
+                fputs(",\"args\":{\"detail\":", file);
+                loader_trace_write_string(file, event->detail);
+                fputc('}', file);
+            }
+            fputc('}', file);
+        }
+        loader_instance_heap_free(NULL, event->detail);
+    }
+    loader_trace.count = 0;
+
+    if (NULL != file) {
+        loader_trace.footer_offset = ftell(file);
+        fputs("\n],\"displayTimeUnit\":\"ms\"}\n", file);
+        fflush(file);
+    }
+}
+
+static void loader_trace_record(const char *name, const char *detail, char phase) {
+    uint64_t timestamp_ns = loader_platform_monotonic_time_ns();
+    uint64_t thread_id = loader_platform_get_thread_id();
+    char *detail_copy = NULL;
+
+    if (NULL != detail) {
+        size_t detail_size = strlen(detail) + 1;
+        detail_copy = loader_instance_heap_alloc(NULL, detail_size, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL != detail_copy) {
+            memcpy(detail_copy, detail, detail_size);
+        }
+    }
+
+    loader_platform_thread_lock_mutex(&loader_trace.lock);
+    if (LOADER_TRACE_MAX_BUFFERED_EVENTS == loader_trace.count) {
+        loader_trace_flush();
+    }
+    struct loader_trace_event *event = &loader_trace.events[loader_trace.count++];
+    event->name = name;
+    event->detail = detail_copy;
+    event->phase = phase;
+    event->timestamp_ns = timestamp_ns;
+    event->thread_id = thread_id;
+    loader_platform_thread_unlock_mutex(&loader_trace.lock);
+}
+
+void loader_trace_initialize(void) {
+    loader_trace.path = loader_secure_getenv("VK_LOADER_TRACE", NULL);
+    if (NULL == loader_trace.path) {
+        return;
+    }
+    if (loader_trace.path[0] == '\0') {
+        loader_free_getenv(loader_trace.path, NULL);
+        loader_trace.path = NULL;
+        return;
+    }
+    loader_trace.events = loader_instance_heap_alloc(NULL, sizeof(struct loader_trace_event) * LOADER_TRACE_MAX_BUFFERED_EVENTS,
+                                                     VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == loader_trace.events) {
+        loader_free_getenv(loader_trace.path, NULL);
+        loader_trace.path = NULL;
+        return;
+    }
+    loader_trace.count = 0;
+    loader_trace.file = NULL;
+    loader_trace.footer_offset = 0;
+    loader_trace.written = 0;
+    loader_platform_thread_create_mutex(&loader_trace.lock);
+#if defined(_WIN32)
+    loader_trace.process_id = (uint64_t)GetCurrentProcessId();
+#else
+    loader_trace.process_id = (uint64_t)getpid();
+#endif
+    loader_trace.start_time_ns = loader_platform_monotonic_time_ns();
+    loader_trace.enabled = true;
+}
+
+void loader_trace_release(void) {
+    if (!loader_trace.enabled) {
+        return;
+    }
+    loader_trace_write();
+    loader_trace.enabled = false;
+    if (NULL != loader_trace.file) {
+        fclose(loader_trace.file);
+        loader_trace.file = NULL;
+    }
+    loader_instance_heap_free(NULL, loader_trace.events);
+    loader_trace.events = NULL;
+    loader_free_getenv(loader_trace.path, NULL);
+    loader_trace.path = NULL;
+    loader_platform_thread_delete_mutex(&loader_trace.lock);
+}
+
+void loader_trace_begin(const char *name, const char *detail) {
+    if (loader_trace.enabled) {
+        loader_trace_record(name, detail, 'B');
+    }
+}
+
+void loader_trace_end(const char *name) {
+    if (loader_trace.enabled) {
+        loader_trace_record(name, NULL, 'E');
+    }
+}
+
+void loader_trace_write(void) {
+    if (!loader_trace.enabled) {
+        return;
+    }
+    loader_platform_thread_lock_mutex(&loader_trace.lock);
+    loader_trace_flush();
+    loader_platform_thread_unlock_mutex(&loader_trace.lock);
+}
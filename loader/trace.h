@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "loader_common.h"
+
+// Optional timeline of the slow parts of loader startup, such as searching for and parsing manifests, opening drivers and
+// layers, and creating the instance.
+//
+// When VK_LOADER_TRACE names a file, every loader_trace_begin and loader_trace_end pair is recorded with a timestamp and the
+// id of the calling thread. Up to 1024 events are buffered. They are appended to the file when the buffer is full, whenever an
+// instance is destroyed, and when the loader is unloaded. The file is in the Chrome trace event format, which chrome://tracing
+// and Perfetto can display, and holds a complete trace after every write.
+//
+// Calls must nest properly on each thread. Neither call does anything if tracing isn't enabled.
+
+// Must be called before any thread can record an event
+void loader_trace_initialize(void);
+
+// Writes the events still buffered and closes the file
+void loader_trace_release(void);
+
+// name must be a string literal, or otherwise outlive the loader. detail, such as a file or library name, may be NULL and is
+// copied.
+void loader_trace_begin(const char *name, const char *detail);
+void loader_trace_end(const char *name);
+
+// Append the events buffered since the last write to the trace file
+void loader_trace_write(void);
@@ -28,10 +28,15 @@
 #include <string.h>
 
 #include "allocation.h"
+#include "creation_feedback.h"
 #include "debug_utils.h"
 #include "gpa_helper.h"
 #include "loader.h"
 #include "log.h"
+#include "manifest_cache.h"
+#include "stats.h"
+#include "trace.h"
+#include "unknown_function_handling.h"
 #include "vk_loader_extensions.h"
 #include "vk_loader_platform.h"
 #include "wsi.h"
@@ -63,12 +68,15 @@
 LOADER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char *pName) {
     // Always should be able to get vkGetInstanceProcAddr if queried, regardless of the value of instance
     if (!strcmp(pName, "vkGetInstanceProcAddr")) return (PFN_vkVoidFunction)vkGetInstanceProcAddr;
+    // Same for the loader's own statistics, which aren't tied to any instance
+    if (!strcmp(pName, VK_LOADER_GET_STATISTICS_NAME)) return (PFN_vkVoidFunction)vk_loaderGetStatistics;
 
     // Get entrypoint addresses that are global (no dispatchable object)
     void *addr = globalGetProcAddr(pName);
     if (addr != VK_NULL_HANDLE) {
         // Always can get a global entrypoint from vkGetInstanceProcAddr with a NULL instance handle
         if (instance == VK_NULL_HANDLE) {
+            loader_stats_add(NULL, VK_LOADER_STATISTIC_GIPA_GLOBAL_HITS, 1);
             return addr;
         } else {
             // New behavior only returns a global entrypoint if the instance handle is NULL.
@@ -81,15 +89,18 @@ LOADER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkI
             if (ptr_instance != NULL &&
                 loader_check_version_meets_required(loader_combine_version(1, 3, 0), ptr_instance->app_api_version)) {
                 // New behavior
+                loader_stats_add(ptr_instance, VK_LOADER_STATISTIC_GIPA_MISSES, 1);
                 return NULL;
             } else {
                 // Old behavior
+                loader_stats_add(ptr_instance, VK_LOADER_STATISTIC_GIPA_GLOBAL_HITS, 1);
                 return addr;
             }
         }
     } else {
         // All other functions require a valid instance handle to get
         if (instance == VK_NULL_HANDLE) {
+            loader_stats_add(NULL, VK_LOADER_STATISTIC_GIPA_MISSES, 1);
             return NULL;
         }
         struct loader_instance *ptr_instance = loader_get_instance(instance);
@@ -103,7 +114,9 @@ LOADER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkI
         // Device extensions are returned if a layer or ICD supports the extension.
         // Instance extensions are returned if the extension is enabled and the
         // loader or someone else supports the extension
-        return trampoline_get_proc_addr(ptr_instance, pName);
+        addr = trampoline_get_proc_addr(ptr_instance, pName);
+        loader_stats_add(ptr_instance, NULL != addr ? VK_LOADER_STATISTIC_GIPA_INSTANCE_HITS : VK_LOADER_STATISTIC_GIPA_MISSES, 1);
+        return addr;
     }
 }
 
@@ -117,26 +130,41 @@ LOADER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkI
 LOADER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice device, const char *pName) {
     void *addr;
 
+    // Lookups are only counted for the process, as finding the instance behind device would cost a search on every call
+
     // For entrypoints that loader must handle (ie non-dispatchable or create object)
     // make sure the loader entrypoint is returned
     addr = loader_non_passthrough_gdpa(pName);
     if (addr) {
+        loader_stats_add(NULL, VK_LOADER_STATISTIC_GDPA_LOADER_HITS, 1);
         return addr;
     }
 
     // Although CreateDevice is on device chain it's dispatchable object isn't
     // a VkDevice or child of VkDevice so return NULL.
-    if (!strcmp(pName, "CreateDevice")) return NULL;
+    if (!strcmp(pName, "CreateDevice")) {
+        loader_stats_add(NULL, VK_LOADER_STATISTIC_GDPA_MISSES, 1);
+        return NULL;
+    }
 
     // Return the dispatch table entrypoint for the fastest case
     const VkLayerDispatchTable *disp_table = *(VkLayerDispatchTable **)device;
-    if (disp_table == NULL) return NULL;
+    if (disp_table == NULL) {
+        loader_stats_add(NULL, VK_LOADER_STATISTIC_GDPA_MISSES, 1);
+        return NULL;
+    }
 
     addr = loader_lookup_device_dispatch_table(disp_table, pName);
-    if (addr) return addr;
+    if (addr) {
+        loader_stats_add(NULL, VK_LOADER_STATISTIC_GDPA_DISPATCH_HITS, 1);
+        return addr;
+    }
 
-    if (disp_table->GetDeviceProcAddr == NULL) return NULL;
-    return disp_table->GetDeviceProcAddr(device, pName);
+    if (disp_table->GetDeviceProcAddr != NULL) {
+        addr = (void *)disp_table->GetDeviceProcAddr(device, pName);
+    }
+    loader_stats_add(NULL, NULL != addr ? VK_LOADER_STATISTIC_GDPA_CHAIN_HITS : VK_LOADER_STATISTIC_GDPA_MISSES, 1);
+    return addr;
 }
 
 LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionProperties(const char *pLayerName,
@@ -158,40 +186,35 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionPropert
     };
     VkEnumerateInstanceExtensionPropertiesChain *chain_head = &chain_tail;
 
-    // Get the implicit layers
-    struct loader_layer_list layers;
-    memset(&layers, 0, sizeof(layers));
-    loader_scan_for_implicit_layers(NULL, &layers);
-
-    // We'll need to save the dl handles so we can close them later
-    loader_platform_dl_handle *libs =
-        loader_calloc(NULL, sizeof(loader_platform_dl_handle) * layers.count, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
-    if (libs == NULL && layers.count > 0) {
-        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    // Get the implicit layers. These, along with any layer libraries opened below, are shared with the other calls made before
+    // an instance is created.
+    struct loader_implicit_layer_cache *implicit_layers = NULL;
+    res = loader_acquire_implicit_layers(&implicit_layers);
+    if (VK_SUCCESS != res) {
+        return res;
     }
-    size_t lib_count = 0;
+    const struct loader_layer_list *layers = &implicit_layers->layers;
 
     // Prepend layers onto the chain if they implement this entry point
-    for (uint32_t i = 0; i < layers.count; ++i) {
-        if (!loader_implicit_layer_is_enabled(NULL, layers.list + i) ||
-            layers.list[i].pre_instance_functions.enumerate_instance_extension_properties[0] == '\0') {
+    for (uint32_t i = 0; i < layers->count; ++i) {
+        if (!loader_implicit_layer_is_enabled(NULL, layers->list + i) ||
+            layers->list[i].pre_instance_functions.enumerate_instance_extension_properties[0] == '\0') {
             continue;
         }
 
-        loader_platform_dl_handle layer_lib = loader_platform_open_library(layers.list[i].lib_name);
+        loader_platform_dl_handle layer_lib = loader_get_implicit_layer_library(implicit_layers, i);
         if (layer_lib == NULL) {
             loader_log(NULL, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_LAYER_BIT, 0,
-                       "%s: Unable to load implicit layer library \"%s\"", __FUNCTION__, layers.list[i].lib_name);
+                       "%s: Unable to load implicit layer library \"%s\"", __FUNCTION__, layers->list[i].lib_name);
             continue;
         }
 
-        libs[lib_count++] = layer_lib;
-        void *pfn = loader_platform_get_proc_address(layer_lib,
-                                                     layers.list[i].pre_instance_functions.enumerate_instance_extension_properties);
+        void *pfn = loader_platform_get_proc_address(
+            layer_lib, layers->list[i].pre_instance_functions.enumerate_instance_extension_properties);
         if (pfn == NULL) {
             loader_log(NULL, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_LAYER_BIT, 0,
                        "%s: Unable to resolve symbol \"%s\" in implicit layer library \"%s\"", __FUNCTION__,
-                       layers.list[i].pre_instance_functions.enumerate_instance_extension_properties, layers.list[i].lib_name);
+                       layers->list[i].pre_instance_functions.enumerate_instance_extension_properties, layers->list[i].lib_name);
             continue;
         }
 
@@ -216,9 +239,6 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionPropert
         res = chain_head->pfnNextLayer(chain_head->pNextLink, pLayerName, pPropertyCount, pProperties);
     }
 
-    // Free up the layers
-    loader_delete_layer_list_and_properties(NULL, &layers);
-
     // Tear down the chain
     while (chain_head != &chain_tail) {
         VkEnumerateInstanceExtensionPropertiesChain *holder = chain_head;
@@ -226,11 +246,8 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionPropert
         loader_free(NULL, holder);
     }
 
-    // Close the dl handles
-    for (size_t i = 0; i < lib_count; ++i) {
-        loader_platform_close_library(libs[i]);
-    }
-    loader_free(NULL, libs);
+    // The layer libraries stay open for the next call
+    loader_release_implicit_layers(implicit_layers);
 
     return res;
 }
@@ -253,40 +270,35 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceLayerProperties(
     };
     VkEnumerateInstanceLayerPropertiesChain *chain_head = &chain_tail;
 
-    // Get the implicit layers
-    struct loader_layer_list layers;
-    memset(&layers, 0, sizeof(layers));
-    loader_scan_for_implicit_layers(NULL, &layers);
-
-    // We'll need to save the dl handles so we can close them later
-    loader_platform_dl_handle *libs =
-        loader_calloc(NULL, sizeof(loader_platform_dl_handle) * layers.count, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
-    if (libs == NULL && layers.count > 0) {
-        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    // Get the implicit layers. These, along with any layer libraries opened below, are shared with the other calls made before
+    // an instance is created.
+    struct loader_implicit_layer_cache *implicit_layers = NULL;
+    res = loader_acquire_implicit_layers(&implicit_layers);
+    if (VK_SUCCESS != res) {
+        return res;
     }
-    size_t lib_count = 0;
+    const struct loader_layer_list *layers = &implicit_layers->layers;
 
     // Prepend layers onto the chain if they implement this entry point
-    for (uint32_t i = 0; i < layers.count; ++i) {
-        if (!loader_implicit_layer_is_enabled(NULL, layers.list + i) ||
-            layers.list[i].pre_instance_functions.enumerate_instance_layer_properties[0] == '\0') {
+    for (uint32_t i = 0; i < layers->count; ++i) {
+        if (!loader_implicit_layer_is_enabled(NULL, layers->list + i) ||
+            layers->list[i].pre_instance_functions.enumerate_instance_layer_properties[0] == '\0') {
             continue;
         }
 
-        loader_platform_dl_handle layer_lib = loader_platform_open_library(layers.list[i].lib_name);
+        loader_platform_dl_handle layer_lib = loader_get_implicit_layer_library(implicit_layers, i);
         if (layer_lib == NULL) {
             loader_log(NULL, VULKAN_LOADER_WARN_BIT, 0, "%s: Unable to load implicit layer library \"%s\"", __FUNCTION__,
-                       layers.list[i].lib_name);
+                       layers->list[i].lib_name);
             continue;
         }
 
-        libs[lib_count++] = layer_lib;
         void *pfn =
-            loader_platform_get_proc_address(layer_lib, layers.list[i].pre_instance_functions.enumerate_instance_layer_properties);
+            loader_platform_get_proc_address(layer_lib, layers->list[i].pre_instance_functions.enumerate_instance_layer_properties);
         if (pfn == NULL) {
             loader_log(NULL, VULKAN_LOADER_WARN_BIT, 0, "%s: Unable to resolve symbol \"%s\" in implicit layer library \"%s\"",
-                       __FUNCTION__, layers.list[i].pre_instance_functions.enumerate_instance_layer_properties,
-                       layers.list[i].lib_name);
+                       __FUNCTION__, layers->list[i].pre_instance_functions.enumerate_instance_layer_properties,
+                       layers->list[i].lib_name);
             continue;
         }
 
@@ -311,9 +323,6 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceLayerProperties(
         res = chain_head->pfnNextLayer(chain_head->pNextLink, pPropertyCount, pProperties);
     }
 
-    // Free up the layers
-    loader_delete_layer_list_and_properties(NULL, &layers);
-
     // Tear down the chain
     while (chain_head != &chain_tail) {
         VkEnumerateInstanceLayerPropertiesChain *holder = chain_head;
@@ -321,11 +330,8 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceLayerProperties(
         loader_free(NULL, holder);
     }
 
-    // Close the dl handles
-    for (size_t i = 0; i < lib_count; ++i) {
-        loader_platform_close_library(libs[i]);
-    }
-    loader_free(NULL, libs);
+    // The layer libraries stay open for the next call
+    loader_release_implicit_layers(implicit_layers);
 
     return res;
 }
@@ -355,38 +361,33 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceVersion(uint32_t
     };
     VkEnumerateInstanceVersionChain *chain_head = &chain_tail;
 
-    // Get the implicit layers
-    struct loader_layer_list layers;
-    memset(&layers, 0, sizeof(layers));
-    loader_scan_for_implicit_layers(NULL, &layers);
-
-    // We'll need to save the dl handles so we can close them later
-    loader_platform_dl_handle *libs =
-        loader_calloc(NULL, sizeof(loader_platform_dl_handle) * layers.count, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
-    if (libs == NULL && layers.count > 0) {
-        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    // Get the implicit layers. These, along with any layer libraries opened below, are shared with the other calls made before
+    // an instance is created.
+    struct loader_implicit_layer_cache *implicit_layers = NULL;
+    res = loader_acquire_implicit_layers(&implicit_layers);
+    if (VK_SUCCESS != res) {
+        return res;
     }
-    size_t lib_count = 0;
+    const struct loader_layer_list *layers = &implicit_layers->layers;
 
     // Prepend layers onto the chain if they implement this entry point
-    for (uint32_t i = 0; i < layers.count; ++i) {
-        if (!loader_implicit_layer_is_enabled(NULL, layers.list + i) ||
-            layers.list[i].pre_instance_functions.enumerate_instance_version[0] == '\0') {
+    for (uint32_t i = 0; i < layers->count; ++i) {
+        if (!loader_implicit_layer_is_enabled(NULL, layers->list + i) ||
+            layers->list[i].pre_instance_functions.enumerate_instance_version[0] == '\0') {
             continue;
         }
 
-        loader_platform_dl_handle layer_lib = loader_platform_open_library(layers.list[i].lib_name);
+        loader_platform_dl_handle layer_lib = loader_get_implicit_layer_library(implicit_layers, i);
         if (layer_lib == NULL) {
             loader_log(NULL, VULKAN_LOADER_WARN_BIT, 0, "%s: Unable to load implicit layer library \"%s\"", __FUNCTION__,
-                       layers.list[i].lib_name);
+                       layers->list[i].lib_name);
             continue;
         }
 
-        libs[lib_count++] = layer_lib;
-        void *pfn = loader_platform_get_proc_address(layer_lib, layers.list[i].pre_instance_functions.enumerate_instance_version);
+        void *pfn = loader_platform_get_proc_address(layer_lib, layers->list[i].pre_instance_functions.enumerate_instance_version);
         if (pfn == NULL) {
             loader_log(NULL, VULKAN_LOADER_WARN_BIT, 0, "%s: Unable to resolve symbol \"%s\" in implicit layer library \"%s\"",
-                       __FUNCTION__, layers.list[i].pre_instance_functions.enumerate_instance_version, layers.list[i].lib_name);
+                       __FUNCTION__, layers->list[i].pre_instance_functions.enumerate_instance_version, layers->list[i].lib_name);
             continue;
         }
 
@@ -411,9 +412,6 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceVersion(uint32_t
         res = chain_head->pfnNextLayer(chain_head->pNextLink, pApiVersion);
     }
 
-    // Free up the layers
-    loader_delete_layer_list_and_properties(NULL, &layers);
-
     // Tear down the chain
     while (chain_head != &chain_tail) {
         VkEnumerateInstanceVersionChain *holder = chain_head;
@@ -421,11 +419,8 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceVersion(uint32_t
         loader_free(NULL, holder);
     }
 
-    // Close the dl handles
-    for (size_t i = 0; i < lib_count; ++i) {
-        loader_platform_close_library(libs[i]);
-    }
-    loader_free(NULL, libs);
+    // The layer libraries stay open for the next call
+    loader_release_implicit_layers(implicit_layers);
 
     return res;
 }
@@ -435,6 +430,7 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
     struct loader_instance *ptr_instance = NULL;
     VkInstance created_instance = VK_NULL_HANDLE;
     VkResult res = VK_ERROR_INITIALIZATION_FAILED;
+    struct loader_creation_feedback creation_feedback = {0};
 
     LOADER_PLATFORM_THREAD_ONCE(&once_init, loader_initialize);
 
@@ -452,14 +448,19 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
     ptr_instance =
         (struct loader_instance *)loader_calloc(pAllocator, sizeof(struct loader_instance), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
 
+    // The instance isn't set up enough to log through yet
     VkInstanceCreateInfo ici = *pCreateInfo;
+    ici.pNext = loader_creation_feedback_begin(NULL, &creation_feedback, pCreateInfo->pNext);
 
     if (ptr_instance == NULL) {
         res = VK_ERROR_OUT_OF_HOST_MEMORY;
         goto out;
     }
+    ptr_instance->creation_feedback = &creation_feedback;
 
-    loader_platform_thread_lock_mutex(&loader_lock);
+    loader_platform_thread_create_mutex(&ptr_instance->instance_lock);
+    loader_platform_thread_create_mutex(&ptr_instance->device_list_lock);
+    loader_platform_thread_create_mutex(&ptr_instance->unknown_function_lock);
     if (pAllocator) {
         ptr_instance->alloc_callbacks = *pAllocator;
     }
@@ -520,6 +521,7 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
     // enabledLayerCount == 0 and VK_INSTANCE_LAYERS is unset. For now always
     // get layer list via loader_scan_for_layers().
     memset(&ptr_instance->instance_layer_list, 0, sizeof(ptr_instance->instance_layer_list));
+    ptr_instance->manifest_cache = loader_manifest_cache_open(ptr_instance);
     loader_scan_for_layers(ptr_instance, &ptr_instance->instance_layer_list);
 
     // Validate the app requested layers to be enabled
@@ -562,8 +564,8 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
         goto out;
     }
 
-    ptr_instance->disp = loader_instance_heap_alloc(ptr_instance, sizeof(struct loader_instance_dispatch_table),
-                                                    VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    ptr_instance->disp = loader_instance_heap_calloc(ptr_instance, sizeof(struct loader_instance_dispatch_table),
+                                                     VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
     if (ptr_instance->disp == NULL) {
         loader_log(ptr_instance, VULKAN_LOADER_ERROR_BIT, 0,
                    "vkCreateInstance:  Failed to allocate Loader's full Instance dispatch table.");
@@ -571,9 +573,9 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
         goto out;
     }
     memcpy(&ptr_instance->disp->layer_inst_disp, &instance_disp, sizeof(instance_disp));
+    ptr_instance->disp->instance = ptr_instance;
 
-    ptr_instance->next = loader.instances;
-    loader.instances = ptr_instance;
+    loader_add_instance(ptr_instance);
 
     // Activate any layers on instance chain
     res = loader_enable_instance_layers(ptr_instance, &ici, &ptr_instance->instance_layer_list);
@@ -581,8 +583,17 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
         goto out;
     }
 
+    // The layers the application enabled are known from here on, which the query entrypoints read from the snapshot
+    res = loader_publish_instance_snapshot(ptr_instance);
+    if (res != VK_SUCCESS) {
+        goto out;
+    }
+
     created_instance = (VkInstance)ptr_instance;
+    loader_creation_feedback_discovery(&creation_feedback);
+    loader_trace_begin("loader_create_instance_chain", NULL);
     res = loader_create_instance_chain(&ici, pAllocator, ptr_instance, &created_instance);
+    loader_trace_end("loader_create_instance_chain");
 
     if (VK_SUCCESS == res) {
         // Check for enabled extensions here to setup the loader structures so the loader knows what extensions
@@ -610,11 +621,15 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
 out:
 
     if (NULL != ptr_instance) {
+        ptr_instance->creation_feedback = NULL;
+        loader_manifest_cache_close(ptr_instance, ptr_instance->manifest_cache);
+        ptr_instance->manifest_cache = NULL;
         if (res != VK_SUCCESS) {
             // error path, should clean everything up
-            if (loader.instances == ptr_instance) {
-                loader.instances = ptr_instance->next;
-            }
+            loader_remove_instance(ptr_instance);
+            loader_free_instance_snapshots(ptr_instance);
+            loader_free_dev_ext_table(ptr_instance);
+            loader_free_phys_dev_ext_table(ptr_instance);
             if (NULL != ptr_instance->disp) {
                 loader_instance_heap_free(ptr_instance, ptr_instance->disp);
             }
@@ -642,14 +657,18 @@ out:
                 loader_icd_destroy(ptr_instance, icd_term, pAllocator);
             }
 
+            loader_platform_thread_delete_mutex(&ptr_instance->unknown_function_lock);
+            loader_platform_thread_delete_mutex(&ptr_instance->device_list_lock);
+            loader_platform_thread_delete_mutex(&ptr_instance->instance_lock);
             loader_instance_heap_free(ptr_instance, ptr_instance);
         } else {
             // success path, swap out created debug callbacks out so they aren't used until instance destruction
             ptr_instance->InstanceCreationDeletionDebugFunctionHead = ptr_instance->DbgFunctionHead;
             ptr_instance->DbgFunctionHead = NULL;
+            util_UpdateDebugCallbackInterest(ptr_instance);
         }
-        loader_platform_thread_unlock_mutex(&loader_lock);
     }
+    loader_creation_feedback_end(&creation_feedback);
 
     return res;
 }
@@ -661,13 +680,12 @@ LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance,
     if (instance == VK_NULL_HANDLE) {
         return;
     }
-    loader_platform_thread_lock_mutex(&loader_lock);
 
+    // The application has to make sure nothing else is using the instance anymore, so no lock is needed to tear it down
     ptr_instance = loader_get_instance(instance);
     if (ptr_instance == NULL) {
         loader_log(NULL, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_VALIDATION_BIT, 0,
                    "vkDestroyInstance: Invalid instance [VUID-vkDestroyInstance-instance-parameter]");
-        loader_platform_thread_unlock_mutex(&loader_lock);
         abort(); /* Intentionally fail so user can correct issue. */
     }
 
@@ -681,6 +699,7 @@ LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance,
     // Swap in the debug callbacks created during instance creation
     ptr_instance->DbgFunctionHead = ptr_instance->InstanceCreationDeletionDebugFunctionHead;
     ptr_instance->InstanceCreationDeletionDebugFunctionHead = NULL;
+    util_UpdateDebugCallbackInterest(ptr_instance);
 
     disp = loader_get_instance_layer_dispatch(instance);
     disp->DestroyInstance(ptr_instance->instance, pAllocator);
@@ -698,17 +717,25 @@ LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance,
         }
         loader_instance_heap_free(ptr_instance, ptr_instance->phys_devs_tramp);
     }
+    loader_free_instance_snapshots(ptr_instance);
 
     // Destroy the debug callbacks created during instance creation
     destroy_debug_callbacks_chain(ptr_instance, pAllocator);
 
     loader_instance_heap_free(ptr_instance, ptr_instance->disp);
+    loader_platform_thread_delete_mutex(&ptr_instance->unknown_function_lock);
+    loader_platform_thread_delete_mutex(&ptr_instance->device_list_lock);
+    loader_platform_thread_delete_mutex(&ptr_instance->instance_lock);
     loader_instance_heap_free(ptr_instance, ptr_instance);
-    loader_platform_thread_unlock_mutex(&loader_lock);
 
     // Unload preloaded layers, so if vkEnumerateInstanceExtensionProperties or vkCreateInstance is called again, the ICD's are up
     // to date
     loader_unload_preloaded_icds();
+
+    // Likewise drop the implicit layers cached by the calls made before the instance was created
+    loader_clear_implicit_layer_cache();
+
+    loader_trace_write();
 }
 
 LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDevices(VkInstance instance, uint32_t *pPhysicalDeviceCount,
@@ -716,8 +743,6 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDevices(VkInstan
     VkResult res = VK_SUCCESS;
     struct loader_instance *inst;
 
-    loader_platform_thread_lock_mutex(&loader_lock);
-
     inst = loader_get_instance(instance);
     if (NULL == inst) {
         loader_log(NULL, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_VALIDATION_BIT, 0,
@@ -733,6 +758,8 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDevices(VkInstan
         goto out;
     }
 
+    // No lock is taken here, the terminator locks the instance while it enumerates the drivers' physical devices and wrapping
+    // them for the application only locks it when they differ from the ones in the snapshot
     // Call down the chain to get the physical device info
     res = inst->disp->layer_inst_disp.EnumeratePhysicalDevices(inst->instance, pPhysicalDeviceCount, pPhysicalDevices);
 
@@ -746,7 +773,6 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDevices(VkInstan
 
 out:
 
-    loader_platform_thread_unlock_mutex(&loader_lock);
     return res;
 }
 
@@ -844,10 +870,8 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDevice(VkPhysicalDevice phy
                    "vkCreateDevice: Invalid physicalDevice [VUID-vkCreateDevice-physicalDevice-parameter]");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    loader_platform_thread_lock_mutex(&loader_lock);
-    VkResult res = loader_layer_create_device(NULL, physicalDevice, pCreateInfo, pAllocator, pDevice, NULL, NULL);
-    loader_platform_thread_unlock_mutex(&loader_lock);
-    return res;
+    // Nothing is locked across creating the device, the loader only locks the list of devices of the instance while adding to it
+    return loader_layer_create_device(NULL, physicalDevice, pCreateInfo, pAllocator, pDevice, NULL, NULL);
 }
 
 LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
@@ -863,11 +887,7 @@ LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyDevice(VkDevice device, const
         abort(); /* Intentionally fail so user can correct issue. */
     }
 
-    loader_platform_thread_lock_mutex(&loader_lock);
-
     loader_layer_destroy_device(device, pAllocator, disp->DestroyDevice);
-
-    loader_platform_thread_unlock_mutex(&loader_lock);
 }
 
 LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice,
@@ -884,16 +904,14 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionPropertie
         abort(); /* Intentionally fail so user can correct issue. */
     }
 
-    loader_platform_thread_lock_mutex(&loader_lock);
-
     // always pass this call down the instance chain which will terminate
     // in the ICD. This allows layers to filter the extensions coming back
     // up the chain. In the terminator we look up layer extensions from the
-    // manifest file if it wasn't provided by the layer itself.
+    // manifest file if it wasn't provided by the layer itself. The layer and extension lists this reads don't change once the
+    // instance is created, so no lock is needed.
     disp = loader_get_instance_layer_dispatch(physicalDevice);
     res = disp->EnumerateDeviceExtensionProperties(phys_dev->phys_dev, pLayerName, pPropertyCount, pProperties);
 
-    loader_platform_thread_unlock_mutex(&loader_lock);
     return res;
 }
 
@@ -902,9 +920,6 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceLayerProperties(Vk
                                                                               VkLayerProperties *pProperties) {
     uint32_t copy_size;
     struct loader_physical_device_tramp *phys_dev;
-    struct loader_layer_list *enabled_layers, layers_list;
-    memset(&layers_list, 0, sizeof(layers_list));
-    loader_platform_thread_lock_mutex(&loader_lock);
 
     // Don't dispatch this call down the instance chain, want all device layers
     // enumerated and instance chain may not contain all device layers
@@ -916,32 +931,25 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceLayerProperties(Vk
         loader_log(NULL, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_VALIDATION_BIT, 0,
                    "vkEnumerateDeviceLayerProperties: Invalid physicalDevice "
                    "[VUID-vkEnumerateDeviceLayerProperties-physicalDevice-parameter]");
-        loader_platform_thread_unlock_mutex(&loader_lock);
         abort(); /* Intentionally fail so user can correct issue. */
     }
 
-    const struct loader_instance *inst = phys_dev->this_instance;
+    const struct loader_instance_snapshot *snapshot = loader_get_instance_snapshot(phys_dev->this_instance);
 
-    uint32_t count = inst->app_activated_layer_list.count;
+    uint32_t count = snapshot->layer_count;
     if (count == 0 || pProperties == NULL) {
         *pPropertyCount = count;
-        loader_platform_thread_unlock_mutex(&loader_lock);
         return VK_SUCCESS;
     }
-    enabled_layers = (struct loader_layer_list *)&inst->app_activated_layer_list;
 
     copy_size = (*pPropertyCount < count) ? *pPropertyCount : count;
-    for (uint32_t i = 0; i < copy_size; i++) {
-        memcpy(&pProperties[i], &(enabled_layers->list[i].info), sizeof(VkLayerProperties));
-    }
+    memcpy(pProperties, snapshot->layers, sizeof(VkLayerProperties) * copy_size);
     *pPropertyCount = copy_size;
 
     if (copy_size < count) {
-        loader_platform_thread_unlock_mutex(&loader_lock);
         return VK_INCOMPLETE;
     }
 
-    loader_platform_thread_unlock_mutex(&loader_lock);
     return VK_SUCCESS;
 }
 
@@ -2449,8 +2457,6 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDeviceGroups(
     VkResult res = VK_SUCCESS;
     struct loader_instance *inst = NULL;
 
-    loader_platform_thread_lock_mutex(&loader_lock);
-
     inst = loader_get_instance(instance);
     if (NULL == inst) {
         loader_log(
@@ -2467,6 +2473,7 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDeviceGroups(
         goto out;
     }
 
+    // Like vkEnumeratePhysicalDevices, only the terminator and wrapping changed physical devices lock the instance
     // Call down the chain to get the physical device group info.
     res = inst->disp->layer_inst_disp.EnumeratePhysicalDeviceGroups(inst->instance, pPhysicalDeviceGroupCount,
                                                                     pPhysicalDeviceGroupProperties);
@@ -2480,7 +2487,6 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDeviceGroups(
 
 out:
 
-    loader_platform_thread_unlock_mutex(&loader_lock);
     return res;
 }
 
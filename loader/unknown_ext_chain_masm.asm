@@ -37,21 +37,25 @@ public vkPhysDevExtTramp&num&
 vkPhysDevExtTramp&num&:
     mov     rax, qword ptr [rcx]                            ; Dereference the wrapped VkPhysicalDevice to get the dispatch table in rax
     mov     rcx, qword ptr [rcx + PHYS_DEV_OFFSET_PHYS_DEV_TRAMP]   ; Load the unwrapped VkPhysicalDevice into rcx
-    jmp     qword ptr [rax + (PHYS_DEV_OFFSET_INST_DISPATCH + (PTR_SIZE * num))] ; Jump to the next function in the chain, preserving the args in other registers
+    mov     rax, qword ptr [rax + (PHYS_DEV_OFFSET_INST_DISPATCH + (PTR_SIZE * (num SHR UNKNOWN_FUNCTION_CHUNK_SHIFT)))] ; Load the chunk holding the function
+    jmp     qword ptr [rax + (PTR_SIZE * (num AND UNKNOWN_FUNCTION_CHUNK_MASK))] ; Jump to the next function in the chain, preserving the args in other registers
 endm
 
 PhysDevExtTermin macro num
 public vkPhysDevExtTermin&num&
 vkPhysDevExtTermin&num&:
     mov     rax, qword ptr [rcx + ICD_TERM_OFFSET_PHYS_DEV_TERM]                ; Store the loader_icd_term* in rax
-    cmp     qword ptr [rax + (DISPATCH_OFFSET_ICD_TERM + (PTR_SIZE * num))], 0  ; Check if the next function in the chain is NULL
+    mov     r11, qword ptr [rax + (DISPATCH_OFFSET_ICD_TERM + (PTR_SIZE * (num SHR UNKNOWN_FUNCTION_CHUNK_SHIFT)))] ; Load the chunk holding the function
+    mov     r11, qword ptr [r11 + (PTR_SIZE * (num AND UNKNOWN_FUNCTION_CHUNK_MASK))] ; Load the next function in the chain into r11
+    test    r11, r11                                                            ; Check if the next function in the chain is NULL
     je      terminError&num&                                                    ; Go to the error section if it is NULL
     mov     rcx, qword ptr [rcx + PHYS_DEV_OFFSET_PHYS_DEV_TERM]                ; Load the unwrapped VkPhysicalDevice into the first arg
-    jmp     qword ptr [rax + (DISPATCH_OFFSET_ICD_TERM + (PTR_SIZE * num))]     ; Jump to the next function in the chain
+    jmp     r11                                                                 ; Jump to the next function in the chain
 terminError&num&:
     sub     rsp, 56                                                             ; Create the stack frame
     mov     rcx, qword ptr [rax + INSTANCE_OFFSET_ICD_TERM]                     ; Load the loader_instance into rcx (first arg)
-    mov     rax, qword ptr [rcx + (FUNCTION_OFFSET_INSTANCE + (CHAR_PTR_SIZE * num))] ; Load the func name into rax
+    mov     rax, qword ptr [rcx + (FUNCTION_OFFSET_INSTANCE + (PTR_SIZE * (num SHR UNKNOWN_FUNCTION_CHUNK_SHIFT)))] ; Load the chunk holding the func name
+    mov     rax, qword ptr [rax + (CHAR_PTR_SIZE * (num AND UNKNOWN_FUNCTION_CHUNK_MASK))] ; Load the func name into rax
     lea     r9, termin_error_string                                             ; Load the error string into r9 (fourth arg)
     xor     r8d, r8d                                                            ; Set r8 to zero (third arg)
     mov     qword ptr [rsp + 32], rax                                           ; Move the func name onto the stack (fifth arg)
@@ -66,7 +70,14 @@ DevExtTramp macro num
 public vkdev_ext&num&
 vkdev_ext&num&:
     mov     rax, qword ptr [rcx]                                               ; Dereference the handle to get the dispatch table
-    jmp     qword ptr [rax + (EXT_OFFSET_DEVICE_DISPATCH + (PTR_SIZE * num))]  ; Jump to the appropriate call chain
+    mov     rax, qword ptr [rax + (EXT_OFFSET_DEVICE_DISPATCH + (PTR_SIZE * (num SHR UNKNOWN_FUNCTION_CHUNK_SHIFT)))] ; Load the chunk holding the function
+    mov     rax, qword ptr [rax + (PTR_SIZE * (num AND UNKNOWN_FUNCTION_CHUNK_MASK))] ; Load the function out of the chunk
+    test    rax, rax                                                           ; Check if the function was resolved for this device yet
+    je      devExtResolve&num&                                                 ; Resolve it first if it wasn't
+    jmp     rax                                                                ; Jump to the appropriate call chain
+devExtResolve&num&:
+    mov     eax, num                                                           ; Pass the index of the function in eax
+    jmp     dev_ext_resolve
 endm
 
 ; 32-bit values and macro
@@ -79,7 +90,8 @@ _vkPhysDevExtTramp&num&@4:
     mov     ecx, [eax + PHYS_DEV_OFFSET_PHYS_DEV_TRAMP]     ; Load the unwrapped VkPhysicalDevice into ecx
     mov     [esp + 4], ecx                                  ; Overwrite the wrapped VkPhysicalDevice with the unwrapped one (on the stack)
     mov     eax, [eax]                                      ; Dereference the wrapped VkPhysicalDevice to get the dispatch table in eax
-    jmp     dword ptr [eax + (PHYS_DEV_OFFSET_INST_DISPATCH + (PTR_SIZE * num))] ; Jump to the next function in the chain, preserving the args on the stack
+    mov     eax, dword ptr [eax + (PHYS_DEV_OFFSET_INST_DISPATCH + (PTR_SIZE * (num SHR UNKNOWN_FUNCTION_CHUNK_SHIFT)))] ; Load the chunk holding the function
+    jmp     dword ptr [eax + (PTR_SIZE * (num AND UNKNOWN_FUNCTION_CHUNK_MASK))] ; Jump to the next function in the chain, preserving the args on the stack
 endm
 
 PhysDevExtTermin macro num
@@ -87,14 +99,17 @@ public _vkPhysDevExtTermin&num&@4
 _vkPhysDevExtTermin&num&@4:
     mov     ecx, dword ptr [esp + 4]                                            ; Move the wrapped VkPhysicalDevice into ecx
     mov     eax, dword ptr [ecx + ICD_TERM_OFFSET_PHYS_DEV_TERM]                ; Store the loader_icd_term* in eax
-    cmp     dword ptr [eax + (DISPATCH_OFFSET_ICD_TERM + (PTR_SIZE * num))], 0  ; Check if the next function in the chain is NULL
+    mov     edx, dword ptr [eax + (DISPATCH_OFFSET_ICD_TERM + (PTR_SIZE * (num SHR UNKNOWN_FUNCTION_CHUNK_SHIFT)))] ; Load the chunk holding the function
+    mov     edx, dword ptr [edx + (PTR_SIZE * (num AND UNKNOWN_FUNCTION_CHUNK_MASK))] ; Load the next function in the chain into edx
+    test    edx, edx                                                            ; Check if the next function in the chain is NULL
     je      terminError&num&                                                    ; Go to the error section if it is NULL
     mov     ecx, dword ptr [ecx + PHYS_DEV_OFFSET_PHYS_DEV_TERM]                ; Unwrap the VkPhysicalDevice in ecx
     mov     dword ptr [esp + 4], ecx                                            ; Copy the unwrapped VkPhysicalDevice into the first arg
-    jmp     dword ptr [eax + (DISPATCH_OFFSET_ICD_TERM + (PTR_SIZE * num))]     ; Jump to the next function in the chain
+    jmp     edx                                                                 ; Jump to the next function in the chain
 terminError&num&:
     mov     eax, dword ptr [eax + INSTANCE_OFFSET_ICD_TERM]                     ; Load the loader_instance into eax
-    push    dword ptr [eax + (FUNCTION_OFFSET_INSTANCE + (CHAR_PTR_SIZE * num))] ; Push the func name (fifth arg)
+    mov     edx, dword ptr [eax + (FUNCTION_OFFSET_INSTANCE + (PTR_SIZE * (num SHR UNKNOWN_FUNCTION_CHUNK_SHIFT)))] ; Load the chunk holding the func name
+    push    dword ptr [edx + (CHAR_PTR_SIZE * (num AND UNKNOWN_FUNCTION_CHUNK_MASK))] ; Push the func name (fifth arg)
     push    offset termin_error_string                                          ; Push the error string (fourth arg)
     push    0                                                                   ; Push zero (third arg)
     push    VULKAN_LOADER_ERROR_BIT                                             ; Push the error logging bit (second arg)
@@ -110,7 +125,14 @@ public _vkdev_ext&num&@4
 _vkdev_ext&num&@4:
     mov     eax, dword ptr [esp + 4]                                           ; Dereference the handle to get VkDevice chain_device
     mov     eax, dword ptr [eax]                                               ; Dereference the chain_device to get the loader_dispatch
-    jmp     dword ptr [eax + (EXT_OFFSET_DEVICE_DISPATCH + (PTR_SIZE * num))]  ; Jump to the appropriate call chain
+    mov     eax, dword ptr [eax + (EXT_OFFSET_DEVICE_DISPATCH + (PTR_SIZE * (num SHR UNKNOWN_FUNCTION_CHUNK_SHIFT)))] ; Load the chunk holding the function
+    mov     eax, dword ptr [eax + (PTR_SIZE * (num AND UNKNOWN_FUNCTION_CHUNK_MASK))] ; Load the function out of the chunk
+    test    eax, eax                                                           ; Check if the function was resolved for this device yet
+    je      devExtResolve&num&                                                 ; Resolve it first if it wasn't
+    jmp     eax                                                                ; Jump to the appropriate call chain
+devExtResolve&num&:
+    mov     eax, num                                                           ; Pass the index of the function in eax
+    jmp     dev_ext_resolve
 endm
 
 ; This is also needed for 32-bit only
@@ -121,12 +143,71 @@ ENDIF
 .const
     termin_error_string db 'Extension %s not supported for this physical device', 0
 
+.data
+
+; These trampolines resolve device functions on their first call, see unknown_function_handling.c
+IFDEF rax
+public loader_lazy_dev_ext_resolution
+    loader_lazy_dev_ext_resolution db 1
+ELSE
+public _loader_lazy_dev_ext_resolution
+    _loader_lazy_dev_ext_resolution db 1
+ENDIF
+
 .code
 
 IFDEF rax
 extrn loader_log:near
+extrn loader_resolve_dev_ext:near
 ELSE
 extrn _loader_log:near
+extrn _loader_resolve_dev_ext:near
+ENDIF
+
+; Reached from a device trampoline whose function wasn't resolved for the device yet, with the index of the function in eax.
+; loader_resolve_dev_ext stores the function in the dispatch table of the device and returns it, and everything the call could
+; have been passed in registers is kept intact around it.
+IFDEF rax
+; Unlike the trampolines this routine has a stack frame and calls into C, so it needs unwind data for exceptions and stack walks
+; that pass through it.
+dev_ext_resolve PROC FRAME
+    push    rcx                                                                 ; Save the integer argument registers
+    .pushreg rcx
+    push    rdx
+    .pushreg rdx
+    push    r8
+    .pushreg r8
+    push    r9
+    .pushreg r9
+    sub     rsp, 104                                                            ; Room for the vector argument registers and the shadow space
+    .allocstack 104
+    .endprolog
+    movdqu  xmmword ptr [rsp + 32], xmm0                                        ; Save the vector argument registers
+    movdqu  xmmword ptr [rsp + 48], xmm1
+    movdqu  xmmword ptr [rsp + 64], xmm2
+    movdqu  xmmword ptr [rsp + 80], xmm3
+    mov     edx, eax                                                            ; The index of the function (second arg), the handle is still in rcx
+    call    loader_resolve_dev_ext                                              ; Look up the function, which is returned in rax
+    movdqu  xmm0, xmmword ptr [rsp + 32]
+    movdqu  xmm1, xmmword ptr [rsp + 48]
+    movdqu  xmm2, xmmword ptr [rsp + 64]
+    movdqu  xmm3, xmmword ptr [rsp + 80]
+    add     rsp, 104
+    pop     r9
+    pop     r8
+    pop     rdx
+    pop     rcx
+    db      048h                                                                ; REX.W prefix, so the unwinder recognizes the jmp as the end of the epilogue
+    jmp     rax                                                                 ; Jump to the appropriate call chain
+dev_ext_resolve ENDP
+ELSE
+dev_ext_resolve:
+    sub     esp, 4                                                              ; Keep the stack aligned for the call
+    push    eax                                                                 ; Push the index of the function (second arg)
+    push    dword ptr [esp + 12]                                                ; Push the handle (first arg)
+    call    _loader_resolve_dev_ext                                             ; Look up the function, which is returned in eax
+    add     esp, 12                                                             ; Clean up the args
+    jmp     eax                                                                 ; Jump to the appropriate call chain
 ENDIF
 
     PhysDevExtTramp 0
@@ -379,6 +460,756 @@ ENDIF
     PhysDevExtTramp 247
     PhysDevExtTramp 248
     PhysDevExtTramp 249
+    PhysDevExtTramp 250
+    PhysDevExtTramp 251
+    PhysDevExtTramp 252
+    PhysDevExtTramp 253
+    PhysDevExtTramp 254
+    PhysDevExtTramp 255
+    PhysDevExtTramp 256
+    PhysDevExtTramp 257
+    PhysDevExtTramp 258
+    PhysDevExtTramp 259
+    PhysDevExtTramp 260
+    PhysDevExtTramp 261
+    PhysDevExtTramp 262
+    PhysDevExtTramp 263
+    PhysDevExtTramp 264
+    PhysDevExtTramp 265
+    PhysDevExtTramp 266
+    PhysDevExtTramp 267
+    PhysDevExtTramp 268
+    PhysDevExtTramp 269
+    PhysDevExtTramp 270
+    PhysDevExtTramp 271
+    PhysDevExtTramp 272
+    PhysDevExtTramp 273
+    PhysDevExtTramp 274
+    PhysDevExtTramp 275
+    PhysDevExtTramp 276
+    PhysDevExtTramp 277
+    PhysDevExtTramp 278
+    PhysDevExtTramp 279
+    PhysDevExtTramp 280
+    PhysDevExtTramp 281
+    PhysDevExtTramp 282
+    PhysDevExtTramp 283
+    PhysDevExtTramp 284
+    PhysDevExtTramp 285
+    PhysDevExtTramp 286
+    PhysDevExtTramp 287
+    PhysDevExtTramp 288
+    PhysDevExtTramp 289
+    PhysDevExtTramp 290
+    PhysDevExtTramp 291
+    PhysDevExtTramp 292
+    PhysDevExtTramp 293
+    PhysDevExtTramp 294
+    PhysDevExtTramp 295
+    PhysDevExtTramp 296
+    PhysDevExtTramp 297
+    PhysDevExtTramp 298
+    PhysDevExtTramp 299
+    PhysDevExtTramp 300
+    PhysDevExtTramp 301
+    PhysDevExtTramp 302
+    PhysDevExtTramp 303
+    PhysDevExtTramp 304
+    PhysDevExtTramp 305
+    PhysDevExtTramp 306
+    PhysDevExtTramp 307
+    PhysDevExtTramp 308
+    PhysDevExtTramp 309
+    PhysDevExtTramp 310
+    PhysDevExtTramp 311
+    PhysDevExtTramp 312
+    PhysDevExtTramp 313
+    PhysDevExtTramp 314
+    PhysDevExtTramp 315
+    PhysDevExtTramp 316
+    PhysDevExtTramp 317
+    PhysDevExtTramp 318
+    PhysDevExtTramp 319
+    PhysDevExtTramp 320
+    PhysDevExtTramp 321
+    PhysDevExtTramp 322
+    PhysDevExtTramp 323
+    PhysDevExtTramp 324
+    PhysDevExtTramp 325
+    PhysDevExtTramp 326
+    PhysDevExtTramp 327
+    PhysDevExtTramp 328
+    PhysDevExtTramp 329
+    PhysDevExtTramp 330
+    PhysDevExtTramp 331
+    PhysDevExtTramp 332
+    PhysDevExtTramp 333
+    PhysDevExtTramp 334
+    PhysDevExtTramp 335
+    PhysDevExtTramp 336
+    PhysDevExtTramp 337
+    PhysDevExtTramp 338
+    PhysDevExtTramp 339
+    PhysDevExtTramp 340
+    PhysDevExtTramp 341
+    PhysDevExtTramp 342
+    PhysDevExtTramp 343
+    PhysDevExtTramp 344
+    PhysDevExtTramp 345
+    PhysDevExtTramp 346
+    PhysDevExtTramp 347
+    PhysDevExtTramp 348
+    PhysDevExtTramp 349
+    PhysDevExtTramp 350
+    PhysDevExtTramp 351
+    PhysDevExtTramp 352
+    PhysDevExtTramp 353
+    PhysDevExtTramp 354
+    PhysDevExtTramp 355
+    PhysDevExtTramp 356
+    PhysDevExtTramp 357
+    PhysDevExtTramp 358
+    PhysDevExtTramp 359
+    PhysDevExtTramp 360
+    PhysDevExtTramp 361
+    PhysDevExtTramp 362
+    PhysDevExtTramp 363
+    PhysDevExtTramp 364
+    PhysDevExtTramp 365
+    PhysDevExtTramp 366
+    PhysDevExtTramp 367
+    PhysDevExtTramp 368
+    PhysDevExtTramp 369
+    PhysDevExtTramp 370
+    PhysDevExtTramp 371
+    PhysDevExtTramp 372
+    PhysDevExtTramp 373
+    PhysDevExtTramp 374
+    PhysDevExtTramp 375
+    PhysDevExtTramp 376
+    PhysDevExtTramp 377
+    PhysDevExtTramp 378
+    PhysDevExtTramp 379
+    PhysDevExtTramp 380
+    PhysDevExtTramp 381
+    PhysDevExtTramp 382
+    PhysDevExtTramp 383
+    PhysDevExtTramp 384
+    PhysDevExtTramp 385
+    PhysDevExtTramp 386
+    PhysDevExtTramp 387
+    PhysDevExtTramp 388
+    PhysDevExtTramp 389
+    PhysDevExtTramp 390
+    PhysDevExtTramp 391
+    PhysDevExtTramp 392
+    PhysDevExtTramp 393
+    PhysDevExtTramp 394
+    PhysDevExtTramp 395
+    PhysDevExtTramp 396
+    PhysDevExtTramp 397
+    PhysDevExtTramp 398
+    PhysDevExtTramp 399
+    PhysDevExtTramp 400
+    PhysDevExtTramp 401
+    PhysDevExtTramp 402
+    PhysDevExtTramp 403
+    PhysDevExtTramp 404
+    PhysDevExtTramp 405
+    PhysDevExtTramp 406
+    PhysDevExtTramp 407
+    PhysDevExtTramp 408
+    PhysDevExtTramp 409
+    PhysDevExtTramp 410
+    PhysDevExtTramp 411
+    PhysDevExtTramp 412
+    PhysDevExtTramp 413
+    PhysDevExtTramp 414
+    PhysDevExtTramp 415
+    PhysDevExtTramp 416
+    PhysDevExtTramp 417
+    PhysDevExtTramp 418
+    PhysDevExtTramp 419
+    PhysDevExtTramp 420
+    PhysDevExtTramp 421
+    PhysDevExtTramp 422
+    PhysDevExtTramp 423
+    PhysDevExtTramp 424
+    PhysDevExtTramp 425
+    PhysDevExtTramp 426
+    PhysDevExtTramp 427
+    PhysDevExtTramp 428
+    PhysDevExtTramp 429
+    PhysDevExtTramp 430
+    PhysDevExtTramp 431
+    PhysDevExtTramp 432
+    PhysDevExtTramp 433
+    PhysDevExtTramp 434
+    PhysDevExtTramp 435
+    PhysDevExtTramp 436
+    PhysDevExtTramp 437
+    PhysDevExtTramp 438
+    PhysDevExtTramp 439
+    PhysDevExtTramp 440
+    PhysDevExtTramp 441
+    PhysDevExtTramp 442
+    PhysDevExtTramp 443
+    PhysDevExtTramp 444
+    PhysDevExtTramp 445
+    PhysDevExtTramp 446
+    PhysDevExtTramp 447
+    PhysDevExtTramp 448
+    PhysDevExtTramp 449
+    PhysDevExtTramp 450
+    PhysDevExtTramp 451
+    PhysDevExtTramp 452
+    PhysDevExtTramp 453
+    PhysDevExtTramp 454
+    PhysDevExtTramp 455
+    PhysDevExtTramp 456
+    PhysDevExtTramp 457
+    PhysDevExtTramp 458
+    PhysDevExtTramp 459
+    PhysDevExtTramp 460
+    PhysDevExtTramp 461
+    PhysDevExtTramp 462
+    PhysDevExtTramp 463
+    PhysDevExtTramp 464
+    PhysDevExtTramp 465
+    PhysDevExtTramp 466
+    PhysDevExtTramp 467
+    PhysDevExtTramp 468
+    PhysDevExtTramp 469
+    PhysDevExtTramp 470
+    PhysDevExtTramp 471
+    PhysDevExtTramp 472
+    PhysDevExtTramp 473
+    PhysDevExtTramp 474
+    PhysDevExtTramp 475
+    PhysDevExtTramp 476
+    PhysDevExtTramp 477
+    PhysDevExtTramp 478
+    PhysDevExtTramp 479
+    PhysDevExtTramp 480
+    PhysDevExtTramp 481
+    PhysDevExtTramp 482
+    PhysDevExtTramp 483
+    PhysDevExtTramp 484
+    PhysDevExtTramp 485
+    PhysDevExtTramp 486
+    PhysDevExtTramp 487
+    PhysDevExtTramp 488
+    PhysDevExtTramp 489
+    PhysDevExtTramp 490
+    PhysDevExtTramp 491
+    PhysDevExtTramp 492
+    PhysDevExtTramp 493
+    PhysDevExtTramp 494
+    PhysDevExtTramp 495
+    PhysDevExtTramp 496
+    PhysDevExtTramp 497
+    PhysDevExtTramp 498
+    PhysDevExtTramp 499
+    PhysDevExtTramp 500
+    PhysDevExtTramp 501
+    PhysDevExtTramp 502
+    PhysDevExtTramp 503
+    PhysDevExtTramp 504
+    PhysDevExtTramp 505
+    PhysDevExtTramp 506
+    PhysDevExtTramp 507
+    PhysDevExtTramp 508
+    PhysDevExtTramp 509
+    PhysDevExtTramp 510
+    PhysDevExtTramp 511
+    PhysDevExtTramp 512
+    PhysDevExtTramp 513
+    PhysDevExtTramp 514
+    PhysDevExtTramp 515
+    PhysDevExtTramp 516
+    PhysDevExtTramp 517
+    PhysDevExtTramp 518
+    PhysDevExtTramp 519
+    PhysDevExtTramp 520
+    PhysDevExtTramp 521
+    PhysDevExtTramp 522
+    PhysDevExtTramp 523
+    PhysDevExtTramp 524
+    PhysDevExtTramp 525
+    PhysDevExtTramp 526
+    PhysDevExtTramp 527
+    PhysDevExtTramp 528
+    PhysDevExtTramp 529
+    PhysDevExtTramp 530
+    PhysDevExtTramp 531
+    PhysDevExtTramp 532
+    PhysDevExtTramp 533
+    PhysDevExtTramp 534
+    PhysDevExtTramp 535
+    PhysDevExtTramp 536
+    PhysDevExtTramp 537
+    PhysDevExtTramp 538
+    PhysDevExtTramp 539
+    PhysDevExtTramp 540
+    PhysDevExtTramp 541
+    PhysDevExtTramp 542
+    PhysDevExtTramp 543
+    PhysDevExtTramp 544
+    PhysDevExtTramp 545
+    PhysDevExtTramp 546
+    PhysDevExtTramp 547
+    PhysDevExtTramp 548
+    PhysDevExtTramp 549
+    PhysDevExtTramp 550
+    PhysDevExtTramp 551
+    PhysDevExtTramp 552
+    PhysDevExtTramp 553
+    PhysDevExtTramp 554
+    PhysDevExtTramp 555
+    PhysDevExtTramp 556
+    PhysDevExtTramp 557
+    PhysDevExtTramp 558
+    PhysDevExtTramp 559
+    PhysDevExtTramp 560
+    PhysDevExtTramp 561
+    PhysDevExtTramp 562
+    PhysDevExtTramp 563
+    PhysDevExtTramp 564
+    PhysDevExtTramp 565
+    PhysDevExtTramp 566
+    PhysDevExtTramp 567
+    PhysDevExtTramp 568
+    PhysDevExtTramp 569
+    PhysDevExtTramp 570
+    PhysDevExtTramp 571
+    PhysDevExtTramp 572
+    PhysDevExtTramp 573
+    PhysDevExtTramp 574
+    PhysDevExtTramp 575
+    PhysDevExtTramp 576
+    PhysDevExtTramp 577
+    PhysDevExtTramp 578
+    PhysDevExtTramp 579
+    PhysDevExtTramp 580
+    PhysDevExtTramp 581
+    PhysDevExtTramp 582
+    PhysDevExtTramp 583
+    PhysDevExtTramp 584
+    PhysDevExtTramp 585
+    PhysDevExtTramp 586
+    PhysDevExtTramp 587
+    PhysDevExtTramp 588
+    PhysDevExtTramp 589
+    PhysDevExtTramp 590
+    PhysDevExtTramp 591
+    PhysDevExtTramp 592
+    PhysDevExtTramp 593
+    PhysDevExtTramp 594
+    PhysDevExtTramp 595
+    PhysDevExtTramp 596
+    PhysDevExtTramp 597
+    PhysDevExtTramp 598
+    PhysDevExtTramp 599
+    PhysDevExtTramp 600
+    PhysDevExtTramp 601
+    PhysDevExtTramp 602
+    PhysDevExtTramp 603
+    PhysDevExtTramp 604
+    PhysDevExtTramp 605
+    PhysDevExtTramp 606
+    PhysDevExtTramp 607
+    PhysDevExtTramp 608
+    PhysDevExtTramp 609
+    PhysDevExtTramp 610
+    PhysDevExtTramp 611
+    PhysDevExtTramp 612
+    PhysDevExtTramp 613
+    PhysDevExtTramp 614
+    PhysDevExtTramp 615
+    PhysDevExtTramp 616
+    PhysDevExtTramp 617
+    PhysDevExtTramp 618
+    PhysDevExtTramp 619
+    PhysDevExtTramp 620
+    PhysDevExtTramp 621
+    PhysDevExtTramp 622
+    PhysDevExtTramp 623
+    PhysDevExtTramp 624
+    PhysDevExtTramp 625
+    PhysDevExtTramp 626
+    PhysDevExtTramp 627
+    PhysDevExtTramp 628
+    PhysDevExtTramp 629
+    PhysDevExtTramp 630
+    PhysDevExtTramp 631
+    PhysDevExtTramp 632
+    PhysDevExtTramp 633
+    PhysDevExtTramp 634
+    PhysDevExtTramp 635
+    PhysDevExtTramp 636
+    PhysDevExtTramp 637
+    PhysDevExtTramp 638
+    PhysDevExtTramp 639
+    PhysDevExtTramp 640
+    PhysDevExtTramp 641
+    PhysDevExtTramp 642
+    PhysDevExtTramp 643
+    PhysDevExtTramp 644
+    PhysDevExtTramp 645
+    PhysDevExtTramp 646
+    PhysDevExtTramp 647
+    PhysDevExtTramp 648
+    PhysDevExtTramp 649
+    PhysDevExtTramp 650
+    PhysDevExtTramp 651
+    PhysDevExtTramp 652
+    PhysDevExtTramp 653
+    PhysDevExtTramp 654
+    PhysDevExtTramp 655
+    PhysDevExtTramp 656
+    PhysDevExtTramp 657
+    PhysDevExtTramp 658
+    PhysDevExtTramp 659
+    PhysDevExtTramp 660
+    PhysDevExtTramp 661
+    PhysDevExtTramp 662
+    PhysDevExtTramp 663
+    PhysDevExtTramp 664
+    PhysDevExtTramp 665
+    PhysDevExtTramp 666
+    PhysDevExtTramp 667
+    PhysDevExtTramp 668
+    PhysDevExtTramp 669
+    PhysDevExtTramp 670
+    PhysDevExtTramp 671
+    PhysDevExtTramp 672
+    PhysDevExtTramp 673
+    PhysDevExtTramp 674
+    PhysDevExtTramp 675
+    PhysDevExtTramp 676
+    PhysDevExtTramp 677
+    PhysDevExtTramp 678
+    PhysDevExtTramp 679
+    PhysDevExtTramp 680
+    PhysDevExtTramp 681
+    PhysDevExtTramp 682
+    PhysDevExtTramp 683
+    PhysDevExtTramp 684
+    PhysDevExtTramp 685
+    PhysDevExtTramp 686
+    PhysDevExtTramp 687
+    PhysDevExtTramp 688
+    PhysDevExtTramp 689
+    PhysDevExtTramp 690
+    PhysDevExtTramp 691
+    PhysDevExtTramp 692
+    PhysDevExtTramp 693
+    PhysDevExtTramp 694
+    PhysDevExtTramp 695
+    PhysDevExtTramp 696
+    PhysDevExtTramp 697
+    PhysDevExtTramp 698
+    PhysDevExtTramp 699
+    PhysDevExtTramp 700
+    PhysDevExtTramp 701
+    PhysDevExtTramp 702
+    PhysDevExtTramp 703
+    PhysDevExtTramp 704
+    PhysDevExtTramp 705
+    PhysDevExtTramp 706
+    PhysDevExtTramp 707
+    PhysDevExtTramp 708
+    PhysDevExtTramp 709
+    PhysDevExtTramp 710
+    PhysDevExtTramp 711
+    PhysDevExtTramp 712
+    PhysDevExtTramp 713
+    PhysDevExtTramp 714
+    PhysDevExtTramp 715
+    PhysDevExtTramp 716
+    PhysDevExtTramp 717
+    PhysDevExtTramp 718
+    PhysDevExtTramp 719
+    PhysDevExtTramp 720
+    PhysDevExtTramp 721
+    PhysDevExtTramp 722
+    PhysDevExtTramp 723
+    PhysDevExtTramp 724
+    PhysDevExtTramp 725
+    PhysDevExtTramp 726
+    PhysDevExtTramp 727
+    PhysDevExtTramp 728
+    PhysDevExtTramp 729
+    PhysDevExtTramp 730
+    PhysDevExtTramp 731
+    PhysDevExtTramp 732
+    PhysDevExtTramp 733
+    PhysDevExtTramp 734
+    PhysDevExtTramp 735
+    PhysDevExtTramp 736
+    PhysDevExtTramp 737
+    PhysDevExtTramp 738
+    PhysDevExtTramp 739
+    PhysDevExtTramp 740
+    PhysDevExtTramp 741
+    PhysDevExtTramp 742
+    PhysDevExtTramp 743
+    PhysDevExtTramp 744
+    PhysDevExtTramp 745
+    PhysDevExtTramp 746
+    PhysDevExtTramp 747
+    PhysDevExtTramp 748
+    PhysDevExtTramp 749
+    PhysDevExtTramp 750
+    PhysDevExtTramp 751
+    PhysDevExtTramp 752
+    PhysDevExtTramp 753
+    PhysDevExtTramp 754
+    PhysDevExtTramp 755
+    PhysDevExtTramp 756
+    PhysDevExtTramp 757
+    PhysDevExtTramp 758
+    PhysDevExtTramp 759
+    PhysDevExtTramp 760
+    PhysDevExtTramp 761
+    PhysDevExtTramp 762
+    PhysDevExtTramp 763
+    PhysDevExtTramp 764
+    PhysDevExtTramp 765
+    PhysDevExtTramp 766
+    PhysDevExtTramp 767
+    PhysDevExtTramp 768
+    PhysDevExtTramp 769
+    PhysDevExtTramp 770
+    PhysDevExtTramp 771
+    PhysDevExtTramp 772
+    PhysDevExtTramp 773
+    PhysDevExtTramp 774
+    PhysDevExtTramp 775
+    PhysDevExtTramp 776
+    PhysDevExtTramp 777
+    PhysDevExtTramp 778
+    PhysDevExtTramp 779
+    PhysDevExtTramp 780
+    PhysDevExtTramp 781
+    PhysDevExtTramp 782
+    PhysDevExtTramp 783
+    PhysDevExtTramp 784
+    PhysDevExtTramp 785
+    PhysDevExtTramp 786
+    PhysDevExtTramp 787
+    PhysDevExtTramp 788
+    PhysDevExtTramp 789
+    PhysDevExtTramp 790
+    PhysDevExtTramp 791
+    PhysDevExtTramp 792
+    PhysDevExtTramp 793
+    PhysDevExtTramp 794
+    PhysDevExtTramp 795
+    PhysDevExtTramp 796
+    PhysDevExtTramp 797
+    PhysDevExtTramp 798
+    PhysDevExtTramp 799
+    PhysDevExtTramp 800
+    PhysDevExtTramp 801
+    PhysDevExtTramp 802
+    PhysDevExtTramp 803
+    PhysDevExtTramp 804
+    PhysDevExtTramp 805
+    PhysDevExtTramp 806
+    PhysDevExtTramp 807
+    PhysDevExtTramp 808
+    PhysDevExtTramp 809
+    PhysDevExtTramp 810
+    PhysDevExtTramp 811
+    PhysDevExtTramp 812
+    PhysDevExtTramp 813
+    PhysDevExtTramp 814
+    PhysDevExtTramp 815
+    PhysDevExtTramp 816
+    PhysDevExtTramp 817
+    PhysDevExtTramp 818
+    PhysDevExtTramp 819
+    PhysDevExtTramp 820
+    PhysDevExtTramp 821
+    PhysDevExtTramp 822
+    PhysDevExtTramp 823
+    PhysDevExtTramp 824
+    PhysDevExtTramp 825
+    PhysDevExtTramp 826
+    PhysDevExtTramp 827
+    PhysDevExtTramp 828
+    PhysDevExtTramp 829
+    PhysDevExtTramp 830
+    PhysDevExtTramp 831
+    PhysDevExtTramp 832
+    PhysDevExtTramp 833
+    PhysDevExtTramp 834
+    PhysDevExtTramp 835
+    PhysDevExtTramp 836
+    PhysDevExtTramp 837
+    PhysDevExtTramp 838
+    PhysDevExtTramp 839
+    PhysDevExtTramp 840
+    PhysDevExtTramp 841
+    PhysDevExtTramp 842
+    PhysDevExtTramp 843
+    PhysDevExtTramp 844
+    PhysDevExtTramp 845
+    PhysDevExtTramp 846
+    PhysDevExtTramp 847
+    PhysDevExtTramp 848
+    PhysDevExtTramp 849
+    PhysDevExtTramp 850
+    PhysDevExtTramp 851
+    PhysDevExtTramp 852
+    PhysDevExtTramp 853
+    PhysDevExtTramp 854
+    PhysDevExtTramp 855
+    PhysDevExtTramp 856
+    PhysDevExtTramp 857
+    PhysDevExtTramp 858
+    PhysDevExtTramp 859
+    PhysDevExtTramp 860
+    PhysDevExtTramp 861
+    PhysDevExtTramp 862
+    PhysDevExtTramp 863
+    PhysDevExtTramp 864
+    PhysDevExtTramp 865
+    PhysDevExtTramp 866
+    PhysDevExtTramp 867
+    PhysDevExtTramp 868
+    PhysDevExtTramp 869
+    PhysDevExtTramp 870
+    PhysDevExtTramp 871
+    PhysDevExtTramp 872
+    PhysDevExtTramp 873
+    PhysDevExtTramp 874
+    PhysDevExtTramp 875
+    PhysDevExtTramp 876
+    PhysDevExtTramp 877
+    PhysDevExtTramp 878
+    PhysDevExtTramp 879
+    PhysDevExtTramp 880
+    PhysDevExtTramp 881
+    PhysDevExtTramp 882
+    PhysDevExtTramp 883
+    PhysDevExtTramp 884
+    PhysDevExtTramp 885
+    PhysDevExtTramp 886
+    PhysDevExtTramp 887
+    PhysDevExtTramp 888
+    PhysDevExtTramp 889
+    PhysDevExtTramp 890
+    PhysDevExtTramp 891
+    PhysDevExtTramp 892
+    PhysDevExtTramp 893
+    PhysDevExtTramp 894
+    PhysDevExtTramp 895
+    PhysDevExtTramp 896
+    PhysDevExtTramp 897
+    PhysDevExtTramp 898
+    PhysDevExtTramp 899
+    PhysDevExtTramp 900
+    PhysDevExtTramp 901
+    PhysDevExtTramp 902
+    PhysDevExtTramp 903
+    PhysDevExtTramp 904
+    PhysDevExtTramp 905
+    PhysDevExtTramp 906
+    PhysDevExtTramp 907
+    PhysDevExtTramp 908
+    PhysDevExtTramp 909
+    PhysDevExtTramp 910
+    PhysDevExtTramp 911
+    PhysDevExtTramp 912
+    PhysDevExtTramp 913
+    PhysDevExtTramp 914
+    PhysDevExtTramp 915
+    PhysDevExtTramp 916
+    PhysDevExtTramp 917
+    PhysDevExtTramp 918
+    PhysDevExtTramp 919
+    PhysDevExtTramp 920
+    PhysDevExtTramp 921
+    PhysDevExtTramp 922
+    PhysDevExtTramp 923
+    PhysDevExtTramp 924
+    PhysDevExtTramp 925
+    PhysDevExtTramp 926
+    PhysDevExtTramp 927
+    PhysDevExtTramp 928
+    PhysDevExtTramp 929
+    PhysDevExtTramp 930
+    PhysDevExtTramp 931
+    PhysDevExtTramp 932
+    PhysDevExtTramp 933
+    PhysDevExtTramp 934
+    PhysDevExtTramp 935
+    PhysDevExtTramp 936
+    PhysDevExtTramp 937
+    PhysDevExtTramp 938
+    PhysDevExtTramp 939
+    PhysDevExtTramp 940
+    PhysDevExtTramp 941
+    PhysDevExtTramp 942
+    PhysDevExtTramp 943
+    PhysDevExtTramp 944
+    PhysDevExtTramp 945
+    PhysDevExtTramp 946
+    PhysDevExtTramp 947
+    PhysDevExtTramp 948
+    PhysDevExtTramp 949
+    PhysDevExtTramp 950
+    PhysDevExtTramp 951
+    PhysDevExtTramp 952
+    PhysDevExtTramp 953
+    PhysDevExtTramp 954
+    PhysDevExtTramp 955
+    PhysDevExtTramp 956
+    PhysDevExtTramp 957
+    PhysDevExtTramp 958
+    PhysDevExtTramp 959
+    PhysDevExtTramp 960
+    PhysDevExtTramp 961
+    PhysDevExtTramp 962
+    PhysDevExtTramp 963
+    PhysDevExtTramp 964
+    PhysDevExtTramp 965
+    PhysDevExtTramp 966
+    PhysDevExtTramp 967
+    PhysDevExtTramp 968
+    PhysDevExtTramp 969
+    PhysDevExtTramp 970
+    PhysDevExtTramp 971
+    PhysDevExtTramp 972
+    PhysDevExtTramp 973
+    PhysDevExtTramp 974
+    PhysDevExtTramp 975
+    PhysDevExtTramp 976
+    PhysDevExtTramp 977
+    PhysDevExtTramp 978
+    PhysDevExtTramp 979
+    PhysDevExtTramp 980
+    PhysDevExtTramp 981
+    PhysDevExtTramp 982
+    PhysDevExtTramp 983
+    PhysDevExtTramp 984
+    PhysDevExtTramp 985
+    PhysDevExtTramp 986
+    PhysDevExtTramp 987
+    PhysDevExtTramp 988
+    PhysDevExtTramp 989
+    PhysDevExtTramp 990
+    PhysDevExtTramp 991
+    PhysDevExtTramp 992
+    PhysDevExtTramp 993
+    PhysDevExtTramp 994
+    PhysDevExtTramp 995
+    PhysDevExtTramp 996
+    PhysDevExtTramp 997
+    PhysDevExtTramp 998
+    PhysDevExtTramp 999
 
     PhysDevExtTermin 0
     PhysDevExtTermin 1
@@ -630,6 +1461,756 @@ ENDIF
     PhysDevExtTermin 247
     PhysDevExtTermin 248
     PhysDevExtTermin 249
+    PhysDevExtTermin 250
+    PhysDevExtTermin 251
+    PhysDevExtTermin 252
+    PhysDevExtTermin 253
+    PhysDevExtTermin 254
+    PhysDevExtTermin 255
+    PhysDevExtTermin 256
+    PhysDevExtTermin 257
+    PhysDevExtTermin 258
+    PhysDevExtTermin 259
+    PhysDevExtTermin 260
+    PhysDevExtTermin 261
+    PhysDevExtTermin 262
+    PhysDevExtTermin 263
+    PhysDevExtTermin 264
+    PhysDevExtTermin 265
+    PhysDevExtTermin 266
+    PhysDevExtTermin 267
+    PhysDevExtTermin 268
+    PhysDevExtTermin 269
+    PhysDevExtTermin 270
+    PhysDevExtTermin 271
+    PhysDevExtTermin 272
+    PhysDevExtTermin 273
+    PhysDevExtTermin 274
+    PhysDevExtTermin 275
+    PhysDevExtTermin 276
+    PhysDevExtTermin 277
+    PhysDevExtTermin 278
+    PhysDevExtTermin 279
+    PhysDevExtTermin 280
+    PhysDevExtTermin 281
+    PhysDevExtTermin 282
+    PhysDevExtTermin 283
+    PhysDevExtTermin 284
+    PhysDevExtTermin 285
+    PhysDevExtTermin 286
+    PhysDevExtTermin 287
+    PhysDevExtTermin 288
+    PhysDevExtTermin 289
+    PhysDevExtTermin 290
+    PhysDevExtTermin 291
+    PhysDevExtTermin 292
+    PhysDevExtTermin 293
+    PhysDevExtTermin 294
+    PhysDevExtTermin 295
+    PhysDevExtTermin 296
+    PhysDevExtTermin 297
+    PhysDevExtTermin 298
+    PhysDevExtTermin 299
+    PhysDevExtTermin 300
+    PhysDevExtTermin 301
+    PhysDevExtTermin 302
+    PhysDevExtTermin 303
+    PhysDevExtTermin 304
+    PhysDevExtTermin 305
+    PhysDevExtTermin 306
+    PhysDevExtTermin 307
+    PhysDevExtTermin 308
+    PhysDevExtTermin 309
+    PhysDevExtTermin 310
+    PhysDevExtTermin 311
+    PhysDevExtTermin 312
+    PhysDevExtTermin 313
+    PhysDevExtTermin 314
+    PhysDevExtTermin 315
+    PhysDevExtTermin 316
+    PhysDevExtTermin 317
+    PhysDevExtTermin 318
+    PhysDevExtTermin 319
+    PhysDevExtTermin 320
+    PhysDevExtTermin 321
+    PhysDevExtTermin 322
+    PhysDevExtTermin 323
+    PhysDevExtTermin 324
+    PhysDevExtTermin 325
+    PhysDevExtTermin 326
+    PhysDevExtTermin 327
+    PhysDevExtTermin 328
+    PhysDevExtTermin 329
+    PhysDevExtTermin 330
+    PhysDevExtTermin 331
+    PhysDevExtTermin 332
+    PhysDevExtTermin 333
+    PhysDevExtTermin 334
+    PhysDevExtTermin 335
+    PhysDevExtTermin 336
+    PhysDevExtTermin 337
+    PhysDevExtTermin 338
+    PhysDevExtTermin 339
+    PhysDevExtTermin 340
+    PhysDevExtTermin 341
+    PhysDevExtTermin 342
+    PhysDevExtTermin 343
+    PhysDevExtTermin 344
+    PhysDevExtTermin 345
+    PhysDevExtTermin 346
+    PhysDevExtTermin 347
+    PhysDevExtTermin 348
+    PhysDevExtTermin 349
+    PhysDevExtTermin 350
+    PhysDevExtTermin 351
+    PhysDevExtTermin 352
+    PhysDevExtTermin 353
+    PhysDevExtTermin 354
+    PhysDevExtTermin 355
+    PhysDevExtTermin 356
+    PhysDevExtTermin 357
+    PhysDevExtTermin 358
+    PhysDevExtTermin 359
+    PhysDevExtTermin 360
+    PhysDevExtTermin 361
+    PhysDevExtTermin 362
+    PhysDevExtTermin 363
+    PhysDevExtTermin 364
+    PhysDevExtTermin 365
+    PhysDevExtTermin 366
+    PhysDevExtTermin 367
+    PhysDevExtTermin 368
+    PhysDevExtTermin 369
+    PhysDevExtTermin 370
+    PhysDevExtTermin 371
+    PhysDevExtTermin 372
+    PhysDevExtTermin 373
+    PhysDevExtTermin 374
+    PhysDevExtTermin 375
+    PhysDevExtTermin 376
+    PhysDevExtTermin 377
+    PhysDevExtTermin 378
+    PhysDevExtTermin 379
+    PhysDevExtTermin 380
+    PhysDevExtTermin 381
+    PhysDevExtTermin 382
+    PhysDevExtTermin 383
+    PhysDevExtTermin 384
+    PhysDevExtTermin 385
+    PhysDevExtTermin 386
+    PhysDevExtTermin 387
+    PhysDevExtTermin 388
+    PhysDevExtTermin 389
+    PhysDevExtTermin 390
+    PhysDevExtTermin 391
+    PhysDevExtTermin 392
+    PhysDevExtTermin 393
+    PhysDevExtTermin 394
+    PhysDevExtTermin 395
+    PhysDevExtTermin 396
+    PhysDevExtTermin 397
+    PhysDevExtTermin 398
+    PhysDevExtTermin 399
+    PhysDevExtTermin 400
+    PhysDevExtTermin 401
+    PhysDevExtTermin 402
+    PhysDevExtTermin 403
+    PhysDevExtTermin 404
+    PhysDevExtTermin 405
+    PhysDevExtTermin 406
+    PhysDevExtTermin 407
+    PhysDevExtTermin 408
+    PhysDevExtTermin 409
+    PhysDevExtTermin 410
+    PhysDevExtTermin 411
+    PhysDevExtTermin 412
+    PhysDevExtTermin 413
+    PhysDevExtTermin 414
+    PhysDevExtTermin 415
+    PhysDevExtTermin 416
+    PhysDevExtTermin 417
+    PhysDevExtTermin 418
+    PhysDevExtTermin 419
+    PhysDevExtTermin 420
+    PhysDevExtTermin 421
+    PhysDevExtTermin 422
+    PhysDevExtTermin 423
+    PhysDevExtTermin 424
+    PhysDevExtTermin 425
+    PhysDevExtTermin 426
+    PhysDevExtTermin 427
+    PhysDevExtTermin 428
+    PhysDevExtTermin 429
+    PhysDevExtTermin 430
+    PhysDevExtTermin 431
+    PhysDevExtTermin 432
+    PhysDevExtTermin 433
+    PhysDevExtTermin 434
+    PhysDevExtTermin 435
+    PhysDevExtTermin 436
+    PhysDevExtTermin 437
+    PhysDevExtTermin 438
+    PhysDevExtTermin 439
+    PhysDevExtTermin 440
+    PhysDevExtTermin 441
+    PhysDevExtTermin 442
+    PhysDevExtTermin 443
+    PhysDevExtTermin 444
+    PhysDevExtTermin 445
+    PhysDevExtTermin 446
+    PhysDevExtTermin 447
+    PhysDevExtTermin 448
+    PhysDevExtTermin 449
+    PhysDevExtTermin 450
+    PhysDevExtTermin 451
+    PhysDevExtTermin 452
+    PhysDevExtTermin 453
+    PhysDevExtTermin 454
+    PhysDevExtTermin 455
+    PhysDevExtTermin 456
+    PhysDevExtTermin 457
+    PhysDevExtTermin 458
+    PhysDevExtTermin 459
+    PhysDevExtTermin 460
+    PhysDevExtTermin 461
+    PhysDevExtTermin 462
+    PhysDevExtTermin 463
+    PhysDevExtTermin 464
+    PhysDevExtTermin 465
+    PhysDevExtTermin 466
+    PhysDevExtTermin 467
+    PhysDevExtTermin 468
+    PhysDevExtTermin 469
+    PhysDevExtTermin 470
+    PhysDevExtTermin 471
+    PhysDevExtTermin 472
+    PhysDevExtTermin 473
+    PhysDevExtTermin 474
+    PhysDevExtTermin 475
+    PhysDevExtTermin 476
+    PhysDevExtTermin 477
+    PhysDevExtTermin 478
+    PhysDevExtTermin 479
+    PhysDevExtTermin 480
+    PhysDevExtTermin 481
+    PhysDevExtTermin 482
+    PhysDevExtTermin 483
+    PhysDevExtTermin 484
+    PhysDevExtTermin 485
+    PhysDevExtTermin 486
+    PhysDevExtTermin 487
+    PhysDevExtTermin 488
+    PhysDevExtTermin 489
+    PhysDevExtTermin 490
+    PhysDevExtTermin 491
+    PhysDevExtTermin 492
+    PhysDevExtTermin 493
+    PhysDevExtTermin 494
+    PhysDevExtTermin 495
+    PhysDevExtTermin 496
+    PhysDevExtTermin 497
+    PhysDevExtTermin 498
+    PhysDevExtTermin 499
+    PhysDevExtTermin 500
+    PhysDevExtTermin 501
+    PhysDevExtTermin 502
+    PhysDevExtTermin 503
+    PhysDevExtTermin 504
+    PhysDevExtTermin 505
+    PhysDevExtTermin 506
+    PhysDevExtTermin 507
+    PhysDevExtTermin 508
+    PhysDevExtTermin 509
+    PhysDevExtTermin 510
+    PhysDevExtTermin 511
+    PhysDevExtTermin 512
+    PhysDevExtTermin 513
+    PhysDevExtTermin 514
+    PhysDevExtTermin 515
+    PhysDevExtTermin 516
+    PhysDevExtTermin 517
+    PhysDevExtTermin 518
+    PhysDevExtTermin 519
+    PhysDevExtTermin 520
+    PhysDevExtTermin 521
+    PhysDevExtTermin 522
+    PhysDevExtTermin 523
+    PhysDevExtTermin 524
+    PhysDevExtTermin 525
+    PhysDevExtTermin 526
+    PhysDevExtTermin 527
+    PhysDevExtTermin 528
+    PhysDevExtTermin 529
+    PhysDevExtTermin 530
+    PhysDevExtTermin 531
+    PhysDevExtTermin 532
+    PhysDevExtTermin 533
+    PhysDevExtTermin 534
+    PhysDevExtTermin 535
+    PhysDevExtTermin 536
+    PhysDevExtTermin 537
+    PhysDevExtTermin 538
+    PhysDevExtTermin 539
+    PhysDevExtTermin 540
+    PhysDevExtTermin 541
+    PhysDevExtTermin 542
+    PhysDevExtTermin 543
+    PhysDevExtTermin 544
+    PhysDevExtTermin 545
+    PhysDevExtTermin 546
+    PhysDevExtTermin 547
+    PhysDevExtTermin 548
+    PhysDevExtTermin 549
+    PhysDevExtTermin 550
+    PhysDevExtTermin 551
+    PhysDevExtTermin 552
+    PhysDevExtTermin 553
+    PhysDevExtTermin 554
+    PhysDevExtTermin 555
+    PhysDevExtTermin 556
+    PhysDevExtTermin 557
+    PhysDevExtTermin 558
+    PhysDevExtTermin 559
+    PhysDevExtTermin 560
+    PhysDevExtTermin 561
+    PhysDevExtTermin 562
+    PhysDevExtTermin 563
+    PhysDevExtTermin 564
+    PhysDevExtTermin 565
+    PhysDevExtTermin 566
+    PhysDevExtTermin 567
+    PhysDevExtTermin 568
+    PhysDevExtTermin 569
+    PhysDevExtTermin 570
+    PhysDevExtTermin 571
+    PhysDevExtTermin 572
+    PhysDevExtTermin 573
+    PhysDevExtTermin 574
+    PhysDevExtTermin 575
+    PhysDevExtTermin 576
+    PhysDevExtTermin 577
+    PhysDevExtTermin 578
+    PhysDevExtTermin 579
+    PhysDevExtTermin 580
+    PhysDevExtTermin 581
+    PhysDevExtTermin 582
+    PhysDevExtTermin 583
+    PhysDevExtTermin 584
+    PhysDevExtTermin 585
+    PhysDevExtTermin 586
+    PhysDevExtTermin 587
+    PhysDevExtTermin 588
+    PhysDevExtTermin 589
+    PhysDevExtTermin 590
+    PhysDevExtTermin 591
+    PhysDevExtTermin 592
+    PhysDevExtTermin 593
+    PhysDevExtTermin 594
+    PhysDevExtTermin 595
+    PhysDevExtTermin 596
+    PhysDevExtTermin 597
+    PhysDevExtTermin 598
+    PhysDevExtTermin 599
+    PhysDevExtTermin 600
+    PhysDevExtTermin 601
+    PhysDevExtTermin 602
+    PhysDevExtTermin 603
+    PhysDevExtTermin 604
+    PhysDevExtTermin 605
+    PhysDevExtTermin 606
+    PhysDevExtTermin 607
+    PhysDevExtTermin 608
+    PhysDevExtTermin 609
+    PhysDevExtTermin 610
+    PhysDevExtTermin 611
+    PhysDevExtTermin 612
+    PhysDevExtTermin 613
+    PhysDevExtTermin 614
+    PhysDevExtTermin 615
+    PhysDevExtTermin 616
+    PhysDevExtTermin 617
+    PhysDevExtTermin 618
+    PhysDevExtTermin 619
+    PhysDevExtTermin 620
+    PhysDevExtTermin 621
+    PhysDevExtTermin 622
+    PhysDevExtTermin 623
+    PhysDevExtTermin 624
+    PhysDevExtTermin 625
+    PhysDevExtTermin 626
+    PhysDevExtTermin 627
+    PhysDevExtTermin 628
+    PhysDevExtTermin 629
+    PhysDevExtTermin 630
+    PhysDevExtTermin 631
+    PhysDevExtTermin 632
+    PhysDevExtTermin 633
+    PhysDevExtTermin 634
+    PhysDevExtTermin 635
+    PhysDevExtTermin 636
+    PhysDevExtTermin 637
+    PhysDevExtTermin 638
+    PhysDevExtTermin 639
+    PhysDevExtTermin 640
+    PhysDevExtTermin 641
+    PhysDevExtTermin 642
+    PhysDevExtTermin 643
+    PhysDevExtTermin 644
+    PhysDevExtTermin 645
+    PhysDevExtTermin 646
+    PhysDevExtTermin 647
+    PhysDevExtTermin 648
+    PhysDevExtTermin 649
+    PhysDevExtTermin 650
+    PhysDevExtTermin 651
+    PhysDevExtTermin 652
+    PhysDevExtTermin 653
+    PhysDevExtTermin 654
+    PhysDevExtTermin 655
+    PhysDevExtTermin 656
+    PhysDevExtTermin 657
+    PhysDevExtTermin 658
+    PhysDevExtTermin 659
+    PhysDevExtTermin 660
+    PhysDevExtTermin 661
+    PhysDevExtTermin 662
+    PhysDevExtTermin 663
+    PhysDevExtTermin 664
+    PhysDevExtTermin 665
+    PhysDevExtTermin 666
+    PhysDevExtTermin 667
+    PhysDevExtTermin 668
+    PhysDevExtTermin 669
+    PhysDevExtTermin 670
+    PhysDevExtTermin 671
+    PhysDevExtTermin 672
+    PhysDevExtTermin 673
+    PhysDevExtTermin 674
+    PhysDevExtTermin 675
+    PhysDevExtTermin 676
+    PhysDevExtTermin 677
+    PhysDevExtTermin 678
+    PhysDevExtTermin 679
+    PhysDevExtTermin 680
+    PhysDevExtTermin 681
+    PhysDevExtTermin 682
+    PhysDevExtTermin 683
+    PhysDevExtTermin 684
+    PhysDevExtTermin 685
+    PhysDevExtTermin 686
+    PhysDevExtTermin 687
+    PhysDevExtTermin 688
+    PhysDevExtTermin 689
+    PhysDevExtTermin 690
+    PhysDevExtTermin 691
+    PhysDevExtTermin 692
+    PhysDevExtTermin 693
+    PhysDevExtTermin 694
+    PhysDevExtTermin 695
+    PhysDevExtTermin 696
+    PhysDevExtTermin 697
+    PhysDevExtTermin 698
+    PhysDevExtTermin 699
+    PhysDevExtTermin 700
+    PhysDevExtTermin 701
+    PhysDevExtTermin 702
+    PhysDevExtTermin 703
+    PhysDevExtTermin 704
+    PhysDevExtTermin 705
+    PhysDevExtTermin 706
+    PhysDevExtTermin 707
+    PhysDevExtTermin 708
+    PhysDevExtTermin 709
+    PhysDevExtTermin 710
+    PhysDevExtTermin 711
+    PhysDevExtTermin 712
+    PhysDevExtTermin 713
+    PhysDevExtTermin 714
+    PhysDevExtTermin 715
+    PhysDevExtTermin 716
+    PhysDevExtTermin 717
+    PhysDevExtTermin 718
+    PhysDevExtTermin 719
+    PhysDevExtTermin 720
+    PhysDevExtTermin 721
+    PhysDevExtTermin 722
+    PhysDevExtTermin 723
+    PhysDevExtTermin 724
+    PhysDevExtTermin 725
+    PhysDevExtTermin 726
+    PhysDevExtTermin 727
+    PhysDevExtTermin 728
+    PhysDevExtTermin 729
+    PhysDevExtTermin 730
+    PhysDevExtTermin 731
+    PhysDevExtTermin 732
+    PhysDevExtTermin 733
+    PhysDevExtTermin 734
+    PhysDevExtTermin 735
+    PhysDevExtTermin 736
+    PhysDevExtTermin 737
+    PhysDevExtTermin 738
+    PhysDevExtTermin 739
+    PhysDevExtTermin 740
+    PhysDevExtTermin 741
+    PhysDevExtTermin 742
+    PhysDevExtTermin 743
+    PhysDevExtTermin 744
+    PhysDevExtTermin 745
+    PhysDevExtTermin 746
+    PhysDevExtTermin 747
+    PhysDevExtTermin 748
+    PhysDevExtTermin 749
+    PhysDevExtTermin 750
+    PhysDevExtTermin 751
+    PhysDevExtTermin 752
+    PhysDevExtTermin 753
+    PhysDevExtTermin 754
+    PhysDevExtTermin 755
+    PhysDevExtTermin 756
+    PhysDevExtTermin 757
+    PhysDevExtTermin 758
+    PhysDevExtTermin 759
+    PhysDevExtTermin 760
+    PhysDevExtTermin 761
+    PhysDevExtTermin 762
+    PhysDevExtTermin 763
+    PhysDevExtTermin 764
+    PhysDevExtTermin 765
+    PhysDevExtTermin 766
+    PhysDevExtTermin 767
+    PhysDevExtTermin 768
+    PhysDevExtTermin 769
+    PhysDevExtTermin 770
+    PhysDevExtTermin 771
+    PhysDevExtTermin 772
+    PhysDevExtTermin 773
+    PhysDevExtTermin 774
+    PhysDevExtTermin 775
+    PhysDevExtTermin 776
+    PhysDevExtTermin 777
+    PhysDevExtTermin 778
+    PhysDevExtTermin 779
+    PhysDevExtTermin 780
+    PhysDevExtTermin 781
+    PhysDevExtTermin 782
+    PhysDevExtTermin 783
+    PhysDevExtTermin 784
+    PhysDevExtTermin 785
+    PhysDevExtTermin 786
+    PhysDevExtTermin 787
+    PhysDevExtTermin 788
+    PhysDevExtTermin 789
+    PhysDevExtTermin 790
+    PhysDevExtTermin 791
+    PhysDevExtTermin 792
+    PhysDevExtTermin 793
+    PhysDevExtTermin 794
+    PhysDevExtTermin 795
+    PhysDevExtTermin 796
+    PhysDevExtTermin 797
+    PhysDevExtTermin 798
+    PhysDevExtTermin 799
+    PhysDevExtTermin 800
+    PhysDevExtTermin 801
+    PhysDevExtTermin 802
+    PhysDevExtTermin 803
+    PhysDevExtTermin 804
+    PhysDevExtTermin 805
+    PhysDevExtTermin 806
+    PhysDevExtTermin 807
+    PhysDevExtTermin 808
+    PhysDevExtTermin 809
+    PhysDevExtTermin 810
+    PhysDevExtTermin 811
+    PhysDevExtTermin 812
+    PhysDevExtTermin 813
+    PhysDevExtTermin 814
+    PhysDevExtTermin 815
+    PhysDevExtTermin 816
+    PhysDevExtTermin 817
+    PhysDevExtTermin 818
+    PhysDevExtTermin 819
+    PhysDevExtTermin 820
+    PhysDevExtTermin 821
+    PhysDevExtTermin 822
+    PhysDevExtTermin 823
+    PhysDevExtTermin 824
+    PhysDevExtTermin 825
+    PhysDevExtTermin 826
+    PhysDevExtTermin 827
+    PhysDevExtTermin 828
+    PhysDevExtTermin 829
+    PhysDevExtTermin 830
+    PhysDevExtTermin 831
+    PhysDevExtTermin 832
+    PhysDevExtTermin 833
+    PhysDevExtTermin 834
+    PhysDevExtTermin 835
+    PhysDevExtTermin 836
+    PhysDevExtTermin 837
+    PhysDevExtTermin 838
+    PhysDevExtTermin 839
+    PhysDevExtTermin 840
+    PhysDevExtTermin 841
+    PhysDevExtTermin 842
+    PhysDevExtTermin 843
+    PhysDevExtTermin 844
+    PhysDevExtTermin 845
+    PhysDevExtTermin 846
+    PhysDevExtTermin 847
+    PhysDevExtTermin 848
+    PhysDevExtTermin 849
+    PhysDevExtTermin 850
+    PhysDevExtTermin 851
+    PhysDevExtTermin 852
+    PhysDevExtTermin 853
+    PhysDevExtTermin 854
+    PhysDevExtTermin 855
+    PhysDevExtTermin 856
+    PhysDevExtTermin 857
+    PhysDevExtTermin 858
+    PhysDevExtTermin 859
+    PhysDevExtTermin 860
+    PhysDevExtTermin 861
+    PhysDevExtTermin 862
+    PhysDevExtTermin 863
+    PhysDevExtTermin 864
+    PhysDevExtTermin 865
+    PhysDevExtTermin 866
+    PhysDevExtTermin 867
+    PhysDevExtTermin 868
+    PhysDevExtTermin 869
+    PhysDevExtTermin 870
+    PhysDevExtTermin 871
+    PhysDevExtTermin 872
+    PhysDevExtTermin 873
+    PhysDevExtTermin 874
+    PhysDevExtTermin 875
+    PhysDevExtTermin 876
+    PhysDevExtTermin 877
+    PhysDevExtTermin 878
+    PhysDevExtTermin 879
+    PhysDevExtTermin 880
+    PhysDevExtTermin 881
+    PhysDevExtTermin 882
+    PhysDevExtTermin 883
+    PhysDevExtTermin 884
+    PhysDevExtTermin 885
+    PhysDevExtTermin 886
+    PhysDevExtTermin 887
+    PhysDevExtTermin 888
+    PhysDevExtTermin 889
+    PhysDevExtTermin 890
+    PhysDevExtTermin 891
+    PhysDevExtTermin 892
+    PhysDevExtTermin 893
+    PhysDevExtTermin 894
+    PhysDevExtTermin 895
+    PhysDevExtTermin 896
+    PhysDevExtTermin 897
+    PhysDevExtTermin 898
+    PhysDevExtTermin 899
+    PhysDevExtTermin 900
+    PhysDevExtTermin 901
+    PhysDevExtTermin 902
+    PhysDevExtTermin 903
+    PhysDevExtTermin 904
+    PhysDevExtTermin 905
+    PhysDevExtTermin 906
+    PhysDevExtTermin 907
+    PhysDevExtTermin 908
+    PhysDevExtTermin 909
+    PhysDevExtTermin 910
+    PhysDevExtTermin 911
+    PhysDevExtTermin 912
+    PhysDevExtTermin 913
+    PhysDevExtTermin 914
+    PhysDevExtTermin 915
+    PhysDevExtTermin 916
+    PhysDevExtTermin 917
+    PhysDevExtTermin 918
+    PhysDevExtTermin 919
+    PhysDevExtTermin 920
+    PhysDevExtTermin 921
+    PhysDevExtTermin 922
+    PhysDevExtTermin 923
+    PhysDevExtTermin 924
+    PhysDevExtTermin 925
+    PhysDevExtTermin 926
+    PhysDevExtTermin 927
+    PhysDevExtTermin 928
+    PhysDevExtTermin 929
+    PhysDevExtTermin 930
+    PhysDevExtTermin 931
+    PhysDevExtTermin 932
+    PhysDevExtTermin 933
+    PhysDevExtTermin 934
+    PhysDevExtTermin 935
+    PhysDevExtTermin 936
+    PhysDevExtTermin 937
+    PhysDevExtTermin 938
+    PhysDevExtTermin 939
+    PhysDevExtTermin 940
+    PhysDevExtTermin 941
+    PhysDevExtTermin 942
+    PhysDevExtTermin 943
+    PhysDevExtTermin 944
+    PhysDevExtTermin 945
+    PhysDevExtTermin 946
+    PhysDevExtTermin 947
+    PhysDevExtTermin 948
+    PhysDevExtTermin 949
+    PhysDevExtTermin 950
+    PhysDevExtTermin 951
+    PhysDevExtTermin 952
+    PhysDevExtTermin 953
+    PhysDevExtTermin 954
+    PhysDevExtTermin 955
+    PhysDevExtTermin 956
+    PhysDevExtTermin 957
+    PhysDevExtTermin 958
+    PhysDevExtTermin 959
+    PhysDevExtTermin 960
+    PhysDevExtTermin 961
+    PhysDevExtTermin 962
+    PhysDevExtTermin 963
+    PhysDevExtTermin 964
+    PhysDevExtTermin 965
+    PhysDevExtTermin 966
+    PhysDevExtTermin 967
+    PhysDevExtTermin 968
+    PhysDevExtTermin 969
+    PhysDevExtTermin 970
+    PhysDevExtTermin 971
+    PhysDevExtTermin 972
+    PhysDevExtTermin 973
+    PhysDevExtTermin 974
+    PhysDevExtTermin 975
+    PhysDevExtTermin 976
+    PhysDevExtTermin 977
+    PhysDevExtTermin 978
+    PhysDevExtTermin 979
+    PhysDevExtTermin 980
+    PhysDevExtTermin 981
+    PhysDevExtTermin 982
+    PhysDevExtTermin 983
+    PhysDevExtTermin 984
+    PhysDevExtTermin 985
+    PhysDevExtTermin 986
+    PhysDevExtTermin 987
+    PhysDevExtTermin 988
+    PhysDevExtTermin 989
+    PhysDevExtTermin 990
+    PhysDevExtTermin 991
+    PhysDevExtTermin 992
+    PhysDevExtTermin 993
+    PhysDevExtTermin 994
+    PhysDevExtTermin 995
+    PhysDevExtTermin 996
+    PhysDevExtTermin 997
+    PhysDevExtTermin 998
+    PhysDevExtTermin 999
 
     DevExtTramp 0
     DevExtTramp 1
@@ -881,5 +2462,755 @@ ENDIF
     DevExtTramp 247
     DevExtTramp 248
     DevExtTramp 249
+    DevExtTramp 250
+    DevExtTramp 251
+    DevExtTramp 252
+    DevExtTramp 253
+    DevExtTramp 254
+    DevExtTramp 255
+    DevExtTramp 256
+    DevExtTramp 257
+    DevExtTramp 258
+    DevExtTramp 259
+    DevExtTramp 260
+    DevExtTramp 261
+    DevExtTramp 262
+    DevExtTramp 263
+    DevExtTramp 264
+    DevExtTramp 265
+    DevExtTramp 266
+    DevExtTramp 267
+    DevExtTramp 268
+    DevExtTramp 269
+    DevExtTramp 270
+    DevExtTramp 271
+    DevExtTramp 272
+    DevExtTramp 273
+    DevExtTramp 274
+    DevExtTramp 275
+    DevExtTramp 276
+    DevExtTramp 277
+    DevExtTramp 278
+    DevExtTramp 279
+    DevExtTramp 280
+    DevExtTramp 281
+    DevExtTramp 282
+    DevExtTramp 283
+    DevExtTramp 284
+    DevExtTramp 285
+    DevExtTramp 286
+    DevExtTramp 287
+    DevExtTramp 288
+    DevExtTramp 289
+    DevExtTramp 290
+    DevExtTramp 291
+    DevExtTramp 292
+    DevExtTramp 293
+    DevExtTramp 294
+    DevExtTramp 295
+    DevExtTramp 296
+    DevExtTramp 297
+    DevExtTramp 298
+    DevExtTramp 299
+    DevExtTramp 300
+    DevExtTramp 301
+    DevExtTramp 302
+    DevExtTramp 303
+    DevExtTramp 304
+    DevExtTramp 305
+    DevExtTramp 306
+    DevExtTramp 307
+    DevExtTramp 308
+    DevExtTramp 309
+    DevExtTramp 310
+    DevExtTramp 311
+    DevExtTramp 312
+    DevExtTramp 313
+    DevExtTramp 314
+    DevExtTramp 315
+    DevExtTramp 316
+    DevExtTramp 317
+    DevExtTramp 318
+    DevExtTramp 319
+    DevExtTramp 320
+    DevExtTramp 321
+    DevExtTramp 322
+    DevExtTramp 323
+    DevExtTramp 324
+    DevExtTramp 325
+    DevExtTramp 326
+    DevExtTramp 327
+    DevExtTramp 328
+    DevExtTramp 329
+    DevExtTramp 330
+    DevExtTramp 331
+    DevExtTramp 332
+    DevExtTramp 333
+    DevExtTramp 334
+    DevExtTramp 335
+    DevExtTramp 336
+    DevExtTramp 337
+    DevExtTramp 338
+    DevExtTramp 339
+    DevExtTramp 340
+    DevExtTramp 341
+    DevExtTramp 342
+    DevExtTramp 343
+    DevExtTramp 344
+    DevExtTramp 345
+    DevExtTramp 346
+    DevExtTramp 347
+    DevExtTramp 348
+    DevExtTramp 349
+    DevExtTramp 350
+    DevExtTramp 351
+    DevExtTramp 352
+    DevExtTramp 353
+    DevExtTramp 354
+    DevExtTramp 355
+    DevExtTramp 356
+    DevExtTramp 357
+    DevExtTramp 358
+    DevExtTramp 359
+    DevExtTramp 360
+    DevExtTramp 361
+    DevExtTramp 362
+    DevExtTramp 363
+    DevExtTramp 364
+    DevExtTramp 365
+    DevExtTramp 366
+    DevExtTramp 367
+    DevExtTramp 368
+    DevExtTramp 369
+    DevExtTramp 370
+    DevExtTramp 371
+    DevExtTramp 372
+    DevExtTramp 373
+    DevExtTramp 374
+    DevExtTramp 375
+    DevExtTramp 376
+    DevExtTramp 377
+    DevExtTramp 378
+    DevExtTramp 379
+    DevExtTramp 380
+    DevExtTramp 381
+    DevExtTramp 382
+    DevExtTramp 383
+    DevExtTramp 384
+    DevExtTramp 385
+    DevExtTramp 386
+    DevExtTramp 387
+    DevExtTramp 388
+    DevExtTramp 389
+    DevExtTramp 390
+    DevExtTramp 391
+    DevExtTramp 392
+    DevExtTramp 393
+    DevExtTramp 394
+    DevExtTramp 395
+    DevExtTramp 396
+    DevExtTramp 397
+    DevExtTramp 398
+    DevExtTramp 399
+    DevExtTramp 400
+    DevExtTramp 401
+    DevExtTramp 402
+    DevExtTramp 403
+    DevExtTramp 404
+    DevExtTramp 405
+    DevExtTramp 406
+    DevExtTramp 407
+    DevExtTramp 408
+    DevExtTramp 409
+    DevExtTramp 410
+    DevExtTramp 411
+    DevExtTramp 412
+    DevExtTramp 413
+    DevExtTramp 414
+    DevExtTramp 415
+    DevExtTramp 416
+    DevExtTramp 417
+    DevExtTramp 418
+    DevExtTramp 419
+    DevExtTramp 420
+    DevExtTramp 421
+    DevExtTramp 422
+    DevExtTramp 423
+    DevExtTramp 424
+    DevExtTramp 425
+    DevExtTramp 426
+    DevExtTramp 427
+    DevExtTramp 428
+    DevExtTramp 429
+    DevExtTramp 430
+    DevExtTramp 431
+    DevExtTramp 432
+    DevExtTramp 433
+    DevExtTramp 434
+    DevExtTramp 435
+    DevExtTramp 436
+    DevExtTramp 437
+    DevExtTramp 438
+    DevExtTramp 439
+    DevExtTramp 440
+    DevExtTramp 441
+    DevExtTramp 442
+    DevExtTramp 443
+    DevExtTramp 444
+    DevExtTramp 445
+    DevExtTramp 446
+    DevExtTramp 447
+    DevExtTramp 448
+    DevExtTramp 449
+    DevExtTramp 450
+    DevExtTramp 451
+    DevExtTramp 452
+    DevExtTramp 453
+    DevExtTramp 454
+    DevExtTramp 455
+    DevExtTramp 456
+    DevExtTramp 457
+    DevExtTramp 458
+    DevExtTramp 459
+    DevExtTramp 460
+    DevExtTramp 461
+    DevExtTramp 462
+    DevExtTramp 463
+    DevExtTramp 464
+    DevExtTramp 465
+    DevExtTramp 466
+    DevExtTramp 467
+    DevExtTramp 468
+    DevExtTramp 469
+    DevExtTramp 470
+    DevExtTramp 471
+    DevExtTramp 472
+    DevExtTramp 473
+    DevExtTramp 474
+    DevExtTramp 475
+    DevExtTramp 476
+    DevExtTramp 477
+    DevExtTramp 478
+    DevExtTramp 479
+    DevExtTramp 480
+    DevExtTramp 481
+    DevExtTramp 482
+    DevExtTramp 483
+    DevExtTramp 484
+    DevExtTramp 485
+    DevExtTramp 486
+    DevExtTramp 487
+    DevExtTramp 488
+    DevExtTramp 489
+    DevExtTramp 490
+    DevExtTramp 491
+    DevExtTramp 492
+    DevExtTramp 493
+    DevExtTramp 494
+    DevExtTramp 495
+    DevExtTramp 496
+    DevExtTramp 497
+    DevExtTramp 498
+    DevExtTramp 499
+    DevExtTramp 500
+    DevExtTramp 501
+    DevExtTramp 502
+    DevExtTramp 503
+    DevExtTramp 504
+    DevExtTramp 505
+    DevExtTramp 506
+    DevExtTramp 507
+    DevExtTramp 508
+    DevExtTramp 509
+    DevExtTramp 510
+    DevExtTramp 511
+    DevExtTramp 512
+    DevExtTramp 513
+    DevExtTramp 514
+    DevExtTramp 515
+    DevExtTramp 516
+    DevExtTramp 517
+    DevExtTramp 518
+    DevExtTramp 519
+    DevExtTramp 520
+    DevExtTramp 521
+    DevExtTramp 522
+    DevExtTramp 523
+    DevExtTramp 524
+    DevExtTramp 525
+    DevExtTramp 526
+    DevExtTramp 527
+    DevExtTramp 528
+    DevExtTramp 529
+    DevExtTramp 530
+    DevExtTramp 531
+    DevExtTramp 532
+    DevExtTramp 533
+    DevExtTramp 534
+    DevExtTramp 535
+    DevExtTramp 536
+    DevExtTramp 537
+    DevExtTramp 538
+    DevExtTramp 539
+    DevExtTramp 540
+    DevExtTramp 541
+    DevExtTramp 542
+    DevExtTramp 543
+    DevExtTramp 544
+    DevExtTramp 545
+    DevExtTramp 546
+    DevExtTramp 547
+    DevExtTramp 548
+    DevExtTramp 549
+    DevExtTramp 550
+    DevExtTramp 551
+    DevExtTramp 552
+    DevExtTramp 553
+    DevExtTramp 554
+    DevExtTramp 555
+    DevExtTramp 556
+    DevExtTramp 557
+    DevExtTramp 558
+    DevExtTramp 559
+    DevExtTramp 560
+    DevExtTramp 561
+    DevExtTramp 562
+    DevExtTramp 563
+    DevExtTramp 564
+    DevExtTramp 565
+    DevExtTramp 566
+    DevExtTramp 567
+    DevExtTramp 568
+    DevExtTramp 569
+    DevExtTramp 570
+    DevExtTramp 571
+    DevExtTramp 572
+    DevExtTramp 573
+    DevExtTramp 574
+    DevExtTramp 575
+    DevExtTramp 576
+    DevExtTramp 577
+    DevExtTramp 578
+    DevExtTramp 579
+    DevExtTramp 580
+    DevExtTramp 581
+    DevExtTramp 582
+    DevExtTramp 583
+    DevExtTramp 584
+    DevExtTramp 585
+    DevExtTramp 586
+    DevExtTramp 587
+    DevExtTramp 588
+    DevExtTramp 589
+    DevExtTramp 590
+    DevExtTramp 591
+    DevExtTramp 592
+    DevExtTramp 593
+    DevExtTramp 594
+    DevExtTramp 595
+    DevExtTramp 596
+    DevExtTramp 597
+    DevExtTramp 598
+    DevExtTramp 599
+    DevExtTramp 600
+    DevExtTramp 601
+    DevExtTramp 602
+    DevExtTramp 603
+    DevExtTramp 604
+    DevExtTramp 605
+    DevExtTramp 606
+    DevExtTramp 607
+    DevExtTramp 608
+    DevExtTramp 609
+    DevExtTramp 610
+    DevExtTramp 611
+    DevExtTramp 612
+    DevExtTramp 613
+    DevExtTramp 614
+    DevExtTramp 615
+    DevExtTramp 616
+    DevExtTramp 617
+    DevExtTramp 618
+    DevExtTramp 619
+    DevExtTramp 620
+    DevExtTramp 621
+    DevExtTramp 622
+    DevExtTramp 623
+    DevExtTramp 624
+    DevExtTramp 625
+    DevExtTramp 626
+    DevExtTramp 627
+    DevExtTramp 628
+    DevExtTramp 629
+    DevExtTramp 630
+    DevExtTramp 631
+    DevExtTramp 632
+    DevExtTramp 633
+    DevExtTramp 634
+    DevExtTramp 635
+    DevExtTramp 636
+    DevExtTramp 637
+    DevExtTramp 638
+    DevExtTramp 639
+    DevExtTramp 640
+    DevExtTramp 641
+    DevExtTramp 642
+    DevExtTramp 643
+    DevExtTramp 644
+    DevExtTramp 645
+    DevExtTramp 646
+    DevExtTramp 647
+    DevExtTramp 648
+    DevExtTramp 649
+    DevExtTramp 650
+    DevExtTramp 651
+    DevExtTramp 652
+    DevExtTramp 653
+    DevExtTramp 654
+    DevExtTramp 655
+    DevExtTramp 656
+    DevExtTramp 657
+    DevExtTramp 658
+    DevExtTramp 659
+    DevExtTramp 660
+    DevExtTramp 661
+    DevExtTramp 662
+    DevExtTramp 663
+    DevExtTramp 664
+    DevExtTramp 665
+    DevExtTramp 666
+    DevExtTramp 667
+    DevExtTramp 668
+    DevExtTramp 669
+    DevExtTramp 670
+    DevExtTramp 671
+    DevExtTramp 672
+    DevExtTramp 673
+    DevExtTramp 674
+    DevExtTramp 675
+    DevExtTramp 676
+    DevExtTramp 677
+    DevExtTramp 678
+    DevExtTramp 679
+    DevExtTramp 680
+    DevExtTramp 681
+    DevExtTramp 682
+    DevExtTramp 683
+    DevExtTramp 684
+    DevExtTramp 685
+    DevExtTramp 686
+    DevExtTramp 687
+    DevExtTramp 688
+    DevExtTramp 689
+    DevExtTramp 690
+    DevExtTramp 691
+    DevExtTramp 692
+    DevExtTramp 693
+    DevExtTramp 694
+    DevExtTramp 695
+    DevExtTramp 696
+    DevExtTramp 697
+    DevExtTramp 698
+    DevExtTramp 699
+    DevExtTramp 700
+    DevExtTramp 701
+    DevExtTramp 702
+    DevExtTramp 703
+    DevExtTramp 704
+    DevExtTramp 705
+    DevExtTramp 706
+    DevExtTramp 707
+    DevExtTramp 708
+    DevExtTramp 709
+    DevExtTramp 710
+    DevExtTramp 711
+    DevExtTramp 712
+    DevExtTramp 713
+    DevExtTramp 714
+    DevExtTramp 715
+    DevExtTramp 716
+    DevExtTramp 717
+    DevExtTramp 718
+    DevExtTramp 719
+    DevExtTramp 720
+    DevExtTramp 721
+    DevExtTramp 722
+    DevExtTramp 723
+    DevExtTramp 724
+    DevExtTramp 725
+    DevExtTramp 726
+    DevExtTramp 727
+    DevExtTramp 728
+    DevExtTramp 729
+    DevExtTramp 730
+    DevExtTramp 731
+    DevExtTramp 732
+    DevExtTramp 733
+    DevExtTramp 734
+    DevExtTramp 735
+    DevExtTramp 736
+    DevExtTramp 737
+    DevExtTramp 738
+    DevExtTramp 739
+    DevExtTramp 740
+    DevExtTramp 741
+    DevExtTramp 742
+    DevExtTramp 743
+    DevExtTramp 744
+    DevExtTramp 745
+    DevExtTramp 746
+    DevExtTramp 747
+    DevExtTramp 748
+    DevExtTramp 749
+    DevExtTramp 750
+    DevExtTramp 751
+    DevExtTramp 752
+    DevExtTramp 753
+    DevExtTramp 754
+    DevExtTramp 755
+    DevExtTramp 756
+    DevExtTramp 757
+    DevExtTramp 758
+    DevExtTramp 759
+    DevExtTramp 760
+    DevExtTramp 761
+    DevExtTramp 762
+    DevExtTramp 763
+    DevExtTramp 764
+    DevExtTramp 765
+    DevExtTramp 766
+    DevExtTramp 767
+    DevExtTramp 768
+    DevExtTramp 769
+    DevExtTramp 770
+    DevExtTramp 771
+    DevExtTramp 772
+    DevExtTramp 773
+    DevExtTramp 774
+    DevExtTramp 775
+    DevExtTramp 776
+    DevExtTramp 777
+    DevExtTramp 778
+    DevExtTramp 779
+    DevExtTramp 780
+    DevExtTramp 781
+    DevExtTramp 782
+    DevExtTramp 783
+    DevExtTramp 784
+    DevExtTramp 785
+    DevExtTramp 786
+    DevExtTramp 787
+    DevExtTramp 788
+    DevExtTramp 789
+    DevExtTramp 790
+    DevExtTramp 791
+    DevExtTramp 792
+    DevExtTramp 793
+    DevExtTramp 794
+    DevExtTramp 795
+    DevExtTramp 796
+    DevExtTramp 797
+    DevExtTramp 798
+    DevExtTramp 799
+    DevExtTramp 800
+    DevExtTramp 801
+    DevExtTramp 802
+    DevExtTramp 803
+    DevExtTramp 804
+    DevExtTramp 805
+    DevExtTramp 806
+    DevExtTramp 807
+    DevExtTramp 808
+    DevExtTramp 809
+    DevExtTramp 810
+    DevExtTramp 811
+    DevExtTramp 812
+    DevExtTramp 813
+    DevExtTramp 814
+    DevExtTramp 815
+    DevExtTramp 816
+    DevExtTramp 817
+    DevExtTramp 818
+    DevExtTramp 819
+    DevExtTramp 820
+    DevExtTramp 821
+    DevExtTramp 822
+    DevExtTramp 823
+    DevExtTramp 824
+    DevExtTramp 825
+    DevExtTramp 826
+    DevExtTramp 827
+    DevExtTramp 828
+    DevExtTramp 829
+    DevExtTramp 830
+    DevExtTramp 831
+    DevExtTramp 832
+    DevExtTramp 833
+    DevExtTramp 834
+    DevExtTramp 835
+    DevExtTramp 836
+    DevExtTramp 837
+    DevExtTramp 838
+    DevExtTramp 839
+    DevExtTramp 840
+    DevExtTramp 841
+    DevExtTramp 842
+    DevExtTramp 843
+    DevExtTramp 844
+    DevExtTramp 845
+    DevExtTramp 846
+    DevExtTramp 847
+    DevExtTramp 848
+    DevExtTramp 849
+    DevExtTramp 850
+    DevExtTramp 851
+    DevExtTramp 852
+    DevExtTramp 853
+    DevExtTramp 854
+    DevExtTramp 855
+    DevExtTramp 856
+    DevExtTramp 857
+    DevExtTramp 858
+    DevExtTramp 859
+    DevExtTramp 860
+    DevExtTramp 861
+    DevExtTramp 862
+    DevExtTramp 863
+    DevExtTramp 864
+    DevExtTramp 865
+    DevExtTramp 866
+    DevExtTramp 867
+    DevExtTramp 868
+    DevExtTramp 869
+    DevExtTramp 870
+    DevExtTramp 871
+    DevExtTramp 872
+    DevExtTramp 873
+    DevExtTramp 874
+    DevExtTramp 875
+    DevExtTramp 876
+    DevExtTramp 877
+    DevExtTramp 878
+    DevExtTramp 879
+    DevExtTramp 880
+    DevExtTramp 881
+    DevExtTramp 882
+    DevExtTramp 883
+    DevExtTramp 884
+    DevExtTramp 885
+    DevExtTramp 886
+    DevExtTramp 887
+    DevExtTramp 888
+    DevExtTramp 889
+    DevExtTramp 890
+    DevExtTramp 891
+    DevExtTramp 892
+    DevExtTramp 893
+    DevExtTramp 894
+    DevExtTramp 895
+    DevExtTramp 896
+    DevExtTramp 897
+    DevExtTramp 898
+    DevExtTramp 899
+    DevExtTramp 900
+    DevExtTramp 901
+    DevExtTramp 902
+    DevExtTramp 903
+    DevExtTramp 904
+    DevExtTramp 905
+    DevExtTramp 906
+    DevExtTramp 907
+    DevExtTramp 908
+    DevExtTramp 909
+    DevExtTramp 910
+    DevExtTramp 911
+    DevExtTramp 912
+    DevExtTramp 913
+    DevExtTramp 914
+    DevExtTramp 915
+    DevExtTramp 916
+    DevExtTramp 917
+    DevExtTramp 918
+    DevExtTramp 919
+    DevExtTramp 920
+    DevExtTramp 921
+    DevExtTramp 922
+    DevExtTramp 923
+    DevExtTramp 924
+    DevExtTramp 925
+    DevExtTramp 926
+    DevExtTramp 927
+    DevExtTramp 928
+    DevExtTramp 929
+    DevExtTramp 930
+    DevExtTramp 931
+    DevExtTramp 932
+    DevExtTramp 933
+    DevExtTramp 934
+    DevExtTramp 935
+    DevExtTramp 936
+    DevExtTramp 937
+    DevExtTramp 938
+    DevExtTramp 939
+    DevExtTramp 940
+    DevExtTramp 941
+    DevExtTramp 942
+    DevExtTramp 943
+    DevExtTramp 944
+    DevExtTramp 945
+    DevExtTramp 946
+    DevExtTramp 947
+    DevExtTramp 948
+    DevExtTramp 949
+    DevExtTramp 950
+    DevExtTramp 951
+    DevExtTramp 952
+    DevExtTramp 953
+    DevExtTramp 954
+    DevExtTramp 955
+    DevExtTramp 956
+    DevExtTramp 957
+    DevExtTramp 958
+    DevExtTramp 959
+    DevExtTramp 960
+    DevExtTramp 961
+    DevExtTramp 962
+    DevExtTramp 963
+    DevExtTramp 964
+    DevExtTramp 965
+    DevExtTramp 966
+    DevExtTramp 967
+    DevExtTramp 968
+    DevExtTramp 969
+    DevExtTramp 970
+    DevExtTramp 971
+    DevExtTramp 972
+    DevExtTramp 973
+    DevExtTramp 974
+    DevExtTramp 975
+    DevExtTramp 976
+    DevExtTramp 977
+    DevExtTramp 978
+    DevExtTramp 979
+    DevExtTramp 980
+    DevExtTramp 981
+    DevExtTramp 982
+    DevExtTramp 983
+    DevExtTramp 984
+    DevExtTramp 985
+    DevExtTramp 986
+    DevExtTramp 987
+    DevExtTramp 988
+    DevExtTramp 989
+    DevExtTramp 990
+    DevExtTramp 991
+    DevExtTramp 992
+    DevExtTramp 993
+    DevExtTramp 994
+    DevExtTramp 995
+    DevExtTramp 996
+    DevExtTramp 997
+    DevExtTramp 998
+    DevExtTramp 999
 
 end
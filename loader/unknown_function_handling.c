@@ -26,12 +26,178 @@
 
 #include "allocation.h"
 #include "log.h"
+#include "stats.h"
 
 // Forward declarations
 void *loader_get_dev_ext_trampoline(uint32_t index);
 void *loader_get_phys_dev_ext_tramp(uint32_t index);
 void *loader_get_phys_dev_ext_termin(uint32_t index);
 
+// Set by whichever of the unknown_ext_chain files is built, true when its device trampolines call loader_resolve_dev_ext for
+// functions which weren't resolved for the device yet.
+extern const bool loader_lazy_dev_ext_resolution;
+
+// Name to index maps, so that functions which were already seen are found without asking the ICDs and layers again
+
+static uint32_t loader_unknown_function_hash(const char *funcName) {
+    // 32 bit FNV-1a
+    uint32_t hash = 2166136261u;
+    for (const char *cur = funcName; *cur != '\0'; cur++) {
+        hash ^= (uint8_t)*cur;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static struct loader_unknown_function_map_entry *loader_find_unknown_function(const struct loader_unknown_function_map *map,
+                                                                              char **const *names, const char *funcName,
+                                                                              uint32_t hash) {
+    if (0 == map->capacity) {
+        return NULL;
+    }
+    uint32_t mask = map->capacity - 1;
+    for (uint32_t slot = hash & mask;; slot = (slot + 1) & mask) {
+        struct loader_unknown_function_map_entry *entry = &map->entries[slot];
+        if (0 == entry->index) {
+            return NULL;
+        }
+        if (entry->hash == hash && !strcmp(LOADER_UNKNOWN_FUNCTION_ENTRY(names, entry->index - 1), funcName)) {
+            return entry;
+        }
+    }
+}
+
+static void loader_insert_unknown_function(struct loader_unknown_function_map_entry *entries, uint32_t capacity,
+                                           const struct loader_unknown_function_map_entry *new_entry) {
+    uint32_t mask = capacity - 1;
+    uint32_t slot = new_entry->hash & mask;
+    while (0 != entries[slot].index) {
+        slot = (slot + 1) & mask;
+    }
+    entries[slot] = *new_entry;
+}
+
+// Record that funcName is stored at index. The map is kept at most half full so that lookups stay short.
+static VkResult loader_add_unknown_function(struct loader_instance *inst, struct loader_unknown_function_map *map, uint32_t hash,
+                                            uint32_t index, bool supported_by_icd) {
+    if ((map->count + 1) * 2 > map->capacity) {
+        uint32_t new_capacity = 0 == map->capacity ? 32 : map->capacity * 2;
+        struct loader_unknown_function_map_entry *new_entries = loader_instance_heap_calloc(
+            inst, sizeof(struct loader_unknown_function_map_entry) * new_capacity, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == new_entries) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        for (uint32_t i = 0; i < map->capacity; i++) {
+            if (0 != map->entries[i].index) {
+                loader_insert_unknown_function(new_entries, new_capacity, &map->entries[i]);
+            }
+        }
+        loader_instance_heap_free(inst, map->entries);
+        map->entries = new_entries;
+        map->capacity = new_capacity;
+    }
+
+    struct loader_unknown_function_map_entry new_entry = {hash, index + 1, supported_by_icd};
+    loader_insert_unknown_function(map->entries, map->capacity, &new_entry);
+    map->count++;
+    loader_stats_add(inst, VK_LOADER_STATISTIC_UNKNOWN_FUNCTIONS_ADDED, 1);
+    return VK_SUCCESS;
+}
+
+static void loader_free_unknown_function_map(struct loader_instance *inst, struct loader_unknown_function_map *map) {
+    loader_instance_heap_free(inst, map->entries);
+    memset(map, 0, sizeof(struct loader_unknown_function_map));
+}
+
+// Looks funcName up under unknown_function_lock. The entry is copied out, since the map can grow and free it once the lock is
+// released.
+static bool loader_lookup_unknown_function(struct loader_instance *inst, const struct loader_unknown_function_map *map,
+                                           char **const *names, const char *funcName, uint32_t hash,
+                                           struct loader_unknown_function_map_entry *found) {
+    loader_stats_lock_mutex(inst, &inst->unknown_function_lock);
+    const struct loader_unknown_function_map_entry *entry = loader_find_unknown_function(map, names, funcName, hash);
+    if (NULL != entry) {
+        *found = *entry;
+    }
+    loader_platform_thread_unlock_mutex(&inst->unknown_function_lock);
+    return NULL != entry;
+}
+
+// Chunked storage, see LOADER_UNKNOWN_FUNCTION_CHUNK_SIZE. A chunk is allocated the first time a function it holds is added,
+// and is only freed along with the object it belongs to.
+
+static VkResult loader_reserve_function_name_chunk(struct loader_instance *inst, char ***chunks, uint32_t index) {
+    uint32_t chunk = index >> LOADER_UNKNOWN_FUNCTION_CHUNK_SHIFT;
+    if (NULL == chunks[chunk]) {
+        chunks[chunk] = loader_instance_heap_calloc(inst, sizeof(char *) * LOADER_UNKNOWN_FUNCTION_CHUNK_SIZE,
+                                                    VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == chunks[chunk]) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+    }
+    return VK_SUCCESS;
+}
+
+static void loader_free_function_name_chunks(struct loader_instance *inst, char ***chunks, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        loader_instance_heap_free(inst, LOADER_UNKNOWN_FUNCTION_ENTRY(chunks, i));
+    }
+    for (uint32_t i = 0; i < LOADER_UNKNOWN_FUNCTION_CHUNK_COUNT; i++) {
+        loader_instance_heap_free(inst, chunks[i]);
+        chunks[i] = NULL;
+    }
+}
+
+static VkResult loader_reserve_phys_dev_ext_chunk(struct loader_instance *inst, PFN_PhysDevExt **chunks, uint32_t index) {
+    uint32_t chunk = index >> LOADER_UNKNOWN_FUNCTION_CHUNK_SHIFT;
+    if (NULL == chunks[chunk]) {
+        chunks[chunk] = loader_instance_heap_calloc(inst, sizeof(PFN_PhysDevExt) * LOADER_UNKNOWN_FUNCTION_CHUNK_SIZE,
+                                                    VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == chunks[chunk]) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+    }
+    return VK_SUCCESS;
+}
+
+static void loader_free_phys_dev_ext_chunks(struct loader_instance *inst, PFN_PhysDevExt **chunks) {
+    for (uint32_t i = 0; i < LOADER_UNKNOWN_FUNCTION_CHUNK_COUNT; i++) {
+        loader_instance_heap_free(inst, chunks[i]);
+        chunks[i] = NULL;
+    }
+}
+
+// Entries of a device dispatch table chunk start out as NULL when the trampolines resolve functions on their first call.
+// Otherwise they start out as vkDevExtError, which reports a function the device doesn't support.
+static VkResult loader_reserve_dev_ext_chunk(struct loader_device *dev, uint32_t index) {
+    uint32_t chunk = index >> LOADER_UNKNOWN_FUNCTION_CHUNK_SHIFT;
+    if (NULL == dev->loader_dispatch.ext_dispatch[chunk]) {
+        PFN_vkDevExt *entries = loader_device_heap_calloc(dev, sizeof(PFN_vkDevExt) * LOADER_UNKNOWN_FUNCTION_CHUNK_SIZE,
+                                                          VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+        if (NULL == entries) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        if (!loader_lazy_dev_ext_resolution) {
+            for (uint32_t i = 0; i < LOADER_UNKNOWN_FUNCTION_CHUNK_SIZE; i++) {
+                entries[i] = (PFN_vkDevExt)vkDevExtError;
+            }
+        }
+        dev->loader_dispatch.ext_dispatch[chunk] = entries;
+    }
+    return VK_SUCCESS;
+}
+
+void loader_free_dispatch_dev_ext(struct loader_device *dev) {
+    for (uint32_t i = 0; i < LOADER_UNKNOWN_FUNCTION_CHUNK_COUNT; i++) {
+        loader_device_heap_free(dev, dev->loader_dispatch.ext_dispatch[i]);
+        dev->loader_dispatch.ext_dispatch[i] = NULL;
+    }
+}
+
+void loader_free_icd_term_phys_dev_ext(struct loader_instance *inst, struct loader_icd_term *icd_term) {
+    loader_free_phys_dev_ext_chunks(inst, icd_term->phys_dev_ext);
+}
+
 // Device function handling
 
 // Initialize device_ext dispatch table entry as follows:
@@ -47,25 +213,52 @@ void loader_init_dispatch_dev_ext_entry(struct loader_instance *inst, struct loa
     void *gdpa_value;
     if (dev != NULL) {
         gdpa_value = dev->loader_dispatch.core_dispatch.GetDeviceProcAddr(dev->chain_device, funcName);
-        if (gdpa_value != NULL) dev->loader_dispatch.ext_dispatch[idx] = (PFN_vkDevExt)gdpa_value;
+        if (gdpa_value != NULL) LOADER_UNKNOWN_FUNCTION_ENTRY(dev->loader_dispatch.ext_dispatch, idx) = (PFN_vkDevExt)gdpa_value;
     } else {
         for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
             struct loader_device *ldev = icd_term->logical_device_list;
             while (ldev) {
                 gdpa_value = ldev->loader_dispatch.core_dispatch.GetDeviceProcAddr(ldev->chain_device, funcName);
-                if (gdpa_value != NULL) ldev->loader_dispatch.ext_dispatch[idx] = (PFN_vkDevExt)gdpa_value;
+                if (gdpa_value != NULL)
+                    LOADER_UNKNOWN_FUNCTION_ENTRY(ldev->loader_dispatch.ext_dispatch, idx) = (PFN_vkDevExt)gdpa_value;
                 ldev = ldev->next;
             }
         }
     }
 }
 
+// Allocate the chunks of the dispatch table of dev needed to hold every dev extension in the function names array.
+// This needs to happen before dev can be used, as only devices which already exist get the chunk of a newly added function.
+// Must be called with device_list_lock held and in the same critical section which adds dev to the list of devices.
+// The chunks of function names are looked at rather than the function count, since a function in a new chunk of names can be
+// on its way to being added on another thread, which has already reserved its chunk in every device in the lists.
+VkResult loader_alloc_dispatch_dev_ext(const struct loader_instance *inst, struct loader_device *dev) {
+    for (uint32_t chunk = 0; chunk < LOADER_UNKNOWN_FUNCTION_CHUNK_COUNT; chunk++) {
+        if (NULL == inst->dev_ext_disp_functions[chunk]) {
+            break;
+        }
+        if (VK_SUCCESS != loader_reserve_dev_ext_chunk(dev, chunk << LOADER_UNKNOWN_FUNCTION_CHUNK_SHIFT)) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+    }
+    return VK_SUCCESS;
+}
+
 // Find all dev extension in the function names array  and initialize the dispatch table
 // for dev  for each of those extension entrypoints found in function names array.
+// Nothing needs to be done when the trampolines resolve the functions on their first call, which keeps the cost of creating a
+// device independent of how many unknown functions were looked up.
 void loader_init_dispatch_dev_ext(struct loader_instance *inst, struct loader_device *dev) {
-    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) {
-        if (inst->dev_ext_disp_functions[i] != NULL)
-            loader_init_dispatch_dev_ext_entry(inst, dev, i, inst->dev_ext_disp_functions[i]);
+    if (loader_lazy_dev_ext_resolution) {
+        return;
+    }
+    // Names below the count never change once added, so only the count needs to be read under the lock
+    loader_stats_lock_mutex(inst, &inst->unknown_function_lock);
+    uint32_t function_count = inst->dev_ext_disp_function_count;
+    loader_platform_thread_unlock_mutex(&inst->unknown_function_lock);
+    for (uint32_t i = 0; i < function_count; i++) {
+        if (NULL != dev->loader_dispatch.ext_dispatch[i >> LOADER_UNKNOWN_FUNCTION_CHUNK_SHIFT])
+            loader_init_dispatch_dev_ext_entry(inst, dev, i, LOADER_UNKNOWN_FUNCTION_ENTRY(inst->dev_ext_disp_functions, i));
     }
 }
 
@@ -102,10 +295,9 @@ bool loader_check_layer_list_for_dev_ext_address(const struct loader_layer_list
 }
 
 void loader_free_dev_ext_table(struct loader_instance *inst) {
-    for (uint32_t i = 0; i < inst->dev_ext_disp_function_count; i++) {
-        loader_instance_heap_free(inst, inst->dev_ext_disp_functions[i]);
-    }
-    memset(inst->dev_ext_disp_functions, 0, sizeof(inst->dev_ext_disp_functions));
+    loader_free_function_name_chunks(inst, inst->dev_ext_disp_functions, inst->dev_ext_disp_function_count);
+    inst->dev_ext_disp_function_count = 0;
+    loader_free_unknown_function_map(inst, &inst->dev_ext_function_map);
 }
 
 /*
@@ -121,15 +313,15 @@ void loader_free_dev_ext_table(struct loader_instance *inst) {
  * Next check if a layer or ICD supports it.
  * If so then a new entry in the function name array is added and that trampoline
  * address for the new entry is returned.
- * NULL is returned if the function name array is full or if no discovered layer or
- * ICD returns a non-NULL GetProcAddr for it.
+ * NULL is returned if all the trampolines are in use, if no discovered layer or
+ * ICD returns a non-NULL GetProcAddr for it, or if memory for it couldn't be allocated.
  */
 void *loader_dev_ext_gpa(struct loader_instance *inst, const char *funcName) {
-    // Linearly look through already added functions to make sure we haven't seen it before
-    // if we have, return the function at the index found
-    for (uint32_t i = 0; i < inst->dev_ext_disp_function_count; i++) {
-        if (inst->dev_ext_disp_functions[i] && !strcmp(inst->dev_ext_disp_functions[i], funcName))
-            return loader_get_dev_ext_trampoline(i);
+    // Look for the function in the functions already added, if it is there return the trampoline at its index
+    uint32_t hash = loader_unknown_function_hash(funcName);
+    struct loader_unknown_function_map_entry found;
+    if (loader_lookup_unknown_function(inst, &inst->dev_ext_function_map, inst->dev_ext_disp_functions, funcName, hash, &found)) {
+        return loader_get_dev_ext_trampoline(found.index - 1);
     }
 
     // Check if funcName is supported in either ICDs or a layer library
@@ -139,25 +331,79 @@ void *loader_dev_ext_gpa(struct loader_instance *inst, const char *funcName) {
         return NULL;
     }
 
-    if (inst->dev_ext_disp_function_count >= MAX_NUM_UNKNOWN_EXTS) {
-        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_dev_ext_gpa: Exhausted the unknown device function array!");
+    // The ICDs and layers were asked without holding the lock, so another thread may have added the function in the meantime
+    loader_stats_lock_mutex(inst, &inst->unknown_function_lock);
+    const struct loader_unknown_function_map_entry *entry =
+        loader_find_unknown_function(&inst->dev_ext_function_map, inst->dev_ext_disp_functions, funcName, hash);
+    if (NULL != entry) {
+        uint32_t index = entry->index - 1;
+        loader_platform_thread_unlock_mutex(&inst->unknown_function_lock);
+        return loader_get_dev_ext_trampoline(index);
+    }
+
+    uint32_t new_function_index = inst->dev_ext_disp_function_count;
+    if (new_function_index >= MAX_NUM_UNKNOWN_FUNCTIONS) {
+        loader_platform_thread_unlock_mutex(&inst->unknown_function_lock);
+        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_dev_ext_gpa: Exhausted the unknown device function trampolines!");
         return NULL;
     }
 
+    // Make room for the new function in the function name array and in the dispatch table of every existing device. Devices
+    // added to the lists afterwards reserve the chunk themselves, see loader_alloc_dispatch_dev_ext.
+    loader_stats_lock_mutex(inst, &inst->device_list_lock);
+    VkResult res = loader_reserve_function_name_chunk(inst, inst->dev_ext_disp_functions, new_function_index);
+    for (struct loader_icd_term *icd_term = inst->icd_terms; VK_SUCCESS == res && icd_term != NULL; icd_term = icd_term->next) {
+        for (struct loader_device *dev = icd_term->logical_device_list; VK_SUCCESS == res && dev != NULL; dev = dev->next) {
+            res = loader_reserve_dev_ext_chunk(dev, new_function_index);
+        }
+    }
+    loader_platform_thread_unlock_mutex(&inst->device_list_lock);
+
     // add found function to dev_ext_disp_functions;
-    size_t funcName_len = strlen(funcName) + 1;
-    inst->dev_ext_disp_functions[inst->dev_ext_disp_function_count] =
-        (char *)loader_instance_heap_alloc(inst, funcName_len, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-    if (NULL == inst->dev_ext_disp_functions[inst->dev_ext_disp_function_count]) {
-        // failed to allocate memory, return NULL
+    if (VK_SUCCESS == res) {
+        size_t funcName_len = strlen(funcName) + 1;
+        char *new_function_name = (char *)loader_instance_heap_alloc(inst, funcName_len, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == new_function_name) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        } else {
+            strncpy(new_function_name, funcName, funcName_len);
+            LOADER_UNKNOWN_FUNCTION_ENTRY(inst->dev_ext_disp_functions, new_function_index) = new_function_name;
+            res = loader_add_unknown_function(inst, &inst->dev_ext_function_map, hash, new_function_index, false);
+            if (VK_SUCCESS != res) {
+                loader_instance_heap_free(inst, new_function_name);
+                LOADER_UNKNOWN_FUNCTION_ENTRY(inst->dev_ext_disp_functions, new_function_index) = NULL;
+            }
+        }
+    }
+    if (VK_SUCCESS == res) {
+        inst->dev_ext_disp_function_count++;
+    }
+    loader_platform_thread_unlock_mutex(&inst->unknown_function_lock);
+    if (VK_SUCCESS != res) {
         return NULL;
     }
-    strncpy(inst->dev_ext_disp_functions[inst->dev_ext_disp_function_count], funcName, funcName_len);
+
     // init any dev dispatch table entries as needed
-    loader_init_dispatch_dev_ext_entry(inst, NULL, inst->dev_ext_disp_function_count, funcName);
-    void *out_function = loader_get_dev_ext_trampoline(inst->dev_ext_disp_function_count);
-    inst->dev_ext_disp_function_count++;
-    return out_function;
+    if (!loader_lazy_dev_ext_resolution) {
+        loader_init_dispatch_dev_ext_entry(inst, NULL, new_function_index, funcName);
+    }
+    return loader_get_dev_ext_trampoline(new_function_index);
+}
+
+// Called by a device trampoline the first time it is used with a device, with the dispatchable object the call was made with.
+// Stores the function the device chain has for the trampoline in the dispatch table of the device and returns it, so that the
+// trampoline can go on to call it and jump there directly from then on.
+PFN_vkDevExt loader_resolve_dev_ext(void *dispatchable_object, uint32_t index) {
+    // The device dispatch table is the first member of struct loader_device
+    struct loader_device *dev = (struct loader_device *)loader_get_dev_dispatch(dispatchable_object);
+    const struct loader_instance *inst = dev->phys_dev_term->this_icd_term->this_instance;
+    PFN_vkDevExt function = (PFN_vkDevExt)dev->loader_dispatch.core_dispatch.GetDeviceProcAddr(
+        dev->chain_device, LOADER_UNKNOWN_FUNCTION_ENTRY(inst->dev_ext_disp_functions, index));
+    if (NULL == function) {
+        function = (PFN_vkDevExt)vkDevExtError;
+    }
+    LOADER_UNKNOWN_FUNCTION_ENTRY(dev->loader_dispatch.ext_dispatch, index) = function;
+    return function;
 }
 
 // Physical Device function handling
@@ -193,10 +439,12 @@ bool loader_check_layer_list_for_phys_dev_ext_address(struct loader_instance *in
 }
 
 void loader_free_phys_dev_ext_table(struct loader_instance *inst) {
-    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) {
-        loader_instance_heap_free(inst, inst->phys_dev_ext_disp_functions[i]);
+    loader_free_function_name_chunks(inst, inst->phys_dev_ext_disp_functions, inst->phys_dev_ext_disp_function_count);
+    inst->phys_dev_ext_disp_function_count = 0;
+    if (NULL != inst->disp) {
+        loader_free_phys_dev_ext_chunks(inst, inst->disp->phys_dev_ext);
     }
-    memset(inst->phys_dev_ext_disp_functions, 0, sizeof(inst->phys_dev_ext_disp_functions));
+    loader_free_unknown_function_map(inst, &inst->phys_dev_ext_function_map);
 }
 
 // This function returns a generic trampoline or terminator function
@@ -209,13 +457,28 @@ void loader_free_phys_dev_ext_table(struct loader_instance *inst) {
 // parameter is used to decide whether to return a trampoline or terminator
 // If it has not been seen before check if a layer or and ICD supports it.
 // If so then a new entry in the function name array is added.
-// Null is returned if discovered layer or ICD returns a non-NULL GetProcAddr for it
-// or if the function name table is full.
+// Null is returned if discovered layer or ICD returns a non-NULL GetProcAddr for it,
+// if all the trampolines are in use or if memory for it couldn't be allocated.
 void *loader_phys_dev_ext_gpa_impl(struct loader_instance *inst, const char *funcName, bool is_tramp) {
     assert(NULL != inst);
 
+    // Look for the function in the functions already added. The ICDs and layers were asked about it when it was added, so
+    // only the answer of the ICDs, which decides whether a terminator can be returned, needs to be remembered.
+    uint32_t hash = loader_unknown_function_hash(funcName);
+    struct loader_unknown_function_map_entry found;
+    if (loader_lookup_unknown_function(inst, &inst->phys_dev_ext_function_map, inst->phys_dev_ext_disp_functions, funcName, hash,
+                                       &found)) {
+        if (is_tramp) {
+            return loader_get_phys_dev_ext_tramp(found.index - 1);
+        } else if (found.supported_by_icd) {
+            return loader_get_phys_dev_ext_termin(found.index - 1);
+        }
+        return NULL;
+    }
+
     // We should always check to see if any ICD supports it.
-    if (!loader_check_icds_for_phys_dev_ext_address(inst, funcName)) {
+    bool supported_by_icd = loader_check_icds_for_phys_dev_ext_address(inst, funcName);
+    if (!supported_by_icd) {
         // If we're not checking layers, or we are and it's not in a layer, just
         // return
         if (!is_tramp || !loader_check_layer_list_for_phys_dev_ext_address(inst, funcName)) {
@@ -223,73 +486,105 @@ void *loader_phys_dev_ext_gpa_impl(struct loader_instance *inst, const char *fun
         }
     }
 
-    // Linearly look through already added functions to make sure we haven't seen it before
-    // if we have, return the function at the index found
-    for (uint32_t i = 0; i < inst->phys_dev_ext_disp_function_count; i++) {
-        if (inst->phys_dev_ext_disp_functions[i] && !strcmp(inst->phys_dev_ext_disp_functions[i], funcName)) {
-            if (is_tramp) {
-                return loader_get_phys_dev_ext_tramp(i);
-            } else {
-                return loader_get_phys_dev_ext_termin(i);
-            }
+    // The ICDs and layers were asked without holding the lock, so another thread may have added the function in the meantime
+    loader_stats_lock_mutex(inst, &inst->unknown_function_lock);
+    const struct loader_unknown_function_map_entry *entry =
+        loader_find_unknown_function(&inst->phys_dev_ext_function_map, inst->phys_dev_ext_disp_functions, funcName, hash);
+    if (NULL != entry) {
+        found = *entry;
+        loader_platform_thread_unlock_mutex(&inst->unknown_function_lock);
+        if (is_tramp) {
+            return loader_get_phys_dev_ext_tramp(found.index - 1);
+        } else if (found.supported_by_icd) {
+            return loader_get_phys_dev_ext_termin(found.index - 1);
         }
+        return NULL;
     }
 
-    if (inst->phys_dev_ext_disp_function_count >= MAX_NUM_UNKNOWN_EXTS) {
-        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_dev_ext_gpa: Exhausted the unknown physical device function array!");
+    uint32_t new_function_index = inst->phys_dev_ext_disp_function_count;
+    if (new_function_index >= MAX_NUM_UNKNOWN_FUNCTIONS) {
+        loader_platform_thread_unlock_mutex(&inst->unknown_function_lock);
+        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
+                   "loader_phys_dev_ext_gpa: Exhausted the unknown physical device function trampolines!");
         return NULL;
     }
-    loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0,
-               "loader_phys_dev_ext_gpa: Adding unknown physical function %s to internal store at index %u", funcName,
-               inst->phys_dev_ext_disp_function_count);
+
+    // Make room for the new function in the function name array, the instance dispatch table and every ICD
+    VkResult res = loader_reserve_function_name_chunk(inst, inst->phys_dev_ext_disp_functions, new_function_index);
+    if (VK_SUCCESS == res) {
+        res = loader_reserve_phys_dev_ext_chunk(inst, inst->disp->phys_dev_ext, new_function_index);
+    }
+    for (struct loader_icd_term *icd_term = inst->icd_terms; VK_SUCCESS == res && icd_term != NULL; icd_term = icd_term->next) {
+        res = loader_reserve_phys_dev_ext_chunk(inst, icd_term->phys_dev_ext, new_function_index);
+    }
 
     // add found function to phys_dev_ext_disp_functions;
-    size_t funcName_len = strlen(funcName) + 1;
-    inst->phys_dev_ext_disp_functions[inst->phys_dev_ext_disp_function_count] =
-        (char *)loader_instance_heap_alloc(inst, funcName_len, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-    if (NULL == inst->phys_dev_ext_disp_functions[inst->phys_dev_ext_disp_function_count]) {
-        // failed to allocate memory, return NULL
+    if (VK_SUCCESS == res) {
+        size_t funcName_len = strlen(funcName) + 1;
+        char *new_function_name = (char *)loader_instance_heap_alloc(inst, funcName_len, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == new_function_name) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        } else {
+            strncpy(new_function_name, funcName, funcName_len);
+            LOADER_UNKNOWN_FUNCTION_ENTRY(inst->phys_dev_ext_disp_functions, new_function_index) = new_function_name;
+        }
+    }
+    if (VK_SUCCESS != res) {
+        loader_platform_thread_unlock_mutex(&inst->unknown_function_lock);
         return NULL;
     }
-    strncpy(inst->phys_dev_ext_disp_functions[inst->phys_dev_ext_disp_function_count], funcName, funcName_len);
 
-    uint32_t new_function_index = inst->phys_dev_ext_disp_function_count;
-    // increment the count so that the subsequent logic includes the newly added entry point when searching for functions
-    inst->phys_dev_ext_disp_function_count++;
-
-    // Setup the ICD function pointers
-    struct loader_icd_term *icd_term = inst->icd_terms;
-    while (NULL != icd_term) {
+    // Setup the ICD function pointers and point the instance dispatch at the loader's terminator before the function is added to
+    // the map. Once it is there another thread can get the trampoline and call it, so every slot it reaches must already be
+    // filled in. If no ICD supports the function, the terminator reports it as unsupported. Drivers never call back into the
+    // loader, so they can be asked while the lock is held.
+    PFN_PhysDevExt *inst_function = &LOADER_UNKNOWN_FUNCTION_ENTRY(inst->disp->phys_dev_ext, new_function_index);
+    *inst_function = loader_get_phys_dev_ext_termin(new_function_index);
+    for (struct loader_icd_term *icd_term = inst->icd_terms; NULL != icd_term; icd_term = icd_term->next) {
+        PFN_PhysDevExt *icd_function = &LOADER_UNKNOWN_FUNCTION_ENTRY(icd_term->phys_dev_ext, new_function_index);
         if (MIN_PHYS_DEV_EXTENSION_ICD_INTERFACE_VERSION <= icd_term->scanned_icd->interface_version &&
             NULL != icd_term->scanned_icd->GetPhysicalDeviceProcAddr) {
-            icd_term->phys_dev_ext[new_function_index] =
-                (PFN_PhysDevExt)icd_term->scanned_icd->GetPhysicalDeviceProcAddr(icd_term->instance, funcName);
-            if (NULL != icd_term->phys_dev_ext[new_function_index]) {
-                // Make sure we set the instance dispatch to point to the loader's terminator now since we can at least handle it in
-                // one ICD.
-                inst->disp->phys_dev_ext[new_function_index] = loader_get_phys_dev_ext_termin(new_function_index);
-
-                loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "loader_phys_dev_ext_gpa: Driver %s returned ptr %p for %s",
-                           icd_term->scanned_icd->lib_name, inst->disp->phys_dev_ext[new_function_index], funcName);
-            }
+            *icd_function = (PFN_PhysDevExt)icd_term->scanned_icd->GetPhysicalDeviceProcAddr(icd_term->instance, funcName);
         } else {
-            icd_term->phys_dev_ext[new_function_index] = NULL;
+            *icd_function = NULL;
         }
+    }
 
-        icd_term = icd_term->next;
+    res = loader_add_unknown_function(inst, &inst->phys_dev_ext_function_map, hash, new_function_index, supported_by_icd);
+    if (VK_SUCCESS != res) {
+        loader_instance_heap_free(inst, LOADER_UNKNOWN_FUNCTION_ENTRY(inst->phys_dev_ext_disp_functions, new_function_index));
+        LOADER_UNKNOWN_FUNCTION_ENTRY(inst->phys_dev_ext_disp_functions, new_function_index) = NULL;
+        loader_platform_thread_unlock_mutex(&inst->unknown_function_lock);
+        return NULL;
+    }
+    // increment the count so that the subsequent logic includes the newly added entry point when searching for functions
+    inst->phys_dev_ext_disp_function_count++;
+    loader_platform_thread_unlock_mutex(&inst->unknown_function_lock);
+
+    loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0,
+               "loader_phys_dev_ext_gpa: Adding unknown physical function %s to internal store at index %u", funcName,
+               new_function_index);
+    for (struct loader_icd_term *icd_term = inst->icd_terms; NULL != icd_term; icd_term = icd_term->next) {
+        PFN_PhysDevExt icd_function = LOADER_UNKNOWN_FUNCTION_ENTRY(icd_term->phys_dev_ext, new_function_index);
+        if (NULL != icd_function) {
+            loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "loader_phys_dev_ext_gpa: Driver %s returned ptr %p for %s",
+                       icd_term->scanned_icd->lib_name, icd_function, funcName);
+        }
     }
 
     // Now, search for the first layer attached and query using it to get the first entry point.
-    // Only set the instance dispatch table to it if it isn't NULL.
+    // Only set the instance dispatch table to it if it isn't NULL. This is done without holding the lock, since the layers call
+    // down to the loader's terminator, which looks the function up again and now finds it. Other threads may already be calling
+    // through the slot, so it is replaced atomically.
     for (uint32_t i = 0; i < inst->expanded_activated_layer_list.count; i++) {
         struct loader_layer_properties *layer_prop = &inst->expanded_activated_layer_list.list[i];
         if (layer_prop->interface_version > 1 && NULL != layer_prop->functions.get_physical_device_proc_addr) {
             void *layer_ret_function =
                 (PFN_PhysDevExt)layer_prop->functions.get_physical_device_proc_addr(inst->instance, funcName);
             if (NULL != layer_ret_function) {
-                inst->disp->phys_dev_ext[new_function_index] = layer_ret_function;
+                loader_platform_atomic_store_ptr((void **)inst_function, layer_ret_function);
                 loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "loader_phys_dev_ext_gpa: Layer %s returned ptr %p for %s",
-                           layer_prop->info.layerName, inst->disp->phys_dev_ext[new_function_index], funcName);
+                           layer_prop->info.layerName, layer_ret_function, funcName);
                 break;
             }
         }
@@ -313,16 +608,11 @@ void *loader_phys_dev_ext_gpa_term(struct loader_instance *inst, const char *fun
 void *loader_phys_dev_ext_gpa_term_no_check(struct loader_instance *inst, const char *funcName) {
     assert(NULL != inst);
 
-    // We should always check to see if any ICD supports it.
-    if (!loader_check_icds_for_phys_dev_ext_address(inst, funcName)) {
-        return NULL;
-    }
-
-    // Linearly look through already added functions to make sure we haven't seen it before
-    // if we have, return the function at the index found
-    for (uint32_t i = 0; i < inst->phys_dev_ext_disp_function_count; i++) {
-        if (inst->phys_dev_ext_disp_functions[i] && !strcmp(inst->phys_dev_ext_disp_functions[i], funcName))
-            return loader_get_phys_dev_ext_termin(i);
+    struct loader_unknown_function_map_entry found;
+    if (loader_lookup_unknown_function(inst, &inst->phys_dev_ext_function_map, inst->phys_dev_ext_disp_functions, funcName,
+                                       loader_unknown_function_hash(funcName), &found) &&
+        found.supported_by_icd) {
+        return loader_get_phys_dev_ext_termin(found.index - 1);
     }
 
     return NULL;
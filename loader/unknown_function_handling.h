@@ -26,12 +26,16 @@
 
 #include "loader_common.h"
 
+VkResult loader_alloc_dispatch_dev_ext(const struct loader_instance *inst, struct loader_device *dev);
 void loader_init_dispatch_dev_ext(struct loader_instance *inst, struct loader_device *dev);
+void loader_free_dispatch_dev_ext(struct loader_device *dev);
 void *loader_dev_ext_gpa(struct loader_instance *inst, const char *funcName);
+PFN_vkDevExt loader_resolve_dev_ext(void *dispatchable_object, uint32_t index);
 
 void *loader_phys_dev_ext_gpa_tramp(struct loader_instance *inst, const char *funcName);
 void *loader_phys_dev_ext_gpa_term(struct loader_instance *inst, const char *funcName);
 void *loader_phys_dev_ext_gpa_term_no_check(struct loader_instance *inst, const char *funcName);
 
 void loader_free_dev_ext_table(struct loader_instance *inst);
-void loader_free_phys_dev_ext_table(struct loader_instance *inst);
\ No newline at end of file
+void loader_free_phys_dev_ext_table(struct loader_instance *inst);
+void loader_free_icd_term_phys_dev_ext(struct loader_instance *inst, struct loader_icd_term *icd_term);
\ No newline at end of file
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Where the time went in a call to vkCreateInstance or vkCreateDevice.
+//
+// An application which chains VkLoaderCreationFeedbackCreateInfo onto the pNext chain of VkInstanceCreateInfo or
+// VkDeviceCreateInfo gets back how long the loader itself took, how long it took to get each layer ready, how long the layers
+// took, and how long each driver took. The structure must come first in the chain, directly in the create info's pNext. The loader
+// then leaves it out of the create info it passes to layers and drivers, so none of them need to know about it. The application's
+// chain is never changed. A feedback structure anywhere else in the chain is ignored, and the loader logs a warning.
+//
+// Layers call one another directly, so the loader can't tell where one layer's create call ends and the next one's begins. What
+// it reports per layer is the time spent loading and preparing that layer, while the time spent inside all of the layers' create
+// calls is reported as a whole in pLayerChainFeedback.
+
+// Not part of any extension, so this was picked far away from the values assigned to extensions
+#define VK_STRUCTURE_TYPE_LOADER_CREATION_FEEDBACK_CREATE_INFO ((VkStructureType)0x7FFF0000)
+
+typedef enum VkLoaderCreationFeedbackFlagBits {
+    VK_LOADER_CREATION_FEEDBACK_VALID_BIT = 0x00000001,  // The loader filled in this feedback
+    VK_LOADER_CREATION_FEEDBACK_FLAG_BITS_MAX_ENUM = 0x7FFFFFFF
+} VkLoaderCreationFeedbackFlagBits;
+typedef VkFlags VkLoaderCreationFeedbackFlags;
+
+typedef struct VkLoaderCreationFeedback {
+    VkLoaderCreationFeedbackFlags flags;
+    char name[VK_MAX_EXTENSION_NAME_SIZE];  // Layer name or driver library, truncated if needed. Empty for the other feedbacks.
+    uint64_t duration;                      // In nanoseconds
+} VkLoaderCreationFeedback;
+
+// Every pointer may be NULL. The counts give how many elements the arrays have room for. Layers are listed in the order they
+// are called, the one closest to the application first, and drivers in the order they are called. Elements the loader had
+// nothing to put in, and every feedback of a call which failed before it got that far, are left with flags set to 0.
+typedef struct VkLoaderCreationFeedbackCreateInfo {
+    VkStructureType sType;
+    const void *pNext;
+    VkLoaderCreationFeedback *pCreationFeedback;    // The whole call
+    VkLoaderCreationFeedback *pDiscoveryFeedback;   // Everything before the loader starts getting the layers ready, such as
+                                                    // searching for and reading manifests and opening drivers
+    VkLoaderCreationFeedback *pLayerChainFeedback;  // From calling the first layer until it returns, less the time in drivers
+    uint32_t layerFeedbackCount;
+    VkLoaderCreationFeedback *pLayerFeedbacks;  // Opening each layer's library and finding its entrypoints
+    uint32_t driverFeedbackCount;
+    VkLoaderCreationFeedback *pDriverFeedbacks;  // Each driver's vkCreateInstance or vkCreateDevice call
+} VkLoaderCreationFeedbackCreateInfo;
+
+#ifdef __cplusplus
+}
+#endif
@@ -50,6 +50,10 @@
 #include <pthread.h>
 #include <stdlib.h>
 #include <libgen.h>
+#include <time.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 
 #elif defined(_WIN32)  // defined(__linux__)
 /* Windows-specific common code: */
@@ -79,11 +83,10 @@
 
 #define MAX_STRING_SIZE 1024
 
-// This is defined in vk_layer.h, but if there's problems we need to create the define
-// here.
-#ifndef MAX_NUM_UNKNOWN_EXTS
-#define MAX_NUM_UNKNOWN_EXTS 250
-#endif
+// The number of trampolines and terminators the loader has for functions it doesn't know about. Storage for the dispatch of
+// those functions grows with the number actually used, so this only bounds how many can be handed out. It must match the
+// number of instantiations in unknown_ext_chain.c and the unknown_ext_chain assembly files.
+#define MAX_NUM_UNKNOWN_FUNCTIONS 1000
 
 // Environment Variable information
 #define VK_ICD_FILENAMES_ENV_VAR "VK_ICD_FILENAMES"  // Deprecated
@@ -354,9 +357,77 @@ static inline const char *loader_platform_get_proc_address_error(const char *nam
 // Thread mutex:
 static inline void loader_platform_thread_create_mutex(loader_platform_thread_mutex *pMutex) { pthread_mutex_init(pMutex, NULL); }
 static inline void loader_platform_thread_lock_mutex(loader_platform_thread_mutex *pMutex) { pthread_mutex_lock(pMutex); }
+// Returns false without waiting if another thread holds the mutex
+static inline bool loader_platform_thread_try_lock_mutex(loader_platform_thread_mutex *pMutex) {
+    return pthread_mutex_trylock(pMutex) == 0;
+}
 static inline void loader_platform_thread_unlock_mutex(loader_platform_thread_mutex *pMutex) { pthread_mutex_unlock(pMutex); }
 static inline void loader_platform_thread_delete_mutex(loader_platform_thread_mutex *pMutex) { pthread_mutex_destroy(pMutex); }
 
+// Thread condition variables, waited on with the mutex given held:
+static inline void loader_platform_thread_create_cond(loader_platform_thread_cond *pCond) { pthread_cond_init(pCond, NULL); }
+static inline void loader_platform_thread_cond_wait(loader_platform_thread_cond *pCond, loader_platform_thread_mutex *pMutex) {
+    pthread_cond_wait(pCond, pMutex);
+}
+static inline void loader_platform_thread_cond_signal(loader_platform_thread_cond *pCond) { pthread_cond_signal(pCond); }
+static inline void loader_platform_thread_delete_cond(loader_platform_thread_cond *pCond) { pthread_cond_destroy(pCond); }
+
+// Threads:
+typedef void *loader_platform_thread_result;
+#define LOADER_PLATFORM_THREAD_CALL
+typedef loader_platform_thread_result(LOADER_PLATFORM_THREAD_CALL *loader_platform_thread_start)(void *arg);
+static inline bool loader_platform_thread_create(loader_platform_thread *thread, loader_platform_thread_start start, void *arg) {
+    return pthread_create(thread, NULL, start, arg) == 0;
+}
+static inline void loader_platform_thread_join(loader_platform_thread thread) { pthread_join(thread, NULL); }
+
+// Atomic pointers, for data which is published once fully written and read without taking a lock:
+static inline void *loader_platform_atomic_load_ptr(void *const *ptr) { return __atomic_load_n(ptr, __ATOMIC_ACQUIRE); }
+static inline void loader_platform_atomic_store_ptr(void **ptr, void *value) { __atomic_store_n(ptr, value, __ATOMIC_RELEASE); }
+
+// Atomic 32-bit values, for flags which are read without taking the lock they are written under:
+static inline uint32_t loader_platform_atomic_load_u32(const uint32_t *ptr) { return __atomic_load_n(ptr, __ATOMIC_ACQUIRE); }
+static inline void loader_platform_atomic_store_u32(uint32_t *ptr, uint32_t value) {
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+// Atomic 64-bit counters and sequence numbers:
+static inline uint64_t loader_platform_atomic_load_u64(const uint64_t *ptr) { return __atomic_load_n(ptr, __ATOMIC_ACQUIRE); }
+static inline void loader_platform_atomic_store_u64(uint64_t *ptr, uint64_t value) {
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+static inline uint64_t loader_platform_atomic_fetch_add_u64(uint64_t *ptr, uint64_t value) {
+    return __atomic_fetch_add(ptr, value, __ATOMIC_ACQ_REL);
+}
+// Returns true and stores desired if *ptr equals *expected, otherwise returns false and loads the current value into *expected
+static inline bool loader_platform_atomic_compare_exchange_u64(uint64_t *ptr, uint64_t *expected, uint64_t desired) {
+    return __atomic_compare_exchange_n(ptr, expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+// Time and thread identification, for timestamping diagnostics:
+static inline uint64_t loader_platform_monotonic_time_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+static inline uint64_t loader_platform_get_thread_id(void) {
+#if defined(__linux__)
+    return (uint64_t)syscall(SYS_gettid);
+#elif defined(__APPLE__)
+    uint64_t thread_id = 0;
+    pthread_threadid_np(NULL, &thread_id);
+    return thread_id;
+#else
+    return (uint64_t)(uintptr_t)pthread_self();
+#endif
+}
+static inline void loader_platform_sleep_ms(uint32_t milliseconds) {
+    struct timespec duration;
+    duration.tv_sec = milliseconds / 1000;
+    duration.tv_nsec = (long)(milliseconds % 1000) * 1000000L;
+    nanosleep(&duration, NULL);
+}
+
 #elif defined(_WIN32)  // defined(__linux__)
 
 // Get the key for the plug n play driver registry
@@ -502,9 +573,81 @@ static const char *loader_platform_get_proc_address_error(const char *name) {
 // Thread mutex:
 static void loader_platform_thread_create_mutex(loader_platform_thread_mutex *pMutex) { InitializeCriticalSection(pMutex); }
 static void loader_platform_thread_lock_mutex(loader_platform_thread_mutex *pMutex) { EnterCriticalSection(pMutex); }
+// Returns false without waiting if another thread holds the mutex
+static bool loader_platform_thread_try_lock_mutex(loader_platform_thread_mutex *pMutex) {
+    return TryEnterCriticalSection(pMutex) != 0;
+}
 static void loader_platform_thread_unlock_mutex(loader_platform_thread_mutex *pMutex) { LeaveCriticalSection(pMutex); }
 static void loader_platform_thread_delete_mutex(loader_platform_thread_mutex *pMutex) { DeleteCriticalSection(pMutex); }
 
+// Thread condition variables, waited on with the mutex given held:
+static void loader_platform_thread_create_cond(loader_platform_thread_cond *pCond) { InitializeConditionVariable(pCond); }
+static void loader_platform_thread_cond_wait(loader_platform_thread_cond *pCond, loader_platform_thread_mutex *pMutex) {
+    SleepConditionVariableCS(pCond, pMutex, INFINITE);
+}
+static void loader_platform_thread_cond_signal(loader_platform_thread_cond *pCond) { WakeConditionVariable(pCond); }
+static void loader_platform_thread_delete_cond(loader_platform_thread_cond *pCond) { (void)pCond; }
+
+// Threads:
+typedef DWORD loader_platform_thread_result;
+#define LOADER_PLATFORM_THREAD_CALL WINAPI
+typedef loader_platform_thread_result(LOADER_PLATFORM_THREAD_CALL *loader_platform_thread_start)(void *arg);
+static bool loader_platform_thread_create(loader_platform_thread *thread, loader_platform_thread_start start, void *arg) {
+    *thread = CreateThread(NULL, 0, start, arg, 0, NULL);
+    return *thread != NULL;
+}
+static void loader_platform_thread_join(loader_platform_thread thread) {
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+
+// Atomic pointers, for data which is published once fully written and read without taking a lock:
+static void *loader_platform_atomic_load_ptr(void *const *ptr) {
+    return InterlockedCompareExchangePointer((PVOID volatile *)ptr, NULL, NULL);
+}
+static void loader_platform_atomic_store_ptr(void **ptr, void *value) { InterlockedExchangePointer((PVOID volatile *)ptr, value); }
+
+// Atomic 32-bit values, for flags which are read without taking the lock they are written under:
+static uint32_t loader_platform_atomic_load_u32(const uint32_t *ptr) {
+    return (uint32_t)InterlockedCompareExchange((LONG volatile *)ptr, 0, 0);
+}
+static void loader_platform_atomic_store_u32(uint32_t *ptr, uint32_t value) {
+    InterlockedExchange((LONG volatile *)ptr, (LONG)value);
+}
+
+// Atomic 64-bit counters and sequence numbers:
+static uint64_t loader_platform_atomic_load_u64(const uint64_t *ptr) {
+    return (uint64_t)InterlockedCompareExchange64((LONG64 volatile *)ptr, 0, 0);
+}
+static void loader_platform_atomic_store_u64(uint64_t *ptr, uint64_t value) {
+    InterlockedExchange64((LONG64 volatile *)ptr, (LONG64)value);
+}
+static uint64_t loader_platform_atomic_fetch_add_u64(uint64_t *ptr, uint64_t value) {
+    return (uint64_t)InterlockedExchangeAdd64((LONG64 volatile *)ptr, (LONG64)value);
+}
+// Returns true and stores desired if *ptr equals *expected, otherwise returns false and loads the current value into *expected
+static bool loader_platform_atomic_compare_exchange_u64(uint64_t *ptr, uint64_t *expected, uint64_t desired) {
+    uint64_t previous = (uint64_t)InterlockedCompareExchange64((LONG64 volatile *)ptr, (LONG64)desired, (LONG64)*expected);
+    if (previous == *expected) {
+        return true;
+    }
+    *expected = previous;
+    return false;
+}
+
+// Time and thread identification, for timestamping diagnostics:
+static uint64_t loader_platform_monotonic_time_ns(void) {
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    // Split the conversion so the multiplication can't overflow for long running processes
+    uint64_t seconds = (uint64_t)counter.QuadPart / (uint64_t)frequency.QuadPart;
+    uint64_t remainder = (uint64_t)counter.QuadPart % (uint64_t)frequency.QuadPart;
+    return seconds * 1000000000ull + remainder * 1000000000ull / (uint64_t)frequency.QuadPart;
+}
+static uint64_t loader_platform_get_thread_id(void) { return (uint64_t)GetCurrentThreadId(); }
+static void loader_platform_sleep_ms(uint32_t milliseconds) { Sleep(milliseconds); }
+
 #else  // defined(_WIN32)
 
 #error The "vk_loader_platform.h" file must be modified for this OS.
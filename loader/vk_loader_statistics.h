@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Counters the loader keeps about the work it has done, for tools which watch for regressions in loader overhead.
+//
+// vk_loaderGetStatistics is loader specific and not part of any extension, so it is only ever returned by the loader's own
+// vkGetInstanceProcAddr, for any value of instance. Each counter only ever goes up. New counters are only ever added to the end
+// of the list, so the index of a counter never changes.
+
+#define VK_LOADER_GET_STATISTICS_NAME "vk_loaderGetStatistics"
+
+typedef enum VkLoaderStatistic {
+    VK_LOADER_STATISTIC_MANIFEST_FILES_OPENED = 0,     // Driver and layer manifest files read, including to check for changes
+    VK_LOADER_STATISTIC_MANIFEST_BYTES_READ = 1,       // Total size of those files
+    VK_LOADER_STATISTIC_JSON_VALUES_PARSED = 2,        // Objects, arrays, strings, numbers, and literals in manifests parsed
+    VK_LOADER_STATISTIC_LIBRARIES_OPENED = 3,          // Driver and layer libraries opened
+    VK_LOADER_STATISTIC_LIBRARIES_CLOSED = 4,          // Driver and layer libraries closed
+    VK_LOADER_STATISTIC_GIPA_GLOBAL_HITS = 5,          // vkGetInstanceProcAddr calls answered with a global function
+    VK_LOADER_STATISTIC_GIPA_INSTANCE_HITS = 6,        // vkGetInstanceProcAddr calls answered with an instance or device function
+    VK_LOADER_STATISTIC_GIPA_MISSES = 7,               // vkGetInstanceProcAddr calls which returned NULL
+    VK_LOADER_STATISTIC_GDPA_LOADER_HITS = 8,          // vkGetDeviceProcAddr calls answered by the loader's own functions
+    VK_LOADER_STATISTIC_GDPA_DISPATCH_HITS = 9,        // vkGetDeviceProcAddr calls answered from the device dispatch table
+    VK_LOADER_STATISTIC_GDPA_CHAIN_HITS = 10,          // vkGetDeviceProcAddr calls answered by the first layer or the driver
+    VK_LOADER_STATISTIC_GDPA_MISSES = 11,              // vkGetDeviceProcAddr calls which returned NULL
+    VK_LOADER_STATISTIC_UNKNOWN_FUNCTIONS_ADDED = 12,  // Functions unknown to the loader given a slot in the dispatch tables
+    VK_LOADER_STATISTIC_LOCK_ACQUISITIONS = 13,        // Times the instance list, instance, or device list lock was taken
+    VK_LOADER_STATISTIC_LOCK_CONTENTIONS = 14,         // How many of those had to wait for another thread to release it
+    VK_LOADER_STATISTIC_COUNT = 15,
+} VkLoaderStatistic;
+
+// With a NULL instance the counters for the whole process are returned, otherwise the counters for that instance alone.
+// vkGetDeviceProcAddr calls are only counted for the whole process.
+//
+// If pStatistics is NULL, the number of counters is returned in pStatisticCount. Otherwise up to *pStatisticCount counters are
+// written to pStatistics, indexed by VkLoaderStatistic, and VK_INCOMPLETE is returned if there are more.
+// VK_ERROR_INITIALIZATION_FAILED is returned if instance isn't a valid instance.
+typedef VkResult(VKAPI_PTR *PFN_vk_loaderGetStatistics)(VkInstance instance, uint32_t *pStatisticCount, uint64_t *pStatistics);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "worker_pool.h"
+
+#include <stdlib.h>
+
+#include "get_environment.h"
+#include "log.h"
+
+struct loader_worker_pool {
+    loader_platform_thread_mutex lock;
+    uint32_t next_index;
+    uint32_t count;
+    void (*func)(void *user_data, uint32_t index);
+    void *user_data;
+};
+
+// Keep taking the next unclaimed index until there are none left
+static void loader_worker_pool_drain(struct loader_worker_pool *pool) {
+    for (;;) {
+        loader_platform_thread_lock_mutex(&pool->lock);
+        uint32_t index = pool->next_index;
+        if (index < pool->count) {
+            pool->next_index++;
+        }
+        loader_platform_thread_unlock_mutex(&pool->lock);
+        if (index >= pool->count) {
+            break;
+        }
+        pool->func(pool->user_data, index);
+    }
+}
+
+static loader_platform_thread_result LOADER_PLATFORM_THREAD_CALL loader_worker_pool_thread(void *arg) {
+    loader_worker_pool_drain((struct loader_worker_pool *)arg);
+    return 0;
+}
+
+uint32_t loader_get_worker_thread_count(const struct loader_instance *inst, const char *env_var) {
+    uint32_t thread_count = 1;
+    char *env_value = loader_getenv(env_var, inst);
+    if (NULL != env_value) {
+        long value = strtol(env_value, NULL, 10);
+        if (value > LOADER_MAX_WORKER_THREADS) {
+            thread_count = LOADER_MAX_WORKER_THREADS;
+        } else if (value > 1) {
+            thread_count = (uint32_t)value;
+        }
+        loader_free_getenv(env_value, inst);
+    }
+    return thread_count;
+}
+
+void loader_run_parallel(const struct loader_instance *inst, uint32_t thread_count, uint32_t count,
+                         void (*func)(void *user_data, uint32_t index), void *user_data) {
+    loader_platform_thread threads[LOADER_MAX_WORKER_THREADS - 1];
+    uint32_t started_threads = 0;
+    struct loader_worker_pool pool;
+
+    if (thread_count > LOADER_MAX_WORKER_THREADS) {
+        thread_count = LOADER_MAX_WORKER_THREADS;
+    }
+    // No point in starting more threads than there are pieces of work
+    if (thread_count > count) {
+        thread_count = count;
+    }
+    if (thread_count <= 1) {
+        for (uint32_t i = 0; i < count; i++) {
+            func(user_data, i);
+        }
+        return;
+    }
+
+    pool.next_index = 0;
+    pool.count = count;
+    pool.func = func;
+    pool.user_data = user_data;
+    loader_platform_thread_create_mutex(&pool.lock);
+
+    // The calling thread is one of the workers
+    for (uint32_t i = 0; i < thread_count - 1; i++) {
+        if (!loader_platform_thread_create(&threads[started_threads], loader_worker_pool_thread, &pool)) {
+            loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
+                       "loader_run_parallel: Only able to start %u of %u worker threads, continuing with fewer threads",
+                       started_threads, thread_count - 1);
+            break;
+        }
+        started_threads++;
+    }
+
+    loader_worker_pool_drain(&pool);
+
+    for (uint32_t i = 0; i < started_threads; i++) {
+        loader_platform_thread_join(threads[i]);
+    }
+    loader_platform_thread_delete_mutex(&pool.lock);
+}
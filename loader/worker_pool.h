@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "loader_common.h"
+
+// Small pool of short lived worker threads for splitting independent pieces of work, such as reading and parsing manifest
+// files, across several threads.
+
+// Upper limit on the number of threads, including the calling thread, loader_run_parallel will use.
+#define LOADER_MAX_WORKER_THREADS 16
+
+// Number of threads to use as given by the environment variable env_var, such as VK_LOADER_MANIFEST_THREADS. Returns 1,
+// meaning everything is done on the calling thread, if the variable isn't set.
+uint32_t loader_get_worker_thread_count(const struct loader_instance *inst, const char *env_var);
+
+// Call func once for every index in [0, count), spread over at most thread_count threads. The calling thread does its share of
+// the work, and nothing returns until every call has finished. The order in which the indices are processed is unspecified,
+// so each call must only touch the state belonging to its own index. If no threads can be started all of the work is done on
+// the calling thread.
+void loader_run_parallel(const struct loader_instance *inst, uint32_t thread_count, uint32_t count,
+                         void (*func)(void *user_data, uint32_t index), void *user_data);
@@ -98,6 +98,77 @@ PRE_INSTANCE_FUNCTIONS = ['vkEnumerateInstanceExtensionProperties',
                           'vkEnumerateInstanceLayerProperties',
                           'vkEnumerateInstanceVersion']
 
+#
+# 32 bit FNV-1a hash of a command name. Must match loader_command_name_hash in the generated source.
+def CommandNameHash(name):
+    hash = 2166136261
+    for c in name.encode():
+        hash ^= c
+        hash = (hash * 16777619) & 0xffffffff
+    return hash
+
+#
+# Mixes a seed into a command name hash, using the MurmurHash3 finalizer so every bit of the result depends on every
+# bit of the input. Must match loader_command_name_mix in the generated source.
+def CommandNameMix(hash, seed):
+    hash ^= seed
+    hash ^= hash >> 16
+    hash = (hash * 0x85ebca6b) & 0xffffffff
+    hash ^= hash >> 13
+    hash = (hash * 0xc2b2ae35) & 0xffffffff
+    hash ^= hash >> 16
+    return hash
+
+#
+# Build a minimal perfect hash of names using hash and displace. Names are placed into buckets by their hash mixed
+# with a seed of 0, then starting with the largest bucket a seed is searched for which sends every name in the bucket
+# to a free slot. Buckets holding a single name are given one of the slots left over directly, stored as -(slot + 1).
+# Returns the per bucket seeds and the name which ended up in each slot.
+def BuildCommandNameHash(names):
+    size = len(names)
+    hashes = {}
+    for name in names:
+        hashes[name] = CommandNameHash(name)
+    if len(set(hashes.values())) != size:
+        raise RuntimeError('Command names with the same hash, a different hash function is needed')
+
+    buckets = [[] for i in range(size)]
+    for name in sorted(names):
+        buckets[CommandNameMix(hashes[name], 0) % size].append(name)
+    bucket_order = sorted(range(size), key=lambda i: (-len(buckets[i]), i))
+
+    seeds = [0] * size
+    slots = [None] * size
+    for bucket_index in bucket_order:
+        bucket = buckets[bucket_index]
+        if len(bucket) <= 1:
+            break
+        seed = 1
+        while True:
+            placed = []
+            for name in bucket:
+                slot = CommandNameMix(hashes[name], seed) % size
+                if slots[slot] is not None or slot in placed:
+                    break
+                placed.append(slot)
+            if len(placed) == len(bucket):
+                break
+            seed += 1
+        for name, slot in zip(bucket, placed):
+            slots[slot] = name
+        seeds[bucket_index] = seed
+
+    free_slots = [i for i in range(size) if slots[i] is None]
+    for bucket_index in bucket_order:
+        bucket = buckets[bucket_index]
+        if len(bucket) != 1:
+            continue
+        slot = free_slots.pop(0)
+        slots[slot] = bucket[0]
+        seeds[bucket_index] = -(slot + 1)
+
+    return seeds, slots
+
 #
 # LoaderExtensionGeneratorOptions - subclass of GeneratorOptions.
 class LoaderExtensionGeneratorOptions(GeneratorOptions):
@@ -212,6 +283,7 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
             preamble += '#pragma once\n'
 
         elif self.genOpts.filename == 'vk_loader_extensions.c':
+            preamble += '#include <stddef.h>\n'
             preamble += '#include <stdio.h>\n'
             preamble += '#include <stdlib.h>\n'
             preamble += '#include <string.h>\n'
@@ -246,7 +318,9 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
             file_data += self.OutputUtilitiesInSource()
             file_data += self.OutputIcdDispatchTableInit()
             file_data += self.OutputLoaderDispatchTables()
+            file_data += self.OutputCommandNameHashUtilities()
             file_data += self.OutputLoaderLookupFunc()
+            file_data += self.OutputCoreTrampolineLookupFuncs()
             file_data += self.CreateTrampTermFuncs()
             file_data += self.InstExtensionGPA()
             file_data += self.InstantExtensionCreate()
@@ -482,6 +556,10 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
         protos += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,\n'
         protos += '                                                                  bool *found_name);\n'
         protos += '\n'
+        protos += '// Core command trampoline lookup functions. The global commands are only found by loader_lookup_global_trampoline.\n'
+        protos += 'void *loader_lookup_core_trampoline(const char *name);\n'
+        protos += 'void *loader_lookup_global_trampoline(const char *name);\n'
+        protos += '\n'
         return protos
 
     def OutputUtilitiesInSource(self):
@@ -765,7 +843,6 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                 tables += '                                                             VkDevice dev) {\n'
                 tables += '    VkLayerDispatchTable *table = &dev_table->core_dispatch;\n'
                 tables += '    table->magic = DEVICE_DISP_TABLE_MAGIC_NUMBER;\n'
-                tables += '    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) dev_table->ext_dispatch[i] = (PFN_vkDevExt)vkDevExtError;\n'
 
             elif x == 1:
                 cur_type = 'device'
@@ -851,31 +928,23 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
         commands = []
         tables = ''
         cur_type = ''
-        cur_extension_name = ''
+
+        tables += '// Location of a command in a dispatch table, or a NULL name if the command isn\'t part of this build\n'
+        tables += 'struct loader_dispatch_table_entry {\n'
+        tables += '    const char *name;\n'
+        tables += '    size_t offset;\n'
+        tables += '};\n'
+        tables += '\n'
 
         for x in range(0, 2):
             if x == 0:
                 cur_type = 'device'
-
-                tables += '// Device command lookup function\n'
-                tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_device_dispatch_table(const VkLayerDispatchTable *table, const char *name) {\n'
-                tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') return NULL;\n'
-                tables += '\n'
-                tables += '    name += 2;\n'
+                table_type = 'VkLayerDispatchTable'
             else:
                 cur_type = 'instance'
+                table_type = 'VkLayerInstanceDispatchTable'
 
-                tables += '// Instance command lookup function\n'
-                tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,\n'
-                tables += '                                                                 bool *found_name) {\n'
-                tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') {\n'
-                tables += '        *found_name = false;\n'
-                tables += '        return NULL;\n'
-                tables += '    }\n'
-                tables += '\n'
-                tables += '    *found_name = true;\n'
-                tables += '    name += 2;\n'
-
+            entries = {}
             for y in range(0, 2):
                 if y == 0:
                     commands = self.core_commands
@@ -886,13 +955,6 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                     is_inst_handle_type = cur_cmd.handle_type == 'VkInstance' or cur_cmd.handle_type == 'VkPhysicalDevice'
                     if ((cur_type == 'instance' and is_inst_handle_type) or (cur_type == 'device' and not is_inst_handle_type)):
 
-                        if cur_cmd.ext_name != cur_extension_name:
-                            if 'VK_VERSION_' in cur_cmd.ext_name:
-                                tables += '\n    // ---- Core %s commands\n' % cur_cmd.ext_name[11:]
-                            else:
-                                tables += '\n    // ---- %s extension commands\n' % cur_cmd.ext_name
-                            cur_extension_name = cur_cmd.ext_name
-
                         # Remove 'vk' from proto name
                         base_name = cur_cmd.name[2:]
 
@@ -902,21 +964,136 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                             base_name == 'EnumerateInstanceVersion'):
                             continue
 
-                        if cur_cmd.protect is not None:
-                            tables += '#ifdef %s\n' % cur_cmd.protect
-
-                        tables += '    if (!strcmp(name, "%s")) return (void *)table->%s;\n' % (base_name, base_name)
+                        if cur_cmd.name not in entries:
+                            entries[cur_cmd.name] = cur_cmd.protect
 
-                        if cur_cmd.protect is not None:
-                            tables += '#endif // %s\n' % cur_cmd.protect
+            seeds, slots = BuildCommandNameHash(list(entries.keys()))
 
+            tables += '// %s dispatch table members, in the order of their perfect hash\n' % cur_type.capitalize()
+            tables += self.OutputCommandNameHashSeeds('%s_dispatch_table_seeds' % cur_type, seeds)
             tables += '\n'
-            if x == 1:
-                tables += '    *found_name = false;\n'
-            tables += '    return NULL;\n'
-            tables += '}\n\n'
+            tables += 'static const struct loader_dispatch_table_entry %s_dispatch_table_entries[%d] = {\n' % (cur_type, len(slots))
+            for name in slots:
+                if entries[name] is not None:
+                    tables += '#ifdef %s\n' % entries[name]
+                tables += '    {"%s", offsetof(%s, %s)},\n' % (name, table_type, name[2:])
+                if entries[name] is not None:
+                    tables += '#else\n'
+                    tables += '    {NULL, 0},\n'
+                    tables += '#endif // %s\n' % entries[name]
+            tables += '};\n'
+            tables += '\n'
+
+            if x == 0:
+                tables += '// Device command lookup function\n'
+                tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_device_dispatch_table(const VkLayerDispatchTable *table, const char *name) {\n'
+                tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') return NULL;\n'
+                tables += '\n'
+                tables += '    const struct loader_dispatch_table_entry *entry =\n'
+                tables += '        &device_dispatch_table_entries[loader_command_name_slot(device_dispatch_table_seeds, %d, name)];\n' % len(slots)
+                tables += '    if (NULL == entry->name || strcmp(entry->name, name) != 0) return NULL;\n'
+                tables += '\n'
+                tables += '    return (void *)*(const PFN_vkVoidFunction *)((const char *)table + entry->offset);\n'
+                tables += '}\n\n'
+            else:
+                tables += '// Instance command lookup function\n'
+                tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,\n'
+                tables += '                                                                 bool *found_name) {\n'
+                tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') {\n'
+                tables += '        *found_name = false;\n'
+                tables += '        return NULL;\n'
+                tables += '    }\n'
+                tables += '\n'
+                tables += '    const struct loader_dispatch_table_entry *entry =\n'
+                tables += '        &instance_dispatch_table_entries[loader_command_name_slot(instance_dispatch_table_seeds, %d, name)];\n' % len(slots)
+                tables += '    if (NULL == entry->name || strcmp(entry->name, name) != 0) {\n'
+                tables += '        *found_name = false;\n'
+                tables += '        return NULL;\n'
+                tables += '    }\n'
+                tables += '\n'
+                tables += '    *found_name = true;\n'
+                tables += '    return (void *)*(const PFN_vkVoidFunction *)((const char *)table + entry->offset);\n'
+                tables += '}\n\n'
         return tables
 
+    #
+    # Helpers shared by every lookup through a command name perfect hash, see BuildCommandNameHash
+    def OutputCommandNameHashUtilities(self):
+        funcs = ''
+        funcs += '// Hashes used to look up commands by name, see BuildCommandNameHash in loader_extension_generator.py\n'
+        funcs += 'static uint32_t loader_command_name_hash(const char *name) {\n'
+        funcs += '    uint32_t hash = 2166136261u;\n'
+        funcs += '    for (; *name != \'\\0\'; name++) {\n'
+        funcs += '        hash ^= (uint8_t)*name;\n'
+        funcs += '        hash *= 16777619u;\n'
+        funcs += '    }\n'
+        funcs += '    return hash;\n'
+        funcs += '}\n'
+        funcs += '\n'
+        funcs += 'static uint32_t loader_command_name_mix(uint32_t hash, uint32_t seed) {\n'
+        funcs += '    hash ^= seed;\n'
+        funcs += '    hash ^= hash >> 16;\n'
+        funcs += '    hash *= 0x85ebca6bu;\n'
+        funcs += '    hash ^= hash >> 13;\n'
+        funcs += '    hash *= 0xc2b2ae35u;\n'
+        funcs += '    hash ^= hash >> 16;\n'
+        funcs += '    return hash;\n'
+        funcs += '}\n'
+        funcs += '\n'
+        funcs += '// Returns the only slot of a perfect hash table which could hold name\n'
+        funcs += 'static uint32_t loader_command_name_slot(const int32_t *seeds, uint32_t size, const char *name) {\n'
+        funcs += '    uint32_t hash = loader_command_name_hash(name);\n'
+        funcs += '    int32_t seed = seeds[loader_command_name_mix(hash, 0) % size];\n'
+        funcs += '    if (seed < 0) return (uint32_t)(-seed - 1);\n'
+        funcs += '    return loader_command_name_mix(hash, (uint32_t)seed) % size;\n'
+        funcs += '}\n'
+        funcs += '\n'
+        return funcs
+
+    #
+    # Write out the seeds of a perfect hash table built by BuildCommandNameHash
+    def OutputCommandNameHashSeeds(self, table_name, seeds):
+        table = 'static const int32_t %s[%d] = {\n' % (table_name, len(seeds))
+        for i in range(0, len(seeds), 12):
+            table += '    %s,\n' % ', '.join(str(seed) for seed in seeds[i:i + 12])
+        table += '};\n'
+        return table
+
+    #
+    # Create perfect hash tables of the exported core command trampolines, which vkGetInstanceProcAddr looks up by name
+    def OutputCoreTrampolineLookupFuncs(self):
+        funcs = ''
+        funcs += 'struct loader_trampoline_entry {\n'
+        funcs += '    const char *name;\n'
+        funcs += '    PFN_vkVoidFunction addr;\n'
+        funcs += '};\n'
+        funcs += '\n'
+
+        for x in range(0, 2):
+            if x == 0:
+                cur_type = 'core'
+                names = [cmd.name for cmd in self.core_commands if cmd.name not in ADD_INST_CMDS]
+            else:
+                cur_type = 'global'
+                names = [cmd.name for cmd in self.core_commands if cmd.name in ADD_INST_CMDS]
+
+            seeds, slots = BuildCommandNameHash(names)
+
+            funcs += self.OutputCommandNameHashSeeds('%s_trampoline_seeds' % cur_type, seeds)
+            funcs += '\n'
+            funcs += 'static const struct loader_trampoline_entry %s_trampolines[%d] = {\n' % (cur_type, len(slots))
+            for name in slots:
+                funcs += '    {"%s", (PFN_vkVoidFunction)%s},\n' % (name, name)
+            funcs += '};\n'
+            funcs += '\n'
+            funcs += 'void *loader_lookup_%s_trampoline(const char *name) {\n' % cur_type
+            funcs += '    const struct loader_trampoline_entry *entry =\n'
+            funcs += '        &%s_trampolines[loader_command_name_slot(%s_trampoline_seeds, %d, name)];\n' % (cur_type, cur_type, len(slots))
+            funcs += '    return strcmp(entry->name, name) == 0 ? (void *)entry->addr : NULL;\n'
+            funcs += '}\n'
+            funcs += '\n'
+        return funcs
+
     #
     # Create the appropriate trampoline (and possibly terminator) functinos
     def CreateTrampTermFuncs(self):
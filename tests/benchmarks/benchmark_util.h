@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and/or associated documentation files (the "Materials"), to
+ * deal in the Materials without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Materials, and to permit persons to whom the Materials are
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be included in
+ * all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE MATERIALS OR THE
+ * USE OR OTHER DEALINGS IN THE MATERIALS.
+ */
+
+/*
+ * Timing and JSON output shared by the loader benchmarks.
+ *
+ * Each benchmark collects a flat list of results, where every result is a set of named parameters describing what was
+ * measured followed by a summary of the timings. Keeping the list flat means the output loads straight into a table, where
+ * plotting any timing against any parameter gives the scaling curve for it.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+inline uint64_t benchmark_now_ns() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Timings are per operation, so a sample which timed a batch of operations is divided by the size of the batch
+struct BenchmarkSummary {
+    uint64_t samples = 0;
+    double min_ns = 0;
+    double median_ns = 0;
+    double mean_ns = 0;
+    double max_ns = 0;
+};
+
+inline BenchmarkSummary summarize(std::vector<uint64_t> durations_ns, uint64_t operations_per_sample = 1) {
+    BenchmarkSummary summary{};
+    if (durations_ns.empty() || operations_per_sample == 0) return summary;
+    std::sort(durations_ns.begin(), durations_ns.end());
+    uint64_t total = 0;
+    for (auto duration : durations_ns) total += duration;
+    double operations = static_cast<double>(operations_per_sample);
+    summary.samples = durations_ns.size();
+    summary.min_ns = durations_ns.front() / operations;
+    summary.median_ns = durations_ns[durations_ns.size() / 2] / operations;
+    summary.mean_ns = total / static_cast<double>(durations_ns.size()) / operations;
+    summary.max_ns = durations_ns.back() / operations;
+    return summary;
+}
+
+struct BenchmarkParameter {
+    std::string name;
+    std::string value;  // Already formatted as JSON
+};
+
+inline BenchmarkParameter benchmark_parameter(std::string const& name, uint64_t value) { return {name, std::to_string(value)}; }
+
+inline BenchmarkParameter benchmark_parameter(std::string const& name, std::string const& value) {
+    std::string quoted = "\"";
+    for (char c : value) {
+        if (c == '"' || c == '\\') quoted += '\\';
+        quoted += c;
+    }
+    return {name, quoted + "\""};
+}
+
+struct BenchmarkResult {
+    std::vector<BenchmarkParameter> parameters;
+    BenchmarkSummary summary;
+};
+
+struct BenchmarkOptions {
+    uint32_t iterations = 0;
+    std::string output_path;  // Empty for stdout
+};
+
+// Understands --iterations <count> and --output <file>. Returns false and prints usage if anything else is given.
+inline bool parse_benchmark_options(int argc, char** argv, uint32_t default_iterations, BenchmarkOptions& options) {
+    options.iterations = default_iterations;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            options.iterations = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            options.output_path = argv[++i];
+        } else {
+            fprintf(stderr, "Usage: %s [--iterations <count>] [--output <file>]\n", argv[0]);
+            return false;
+        }
+    }
+    if (options.iterations == 0) options.iterations = 1;
+    return true;
+}
+
+// Writes {"benchmark": name, "iterations": N, "results": [...]}, with each result's parameters followed by its summary
+inline bool write_benchmark_results(BenchmarkOptions const& options, std::string const& benchmark_name,
+                                    std::vector<BenchmarkResult> const& results) {
+    FILE* file = stdout;
+    if (!options.output_path.empty()) {
+        file = fopen(options.output_path.c_str(), "w");
+        if (file == nullptr) {
+            fprintf(stderr, "Unable to open %s\n", options.output_path.c_str());
+            return false;
+        }
+    }
+    fprintf(file, "{\n\"benchmark\": \"%s\",\n\"iterations\": %u,\n\"results\": [\n", benchmark_name.c_str(), options.iterations);
+    for (size_t i = 0; i < results.size(); i++) {
+        fputs("{", file);
+        for (auto const& parameter : results[i].parameters) {
+            fprintf(file, "\"%s\": %s, ", parameter.name.c_str(), parameter.value.c_str());
+        }
+        auto const& summary = results[i].summary;
+        fprintf(file, "\"samples\": %llu, \"min_ns\": %.2f, \"median_ns\": %.2f, \"mean_ns\": %.2f, \"max_ns\": %.2f}%s\n",
+                static_cast<unsigned long long>(summary.samples), summary.min_ns, summary.median_ns, summary.mean_ns,
+                summary.max_ns, i + 1 < results.size() ? "," : "");
+    }
+    fputs("]\n}\n", file);
+    if (file != stdout) fclose(file);
+    return true;
+}
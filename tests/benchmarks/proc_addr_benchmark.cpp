@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and/or associated documentation files (the "Materials"), to
+ * deal in the Materials without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Materials, and to permit persons to whom the Materials are
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be included in
+ * all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE MATERIALS OR THE
+ * USE OR OTHER DEALINGS IN THE MATERIALS.
+ */
+
+#include "test_environment.h"
+
+#include "loader/generated/vk_dispatch_table_helper.h"
+
+#include "benchmark_util.h"
+
+/*
+ * Times vkGetInstanceProcAddr and vkGetDeviceProcAddr for every function in the generated dispatch tables, with zero, one,
+ * and five explicit layers enabled. The names are grouped into categories:
+ *  - global: looked up with a NULL instance
+ *  - instance: looked up with vkGetInstanceProcAddr
+ *  - device: looked up with both vkGetInstanceProcAddr and vkGetDeviceProcAddr
+ *  - unknown_physical_device and unknown_device: vendor functions the loader doesn't know but the driver does, which go through
+ *    the loader's unknown function trampolines
+ *  - missing: functions nobody knows, which are looked up with both
+ * Each sample times a batch of lookups of one name, and the results are reported per lookup, both for each name and for each
+ * category as a whole (with "name" set to "*"). A round of untimed lookups comes first, so that unknown functions already have
+ * their slots in the dispatch tables. "resolved" tells whether the lookup returned a function.
+ *
+ * A second sweep, in the "instance_lookup" category, times how long vkGetInstanceProcAddr takes to find the loader's instance
+ * as the number of live instances grows. The instance looked up is the one created first, and the function looked up is a
+ * global one, so that finding the instance is all the lookup does. Every result has "live_instances" set, which is 1 for the
+ * first sweep.
+ */
+
+static const uint32_t lookups_per_sample = 100;
+static const uint32_t vendor_function_count = 8;
+static const uint32_t live_instance_counts[] = {1, 16, 64, 256};
+
+static std::vector<std::string>* recorded_names = nullptr;
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL record_instance_function_name(VkInstance, const char* name) {
+    recorded_names->push_back(name);
+    return nullptr;
+}
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL record_device_function_name(VkDevice, const char* name) {
+    recorded_names->push_back(name);
+    return nullptr;
+}
+
+// Never called, the driver just needs something to return for the vendor functions
+static VKAPI_ATTR void VKAPI_CALL vendor_function() {}
+
+struct Lookup {
+    std::string entry_point;
+    std::string category;
+    std::string name;
+};
+
+static std::vector<Lookup> gather_lookups() {
+    std::vector<Lookup> lookups;
+    for (const char* name : {"vkGetInstanceProcAddr", "vkCreateInstance", "vkEnumerateInstanceExtensionProperties",
+                             "vkEnumerateInstanceLayerProperties", "vkEnumerateInstanceVersion"}) {
+        lookups.push_back({"vkGetInstanceProcAddr", "global", name});
+    }
+
+    std::vector<std::string> instance_names;
+    recorded_names = &instance_names;
+    VkLayerInstanceDispatchTable instance_table;
+    layer_init_instance_dispatch_table(VK_NULL_HANDLE, &instance_table, record_instance_function_name);
+    for (auto const& name : instance_names) lookups.push_back({"vkGetInstanceProcAddr", "instance", name});
+
+    // The device table is given the vkGetDeviceProcAddr it was initialized with rather than looking it up
+    std::vector<std::string> device_names{"vkGetDeviceProcAddr"};
+    recorded_names = &device_names;
+    VkLayerDispatchTable device_table;
+    layer_init_device_dispatch_table(VK_NULL_HANDLE, &device_table, record_device_function_name);
+    recorded_names = nullptr;
+    for (auto const& name : device_names) lookups.push_back({"vkGetInstanceProcAddr", "device", name});
+    for (auto const& name : device_names) lookups.push_back({"vkGetDeviceProcAddr", "device", name});
+
+    for (uint32_t i = 0; i < vendor_function_count; i++) {
+        std::string physical_device_name = "vkGetPhysicalDeviceBenchmark" + std::to_string(i) + "VENDOR";
+        std::string device_name = "vkCmdBenchmark" + std::to_string(i) + "VENDOR";
+        std::string missing_name = "vkBenchmarkMissing" + std::to_string(i) + "VENDOR";
+#if !defined(__APPLE__)
+        // macOS doesn't fully support unknown functions from vkGetInstanceProcAddr yet
+        lookups.push_back({"vkGetInstanceProcAddr", "unknown_physical_device", physical_device_name});
+        lookups.push_back({"vkGetInstanceProcAddr", "unknown_device", device_name});
+#endif
+        lookups.push_back({"vkGetDeviceProcAddr", "unknown_device", device_name});
+        lookups.push_back({"vkGetInstanceProcAddr", "missing", missing_name});
+        lookups.push_back({"vkGetDeviceProcAddr", "missing", missing_name});
+    }
+    return lookups;
+}
+
+static bool run_configuration(uint32_t layer_count, std::vector<Lookup> const& lookups, uint32_t iterations,
+                              std::vector<BenchmarkResult>& results) {
+    FrameworkEnvironment env{FrameworkSettings{}.set_log_filter(nullptr)};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
+    auto& driver = env.get_test_icd();
+    driver.physical_devices.emplace_back("physical_device_0");
+    driver.physical_devices.back().queue_family_properties.push_back(
+        MockQueueFamilyProperties{{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, true});
+    for (uint32_t i = 0; i < vendor_function_count; i++) {
+        driver.custom_physical_device_functions.push_back(VulkanFunction{
+            "vkGetPhysicalDeviceBenchmark" + std::to_string(i) + "VENDOR", reinterpret_cast<void*>(vendor_function)});
+        driver.physical_devices.back().known_device_functions.push_back(
+            VulkanFunction{"vkCmdBenchmark" + std::to_string(i) + "VENDOR", reinterpret_cast<void*>(vendor_function)});
+    }
+
+    std::vector<std::string> layer_names;
+    for (uint32_t i = 0; i < layer_count; i++) {
+        layer_names.push_back("VK_LAYER_benchmark_" + std::to_string(i));
+        env.add_explicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                             .set_name(layer_names.back())
+                                                             .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+                               layer_names.back() + ".json");
+    }
+    InstWrapper inst{env.vulkan_functions};
+    for (auto const& name : layer_names) inst.create_info.add_layer(name.c_str());
+    if (VK_SUCCESS != env.vulkan_functions.vkCreateInstance(inst.create_info.get(), nullptr, &inst.inst)) return false;
+
+    uint32_t phys_dev_count = 1;
+    VkPhysicalDevice phys_dev = VK_NULL_HANDLE;
+    if (VK_SUCCESS != env.vulkan_functions.vkEnumeratePhysicalDevices(inst, &phys_dev_count, &phys_dev)) return false;
+    DeviceWrapper dev{inst};
+    dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(0.0f));
+    if (VK_SUCCESS != env.vulkan_functions.vkCreateDevice(phys_dev, dev.create_info.get(), nullptr, &dev.dev)) return false;
+
+    auto gipa = env.vulkan_functions.vkGetInstanceProcAddr;
+    auto gdpa = env.vulkan_functions.vkGetDeviceProcAddr;
+    std::vector<bool> resolved(lookups.size());
+    std::vector<std::vector<uint64_t>> durations_ns(lookups.size());
+    for (uint32_t round = 0; round <= iterations; round++) {
+        for (size_t i = 0; i < lookups.size(); i++) {
+            Lookup const& lookup = lookups[i];
+            const char* name = lookup.name.c_str();
+            PFN_vkVoidFunction function = nullptr;
+            uint64_t start = benchmark_now_ns();
+            if (lookup.entry_point == "vkGetDeviceProcAddr") {
+                for (uint32_t j = 0; j < lookups_per_sample; j++) function = gdpa(dev, name);
+            } else if (lookup.category == "global") {
+                for (uint32_t j = 0; j < lookups_per_sample; j++) function = gipa(VK_NULL_HANDLE, name);
+            } else {
+                for (uint32_t j = 0; j < lookups_per_sample; j++) function = gipa(inst, name);
+            }
+            uint64_t duration = benchmark_now_ns() - start;
+            if (round == 0) {
+                resolved[i] = function != nullptr;
+            } else {
+                durations_ns[i].push_back(duration);
+            }
+        }
+    }
+
+    auto add_result = [&](Lookup const& lookup, bool lookup_resolved, std::vector<uint64_t> const& samples,
+                          uint64_t lookups_in_sample) {
+        results.push_back(BenchmarkResult{
+            {benchmark_parameter("live_instances", 1), benchmark_parameter("layers", layer_count),
+             benchmark_parameter("entry_point", lookup.entry_point),
+             benchmark_parameter("category", lookup.category), benchmark_parameter("name", lookup.name),
+             benchmark_parameter("resolved", static_cast<uint64_t>(lookup_resolved))},
+            summarize(samples, lookups_in_sample)});
+    };
+    for (size_t i = 0; i < lookups.size(); i++) add_result(lookups[i], resolved[i], durations_ns[i], lookups_per_sample);
+
+    // Each category as a whole, where a sample is the time taken to look up every name in the category once per batch
+    for (size_t first = 0; first < lookups.size();) {
+        size_t end = first;
+        bool all_resolved = true;
+        std::vector<uint64_t> category_ns(iterations, 0);
+        while (end < lookups.size() && lookups[end].entry_point == lookups[first].entry_point &&
+               lookups[end].category == lookups[first].category) {
+            all_resolved = all_resolved && resolved[end];
+            for (uint32_t round = 0; round < iterations; round++) category_ns[round] += durations_ns[end][round];
+            end++;
+        }
+        add_result(Lookup{lookups[first].entry_point, lookups[first].category, "*"}, all_resolved, category_ns,
+                   lookups_per_sample * (end - first));
+        first = end;
+    }
+    return true;
+}
+
+static bool run_live_instance_configuration(uint32_t live_instances, uint32_t iterations, std::vector<BenchmarkResult>& results) {
+    FrameworkEnvironment env{FrameworkSettings{}.set_log_filter(nullptr)};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.emplace_back("physical_device_0");
+
+    auto& vk = env.vulkan_functions;
+    InstanceCreateInfo inst_create_info{};
+    VkInstanceCreateInfo* inst_info = inst_create_info.get();
+    std::vector<VkInstance> instances;
+    bool created = true;
+    for (uint32_t i = 0; i < live_instances && created; i++) {
+        VkInstance inst = VK_NULL_HANDLE;
+        created = VK_SUCCESS == vk.vkCreateInstance(inst_info, nullptr, &inst);
+        if (created) instances.push_back(inst);
+    }
+
+    if (created) {
+        // Created first, so that it is the one furthest away if the loader ever has to search through its instances
+        VkInstance probe = instances.front();
+        const char* name = "vkEnumerateInstanceVersion";
+        PFN_vkVoidFunction function = nullptr;
+        std::vector<uint64_t> durations_ns;
+        for (uint32_t round = 0; round <= iterations; round++) {
+            uint64_t start = benchmark_now_ns();
+            for (uint32_t j = 0; j < lookups_per_sample; j++) function = vk.vkGetInstanceProcAddr(probe, name);
+            uint64_t duration = benchmark_now_ns() - start;
+            if (round > 0) durations_ns.push_back(duration);
+        }
+        results.push_back(BenchmarkResult{
+            {benchmark_parameter("live_instances", live_instances), benchmark_parameter("layers", 0),
+             benchmark_parameter("entry_point", "vkGetInstanceProcAddr"), benchmark_parameter("category", "instance_lookup"),
+             benchmark_parameter("name", name), benchmark_parameter("resolved", static_cast<uint64_t>(function != nullptr))},
+            summarize(durations_ns, lookups_per_sample)});
+    }
+
+    for (VkInstance inst : instances) vk.vkDestroyInstance(inst, nullptr);
+    return created;
+}
+
+int main(int argc, char** argv) {
+    BenchmarkOptions options;
+    if (!parse_benchmark_options(argc, argv, 50, options)) return 1;
+
+    std::vector<Lookup> lookups = gather_lookups();
+    // Keep each entry point and category together so that they can be summed up as a whole
+    std::stable_sort(lookups.begin(), lookups.end(), [](Lookup const& a, Lookup const& b) {
+        return a.entry_point != b.entry_point ? a.entry_point < b.entry_point : a.category < b.category;
+    });
+
+    std::vector<BenchmarkResult> results;
+    bool all_succeeded = true;
+    for (uint32_t layer_count : {0, 1, 5}) {
+        if (!run_configuration(layer_count, lookups, options.iterations, results)) {
+            fprintf(stderr, "Failed to create an instance and device with %u layers\n", layer_count);
+            all_succeeded = false;
+        }
+    }
+    for (uint32_t live_instances : live_instance_counts) {
+        if (!run_live_instance_configuration(live_instances, options.iterations, results)) {
+            fprintf(stderr, "Failed to create %u instances\n", live_instances);
+            all_succeeded = false;
+        }
+    }
+    if (!write_benchmark_results(options, "proc_addr", results)) return 1;
+    return all_succeeded ? 0 : 1;
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and/or associated documentation files (the "Materials"), to
+ * deal in the Materials without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Materials, and to permit persons to whom the Materials are
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be included in
+ * all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE MATERIALS OR THE
+ * USE OR OTHER DEALINGS IN THE MATERIALS.
+ */
+
+#include "test_environment.h"
+
+#include "benchmark_util.h"
+
+/*
+ * Times vkEnumerateInstanceExtensionProperties, vkCreateInstance, vkCreateDevice, and vkDestroyInstance against the test
+ * drivers and layers, while sweeping one of:
+ *  - icd_count: how many drivers there are, each with one physical device
+ *  - implicit_layers: how many implicit layers are enabled
+ *  - explicit_layers: how many explicit layers the application enables
+ *  - manifests_per_directory: how many extra layer manifests sit in each of the implicit and explicit layer folders. These
+ *    describe layers which are never enabled, so they only cost the loader the time to find and parse them.
+ * The parameters that aren't being swept are left at one driver and nothing else. Every configuration gets a fresh
+ * FrameworkEnvironment, and so a freshly loaded loader, and runs one untimed iteration first so that the timings are of the
+ * steady state rather than of the first call.
+ *
+ * Loader debug output is turned off, since writing it would otherwise dominate the timings.
+ */
+
+struct StartupConfiguration {
+    const char* sweep;
+    uint32_t icd_count;
+    uint32_t implicit_layers;
+    uint32_t explicit_layers;
+    uint32_t manifests_per_directory;
+};
+
+static void add_inert_layer_manifests(FrameworkEnvironment& env, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        std::string implicit_name = "VK_LAYER_benchmark_inert_implicit_" + std::to_string(i);
+        auto implicit_manifest = ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                                .set_name(implicit_name)
+                                                                .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                                                                .set_disable_environment("DISABLE_" + implicit_name)
+                                                                .set_enable_environment("ENABLE_" + implicit_name));
+        auto implicit_path = env.get_folder(ManifestLocation::implicit_layer)
+                                 .write_manifest(implicit_name + ".json", implicit_manifest.get_manifest_str());
+        env.platform_shim->add_manifest(ManifestCategory::implicit_layer, implicit_path);
+
+        std::string explicit_name = "VK_LAYER_benchmark_inert_explicit_" + std::to_string(i);
+        auto explicit_manifest = ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(explicit_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2));
+        auto explicit_path = env.get_folder(ManifestLocation::explicit_layer)
+                                 .write_manifest(explicit_name + ".json", explicit_manifest.get_manifest_str());
+        env.platform_shim->add_manifest(ManifestCategory::explicit_layer, explicit_path);
+    }
+}
+
+// Returns false if any call failed, in which case nothing is recorded for the configuration
+static bool run_configuration(StartupConfiguration const& config, uint32_t iterations, std::vector<BenchmarkResult>& results) {
+    FrameworkEnvironment env{FrameworkSettings{}.set_log_filter(nullptr)};
+    MockQueueFamilyProperties family_props{{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, true};
+    for (uint32_t i = 0; i < config.icd_count; i++) {
+        env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+        env.get_test_icd(i).physical_devices.emplace_back("physical_device_" + std::to_string(i));
+        env.get_test_icd(i).physical_devices.back().queue_family_properties.push_back(family_props);
+    }
+    for (uint32_t i = 0; i < config.implicit_layers; i++) {
+        std::string name = "VK_LAYER_benchmark_implicit_" + std::to_string(i);
+        env.add_implicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                             .set_name(name)
+                                                             .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                                                             .set_disable_environment("DISABLE_" + name)),
+                               name + ".json");
+    }
+    std::vector<std::string> explicit_layer_names;
+    for (uint32_t i = 0; i < config.explicit_layers; i++) {
+        explicit_layer_names.push_back("VK_LAYER_benchmark_explicit_" + std::to_string(i));
+        env.add_explicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                             .set_name(explicit_layer_names.back())
+                                                             .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+                               explicit_layer_names.back() + ".json");
+    }
+    add_inert_layer_manifests(env, config.manifests_per_directory);
+
+    InstanceCreateInfo inst_create_info{};
+    for (auto const& name : explicit_layer_names) inst_create_info.add_layer(name.c_str());
+    DeviceCreateInfo dev_create_info{};
+    dev_create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(0.0f));
+    // get() appends the queue infos every time it is called, so only call it once
+    VkInstanceCreateInfo* inst_info = inst_create_info.get();
+    VkDeviceCreateInfo* dev_info = dev_create_info.get();
+
+    auto& vk = env.vulkan_functions;
+    std::vector<uint64_t> enumerate_ns, create_instance_ns, create_device_ns, destroy_instance_ns;
+    for (uint32_t i = 0; i <= iterations; i++) {
+        bool warm_up = i == 0;
+
+        uint64_t start = benchmark_now_ns();
+        uint32_t ext_count = 0;
+        if (VK_SUCCESS != vk.vkEnumerateInstanceExtensionProperties(nullptr, &ext_count, nullptr)) return false;
+        std::vector<VkExtensionProperties> extensions(ext_count);
+        if (VK_SUCCESS != vk.vkEnumerateInstanceExtensionProperties(nullptr, &ext_count, extensions.data())) return false;
+        if (!warm_up) enumerate_ns.push_back(benchmark_now_ns() - start);
+
+        VkInstance inst = VK_NULL_HANDLE;
+        start = benchmark_now_ns();
+        VkResult res = vk.vkCreateInstance(inst_info, nullptr, &inst);
+        if (!warm_up) create_instance_ns.push_back(benchmark_now_ns() - start);
+        if (VK_SUCCESS != res) return false;
+
+        uint32_t phys_dev_count = 1;
+        VkPhysicalDevice phys_dev = VK_NULL_HANDLE;
+        res = vk.vkEnumeratePhysicalDevices(inst, &phys_dev_count, &phys_dev);
+        if (VK_SUCCESS == res || VK_INCOMPLETE == res) {
+            VkDevice dev = VK_NULL_HANDLE;
+            start = benchmark_now_ns();
+            res = vk.vkCreateDevice(phys_dev, dev_info, nullptr, &dev);
+            if (!warm_up) create_device_ns.push_back(benchmark_now_ns() - start);
+            if (VK_SUCCESS == res) DeviceFunctions{vk, dev}.vkDestroyDevice(dev, nullptr);
+        }
+
+        start = benchmark_now_ns();
+        vk.vkDestroyInstance(inst, nullptr);
+        if (!warm_up) destroy_instance_ns.push_back(benchmark_now_ns() - start);
+        if (VK_SUCCESS != res) return false;
+    }
+
+    auto add_result = [&](const char* operation, std::vector<uint64_t> const& durations_ns) {
+        results.push_back(BenchmarkResult{{benchmark_parameter("sweep", config.sweep), benchmark_parameter("operation", operation),
+                                           benchmark_parameter("icd_count", config.icd_count),
+                                           benchmark_parameter("implicit_layers", config.implicit_layers),
+                                           benchmark_parameter("explicit_layers", config.explicit_layers),
+                                           benchmark_parameter("manifests_per_directory", config.manifests_per_directory)},
+                                          summarize(durations_ns)});
+    };
+    add_result("vkEnumerateInstanceExtensionProperties", enumerate_ns);
+    add_result("vkCreateInstance", create_instance_ns);
+    add_result("vkCreateDevice", create_device_ns);
+    add_result("vkDestroyInstance", destroy_instance_ns);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    BenchmarkOptions options;
+    if (!parse_benchmark_options(argc, argv, 20, options)) return 1;
+
+    std::vector<StartupConfiguration> configs;
+    for (uint32_t count : {1, 2, 4, 8, 16}) configs.push_back({"icd_count", count, 0, 0, 0});
+    for (uint32_t count : {0, 1, 2, 4, 8, 16, 32, 64}) configs.push_back({"implicit_layers", 1, count, 0, 0});
+    for (uint32_t count : {0, 1, 2, 4, 8, 16, 32, 64}) configs.push_back({"explicit_layers", 1, 0, count, 0});
+    for (uint32_t count : {0, 16, 64, 256}) configs.push_back({"manifests_per_directory", 1, 0, 0, count});
+
+    std::vector<BenchmarkResult> results;
+    bool all_succeeded = true;
+    for (auto const& config : configs) {
+        if (!run_configuration(config, options.iterations, results)) {
+            fprintf(stderr, "Failed to run %s with %u drivers, %u implicit layers, %u explicit layers, %u manifests per folder\n",
+                    config.sweep, config.icd_count, config.implicit_layers, config.explicit_layers, config.manifests_per_directory);
+            all_succeeded = false;
+        }
+    }
+    if (!write_benchmark_results(options, "startup_latency", results)) return 1;
+    return all_succeeded ? 0 : 1;
+}
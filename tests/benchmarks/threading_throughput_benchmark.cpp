@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and/or associated documentation files (the "Materials"), to
+ * deal in the Materials without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Materials, and to permit persons to whom the Materials are
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be included in
+ * all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE MATERIALS OR THE
+ * USE OR OTHER DEALINGS IN THE MATERIALS.
+ */
+
+#include "test_environment.h"
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+#include "benchmark_util.h"
+
+/*
+ * Measures how many calls per second the loader handles when several threads call into it at once, each on its own instance,
+ * for each of:
+ *  - vkEnumeratePhysicalDevices
+ *  - vkEnumerateDeviceExtensionProperties
+ *  - vkCreateDevice+vkDestroyDevice, where creating and destroying one device counts as one call
+ * while sweeping the number of threads. Every thread makes the same number of calls, and all of them are let go at once.
+ * "calls_per_second" is the number of calls made by all of the threads together divided by the time from letting them go until
+ * the last one finished. If calls on different instances don't wait on each other, it grows with the number of threads, up to
+ * the number of cores. The summary is of the time each call took on its own thread.
+ *
+ * Every thread count gets a fresh FrameworkEnvironment, and each thread runs one untimed batch first.
+ */
+
+static const uint32_t calls_per_sample = 20;
+
+enum class Operation { enumerate_physical_devices, enumerate_device_extensions, create_destroy_device };
+
+static const char* operation_name(Operation operation) {
+    switch (operation) {
+        case Operation::enumerate_physical_devices:
+            return "vkEnumeratePhysicalDevices";
+        case Operation::enumerate_device_extensions:
+            return "vkEnumerateDeviceExtensionProperties";
+        case Operation::create_destroy_device:
+            return "vkCreateDevice+vkDestroyDevice";
+    }
+    return "";
+}
+
+struct ThreadState {
+    VkInstance inst = VK_NULL_HANDLE;
+    VkPhysicalDevice phys_dev = VK_NULL_HANDLE;
+    DeviceCreateInfo dev_create_info;
+    VkDeviceCreateInfo* dev_info = nullptr;
+    std::vector<uint64_t> durations_ns;
+    bool failed = false;
+};
+
+static bool make_calls(VulkanFunctions& vk, Operation operation, ThreadState& state) {
+    for (uint32_t i = 0; i < calls_per_sample; i++) {
+        if (operation == Operation::enumerate_physical_devices) {
+            uint32_t count = 1;
+            VkPhysicalDevice phys_dev = VK_NULL_HANDLE;
+            VkResult res = vk.vkEnumeratePhysicalDevices(state.inst, &count, &phys_dev);
+            if (VK_SUCCESS != res && VK_INCOMPLETE != res) return false;
+        } else if (operation == Operation::enumerate_device_extensions) {
+            uint32_t count = 0;
+            if (VK_SUCCESS != vk.vkEnumerateDeviceExtensionProperties(state.phys_dev, nullptr, &count, nullptr)) return false;
+        } else {
+            VkDevice dev = VK_NULL_HANDLE;
+            if (VK_SUCCESS != vk.vkCreateDevice(state.phys_dev, state.dev_info, nullptr, &dev)) return false;
+            vk.vkDestroyDevice(dev, nullptr);
+        }
+    }
+    return true;
+}
+
+// Returns false if any call failed, in which case nothing is recorded for the thread count
+static bool run_configuration(uint32_t thread_count, uint32_t iterations, std::vector<BenchmarkResult>& results) {
+    FrameworkEnvironment env{FrameworkSettings{}.set_log_filter(nullptr)};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.emplace_back("physical_device_0");
+    env.get_test_icd().physical_devices.back().queue_family_properties.push_back(
+        MockQueueFamilyProperties{{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, true});
+
+    auto& vk = env.vulkan_functions;
+    InstanceCreateInfo inst_create_info{};
+    VkInstanceCreateInfo* inst_info = inst_create_info.get();
+    std::vector<ThreadState> states(thread_count);
+    bool succeeded = true;
+    for (auto& state : states) {
+        uint32_t phys_dev_count = 1;
+        if (VK_SUCCESS != vk.vkCreateInstance(inst_info, nullptr, &state.inst) ||
+            VK_SUCCESS != vk.vkEnumeratePhysicalDevices(state.inst, &phys_dev_count, &state.phys_dev)) {
+            succeeded = false;
+            break;
+        }
+        state.dev_create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(0.0f));
+        // get() appends the queue infos every time it is called, so only call it once
+        state.dev_info = state.dev_create_info.get();
+    }
+
+    for (Operation operation :
+         {Operation::enumerate_physical_devices, Operation::enumerate_device_extensions, Operation::create_destroy_device}) {
+        if (!succeeded) break;
+        std::promise<void> start_promise;
+        std::shared_future<void> start = start_promise.get_future().share();
+        std::vector<std::thread> threads;
+        for (auto& state : states) {
+            state.durations_ns.clear();
+            threads.emplace_back([&, start]() {
+                state.failed = !make_calls(vk, operation, state);
+                start.wait();
+                for (uint32_t i = 0; i < iterations && !state.failed; i++) {
+                    uint64_t sample_start = benchmark_now_ns();
+                    state.failed = !make_calls(vk, operation, state);
+                    state.durations_ns.push_back(benchmark_now_ns() - sample_start);
+                }
+            });
+        }
+        uint64_t wall_start = benchmark_now_ns();
+        start_promise.set_value();
+        for (auto& thread : threads) thread.join();
+        uint64_t wall_ns = benchmark_now_ns() - wall_start;
+
+        std::vector<uint64_t> durations_ns;
+        for (auto const& state : states) {
+            succeeded = succeeded && !state.failed;
+            durations_ns.insert(durations_ns.end(), state.durations_ns.begin(), state.durations_ns.end());
+        }
+        if (!succeeded) break;
+
+        uint64_t total_calls = static_cast<uint64_t>(thread_count) * iterations * calls_per_sample;
+        uint64_t calls_per_second = wall_ns == 0 ? 0 : static_cast<uint64_t>(total_calls * 1e9 / static_cast<double>(wall_ns));
+        results.push_back(BenchmarkResult{{benchmark_parameter("threads", thread_count),
+                                           benchmark_parameter("operation", operation_name(operation)),
+                                           benchmark_parameter("calls_per_second", calls_per_second)},
+                                          summarize(durations_ns, calls_per_sample)});
+    }
+
+    for (auto const& state : states) {
+        if (VK_NULL_HANDLE != state.inst) vk.vkDestroyInstance(state.inst, nullptr);
+    }
+    return succeeded;
+}
+
+int main(int argc, char** argv) {
+    BenchmarkOptions options;
+    if (!parse_benchmark_options(argc, argv, 50, options)) return 1;
+
+    std::vector<BenchmarkResult> results;
+    bool all_succeeded = true;
+    for (uint32_t thread_count : {1, 2, 4, 8, 16}) {
+        if (!run_configuration(thread_count, options.iterations, results)) {
+            fprintf(stderr, "Failed to make calls on %u threads\n", thread_count);
+            all_succeeded = false;
+        }
+    }
+    if (!write_benchmark_results(options, "threading_throughput", results)) return 1;
+    return all_succeeded ? 0 : 1;
+}
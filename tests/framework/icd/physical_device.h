@@ -46,6 +46,8 @@ struct PhysicalDevice {
     BUILDER_VALUE(PhysicalDevice, VkExternalSemaphoreProperties, external_semaphore_properties, {})
     BUILDER_VALUE(PhysicalDevice, VkExternalFenceProperties, external_fence_properties, {})
     BUILDER_VALUE(PhysicalDevice, uint32_t, pci_bus, {})
+    // Called at the start of vkCreateDevice, for tests which need to hold a driver call up until they let it go
+    BUILDER_VALUE(PhysicalDevice, std::function<void()>, create_device_callback, {})
 
     BUILDER_VECTOR(PhysicalDevice, MockQueueFamilyProperties, queue_family_properties, queue_family_properties)
     BUILDER_VECTOR(PhysicalDevice, VkFormatProperties, format_properties, format_properties)
@@ -27,6 +27,10 @@
 
 #include "test_icd.h"
 
+#include <chrono>
+#include <mutex>
+#include <thread>
+
 // export vk_icdGetInstanceProcAddr
 #ifndef TEST_ICD_EXPORT_ICD_GIPA
 #define TEST_ICD_EXPORT_ICD_GIPA 0
@@ -48,6 +52,8 @@
 #endif
 
 TestICD icd;
+// Devices can be created and destroyed from several threads at once, which all add to and remove from the same lists
+std::mutex device_handles_mutex;
 extern "C" {
 FRAMEWORK_EXPORT TestICD* get_test_icd_func() { return &icd; }
 FRAMEWORK_EXPORT TestICD* reset_icd_func() {
@@ -361,6 +367,10 @@ VKAPI_ATTR VkResult VKAPI_CALL test_vkCreateDevice(VkPhysicalDevice physicalDevi
         return phys_dev.vk_physical_device.handle == physicalDevice;
     });
     if (found == icd.physical_devices.end()) return VK_ERROR_INITIALIZATION_FAILED;
+    if (found->create_device_callback) {
+        found->create_device_callback();
+    }
+    std::lock_guard<std::mutex> lock(device_handles_mutex);
     auto device_handle = DispatchableHandle<VkDevice>();
     *pDevice = device_handle.handle;
     found->device_handles.push_back(device_handle.handle);
@@ -374,6 +384,7 @@ VKAPI_ATTR VkResult VKAPI_CALL test_vkCreateDevice(VkPhysicalDevice physicalDevi
 }
 
 VKAPI_ATTR void VKAPI_CALL test_vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) {
+    std::lock_guard<std::mutex> lock(device_handles_mutex);
     auto found = std::find(icd.device_handles.begin(), icd.device_handles.end(), device);
     if (found != icd.device_handles.end()) icd.device_handles.erase(found);
 }
@@ -774,6 +785,7 @@ VKAPI_ATTR VkResult VKAPI_CALL test_vkAllocateCommandBuffers(VkDevice device, co
 }
 
 VKAPI_ATTR void VKAPI_CALL test_vkGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {
+    std::lock_guard<std::mutex> lock(device_handles_mutex);
     *pQueue = icd.physical_devices.back().queue_handles[queueIndex].handle;
 }
 
@@ -1282,6 +1294,7 @@ PFN_vkVoidFunction get_instance_func(VkInstance instance, const char* pName) {
 
 PFN_vkVoidFunction get_device_func(VkDevice device, const char* pName) {
     if (device != nullptr) {
+        std::lock_guard<std::mutex> lock(device_handles_mutex);
         if (!std::any_of(icd.physical_devices.begin(), icd.physical_devices.end(), [&](const PhysicalDevice& pd) {
                 return std::any_of(pd.device_handles.begin(), pd.device_handles.end(),
                                    [&](const VkDevice& pd_device) { return pd_device == device; });
@@ -1340,6 +1353,9 @@ PFN_vkVoidFunction base_get_instance_proc_addr(VkInstance instance, const char*
 extern "C" {
 #if TEST_ICD_EXPORT_NEGOTIATE_INTERFACE_VERSION
 extern FRAMEWORK_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vk_icdNegotiateLoaderICDInterfaceVersion(uint32_t* pSupportedVersion) {
+    if (icd.initialization_delay_ms > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(icd.initialization_delay_ms));
+    }
     if (icd.called_vk_icd_gipa == CalledICDGIPA::not_called &&
         icd.called_negotiate_interface == CalledNegotiateInterface::not_called)
         icd.called_negotiate_interface = CalledNegotiateInterface::vk_icd_negotiate;
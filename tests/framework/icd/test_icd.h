@@ -59,6 +59,10 @@ struct TestICD {
     BUILDER_VALUE(TestICD, uint32_t, min_icd_interface_version, 0)
     BUILDER_VALUE(TestICD, uint32_t, max_icd_interface_version, 6)
     uint32_t icd_interface_version_received = 0;
+    // Time vk_icdNegotiateLoaderICDInterfaceVersion spends sleeping, standing in for drivers which do a lot of work when they are
+    // first loaded. Since the test framework already has the library open before the loader gets to it, this is where a
+    // driver's startup cost shows up rather than in a constructor.
+    BUILDER_VALUE(TestICD, uint32_t, initialization_delay_ms, 0)
 
     bool called_enumerate_adapter_physical_devices = false;
 
@@ -27,6 +27,12 @@
 
 #include "shim.h"
 
+#include <fcntl.h>
+#include <stdarg.h>
+#if defined(__linux__)
+#include <sys/inotify.h>
+#endif
+
 static PlatformShim platform_shim;
 extern "C" {
 #if defined(__linux__) || defined(__FreeBSD__)
@@ -48,6 +54,7 @@ FRAMEWORK_EXPORT PlatformShim* get_platform_shim(std::vector<fs::FolderManager>*
 #define CLOSEDIR_FUNC_NAME closedir
 #define ACCESS_FUNC_NAME access
 #define FOPEN_FUNC_NAME fopen
+#define OPEN_FUNC_NAME open
 #define GETEUID_FUNC_NAME geteuid
 #define GETEGID_FUNC_NAME getegid
 #if defined(HAVE_SECURE_GETENV)
@@ -62,6 +69,7 @@ FRAMEWORK_EXPORT PlatformShim* get_platform_shim(std::vector<fs::FolderManager>*
 #define CLOSEDIR_FUNC_NAME my_closedir
 #define ACCESS_FUNC_NAME my_access
 #define FOPEN_FUNC_NAME my_fopen
+#define OPEN_FUNC_NAME my_open
 #define GETEUID_FUNC_NAME my_geteuid
 #define GETEGID_FUNC_NAME my_getegid
 #if defined(HAVE_SECURE_GETENV)
@@ -77,17 +85,22 @@ using PFN_READDIR = struct dirent* (*)(DIR* dir_stream);
 using PFN_CLOSEDIR = int (*)(DIR* dir_stream);
 using PFN_ACCESS = int (*)(const char* pathname, int mode);
 using PFN_FOPEN = FILE* (*)(const char* filename, const char* mode);
+using PFN_OPEN = int (*)(const char* pathname, int flags, ...);
 using PFN_GETEUID = uid_t (*)(void);
 using PFN_GETEGID = gid_t (*)(void);
 #if defined(HAVE_SECURE_GETENV) || defined(HAVE___SECURE_GETENV)
 using PFN_SEC_GETENV = char* (*)(const char* name);
 #endif
+#if defined(__linux__)
+using PFN_INOTIFY_ADD_WATCH = int (*)(int fd, const char* pathname, uint32_t mask);
+#endif
 
 static PFN_OPENDIR real_opendir = nullptr;
 static PFN_READDIR real_readdir = nullptr;
 static PFN_CLOSEDIR real_closedir = nullptr;
 static PFN_ACCESS real_access = nullptr;
 static PFN_FOPEN real_fopen = nullptr;
+static PFN_OPEN real_open = nullptr;
 static PFN_GETEUID real_geteuid = nullptr;
 static PFN_GETEGID real_getegid = nullptr;
 #if defined(HAVE_SECURE_GETENV)
@@ -96,6 +109,9 @@ static PFN_SEC_GETENV real_secure_getenv = nullptr;
 #if defined(HAVE___SECURE_GETENV)
 static PFN_SEC_GETENV real__secure_getenv = nullptr;
 #endif
+#if defined(__linux__)
+static PFN_INOTIFY_ADD_WATCH real_inotify_add_watch = nullptr;
+#endif
 
 FRAMEWORK_EXPORT DIR* OPENDIR_FUNC_NAME(const char* path_name) {
     if (!real_opendir) real_opendir = (PFN_OPENDIR)dlsym(RTLD_NEXT, "opendir");
@@ -198,6 +214,26 @@ FRAMEWORK_EXPORT FILE* FOPEN_FUNC_NAME(const char* in_filename, const char* mode
     return f_ptr;
 }
 
+FRAMEWORK_EXPORT int OPEN_FUNC_NAME(const char* in_pathname, int flags, ...) {
+    if (!real_open) real_open = (PFN_OPEN)dlsym(RTLD_NEXT, "open");
+
+    // The mode is only passed along when a file may be created
+    mode_t mode = 0;
+    if (flags & O_CREAT) {
+        va_list args;
+        va_start(args, flags);
+        mode = static_cast<mode_t>(va_arg(args, int));
+        va_end(args);
+    }
+
+    fs::path path{in_pathname};
+    if (path.has_parent_path() && platform_shim.is_fake_path(path.parent_path())) {
+        auto fake_path = platform_shim.get_fake_path(path.parent_path()) / path.filename();
+        return real_open(fake_path.c_str(), flags, mode);
+    }
+    return real_open(in_pathname, flags, mode);
+}
+
 FRAMEWORK_EXPORT uid_t GETEUID_FUNC_NAME(void) {
     if (!real_geteuid) real_geteuid = (PFN_GETEUID)dlsym(RTLD_NEXT, "geteuid");
 
@@ -243,6 +279,23 @@ FRAMEWORK_EXPORT char* __SECURE_GETENV_FUNC_NAME(const char* name) {
 }
 #endif
 
+#if defined(__linux__)
+// Used by the loader to watch the folders it searches for manifest files
+FRAMEWORK_EXPORT int inotify_add_watch(int fd, const char* in_pathname, uint32_t mask) {
+    if (!real_inotify_add_watch) real_inotify_add_watch = (PFN_INOTIFY_ADD_WATCH)dlsym(RTLD_NEXT, "inotify_add_watch");
+
+    fs::path path{in_pathname};
+    if (platform_shim.is_fake_path(path)) {
+        return real_inotify_add_watch(fd, platform_shim.get_fake_path(path).c_str(), mask);
+    }
+    if (path.has_parent_path() && platform_shim.is_fake_path(path.parent_path())) {
+        auto fake_path = platform_shim.get_fake_path(path.parent_path()) / path.filename();
+        return real_inotify_add_watch(fd, fake_path.c_str(), mask);
+    }
+    return real_inotify_add_watch(fd, in_pathname, mask);
+}
+#endif
+
 /* Shiming functions on apple is limited by the linker prefering to not use functions in the
  * executable in loaded dylibs. By adding an interposer, we redirect the linker to use our
  * version of the function over the real one, thus shimming the system function.
@@ -262,6 +315,7 @@ __attribute__((used)) static Interposer _interpose_opendir MACOS_ATTRIB = {VOIDP
 __attribute__((used)) static Interposer _interpose_closedir MACOS_ATTRIB = {VOIDP_CAST(my_closedir), VOIDP_CAST(closedir)};
 __attribute__((used)) static Interposer _interpose_access MACOS_ATTRIB = {VOIDP_CAST(my_access), VOIDP_CAST(access)};
 __attribute__((used)) static Interposer _interpose_fopen MACOS_ATTRIB = {VOIDP_CAST(my_fopen), VOIDP_CAST(fopen)};
+__attribute__((used)) static Interposer _interpose_open MACOS_ATTRIB = {VOIDP_CAST(my_open), VOIDP_CAST(open)};
 __attribute__((used)) static Interposer _interpose_euid MACOS_ATTRIB = {VOIDP_CAST(my_geteuid), VOIDP_CAST(geteuid)};
 __attribute__((used)) static Interposer _interpose_egid MACOS_ATTRIB = {VOIDP_CAST(my_getegid), VOIDP_CAST(getegid)};
 #if defined(HAVE_SECURE_GETENV)
@@ -261,7 +261,7 @@ void FillDebugUtilsCreateDetails(InstanceCreateInfo& create_info, DebugUtilsWrap
 struct FrameworkEnvironment;  // forward declaration
 
 struct PlatformShimWrapper {
-    PlatformShimWrapper(std::vector<fs::FolderManager>* folders) noexcept;
+    PlatformShimWrapper(std::vector<fs::FolderManager>* folders, const char* log_filter) noexcept;
     ~PlatformShimWrapper() noexcept;
     PlatformShimWrapper(PlatformShimWrapper const&) = delete;
     PlatformShimWrapper& operator=(PlatformShimWrapper const&) = delete;
@@ -343,8 +343,14 @@ enum class ManifestLocation {
     windows_app_package = 8,
 };
 
+struct FrameworkSettings {
+    // Value given to VK_LOADER_DEBUG, or nullptr to leave it unset, such as when timing the loader
+    BUILDER_VALUE(FrameworkSettings, const char*, log_filter, "all");
+};
+
 struct FrameworkEnvironment {
     FrameworkEnvironment() noexcept;
+    FrameworkEnvironment(FrameworkSettings const& settings) noexcept;
 
     void add_icd(TestICDDetails icd_details) noexcept;
     void add_implicit_layer(ManifestLayer layer_manifest, const std::string& json_name) noexcept;
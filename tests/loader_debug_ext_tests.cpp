@@ -633,6 +633,37 @@ TEST_F(SeparateMessenger, ErrorInEnumDevs) {
     ASSERT_EQ(true, message_found);
 }
 
+// Test debug utils created outside of vkCreateInstance and destroyed before the error in vkEnumeratePhysicalDevices.
+// This should not be logged because nothing is listening anymore.
+TEST_F(SeparateMessenger, ErrorInEnumDevsAfterDestroy) {
+    expected_message = "VUID-vkEnumeratePhysicalDevices-pPhysicalDeviceCount-parameter";
+    expected_object_type = VK_OBJECT_TYPE_INSTANCE;
+    expected_message_flags = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    expected_severity_flags = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+
+    VkInstance inst = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS,
+              CreateUtilsInstance(VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT,
+                                  VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT, &inst));
+
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, CreateUtilsMessenger(inst, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT,
+                                               VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT, &messenger));
+
+    ASSERT_EQ(env->vulkan_functions.vkEnumeratePhysicalDevices(inst, nullptr, nullptr), VK_ERROR_INITIALIZATION_FAILED);
+    ASSERT_EQ(true, message_found);
+
+    // Once the messenger is gone the same error must not reach it
+    ASSERT_EQ(VK_SUCCESS, DestroyUtilsMessenger(inst, messenger));
+    message_found = false;
+
+    ASSERT_EQ(env->vulkan_functions.vkEnumeratePhysicalDevices(inst, nullptr, nullptr), VK_ERROR_INITIALIZATION_FAILED);
+
+    env->vulkan_functions.vkDestroyInstance(inst, nullptr);
+
+    ASSERT_EQ(false, message_found);
+}
+
 // Test debug utils created outside of vkCreateInstance with info in vkEnumeratePhysicalDevices.
 // This should not be logged because type is wrong.
 TEST_F(SeparateMessenger, InfoInEnumDevsIgnoredType) {
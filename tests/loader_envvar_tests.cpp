@@ -354,4 +354,197 @@ TEST(EnvVarICDOverrideSetup, TestOnlyAddLayerEnvVar) {
     remove_env_var("VK_ADD_LAYER_PATH");
 }
 
+// Check that VK_LOADER_MANIFEST_CACHE stores decoded manifests and uses them on later scans, and that changing a manifest
+// invalidates its entry.
+TEST(EnvVarICDOverrideSetup, ManifestCache) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    const char* implicit_layer_name = "VK_LAYER_ImplicitTestLayer";
+    env.add_implicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                         .set_name(implicit_layer_name)
+                                                         .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                                                         .set_disable_environment("DISABLE_ME")),
+                           "implicit_test_layer.json");
+    const char* explicit_layer_name = "VK_LAYER_ExplicitTestLayer";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(explicit_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "explicit_test_layer.json");
+
+    fs::FolderManager cache_folder{FRAMEWORK_BUILD_DIRECTORY, "manifest_cache"};
+    set_env_var("XDG_CACHE_HOME", cache_folder.location().str());
+    set_env_var("VK_LOADER_MANIFEST_CACHE", "1");
+
+    // Populates the cache
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.create_info.add_layer(explicit_layer_name);
+        inst.CheckCreate();
+    }
+    std::ifstream cache_file{(cache_folder.location() / "vulkan" / "loader_manifest_cache.bin").str()};
+    ASSERT_TRUE(cache_file.good());
+    env.debug_log.clear();
+
+    // Every manifest now comes out of the cache
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.create_info.add_layer(explicit_layer_name);
+        inst.CheckCreate();
+        ASSERT_TRUE(env.debug_log.find("Using cached contents of ICD manifest file"));
+        ASSERT_TRUE(env.debug_log.find("Using cached contents of layer manifest file"));
+
+        uint32_t layer_count = 0;
+        ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&layer_count, nullptr));
+        ASSERT_EQ(layer_count, 2U);
+        std::array<VkLayerProperties, 2> layers;
+        ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&layer_count, layers.data()));
+        ASSERT_TRUE(string_eq(layers[0].layerName, implicit_layer_name));
+        ASSERT_TRUE(string_eq(layers[1].layerName, explicit_layer_name));
+        ASSERT_TRUE(env.debug_log.find(std::string("Insert instance layer ") + implicit_layer_name));
+        ASSERT_TRUE(env.debug_log.find(std::string("Insert instance layer ") + explicit_layer_name));
+    }
+    env.debug_log.clear();
+
+    // Rewriting a manifest must not use the stale entry, which would still have the old layer name
+    const char* renamed_layer_name = "VK_LAYER_RenamedExplicitTestLayer";
+    env.get_folder(ManifestLocation::explicit_layer).remove("explicit_test_layer.json");
+    env.get_folder(ManifestLocation::explicit_layer)
+        .write_manifest("explicit_test_layer.json",
+                        ManifestLayer{}
+                            .add_layer(ManifestLayer::LayerDescription{}
+                                           .set_name(renamed_layer_name)
+                                           .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2))
+                            .get_manifest_str());
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.create_info.add_layer(renamed_layer_name);
+        inst.CheckCreate();
+        ASSERT_TRUE(env.debug_log.find(std::string("Insert instance layer ") + renamed_layer_name));
+    }
+
+    remove_env_var("VK_LOADER_MANIFEST_CACHE");
+    remove_env_var("XDG_CACHE_HOME");
+}
+
+#if defined(__linux__)
+// Check that VK_LOADER_MANIFEST_WATCH reuses the files found by earlier searches, and that adding or removing a manifest in a
+// searched folder is still noticed.
+TEST(EnvVarICDOverrideSetup, ManifestWatch) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    const char* explicit_layer_name = "VK_LAYER_ExplicitTestLayer";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(explicit_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "explicit_test_layer.json");
+
+    set_env_var("VK_LOADER_MANIFEST_WATCH", "1");
+
+    // Searches the folders and starts watching them
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.create_info.add_layer(explicit_layer_name);
+        inst.CheckCreate();
+    }
+    env.debug_log.clear();
+
+    // Nothing changed, so the folders don't need to be read again
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.create_info.add_layer(explicit_layer_name);
+        inst.CheckCreate();
+        ASSERT_TRUE(env.debug_log.find("Nothing changed in these folders since they were last searched"));
+        ASSERT_TRUE(env.debug_log.find(std::string("Insert instance layer ") + explicit_layer_name));
+    }
+    env.debug_log.clear();
+
+    const char* second_layer_name = "VK_LAYER_SecondExplicitTestLayer";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(second_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "second_explicit_test_layer.json");
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.create_info.add_layer(explicit_layer_name).add_layer(second_layer_name);
+        inst.CheckCreate();
+        ASSERT_TRUE(env.debug_log.find(std::string("Insert instance layer ") + second_layer_name));
+    }
+    env.debug_log.clear();
+
+    env.get_folder(ManifestLocation::explicit_layer).remove("second_explicit_test_layer.json");
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.create_info.add_layer(second_layer_name);
+        inst.CheckCreate(VK_ERROR_LAYER_NOT_PRESENT);
+    }
+
+    remove_env_var("VK_LOADER_MANIFEST_WATCH");
+}
 #endif
+
+// Check that VK_LOADER_DEBUG_FILE sends the VK_LOADER_DEBUG output to the file, with timestamps and thread ids, and that
+// everything still queued when the loader is unloaded gets written.
+TEST(EnvVarICDOverrideSetup, DebugFile) {
+    fs::FolderManager log_folder{FRAMEWORK_BUILD_DIRECTORY, "debug_file"};
+    auto log_path = log_folder.location() / "loader_log.txt";
+    // Both are read when the loader library is loaded, which happens when the environment is created
+    set_env_var("VK_LOADER_DEBUG", "all");
+    set_env_var("VK_LOADER_DEBUG_FILE", log_path.str());
+    {
+        FrameworkEnvironment env{};
+        env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+    }
+    remove_env_var("VK_LOADER_DEBUG");
+    remove_env_var("VK_LOADER_DEBUG_FILE");
+
+    std::ifstream log_file{log_path.str()};
+    ASSERT_TRUE(log_file.good());
+    std::string contents{std::istreambuf_iterator<char>(log_file), std::istreambuf_iterator<char>()};
+    ASSERT_NE(contents.find("Vulkan Loader Version"), std::string::npos);
+    ASSERT_NE(contents.find("] [tid "), std::string::npos);
+    ASSERT_NE(contents.find("Found ICD manifest file"), std::string::npos);
+    log_file.close();
+    log_folder.remove("loader_log.txt");
+}
+
+#endif
+
+// Check that VK_LOADER_TRACE records the startup phases of vkCreateInstance, and writes them out in vkDestroyInstance.
+TEST(EnvVarICDOverrideSetup, Trace) {
+    fs::FolderManager trace_folder{FRAMEWORK_BUILD_DIRECTORY, "trace"};
+    auto trace_path = trace_folder.location() / "loader_trace.json";
+    // Read when the loader library is loaded, which happens when the environment is created
+    set_env_var("VK_LOADER_TRACE", trace_path.str());
+    FrameworkEnvironment env{};
+    remove_env_var("VK_LOADER_TRACE");
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.push_back({});
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        inst.GetPhysDev();
+    }
+
+    std::ifstream trace_file{trace_path.str()};
+    ASSERT_TRUE(trace_file.good());
+    std::string contents{std::istreambuf_iterator<char>(trace_file), std::istreambuf_iterator<char>()};
+    ASSERT_EQ(contents.rfind("{\"traceEvents\":[", 0), 0U);
+    for (const char* name : {"read_data_files_in_search_paths", "loader_read_json_file", "loader_scanned_icd_add",
+                             "loader_create_instance_chain", "terminator_CreateInstance", "setup_loader_term_phys_devs"}) {
+        ASSERT_NE(contents.find(std::string("{\"name\":\"") + name + "\",\"cat\":\"loader\",\"ph\":\"B\""), std::string::npos)
+            << name;
+        ASSERT_NE(contents.find(std::string("{\"name\":\"") + name + "\",\"cat\":\"loader\",\"ph\":\"E\""), std::string::npos)
+            << name;
+    }
+    trace_file.close();
+    trace_folder.remove("loader_trace.json");
+}
@@ -27,6 +27,8 @@
 
 #include "test_environment.h"
 
+#include "loader/vk_loader_statistics.h"
+
 // Verify that the various ways to get vkGetInstanceProcAddr return the same value
 TEST(GetProcAddr, VerifyGetInstanceProcAddr) {
     FrameworkEnvironment env{};
@@ -184,4 +186,117 @@ TEST(GetProcAddr, GlobalFunctions) {
         EnumeratePhysicalDevices = reinterpret_cast<PFN_vkGetInstanceProcAddr>(gipa(NULL, "vkEnumeratePhysicalDevices"));
         handle_assert_null(EnumeratePhysicalDevices);
     }
-}
\ No newline at end of file
+}
+// Core commands are looked up through a table, make sure it hands out the same trampolines the loader exports
+TEST(GetProcAddr, CoreFunctionsMatchExports) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
+    env.get_test_icd().physical_devices.emplace_back("physical_device_0");
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.set_api_version(VK_API_VERSION_1_3);
+    inst.CheckCreate();
+
+    auto& gipa = env.vulkan_functions.vkGetInstanceProcAddr;
+    const char* core_functions[] = {"vkDestroyInstance",
+                                    "vkEnumeratePhysicalDevices",
+                                    "vkGetPhysicalDeviceSparseImageFormatProperties",
+                                    "vkCreateDevice",
+                                    "vkGetDeviceProcAddr",
+                                    "vkCmdExecuteCommands",
+                                    "vkEnumeratePhysicalDeviceGroups",
+                                    "vkGetPhysicalDeviceExternalFenceProperties",
+                                    "vkGetBufferMemoryRequirements2",
+                                    "vkCreateRenderPass2",
+                                    "vkResetQueryPool",
+                                    "vkGetPhysicalDeviceToolProperties",
+                                    "vkCmdSetPrimitiveRestartEnable",
+                                    "vkGetDeviceImageSparseMemoryRequirements"};
+    for (const char* name : core_functions) {
+        PFN_vkVoidFunction exported = env.vulkan_functions.loader.get_symbol(name);
+        handle_assert_has_value(exported);
+        ASSERT_EQ(exported, gipa(inst, name)) << name;
+    }
+}
+
+// Every live instance is found from its own VkInstance, no matter how many others there are. proc_addr_benchmark times this.
+TEST(GetProcAddr, InstanceLookupWithManyInstances) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.emplace_back("physical_device_0");
+
+    auto& gipa = env.vulkan_functions.vkGetInstanceProcAddr;
+    std::vector<InstWrapper> instances;
+    for (uint32_t i = 0; i < 256; i++) {
+        instances.emplace_back(env.vulkan_functions);
+        instances.back().CheckCreate();
+    }
+
+    // A global function asked for with an instance only needs to find the loader's instance, the others need its dispatch table
+    for (auto& inst : instances) {
+        handle_assert_has_value(gipa(inst, "vkEnumerateInstanceVersion"));
+        ASSERT_EQ(reinterpret_cast<PFN_vkVoidFunction>(env.vulkan_functions.vkDestroyInstance), gipa(inst, "vkDestroyInstance"));
+        ASSERT_EQ(1U, inst.GetPhysDevs().size());
+    }
+}
+
+// The loader's statistics are available through vkGetInstanceProcAddr, both for the whole process and for each instance
+TEST(GetProcAddr, LoaderStatistics) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.emplace_back("physical_device_0");
+    const char* layer_name = "VK_LAYER_RegularLayer";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "regular_test_layer.json");
+
+    auto& gipa = env.vulkan_functions.vkGetInstanceProcAddr;
+    auto GetStatistics = reinterpret_cast<PFN_vk_loaderGetStatistics>(gipa(NULL, VK_LOADER_GET_STATISTICS_NAME));
+    handle_assert_has_value(GetStatistics);
+
+    uint32_t count = 0;
+    ASSERT_EQ(VK_SUCCESS, GetStatistics(VK_NULL_HANDLE, &count, nullptr));
+    ASSERT_EQ(count, static_cast<uint32_t>(VK_LOADER_STATISTIC_COUNT));
+    std::vector<uint64_t> process_before(count);
+    ASSERT_EQ(VK_SUCCESS, GetStatistics(VK_NULL_HANDLE, &count, process_before.data()));
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_layer(layer_name);
+    inst.CheckCreate();
+    inst.GetPhysDev();
+    ASSERT_EQ(GetStatistics, reinterpret_cast<PFN_vk_loaderGetStatistics>(gipa(inst, VK_LOADER_GET_STATISTICS_NAME)));
+    handle_assert_has_value(gipa(inst, "vkEnumeratePhysicalDevices"));
+    ASSERT_EQ(nullptr, gipa(inst, "vkNotARealFunctionName"));
+
+    std::vector<uint64_t> instance_stats(VK_LOADER_STATISTIC_COUNT);
+    ASSERT_EQ(VK_SUCCESS, GetStatistics(inst, &count, instance_stats.data()));
+    ASSERT_GE(instance_stats[VK_LOADER_STATISTIC_MANIFEST_FILES_OPENED], 2U);
+    ASSERT_GT(instance_stats[VK_LOADER_STATISTIC_MANIFEST_BYTES_READ], 0U);
+    ASSERT_GT(instance_stats[VK_LOADER_STATISTIC_JSON_VALUES_PARSED], 0U);
+    ASSERT_GE(instance_stats[VK_LOADER_STATISTIC_LIBRARIES_OPENED], 2U);
+    ASSERT_GE(instance_stats[VK_LOADER_STATISTIC_GIPA_INSTANCE_HITS], 1U);
+    ASSERT_GE(instance_stats[VK_LOADER_STATISTIC_GIPA_MISSES], 1U);
+    ASSERT_GT(instance_stats[VK_LOADER_STATISTIC_LOCK_ACQUISITIONS], 0U);
+    ASSERT_LE(instance_stats[VK_LOADER_STATISTIC_LOCK_CONTENTIONS], instance_stats[VK_LOADER_STATISTIC_LOCK_ACQUISITIONS]);
+
+    // Everything counted for the instance is also counted for the process
+    std::vector<uint64_t> process_after(VK_LOADER_STATISTIC_COUNT);
+    ASSERT_EQ(VK_SUCCESS, GetStatistics(VK_NULL_HANDLE, &count, process_after.data()));
+    for (uint32_t i = 0; i < count; i++) {
+        ASSERT_GE(process_after[i] - process_before[i], instance_stats[i]) << i;
+    }
+
+    // A second instance starts counting from zero
+    InstWrapper other_inst{env.vulkan_functions};
+    other_inst.CheckCreate();
+    std::vector<uint64_t> other_stats(VK_LOADER_STATISTIC_COUNT);
+    ASSERT_EQ(VK_SUCCESS, GetStatistics(other_inst, &count, other_stats.data()));
+    ASSERT_EQ(other_stats[VK_LOADER_STATISTIC_GIPA_MISSES], 0U);
+    ASSERT_GE(other_stats[VK_LOADER_STATISTIC_LIBRARIES_OPENED], 1U);
+
+    // Asking for fewer counters than there are
+    count = 1;
+    ASSERT_EQ(VK_INCOMPLETE, GetStatistics(inst, &count, instance_stats.data()));
+    ASSERT_EQ(count, 1U);
+}
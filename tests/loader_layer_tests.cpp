@@ -243,6 +243,68 @@ TEST(ImplicitLayers, PreInstanceVersion) {
     remove_env_var(disable_env_var);
 }
 
+// The implicit layers found by the pre-instance functions are kept between calls, so make sure repeated calls keep working and
+// that changes to the manifests are still noticed.
+TEST(ImplicitLayers, PreInstanceRepeatedCalls) {
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
+    env.get_test_icd().physical_devices.push_back({});
+    const char* implicit_layer_name = "ImplicitTestLayer";
+    const char* disable_env_var = "DISABLE_ME";
+
+    env.add_implicit_layer(
+        ManifestLayer{}
+            .set_file_format_version(ManifestVersion(1, 1, 2))
+            .add_layer(ManifestLayer::LayerDescription{}
+                           .set_name(implicit_layer_name)
+                           .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                           .set_disable_environment(disable_env_var)
+                           .add_pre_instance_function(ManifestLayer::LayerDescription::FunctionOverride{}
+                                                          .set_vk_func("vkEnumerateInstanceLayerProperties")
+                                                          .set_override_name("test_preinst_vkEnumerateInstanceLayerProperties"))),
+        "implicit_test_layer.json");
+
+    uint32_t layer_props = 43;
+    auto& layer = env.get_test_layer(0);
+    layer.set_reported_layer_props(layer_props);
+
+    for (uint32_t i = 0; i < 5; i++) {
+        uint32_t count = 0;
+        ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&count, nullptr));
+        ASSERT_EQ(count, layer_props);
+        uint32_t version = 0;
+        ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceVersion(&version));
+        ASSERT_NE(version, 0U);
+    }
+
+    // Environment variables are still checked on every call
+    set_env_var(disable_env_var, "1");
+    uint32_t count = 0;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&count, nullptr));
+    ASSERT_NE(count, layer_props);
+    remove_env_var(disable_env_var);
+
+    count = 0;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&count, nullptr));
+    ASSERT_EQ(count, layer_props);
+
+    // Rewrite the manifest without the pre-instance function, which must not be intercepted anymore
+    env.get_folder(ManifestLocation::implicit_layer)
+        .write_manifest("implicit_test_layer.json", ManifestLayer{}
+                                                        .set_file_format_version(ManifestVersion(1, 1, 2))
+                                                        .add_layer(ManifestLayer::LayerDescription{}
+                                                                       .set_name(implicit_layer_name)
+                                                                       .set_lib_path(env.get_test_layer_path(0))
+                                                                       .set_disable_environment(disable_env_var))
+                                                        .get_manifest_str());
+    count = 0;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&count, nullptr));
+    ASSERT_EQ(count, 1U);
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+}
+
 // Run with a pre-Negotiate function version of the layer so that it has to query vkCreateInstance using the
 // renamed vkGetInstanceProcAddr function which returns one that intentionally fails.  Then disable the
 // layer and verify it works.  The non-override version of vkCreateInstance in the layer also works (and is
@@ -1898,6 +1960,44 @@ TEST(LayerExtensions, ExplicitBothInstanceExtensions) {
     ASSERT_EQ(365U, surf_caps.maxImageArrayLayers);
 }
 
+// Manifests of 16KiB or more are mapped rather than read. The manifest is padded out to a whole number of pages, with the
+// padding in front, so that it ends right at the end of the mapping.
+TEST(LayerExtensions, LargeManifest) {
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+
+    const char* explicit_layer_name = "VK_LAYER_LargeManifest";
+    const uint32_t layer_extension_count = 400;
+    ManifestLayer::LayerDescription layer{};
+    layer.set_name(explicit_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2);
+    for (uint32_t i = 0; i < layer_extension_count; i++) {
+        layer.add_instance_extension({"VK_EXT_large_manifest_" + std::to_string(i), 1});
+    }
+    std::string manifest = ManifestLayer{}.add_layer(layer).get_manifest_str();
+    const size_t padded_size = 64 * 1024;
+    ASSERT_GE(manifest.size(), 16U * 1024U);
+    ASSERT_LE(manifest.size(), padded_size);
+    manifest.insert(0, padded_size - manifest.size(), ' ');
+    auto manifest_path = env.get_folder(ManifestLocation::explicit_layer).write_manifest("large_manifest.json", manifest);
+    env.platform_shim->add_manifest(ManifestCategory::explicit_layer, manifest_path);
+
+    uint32_t extension_count = 0;
+    ASSERT_EQ(VK_SUCCESS,
+              env.vulkan_functions.vkEnumerateInstanceExtensionProperties(explicit_layer_name, &extension_count, nullptr));
+    ASSERT_EQ(extension_count, layer_extension_count);
+    std::vector<VkExtensionProperties> extension_props(extension_count);
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceExtensionProperties(explicit_layer_name, &extension_count,
+                                                                                      extension_props.data()));
+    ASSERT_EQ(extension_count, layer_extension_count);
+    for (uint32_t i = 0; i < layer_extension_count; i++) {
+        ASSERT_TRUE(string_eq(extension_props[i].extensionName, ("VK_EXT_large_manifest_" + std::to_string(i)).c_str()));
+    }
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_layer(explicit_layer_name);
+    inst.CheckCreate();
+}
+
 TEST(LayerExtensions, ImplicitNoAdditionalDeviceExtension) {
     FrameworkEnvironment env;
     env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
@@ -2913,6 +3013,150 @@ TEST(TestLayers, DeviceLayerNotPresent) {
     dev.CheckCreate(phys_dev);
 }
 
+// Members of the manifest which the loader doesn't know about are skipped, no matter what they contain
+TEST(TestLayers, ManifestWithUnknownMembers) {
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().add_physical_device({});
+
+    const char* layer_name = "VK_LAYER_test_unknown_members";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "unknown_members_layer.json");
+
+    auto& layer_folder = env.get_folder(ManifestLocation::explicit_layer);
+    layer_folder.remove("unknown_members_layer.json");
+    layer_folder.write_manifest("unknown_members_layer.json",
+                                std::string(R"({
+    "unknown_object": {"nested": [1, -2.5e3, true, false, null, {"deep": "layers"}]},
+    "file_format_version": "1.1.0",
+    "layer": {
+        "name": ")") + layer_name + R"(",
+        "unknown_array": ["type", {"name": [[], {}]}],
+        "type": "GLOBAL",
+        "library_path": ")" + fs::fixup_backslashes_in_path(std::string(TEST_LAYER_PATH_EXPORT_VERSION_2)) +
+                                    R"(",
+        "api_version": "1.1.0",
+        "implementation_version": "3",
+        "description": "Escaped \"description\" A\/\u00e9",
+        "unknown_number": 12
+    },
+    "unknown_string": "layer"
+})");
+
+    uint32_t layer_count = 0;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&layer_count, nullptr));
+    ASSERT_EQ(layer_count, 1U);
+    VkLayerProperties layer_props{};
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&layer_count, &layer_props));
+    ASSERT_TRUE(string_eq(layer_props.layerName, layer_name));
+    ASSERT_EQ(layer_props.implementationVersion, 3U);
+    ASSERT_TRUE(string_eq(layer_props.description, "Escaped \"description\" A/\xc3\xa9"));
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_layer(layer_name);
+    inst.CheckCreate();
+}
+
+// A manifest which isn't valid JSON is skipped without affecting any other manifest
+TEST(TestLayers, MalformedManifest) {
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().add_physical_device({});
+
+    const char* good_layer_name = "VK_LAYER_test_good_layer";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(good_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "good_layer.json");
+    const char* malformed_layer_name = "VK_LAYER_test_malformed_layer";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(malformed_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "malformed_layer.json");
+
+    // Cut the manifest off partway through
+    auto& layer_folder = env.get_folder(ManifestLocation::explicit_layer);
+    std::string manifest = ManifestLayer{}
+                               .add_layer(ManifestLayer::LayerDescription{}
+                                              .set_name(malformed_layer_name)
+                                              .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2))
+                               .get_manifest_str();
+    layer_folder.remove("malformed_layer.json");
+    layer_folder.write_manifest("malformed_layer.json", manifest.substr(0, manifest.size() / 2));
+
+    uint32_t layer_count = 0;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&layer_count, nullptr));
+    ASSERT_EQ(layer_count, 1U);
+    VkLayerProperties layer_props{};
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&layer_count, &layer_props));
+    ASSERT_TRUE(string_eq(layer_props.layerName, good_layer_name));
+
+    InstWrapper inst{env.vulkan_functions};
+    FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+    inst.create_info.add_layer(good_layer_name);
+    inst.CheckCreate();
+    ASSERT_TRUE(env.debug_log.find("Failed to parse JSON file"));
+}
+
+// Parsing the manifests on several threads must not change which drivers and layers are found, nor the order they are in
+TEST(TestLayers, ManifestsParsedOnMultipleThreads) {
+    FrameworkEnvironment env;
+    for (uint32_t i = 0; i < 4; i++) {
+        env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+        env.get_test_icd(i).physical_devices.push_back({std::string("physical_device_") + std::to_string(i)});
+    }
+    for (uint32_t i = 0; i < 12; i++) {
+        std::string layer_name = std::string("VK_LAYER_test_layer_") + std::to_string(i);
+        env.add_explicit_layer(
+            ManifestLayer{}.add_layer(
+                ManifestLayer::LayerDescription{}.set_name(layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+            layer_name + ".json");
+    }
+
+    auto get_layer_names = [&env]() {
+        uint32_t layer_count = 0;
+        EXPECT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&layer_count, nullptr));
+        std::vector<VkLayerProperties> layer_props(layer_count);
+        EXPECT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&layer_count, layer_props.data()));
+        std::vector<std::string> layer_names;
+        for (auto const& props : layer_props) {
+            layer_names.push_back(props.layerName);
+        }
+        return layer_names;
+    };
+    auto get_device_names = [&env]() {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        std::vector<std::string> device_names;
+        for (auto physical_device : inst.GetPhysDevs(4)) {
+            VkPhysicalDeviceProperties props{};
+            inst->vkGetPhysicalDeviceProperties(physical_device, &props);
+            device_names.push_back(props.deviceName);
+        }
+        return device_names;
+    };
+
+    remove_env_var("VK_LOADER_MANIFEST_THREADS");
+    auto expected_layer_names = get_layer_names();
+    auto expected_device_names = get_device_names();
+    ASSERT_EQ(expected_layer_names.size(), 12U);
+
+    set_env_var("VK_LOADER_MANIFEST_THREADS", "4");
+    for (uint32_t i = 0; i < 8; i++) {
+        ASSERT_EQ(get_layer_names(), expected_layer_names);
+        ASSERT_EQ(get_device_names(), expected_device_names);
+    }
+
+    InstWrapper inst{env.vulkan_functions};
+    FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+    inst.create_info.add_layer(expected_layer_names.back().c_str());
+    inst.CheckCreate();
+    ASSERT_TRUE(env.debug_log.find("Parsing 12 layer manifest files on up to 4 threads"));
+    remove_env_var("VK_LOADER_MANIFEST_THREADS");
+}
+
 TEST(LayerPhysDeviceMod, AddPhysicalDevices) {
     FrameworkEnvironment env;
     env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
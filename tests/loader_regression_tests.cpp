@@ -27,6 +27,8 @@
 
 #include "test_environment.h"
 
+#include "loader/vk_loader_creation_feedback.h"
+
 // Test case origin
 // LX = lunar exchange
 // LVLGH = loader and validation github
@@ -1013,6 +1015,153 @@ TEST(CreateDevice, ConsecutiveCreateWithoutDestruction) {
     }
 }
 
+// The loader has to keep finding the right device and driver as devices on several drivers come and go
+TEST(CreateDevice, DestroyOutOfOrderAcrossDrivers) {
+    FrameworkEnvironment env{};
+    const uint32_t driver_count = 4;
+    MockQueueFamilyProperties family_props{{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, true};
+    for (uint32_t i = 0; i < driver_count; i++) {
+        env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+        env.get_test_icd(i).physical_devices.emplace_back("physical_device_" + std::to_string(i));
+        env.get_test_icd(i).physical_devices.back().queue_family_properties.push_back(family_props);
+    }
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    auto phys_devs = inst.GetPhysDevs(driver_count);
+
+    std::vector<DeviceWrapper> devices;
+    for (uint32_t i = 0; i < driver_count * 8; i++) {
+        devices.emplace_back(inst);
+        devices.back().create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(0.0f));
+        devices.back().CheckCreate(phys_devs[i % driver_count]);
+    }
+    // Destroy every other device, starting from the middle, then create some new ones in between
+    for (size_t i = devices.size() / 2; i < devices.size(); i += 2) {
+        devices[i] = DeviceWrapper{inst};
+    }
+    for (size_t i = 1; i < devices.size() / 2; i += 2) {
+        devices[i] = DeviceWrapper{inst};
+    }
+    for (uint32_t i = 0; i < driver_count * 2; i++) {
+        devices.emplace_back(inst);
+        devices.back().create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(0.0f));
+        devices.back().CheckCreate(phys_devs[i % driver_count]);
+    }
+
+    for (auto& dev : devices) {
+        if (dev.dev == VK_NULL_HANDLE) continue;
+        VkQueue queue = VK_NULL_HANDLE;
+        inst->vkGetDeviceQueue(dev, 0, 0, &queue);
+        ASSERT_NE(queue, VK_NULL_HANDLE);
+    }
+}
+
+// The feedback structure is filled in for both instance and device creation, the rest of the application's pNext chain is still
+// passed on, and the chain is left as it was
+TEST(CreateInstance, CreationFeedback) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    MockQueueFamilyProperties family_props{{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, true};
+    env.get_test_icd().physical_devices.emplace_back("physical_device_0");
+    env.get_test_icd().physical_devices.back().queue_family_properties.push_back(family_props);
+    const char* layer_name = "VK_LAYER_RegularLayer";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "regular_test_layer.json");
+
+    const VkLoaderCreationFeedbackFlags valid = VK_LOADER_CREATION_FEEDBACK_VALID_BIT;
+    auto check_feedback = [&](const VkLoaderCreationFeedbackCreateInfo& info) {
+        ASSERT_EQ(info.pCreationFeedback->flags, valid);
+        ASSERT_EQ(info.pDiscoveryFeedback->flags, valid);
+        ASSERT_EQ(info.pLayerChainFeedback->flags, valid);
+        ASSERT_LE(info.pDiscoveryFeedback->duration, info.pCreationFeedback->duration);
+        ASSERT_LE(info.pLayerChainFeedback->duration, info.pCreationFeedback->duration);
+
+        ASSERT_EQ(info.pLayerFeedbacks[0].flags, valid);
+        ASSERT_TRUE(string_eq(info.pLayerFeedbacks[0].name, layer_name));
+        ASSERT_EQ(info.pLayerFeedbacks[1].flags, 0U);
+
+        ASSERT_EQ(info.pDriverFeedbacks[0].flags, valid);
+        ASSERT_NE(info.pDriverFeedbacks[0].name[0], '\0');
+        ASSERT_LE(info.pDriverFeedbacks[0].duration, info.pCreationFeedback->duration);
+        ASSERT_EQ(info.pDriverFeedbacks[1].flags, 0U);
+    };
+
+    VkLoaderCreationFeedback inst_creation{}, inst_discovery{}, inst_chain{};
+    std::array<VkLoaderCreationFeedback, 2> inst_layers{};
+    std::array<VkLoaderCreationFeedback, 2> inst_drivers{};
+    VkLoaderCreationFeedbackCreateInfo inst_feedback{VK_STRUCTURE_TYPE_LOADER_CREATION_FEEDBACK_CREATE_INFO,
+                                                     nullptr,
+                                                     &inst_creation,
+                                                     &inst_discovery,
+                                                     &inst_chain,
+                                                     static_cast<uint32_t>(inst_layers.size()),
+                                                     inst_layers.data(),
+                                                     static_cast<uint32_t>(inst_drivers.size()),
+                                                     inst_drivers.data()};
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_layer(layer_name);
+    inst.create_info.instance_info.pNext = &inst_feedback;
+    inst.CheckCreate();
+    ASSERT_EQ(inst.create_info.instance_info.pNext, &inst_feedback);
+    check_feedback(inst_feedback);
+
+    VkLoaderCreationFeedback dev_creation{}, dev_discovery{}, dev_chain{};
+    std::array<VkLoaderCreationFeedback, 2> dev_layers{};
+    std::array<VkLoaderCreationFeedback, 2> dev_drivers{};
+    VkLoaderCreationFeedbackCreateInfo dev_feedback{VK_STRUCTURE_TYPE_LOADER_CREATION_FEEDBACK_CREATE_INFO,
+                                                    nullptr,
+                                                    &dev_creation,
+                                                    &dev_discovery,
+                                                    &dev_chain,
+                                                    static_cast<uint32_t>(dev_layers.size()),
+                                                    dev_layers.data(),
+                                                    static_cast<uint32_t>(dev_drivers.size()),
+                                                    dev_drivers.data()};
+    // Put another structure behind it, which still has to reach the layers and drivers
+    VkBaseInStructure spacer{};
+    spacer.sType = static_cast<VkStructureType>(100000);
+    dev_feedback.pNext = &spacer;
+    DeviceWrapper dev{inst};
+    dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(0.0f));
+    dev.create_info.dev.pNext = &dev_feedback;
+    dev.CheckCreate(inst.GetPhysDev());
+    ASSERT_EQ(dev.create_info.dev.pNext, &dev_feedback);
+    ASSERT_EQ(dev_feedback.pNext, &spacer);
+    check_feedback(dev_feedback);
+}
+
+// The loader can't take the feedback structure out of the chain without changing the application's structures unless it comes
+// first, so anywhere else it is ignored
+TEST(CreateInstance, CreationFeedbackNotFirstInChain) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    MockQueueFamilyProperties family_props{{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, true};
+    env.get_test_icd().physical_devices.emplace_back("physical_device_0");
+    env.get_test_icd().physical_devices.back().queue_family_properties.push_back(family_props);
+
+    VkLoaderCreationFeedback creation{};
+    VkLoaderCreationFeedbackCreateInfo feedback{
+        VK_STRUCTURE_TYPE_LOADER_CREATION_FEEDBACK_CREATE_INFO, nullptr, &creation, nullptr, nullptr, 0, nullptr, 0, nullptr};
+    VkBaseInStructure spacer{};
+    spacer.sType = static_cast<VkStructureType>(100000);
+    spacer.pNext = reinterpret_cast<const VkBaseInStructure*>(&feedback);
+
+    DebugUtilsLogger log{VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT};
+    InstWrapper inst{env.vulkan_functions};
+    FillDebugUtilsCreateDetails(inst.create_info, log);
+    inst.CheckCreate();
+
+    DeviceWrapper dev{inst};
+    dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(0.0f));
+    dev.create_info.dev.pNext = &spacer;
+    dev.CheckCreate(inst.GetPhysDev());
+    ASSERT_EQ(spacer.pNext, reinterpret_cast<const VkBaseInStructure*>(&feedback));
+    ASSERT_EQ(creation.flags, 0U);
+    ASSERT_TRUE(log.find("VkLoaderCreationFeedbackCreateInfo must be the first structure in the pNext chain"));
+}
+
 TEST(TryLoadWrongBinaries, WrongICD) {
     FrameworkEnvironment env{};
     env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
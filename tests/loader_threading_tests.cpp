@@ -27,6 +27,10 @@
 
 #include "test_environment.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
 #include <mutex>
 #include <thread>
 
@@ -104,3 +108,172 @@ TEST(ThreadingTests, ConcurentGetDeviceProcAddr) {
         threads[i].join();
     }
 }
+
+// A slow call down the chain of one instance must not hold up calls made on another instance at the same time
+TEST(ThreadingTests, SlowCallDoesNotBlockOtherInstances) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    auto& driver = env.get_test_icd();
+
+    // vkCreateDevice on the slow instance stays in the driver until the test lets it go
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool slow_call_entered = false;
+    bool slow_call_released = false;
+    driver.physical_devices.emplace_back("physical_device_0");
+    driver.physical_devices.back()
+        .add_queue_family_properties({{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, false})
+        .set_create_device_callback([&]() {
+            std::unique_lock<std::mutex> lock(mutex);
+            slow_call_entered = true;
+            cv.notify_all();
+            cv.wait(lock, [&]() { return slow_call_released; });
+        });
+
+    InstWrapper inst_slow{env.vulkan_functions};
+    inst_slow.CheckCreate();
+    VkPhysicalDevice phys_dev_slow = inst_slow.GetPhysDev();
+
+    InstWrapper inst_fast{env.vulkan_functions};
+    inst_fast.CheckCreate();
+    VkPhysicalDevice phys_dev_fast = inst_fast.GetPhysDev();
+
+    DeviceWrapper dev{inst_slow};
+    dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(1.0));
+    VkResult create_device_result = VK_RESULT_MAX_ENUM;
+    std::thread slow_thread(
+        [&]() { create_device_result = inst_slow->vkCreateDevice(phys_dev_slow, dev.create_info.get(), nullptr, &dev.dev); });
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]() { return slow_call_entered; });
+    }
+
+    // The slow instance is stuck in the driver now. The calls on the other instance are made on their own thread, so that if
+    // they do get stuck behind it the test can still let the slow call go and fail rather than hang.
+    VkResult enumerate_result = VK_RESULT_MAX_ENUM;
+    VkResult extension_result = VK_RESULT_MAX_ENUM;
+    uint32_t phys_dev_count = 0;
+    std::promise<void> fast_calls_done;
+    std::thread fast_thread([&]() {
+        enumerate_result = inst_fast->vkEnumeratePhysicalDevices(inst_fast.inst, &phys_dev_count, nullptr);
+        uint32_t extension_count = 0;
+        extension_result = inst_fast->vkEnumerateDeviceExtensionProperties(phys_dev_fast, nullptr, &extension_count, nullptr);
+        fast_calls_done.set_value();
+    });
+    bool fast_calls_finished_first = fast_calls_done.get_future().wait_for(std::chrono::seconds(10)) == std::future_status::ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        slow_call_released = true;
+    }
+    cv.notify_all();
+    fast_thread.join();
+    slow_thread.join();
+
+    ASSERT_TRUE(fast_calls_finished_first);
+    ASSERT_EQ(VK_SUCCESS, enumerate_result);
+    ASSERT_EQ(phys_dev_count, 1U);
+    ASSERT_EQ(VK_SUCCESS, extension_result);
+    ASSERT_EQ(VK_SUCCESS, create_device_result);
+}
+
+// Creating and destroying devices on different physical devices from different threads must not wait on each other's drivers
+TEST(ThreadingTests, CreateDevicesInParallelAcrossPhysicalDevices) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    auto& driver = env.get_test_icd();
+    const uint32_t phys_dev_count = 4;
+
+    // vkCreateDevice doesn't return until every thread is inside it, which only happens if the loader lets them all in at once.
+    // The wait gives up after a generous timeout so that a regression fails the test rather than hanging it.
+    std::mutex mutex;
+    std::condition_variable cv;
+    uint32_t threads_in_create_device = 0;
+    auto barrier = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        threads_in_create_device++;
+        cv.notify_all();
+        cv.wait_for(lock, std::chrono::seconds(10), [&]() { return threads_in_create_device == phys_dev_count; });
+    };
+    for (uint32_t i = 0; i < phys_dev_count; i++) {
+        driver.physical_devices.emplace_back(std::string("physical_device_") + std::to_string(i));
+        driver.physical_devices.back()
+            .add_queue_family_properties({{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, false})
+            .set_create_device_callback(barrier);
+    }
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    auto phys_devs = inst.GetPhysDevs(phys_dev_count);
+
+    struct ThreadResult {
+        bool all_threads_in_create_device = false;
+        VkResult create_device_result = VK_RESULT_MAX_ENUM;
+        VkQueue queue = VK_NULL_HANDLE;
+    };
+    std::vector<ThreadResult> results(phys_dev_count);
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < phys_dev_count; i++) {
+        threads.emplace_back([&, i]() {
+            DeviceWrapper dev{inst};
+            dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(1.0));
+            results[i].create_device_result = inst->vkCreateDevice(phys_devs[i], dev.create_info.get(), nullptr, &dev.dev);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                results[i].all_threads_in_create_device = threads_in_create_device == phys_dev_count;
+            }
+            if (VK_SUCCESS == results[i].create_device_result) {
+                dev->vkGetDeviceQueue(dev.dev, 0, 0, &results[i].queue);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto const& result : results) {
+        ASSERT_TRUE(result.all_threads_in_create_device);
+        ASSERT_EQ(VK_SUCCESS, result.create_device_result);
+        ASSERT_NE(result.queue, nullptr);
+    }
+    ASSERT_TRUE(driver.device_handles.empty());
+}
+
+// Enumerating on many threads at once must keep handing out the same physical device handles
+TEST(ThreadingTests, ConcurrentEnumeratePhysicalDevices) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    auto& driver = env.get_test_icd();
+    const uint32_t phys_dev_count = 3;
+    for (uint32_t i = 0; i < phys_dev_count; i++) {
+        driver.physical_devices.emplace_back(std::string("physical_device_") + std::to_string(i));
+    }
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    auto expected = inst.GetPhysDevs(phys_dev_count);
+
+    const uint32_t num_threads = 16;
+    const uint32_t num_loops = 200;
+    std::atomic<uint32_t> mismatches{0};
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < num_threads; i++) {
+        threads.emplace_back([&]() {
+            for (uint32_t j = 0; j < num_loops; j++) {
+                std::array<VkPhysicalDevice, phys_dev_count> phys_devs{};
+                uint32_t count = phys_dev_count;
+                if (VK_SUCCESS != inst->vkEnumeratePhysicalDevices(inst, &count, phys_devs.data()) || count != phys_dev_count ||
+                    !std::equal(phys_devs.begin(), phys_devs.end(), expected.begin())) {
+                    mismatches++;
+                }
+                uint32_t layer_count = 1;
+                if (VK_SUCCESS != inst->vkEnumerateDeviceLayerProperties(phys_devs[0], &layer_count, nullptr) || layer_count != 0) {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(mismatches.load(), 0U);
+}
@@ -699,3 +699,82 @@ TEST(UnknownFunction, QueueFunctionFromGetInstanceProcAddrWithImplicitLayer) {
 
     check_custom_functions(env.vulkan_functions, inst.inst, queue, custom_queue_functions{}, fake_function_names, function_count);
 }
+
+// Unknown functions are remembered the first time they're found, make sure asking again gives back the same function
+TEST(UnknownFunction, RepeatedLookups) {
+#if defined(__APPLE__)
+    GTEST_SKIP() << "Skip this test as currently macOS doesn't fully support unknown functions.";
+#endif
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
+    uint32_t function_count = 20;
+    auto& driver = env.get_test_icd();
+    driver.physical_devices.emplace_back("physical_device_0");
+    std::vector<std::string> fake_function_names;
+
+    // The first function_count names are physical device functions, the rest are device functions
+    fill_custom_functions(driver.custom_physical_device_functions, fake_function_names, custom_physical_device_functions{},
+                          function_count);
+    fill_custom_functions(driver.physical_devices.back().known_device_functions, fake_function_names, custom_device_functions{},
+                          function_count, function_count);
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+
+    std::vector<PFN_vkVoidFunction> first_lookups;
+    for (auto const& name : fake_function_names) {
+        first_lookups.push_back(env.vulkan_functions.vkGetInstanceProcAddr(inst, name.c_str()));
+        ASSERT_NE(first_lookups.back(), nullptr);
+    }
+    for (size_t i = 0; i < fake_function_names.size(); i++) {
+        ASSERT_EQ(first_lookups.at(i), env.vulkan_functions.vkGetInstanceProcAddr(inst, fake_function_names.at(i).c_str()));
+    }
+    ASSERT_EQ(nullptr, env.vulkan_functions.vkGetInstanceProcAddr(inst, "vkNotRealAndNotInAnyDriverTEST"));
+
+    VkPhysicalDevice phys_dev = inst.GetPhysDev();
+    check_custom_functions(env.vulkan_functions, inst.inst, phys_dev, custom_physical_device_functions{}, fake_function_names,
+                           function_count);
+
+    DeviceWrapper dev{inst};
+    dev.CheckCreate(phys_dev);
+    check_custom_functions(env.vulkan_functions, inst.inst, dev.dev, custom_device_functions{}, fake_function_names,
+                           function_count, function_count);
+}
+
+TEST(UnknownFunction, ManyFunctions) {
+#if defined(__APPLE__)
+    GTEST_SKIP() << "Skip this test as currently macOS doesn't fully support unknown functions.";
+#endif
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
+    // Well past the number of functions the loader used to support
+    uint32_t function_count = 3 * MAX_NUM_UNKNOWN_EXTS;
+    auto& driver = env.get_test_icd();
+    driver.physical_devices.emplace_back("physical_device_0");
+    std::vector<std::string> fake_function_names;
+
+    // The first function_count names are physical device functions, the rest are device functions
+    fill_custom_functions(driver.custom_physical_device_functions, fake_function_names, custom_physical_device_functions{},
+                          function_count);
+    fill_custom_functions(driver.physical_devices.back().known_device_functions, fake_function_names, custom_device_functions{},
+                          function_count, function_count);
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+
+    VkPhysicalDevice phys_dev = inst.GetPhysDev();
+    check_custom_functions(env.vulkan_functions, inst.inst, phys_dev, custom_physical_device_functions{}, fake_function_names,
+                           function_count);
+
+    // A device created before the functions are looked up has its dispatch table grown as they are added
+    DeviceWrapper dev_before{inst};
+    dev_before.CheckCreate(phys_dev);
+    check_custom_functions(env.vulkan_functions, inst.inst, dev_before.dev, custom_device_functions{}, fake_function_names,
+                           function_count, function_count);
+
+    // While one created afterwards gets room for all of them up front
+    DeviceWrapper dev_after{inst};
+    dev_after.CheckCreate(phys_dev);
+    check_custom_functions(env.vulkan_functions, inst.inst, dev_after.dev, custom_device_functions{}, fake_function_names,
+                           function_count, function_count);
+}
@@ -27,6 +27,8 @@
 
 #include "test_environment.h"
 
+#include <chrono>
+
 TEST(ICDInterfaceVersion2Plus, vk_icdNegotiateLoaderICDInterfaceVersion) {
     FrameworkEnvironment env{};
     env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
@@ -452,6 +454,52 @@ TEST(MultipleDriverConfig, DifferentICDsWithDevicesAndGroups) {
     ASSERT_EQ(group_count, returned_group_count);
 }
 
+// Opening drivers on several threads must not change which drivers are used nor the order they are in, while the time the
+// drivers take to initialize overlaps
+TEST(MultipleDriverConfig, DriversLoadedOnMultipleThreads) {
+    FrameworkEnvironment env{};
+    const uint32_t driver_count = 4;
+    for (uint32_t i = 0; i < driver_count; i++) {
+        env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+        env.get_test_icd(i).physical_devices.emplace_back(std::string("physical_device_") + std::to_string(i));
+    }
+    // Still skipped when negotiating with it happens on another thread
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(driver_count).physical_devices.emplace_back("physical_device_incompatible");
+    env.get_test_icd(driver_count).set_min_icd_interface_version(100).set_max_icd_interface_version(100);
+
+    auto get_device_names = [&env, driver_count]() {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        std::vector<std::string> device_names;
+        for (auto physical_device : inst.GetPhysDevs(driver_count)) {
+            VkPhysicalDeviceProperties props{};
+            env.vulkan_functions.vkGetPhysicalDeviceProperties(physical_device, &props);
+            device_names.push_back(props.deviceName);
+        }
+        return device_names;
+    };
+
+    remove_env_var("VK_LOADER_DRIVER_THREADS");
+    auto expected_device_names = get_device_names();
+
+    const uint32_t initialization_delay_ms = 200;
+    for (uint32_t i = 0; i < driver_count; i++) {
+        env.get_test_icd(i).set_initialization_delay_ms(initialization_delay_ms);
+    }
+    set_env_var("VK_LOADER_DRIVER_THREADS", std::to_string(driver_count));
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(get_device_names(), expected_device_names);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    remove_env_var("VK_LOADER_DRIVER_THREADS");
+#if !defined(WIN32)
+    // Loading the drivers one after the other takes at least the sum of their delays
+    ASSERT_LT(elapsed, std::chrono::milliseconds(driver_count * initialization_delay_ms));
+#else
+    (void)elapsed;
+#endif
+}
+
 #if defined(WIN32)
 // This is testing when there are drivers that support the Windows device adapter sorting mechanism by exporting
 // EnumerateAdapterPhysicalDevices and drivers that do not expose that functionality